@@ -0,0 +1,78 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/miniconda/lib/cmake/GTest/GTestConfig.cmake"
+  "/root/miniconda/lib/cmake/GTest/GTestConfigVersion.cmake"
+  "/root/miniconda/lib/cmake/GTest/GTestTargets-release.cmake"
+  "/root/miniconda/lib/cmake/GTest/GTestTargets.cmake"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "/root/repo/libuavcan/CMakeLists.txt"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeFindDependencyMacro.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFile.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckLibraryExists.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/FindGTest.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/FindThreads.cmake"
+  "/usr/share/cmake-3.25/Modules/GoogleTest.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "CMakeFiles/libuavcan_dsdlc.dir/DependInfo.cmake"
+  "CMakeFiles/uavcan.dir/DependInfo.cmake"
+  "CMakeFiles/uavcan_cpp03.dir/DependInfo.cmake"
+  "CMakeFiles/uavcan_optim.dir/DependInfo.cmake"
+  "CMakeFiles/uavcan_benchmark.dir/DependInfo.cmake"
+  "CMakeFiles/libuavcan_test.dir/DependInfo.cmake"
+  "CMakeFiles/libuavcan_test_cpp03.dir/DependInfo.cmake"
+  "CMakeFiles/libuavcan_test_optim.dir/DependInfo.cmake"
+  "CMakeFiles/libuavcan_benchmark_tx_queue.dir/DependInfo.cmake"
+  "CMakeFiles/libuavcan_benchmark_transfer_receiver_store.dir/DependInfo.cmake"
+  "CMakeFiles/libuavcan_benchmark_arena_transfer_buffer.dir/DependInfo.cmake"
+  "CMakeFiles/libuavcan_benchmark_dynamic_memory.dir/DependInfo.cmake"
+  "CMakeFiles/libuavcan_benchmark_hash_map.dir/DependInfo.cmake"
+  "CMakeFiles/libuavcan_benchmark_bit_array_copy.dir/DependInfo.cmake"
+  "CMakeFiles/libuavcan_benchmark_dsdl_fixed_layout.dir/DependInfo.cmake"
+  "CMakeFiles/libuavcan_benchmark_crc_slice1.dir/DependInfo.cmake"
+  "CMakeFiles/libuavcan_benchmark_crc_slice4.dir/DependInfo.cmake"
+  "CMakeFiles/libuavcan_benchmark_crc_slice8.dir/DependInfo.cmake"
+  )
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/libuavcan_benchmark_arena_transfer_buffer.dir/benchmark/arena_transfer_buffer.cpp.o"
+  "CMakeFiles/libuavcan_benchmark_arena_transfer_buffer.dir/benchmark/arena_transfer_buffer.cpp.o.d"
+  "libuavcan_benchmark_arena_transfer_buffer"
+  "libuavcan_benchmark_arena_transfer_buffer.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/libuavcan_benchmark_arena_transfer_buffer.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/libuavcan_benchmark_bit_array_copy.dir/benchmark/bit_array_copy.cpp.o"
+  "CMakeFiles/libuavcan_benchmark_bit_array_copy.dir/benchmark/bit_array_copy.cpp.o.d"
+  "libuavcan_benchmark_bit_array_copy"
+  "libuavcan_benchmark_bit_array_copy.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/libuavcan_benchmark_bit_array_copy.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
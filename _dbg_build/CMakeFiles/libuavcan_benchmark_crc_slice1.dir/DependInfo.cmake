@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/libuavcan/benchmark/crc.cpp" "CMakeFiles/libuavcan_benchmark_crc_slice1.dir/benchmark/crc.cpp.o" "gcc" "CMakeFiles/libuavcan_benchmark_crc_slice1.dir/benchmark/crc.cpp.o.d"
+  "/root/repo/libuavcan/src/transport/uc_crc.cpp" "CMakeFiles/libuavcan_benchmark_crc_slice1.dir/src/transport/uc_crc.cpp.o" "gcc" "CMakeFiles/libuavcan_benchmark_crc_slice1.dir/src/transport/uc_crc.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_dbg_build/CMakeFiles/uavcan_benchmark.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/libuavcan_benchmark_crc_slice1.dir/benchmark/crc.cpp.o"
+  "CMakeFiles/libuavcan_benchmark_crc_slice1.dir/benchmark/crc.cpp.o.d"
+  "CMakeFiles/libuavcan_benchmark_crc_slice1.dir/src/transport/uc_crc.cpp.o"
+  "CMakeFiles/libuavcan_benchmark_crc_slice1.dir/src/transport/uc_crc.cpp.o.d"
+  "libuavcan_benchmark_crc_slice1"
+  "libuavcan_benchmark_crc_slice1.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/libuavcan_benchmark_crc_slice1.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/libuavcan_benchmark_dsdl_fixed_layout.dir/benchmark/dsdl_fixed_layout.cpp.o"
+  "CMakeFiles/libuavcan_benchmark_dsdl_fixed_layout.dir/benchmark/dsdl_fixed_layout.cpp.o.d"
+  "libuavcan_benchmark_dsdl_fixed_layout"
+  "libuavcan_benchmark_dsdl_fixed_layout.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/libuavcan_benchmark_dsdl_fixed_layout.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/libuavcan_benchmark_dynamic_memory.dir/benchmark/dynamic_memory.cpp.o"
+  "CMakeFiles/libuavcan_benchmark_dynamic_memory.dir/benchmark/dynamic_memory.cpp.o.d"
+  "libuavcan_benchmark_dynamic_memory"
+  "libuavcan_benchmark_dynamic_memory.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/libuavcan_benchmark_dynamic_memory.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
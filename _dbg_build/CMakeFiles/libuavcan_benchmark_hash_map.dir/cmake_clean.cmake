@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/libuavcan_benchmark_hash_map.dir/benchmark/hash_map.cpp.o"
+  "CMakeFiles/libuavcan_benchmark_hash_map.dir/benchmark/hash_map.cpp.o.d"
+  "libuavcan_benchmark_hash_map"
+  "libuavcan_benchmark_hash_map.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/libuavcan_benchmark_hash_map.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
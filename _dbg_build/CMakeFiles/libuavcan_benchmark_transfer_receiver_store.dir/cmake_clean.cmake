@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/libuavcan_benchmark_transfer_receiver_store.dir/benchmark/transfer_receiver_store.cpp.o"
+  "CMakeFiles/libuavcan_benchmark_transfer_receiver_store.dir/benchmark/transfer_receiver_store.cpp.o.d"
+  "libuavcan_benchmark_transfer_receiver_store"
+  "libuavcan_benchmark_transfer_receiver_store.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/libuavcan_benchmark_transfer_receiver_store.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
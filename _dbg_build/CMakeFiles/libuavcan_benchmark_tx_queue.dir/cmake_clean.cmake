@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/libuavcan_benchmark_tx_queue.dir/benchmark/tx_queue.cpp.o"
+  "CMakeFiles/libuavcan_benchmark_tx_queue.dir/benchmark/tx_queue.cpp.o.d"
+  "libuavcan_benchmark_tx_queue"
+  "libuavcan_benchmark_tx_queue.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/libuavcan_benchmark_tx_queue.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/libuavcan_dsdlc"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/libuavcan_dsdlc.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,81 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/libuavcan/test/data_type.cpp" "CMakeFiles/libuavcan_test_cpp03.dir/test/data_type.cpp.o" "gcc" "CMakeFiles/libuavcan_test_cpp03.dir/test/data_type.cpp.o.d"
+  "/root/repo/libuavcan/test/dsdl_test/dsdl_const_1.cpp" "CMakeFiles/libuavcan_test_cpp03.dir/test/dsdl_test/dsdl_const_1.cpp.o" "gcc" "CMakeFiles/libuavcan_test_cpp03.dir/test/dsdl_test/dsdl_const_1.cpp.o.d"
+  "/root/repo/libuavcan/test/dsdl_test/dsdl_const_2.cpp" "CMakeFiles/libuavcan_test_cpp03.dir/test/dsdl_test/dsdl_const_2.cpp.o" "gcc" "CMakeFiles/libuavcan_test_cpp03.dir/test/dsdl_test/dsdl_const_2.cpp.o.d"
+  "/root/repo/libuavcan/test/dsdl_test/dsdl_fixed_layout.cpp" "CMakeFiles/libuavcan_test_cpp03.dir/test/dsdl_test/dsdl_fixed_layout.cpp.o" "gcc" "CMakeFiles/libuavcan_test_cpp03.dir/test/dsdl_test/dsdl_fixed_layout.cpp.o.d"
+  "/root/repo/libuavcan/test/dsdl_test/dsdl_test.cpp" "CMakeFiles/libuavcan_test_cpp03.dir/test/dsdl_test/dsdl_test.cpp.o" "gcc" "CMakeFiles/libuavcan_test_cpp03.dir/test/dsdl_test/dsdl_test.cpp.o.d"
+  "/root/repo/libuavcan/test/dsdl_test/dsdl_uavcan_compilability.cpp" "CMakeFiles/libuavcan_test_cpp03.dir/test/dsdl_test/dsdl_uavcan_compilability.cpp.o" "gcc" "CMakeFiles/libuavcan_test_cpp03.dir/test/dsdl_test/dsdl_uavcan_compilability.cpp.o.d"
+  "/root/repo/libuavcan/test/dynamic_memory.cpp" "CMakeFiles/libuavcan_test_cpp03.dir/test/dynamic_memory.cpp.o" "gcc" "CMakeFiles/libuavcan_test_cpp03.dir/test/dynamic_memory.cpp.o.d"
+  "/root/repo/libuavcan/test/helpers/component_status_manager.cpp" "CMakeFiles/libuavcan_test_cpp03.dir/test/helpers/component_status_manager.cpp.o" "gcc" "CMakeFiles/libuavcan_test_cpp03.dir/test/helpers/component_status_manager.cpp.o.d"
+  "/root/repo/libuavcan/test/marshal/array.cpp" "CMakeFiles/libuavcan_test_cpp03.dir/test/marshal/array.cpp.o" "gcc" "CMakeFiles/libuavcan_test_cpp03.dir/test/marshal/array.cpp.o.d"
+  "/root/repo/libuavcan/test/marshal/bit_array_copy.cpp" "CMakeFiles/libuavcan_test_cpp03.dir/test/marshal/bit_array_copy.cpp.o" "gcc" "CMakeFiles/libuavcan_test_cpp03.dir/test/marshal/bit_array_copy.cpp.o.d"
+  "/root/repo/libuavcan/test/marshal/bit_stream.cpp" "CMakeFiles/libuavcan_test_cpp03.dir/test/marshal/bit_stream.cpp.o" "gcc" "CMakeFiles/libuavcan_test_cpp03.dir/test/marshal/bit_stream.cpp.o.d"
+  "/root/repo/libuavcan/test/marshal/char_array_formatter.cpp" "CMakeFiles/libuavcan_test_cpp03.dir/test/marshal/char_array_formatter.cpp.o" "gcc" "CMakeFiles/libuavcan_test_cpp03.dir/test/marshal/char_array_formatter.cpp.o.d"
+  "/root/repo/libuavcan/test/marshal/float_spec.cpp" "CMakeFiles/libuavcan_test_cpp03.dir/test/marshal/float_spec.cpp.o" "gcc" "CMakeFiles/libuavcan_test_cpp03.dir/test/marshal/float_spec.cpp.o.d"
+  "/root/repo/libuavcan/test/marshal/integer_spec.cpp" "CMakeFiles/libuavcan_test_cpp03.dir/test/marshal/integer_spec.cpp.o" "gcc" "CMakeFiles/libuavcan_test_cpp03.dir/test/marshal/integer_spec.cpp.o.d"
+  "/root/repo/libuavcan/test/marshal/scalar_codec.cpp" "CMakeFiles/libuavcan_test_cpp03.dir/test/marshal/scalar_codec.cpp.o" "gcc" "CMakeFiles/libuavcan_test_cpp03.dir/test/marshal/scalar_codec.cpp.o.d"
+  "/root/repo/libuavcan/test/marshal/type_util.cpp" "CMakeFiles/libuavcan_test_cpp03.dir/test/marshal/type_util.cpp.o" "gcc" "CMakeFiles/libuavcan_test_cpp03.dir/test/marshal/type_util.cpp.o.d"
+  "/root/repo/libuavcan/test/node/global_data_type_registry.cpp" "CMakeFiles/libuavcan_test_cpp03.dir/test/node/global_data_type_registry.cpp.o" "gcc" "CMakeFiles/libuavcan_test_cpp03.dir/test/node/global_data_type_registry.cpp.o.d"
+  "/root/repo/libuavcan/test/node/memory_budget.cpp" "CMakeFiles/libuavcan_test_cpp03.dir/test/node/memory_budget.cpp.o" "gcc" "CMakeFiles/libuavcan_test_cpp03.dir/test/node/memory_budget.cpp.o.d"
+  "/root/repo/libuavcan/test/node/node.cpp" "CMakeFiles/libuavcan_test_cpp03.dir/test/node/node.cpp.o" "gcc" "CMakeFiles/libuavcan_test_cpp03.dir/test/node/node.cpp.o.d"
+  "/root/repo/libuavcan/test/node/publisher.cpp" "CMakeFiles/libuavcan_test_cpp03.dir/test/node/publisher.cpp.o" "gcc" "CMakeFiles/libuavcan_test_cpp03.dir/test/node/publisher.cpp.o.d"
+  "/root/repo/libuavcan/test/node/scheduler.cpp" "CMakeFiles/libuavcan_test_cpp03.dir/test/node/scheduler.cpp.o" "gcc" "CMakeFiles/libuavcan_test_cpp03.dir/test/node/scheduler.cpp.o.d"
+  "/root/repo/libuavcan/test/node/service_client.cpp" "CMakeFiles/libuavcan_test_cpp03.dir/test/node/service_client.cpp.o" "gcc" "CMakeFiles/libuavcan_test_cpp03.dir/test/node/service_client.cpp.o.d"
+  "/root/repo/libuavcan/test/node/service_server.cpp" "CMakeFiles/libuavcan_test_cpp03.dir/test/node/service_server.cpp.o" "gcc" "CMakeFiles/libuavcan_test_cpp03.dir/test/node/service_server.cpp.o.d"
+  "/root/repo/libuavcan/test/node/subscriber.cpp" "CMakeFiles/libuavcan_test_cpp03.dir/test/node/subscriber.cpp.o" "gcc" "CMakeFiles/libuavcan_test_cpp03.dir/test/node/subscriber.cpp.o.d"
+  "/root/repo/libuavcan/test/protocol/data_type_info_provider.cpp" "CMakeFiles/libuavcan_test_cpp03.dir/test/protocol/data_type_info_provider.cpp.o" "gcc" "CMakeFiles/libuavcan_test_cpp03.dir/test/protocol/data_type_info_provider.cpp.o.d"
+  "/root/repo/libuavcan/test/protocol/global_time_sync_master.cpp" "CMakeFiles/libuavcan_test_cpp03.dir/test/protocol/global_time_sync_master.cpp.o" "gcc" "CMakeFiles/libuavcan_test_cpp03.dir/test/protocol/global_time_sync_master.cpp.o.d"
+  "/root/repo/libuavcan/test/protocol/global_time_sync_slave.cpp" "CMakeFiles/libuavcan_test_cpp03.dir/test/protocol/global_time_sync_slave.cpp.o" "gcc" "CMakeFiles/libuavcan_test_cpp03.dir/test/protocol/global_time_sync_slave.cpp.o.d"
+  "/root/repo/libuavcan/test/protocol/logger.cpp" "CMakeFiles/libuavcan_test_cpp03.dir/test/protocol/logger.cpp.o" "gcc" "CMakeFiles/libuavcan_test_cpp03.dir/test/protocol/logger.cpp.o.d"
+  "/root/repo/libuavcan/test/protocol/network_compat_checker.cpp" "CMakeFiles/libuavcan_test_cpp03.dir/test/protocol/network_compat_checker.cpp.o" "gcc" "CMakeFiles/libuavcan_test_cpp03.dir/test/protocol/network_compat_checker.cpp.o.d"
+  "/root/repo/libuavcan/test/protocol/node_status_monitor.cpp" "CMakeFiles/libuavcan_test_cpp03.dir/test/protocol/node_status_monitor.cpp.o" "gcc" "CMakeFiles/libuavcan_test_cpp03.dir/test/protocol/node_status_monitor.cpp.o.d"
+  "/root/repo/libuavcan/test/protocol/node_status_provider.cpp" "CMakeFiles/libuavcan_test_cpp03.dir/test/protocol/node_status_provider.cpp.o" "gcc" "CMakeFiles/libuavcan_test_cpp03.dir/test/protocol/node_status_provider.cpp.o.d"
+  "/root/repo/libuavcan/test/protocol/panic_broadcaster.cpp" "CMakeFiles/libuavcan_test_cpp03.dir/test/protocol/panic_broadcaster.cpp.o" "gcc" "CMakeFiles/libuavcan_test_cpp03.dir/test/protocol/panic_broadcaster.cpp.o.d"
+  "/root/repo/libuavcan/test/protocol/panic_listener.cpp" "CMakeFiles/libuavcan_test_cpp03.dir/test/protocol/panic_listener.cpp.o" "gcc" "CMakeFiles/libuavcan_test_cpp03.dir/test/protocol/panic_listener.cpp.o.d"
+  "/root/repo/libuavcan/test/protocol/param_server.cpp" "CMakeFiles/libuavcan_test_cpp03.dir/test/protocol/param_server.cpp.o" "gcc" "CMakeFiles/libuavcan_test_cpp03.dir/test/protocol/param_server.cpp.o.d"
+  "/root/repo/libuavcan/test/protocol/restart_request_server.cpp" "CMakeFiles/libuavcan_test_cpp03.dir/test/protocol/restart_request_server.cpp.o" "gcc" "CMakeFiles/libuavcan_test_cpp03.dir/test/protocol/restart_request_server.cpp.o.d"
+  "/root/repo/libuavcan/test/protocol/transport_stats_provider.cpp" "CMakeFiles/libuavcan_test_cpp03.dir/test/protocol/transport_stats_provider.cpp.o" "gcc" "CMakeFiles/libuavcan_test_cpp03.dir/test/protocol/transport_stats_provider.cpp.o.d"
+  "/root/repo/libuavcan/test/test_main.cpp" "CMakeFiles/libuavcan_test_cpp03.dir/test/test_main.cpp.o" "gcc" "CMakeFiles/libuavcan_test_cpp03.dir/test/test_main.cpp.o.d"
+  "/root/repo/libuavcan/test/time.cpp" "CMakeFiles/libuavcan_test_cpp03.dir/test/time.cpp.o" "gcc" "CMakeFiles/libuavcan_test_cpp03.dir/test/time.cpp.o.d"
+  "/root/repo/libuavcan/test/transport/arena_transfer_buffer.cpp" "CMakeFiles/libuavcan_test_cpp03.dir/test/transport/arena_transfer_buffer.cpp.o" "gcc" "CMakeFiles/libuavcan_test_cpp03.dir/test/transport/arena_transfer_buffer.cpp.o.d"
+  "/root/repo/libuavcan/test/transport/can/can_driver.cpp" "CMakeFiles/libuavcan_test_cpp03.dir/test/transport/can/can_driver.cpp.o" "gcc" "CMakeFiles/libuavcan_test_cpp03.dir/test/transport/can/can_driver.cpp.o.d"
+  "/root/repo/libuavcan/test/transport/can/iface_mock.cpp" "CMakeFiles/libuavcan_test_cpp03.dir/test/transport/can/iface_mock.cpp.o" "gcc" "CMakeFiles/libuavcan_test_cpp03.dir/test/transport/can/iface_mock.cpp.o.d"
+  "/root/repo/libuavcan/test/transport/can/io.cpp" "CMakeFiles/libuavcan_test_cpp03.dir/test/transport/can/io.cpp.o" "gcc" "CMakeFiles/libuavcan_test_cpp03.dir/test/transport/can/io.cpp.o.d"
+  "/root/repo/libuavcan/test/transport/can/tx_queue.cpp" "CMakeFiles/libuavcan_test_cpp03.dir/test/transport/can/tx_queue.cpp.o" "gcc" "CMakeFiles/libuavcan_test_cpp03.dir/test/transport/can/tx_queue.cpp.o.d"
+  "/root/repo/libuavcan/test/transport/can_acceptance_filter_builder.cpp" "CMakeFiles/libuavcan_test_cpp03.dir/test/transport/can_acceptance_filter_builder.cpp.o" "gcc" "CMakeFiles/libuavcan_test_cpp03.dir/test/transport/can_acceptance_filter_builder.cpp.o.d"
+  "/root/repo/libuavcan/test/transport/crc.cpp" "CMakeFiles/libuavcan_test_cpp03.dir/test/transport/crc.cpp.o" "gcc" "CMakeFiles/libuavcan_test_cpp03.dir/test/transport/crc.cpp.o.d"
+  "/root/repo/libuavcan/test/transport/dispatcher.cpp" "CMakeFiles/libuavcan_test_cpp03.dir/test/transport/dispatcher.cpp.o" "gcc" "CMakeFiles/libuavcan_test_cpp03.dir/test/transport/dispatcher.cpp.o.d"
+  "/root/repo/libuavcan/test/transport/frame.cpp" "CMakeFiles/libuavcan_test_cpp03.dir/test/transport/frame.cpp.o" "gcc" "CMakeFiles/libuavcan_test_cpp03.dir/test/transport/frame.cpp.o.d"
+  "/root/repo/libuavcan/test/transport/incoming_transfer.cpp" "CMakeFiles/libuavcan_test_cpp03.dir/test/transport/incoming_transfer.cpp.o" "gcc" "CMakeFiles/libuavcan_test_cpp03.dir/test/transport/incoming_transfer.cpp.o.d"
+  "/root/repo/libuavcan/test/transport/outgoing_transfer_registry.cpp" "CMakeFiles/libuavcan_test_cpp03.dir/test/transport/outgoing_transfer_registry.cpp.o" "gcc" "CMakeFiles/libuavcan_test_cpp03.dir/test/transport/outgoing_transfer_registry.cpp.o.d"
+  "/root/repo/libuavcan/test/transport/transfer.cpp" "CMakeFiles/libuavcan_test_cpp03.dir/test/transport/transfer.cpp.o" "gcc" "CMakeFiles/libuavcan_test_cpp03.dir/test/transport/transfer.cpp.o.d"
+  "/root/repo/libuavcan/test/transport/transfer_buffer.cpp" "CMakeFiles/libuavcan_test_cpp03.dir/test/transport/transfer_buffer.cpp.o" "gcc" "CMakeFiles/libuavcan_test_cpp03.dir/test/transport/transfer_buffer.cpp.o.d"
+  "/root/repo/libuavcan/test/transport/transfer_listener.cpp" "CMakeFiles/libuavcan_test_cpp03.dir/test/transport/transfer_listener.cpp.o" "gcc" "CMakeFiles/libuavcan_test_cpp03.dir/test/transport/transfer_listener.cpp.o.d"
+  "/root/repo/libuavcan/test/transport/transfer_receiver.cpp" "CMakeFiles/libuavcan_test_cpp03.dir/test/transport/transfer_receiver.cpp.o" "gcc" "CMakeFiles/libuavcan_test_cpp03.dir/test/transport/transfer_receiver.cpp.o.d"
+  "/root/repo/libuavcan/test/transport/transfer_receiver_store.cpp" "CMakeFiles/libuavcan_test_cpp03.dir/test/transport/transfer_receiver_store.cpp.o" "gcc" "CMakeFiles/libuavcan_test_cpp03.dir/test/transport/transfer_receiver_store.cpp.o.d"
+  "/root/repo/libuavcan/test/transport/transfer_sender.cpp" "CMakeFiles/libuavcan_test_cpp03.dir/test/transport/transfer_sender.cpp.o" "gcc" "CMakeFiles/libuavcan_test_cpp03.dir/test/transport/transfer_sender.cpp.o.d"
+  "/root/repo/libuavcan/test/transport/transfer_test_helpers.cpp" "CMakeFiles/libuavcan_test_cpp03.dir/test/transport/transfer_test_helpers.cpp.o" "gcc" "CMakeFiles/libuavcan_test_cpp03.dir/test/transport/transfer_test_helpers.cpp.o.d"
+  "/root/repo/libuavcan/test/util/comparison.cpp" "CMakeFiles/libuavcan_test_cpp03.dir/test/util/comparison.cpp.o" "gcc" "CMakeFiles/libuavcan_test_cpp03.dir/test/util/comparison.cpp.o.d"
+  "/root/repo/libuavcan/test/util/hash_map.cpp" "CMakeFiles/libuavcan_test_cpp03.dir/test/util/hash_map.cpp.o" "gcc" "CMakeFiles/libuavcan_test_cpp03.dir/test/util/hash_map.cpp.o.d"
+  "/root/repo/libuavcan/test/util/lazy_constructor.cpp" "CMakeFiles/libuavcan_test_cpp03.dir/test/util/lazy_constructor.cpp.o" "gcc" "CMakeFiles/libuavcan_test_cpp03.dir/test/util/lazy_constructor.cpp.o.d"
+  "/root/repo/libuavcan/test/util/linked_list.cpp" "CMakeFiles/libuavcan_test_cpp03.dir/test/util/linked_list.cpp.o" "gcc" "CMakeFiles/libuavcan_test_cpp03.dir/test/util/linked_list.cpp.o.d"
+  "/root/repo/libuavcan/test/util/map.cpp" "CMakeFiles/libuavcan_test_cpp03.dir/test/util/map.cpp.o" "gcc" "CMakeFiles/libuavcan_test_cpp03.dir/test/util/map.cpp.o.d"
+  "/root/repo/libuavcan/test/util/templates.cpp" "CMakeFiles/libuavcan_test_cpp03.dir/test/util/templates.cpp.o" "gcc" "CMakeFiles/libuavcan_test_cpp03.dir/test/util/templates.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_dbg_build/CMakeFiles/uavcan_cpp03.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,133 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/libuavcan_test_cpp03.dir/test/data_type.cpp.o"
+  "CMakeFiles/libuavcan_test_cpp03.dir/test/data_type.cpp.o.d"
+  "CMakeFiles/libuavcan_test_cpp03.dir/test/dsdl_test/dsdl_const_1.cpp.o"
+  "CMakeFiles/libuavcan_test_cpp03.dir/test/dsdl_test/dsdl_const_1.cpp.o.d"
+  "CMakeFiles/libuavcan_test_cpp03.dir/test/dsdl_test/dsdl_const_2.cpp.o"
+  "CMakeFiles/libuavcan_test_cpp03.dir/test/dsdl_test/dsdl_const_2.cpp.o.d"
+  "CMakeFiles/libuavcan_test_cpp03.dir/test/dsdl_test/dsdl_fixed_layout.cpp.o"
+  "CMakeFiles/libuavcan_test_cpp03.dir/test/dsdl_test/dsdl_fixed_layout.cpp.o.d"
+  "CMakeFiles/libuavcan_test_cpp03.dir/test/dsdl_test/dsdl_test.cpp.o"
+  "CMakeFiles/libuavcan_test_cpp03.dir/test/dsdl_test/dsdl_test.cpp.o.d"
+  "CMakeFiles/libuavcan_test_cpp03.dir/test/dsdl_test/dsdl_uavcan_compilability.cpp.o"
+  "CMakeFiles/libuavcan_test_cpp03.dir/test/dsdl_test/dsdl_uavcan_compilability.cpp.o.d"
+  "CMakeFiles/libuavcan_test_cpp03.dir/test/dynamic_memory.cpp.o"
+  "CMakeFiles/libuavcan_test_cpp03.dir/test/dynamic_memory.cpp.o.d"
+  "CMakeFiles/libuavcan_test_cpp03.dir/test/helpers/component_status_manager.cpp.o"
+  "CMakeFiles/libuavcan_test_cpp03.dir/test/helpers/component_status_manager.cpp.o.d"
+  "CMakeFiles/libuavcan_test_cpp03.dir/test/marshal/array.cpp.o"
+  "CMakeFiles/libuavcan_test_cpp03.dir/test/marshal/array.cpp.o.d"
+  "CMakeFiles/libuavcan_test_cpp03.dir/test/marshal/bit_array_copy.cpp.o"
+  "CMakeFiles/libuavcan_test_cpp03.dir/test/marshal/bit_array_copy.cpp.o.d"
+  "CMakeFiles/libuavcan_test_cpp03.dir/test/marshal/bit_stream.cpp.o"
+  "CMakeFiles/libuavcan_test_cpp03.dir/test/marshal/bit_stream.cpp.o.d"
+  "CMakeFiles/libuavcan_test_cpp03.dir/test/marshal/char_array_formatter.cpp.o"
+  "CMakeFiles/libuavcan_test_cpp03.dir/test/marshal/char_array_formatter.cpp.o.d"
+  "CMakeFiles/libuavcan_test_cpp03.dir/test/marshal/float_spec.cpp.o"
+  "CMakeFiles/libuavcan_test_cpp03.dir/test/marshal/float_spec.cpp.o.d"
+  "CMakeFiles/libuavcan_test_cpp03.dir/test/marshal/integer_spec.cpp.o"
+  "CMakeFiles/libuavcan_test_cpp03.dir/test/marshal/integer_spec.cpp.o.d"
+  "CMakeFiles/libuavcan_test_cpp03.dir/test/marshal/scalar_codec.cpp.o"
+  "CMakeFiles/libuavcan_test_cpp03.dir/test/marshal/scalar_codec.cpp.o.d"
+  "CMakeFiles/libuavcan_test_cpp03.dir/test/marshal/type_util.cpp.o"
+  "CMakeFiles/libuavcan_test_cpp03.dir/test/marshal/type_util.cpp.o.d"
+  "CMakeFiles/libuavcan_test_cpp03.dir/test/node/global_data_type_registry.cpp.o"
+  "CMakeFiles/libuavcan_test_cpp03.dir/test/node/global_data_type_registry.cpp.o.d"
+  "CMakeFiles/libuavcan_test_cpp03.dir/test/node/memory_budget.cpp.o"
+  "CMakeFiles/libuavcan_test_cpp03.dir/test/node/memory_budget.cpp.o.d"
+  "CMakeFiles/libuavcan_test_cpp03.dir/test/node/node.cpp.o"
+  "CMakeFiles/libuavcan_test_cpp03.dir/test/node/node.cpp.o.d"
+  "CMakeFiles/libuavcan_test_cpp03.dir/test/node/publisher.cpp.o"
+  "CMakeFiles/libuavcan_test_cpp03.dir/test/node/publisher.cpp.o.d"
+  "CMakeFiles/libuavcan_test_cpp03.dir/test/node/scheduler.cpp.o"
+  "CMakeFiles/libuavcan_test_cpp03.dir/test/node/scheduler.cpp.o.d"
+  "CMakeFiles/libuavcan_test_cpp03.dir/test/node/service_client.cpp.o"
+  "CMakeFiles/libuavcan_test_cpp03.dir/test/node/service_client.cpp.o.d"
+  "CMakeFiles/libuavcan_test_cpp03.dir/test/node/service_server.cpp.o"
+  "CMakeFiles/libuavcan_test_cpp03.dir/test/node/service_server.cpp.o.d"
+  "CMakeFiles/libuavcan_test_cpp03.dir/test/node/subscriber.cpp.o"
+  "CMakeFiles/libuavcan_test_cpp03.dir/test/node/subscriber.cpp.o.d"
+  "CMakeFiles/libuavcan_test_cpp03.dir/test/protocol/data_type_info_provider.cpp.o"
+  "CMakeFiles/libuavcan_test_cpp03.dir/test/protocol/data_type_info_provider.cpp.o.d"
+  "CMakeFiles/libuavcan_test_cpp03.dir/test/protocol/global_time_sync_master.cpp.o"
+  "CMakeFiles/libuavcan_test_cpp03.dir/test/protocol/global_time_sync_master.cpp.o.d"
+  "CMakeFiles/libuavcan_test_cpp03.dir/test/protocol/global_time_sync_slave.cpp.o"
+  "CMakeFiles/libuavcan_test_cpp03.dir/test/protocol/global_time_sync_slave.cpp.o.d"
+  "CMakeFiles/libuavcan_test_cpp03.dir/test/protocol/logger.cpp.o"
+  "CMakeFiles/libuavcan_test_cpp03.dir/test/protocol/logger.cpp.o.d"
+  "CMakeFiles/libuavcan_test_cpp03.dir/test/protocol/network_compat_checker.cpp.o"
+  "CMakeFiles/libuavcan_test_cpp03.dir/test/protocol/network_compat_checker.cpp.o.d"
+  "CMakeFiles/libuavcan_test_cpp03.dir/test/protocol/node_status_monitor.cpp.o"
+  "CMakeFiles/libuavcan_test_cpp03.dir/test/protocol/node_status_monitor.cpp.o.d"
+  "CMakeFiles/libuavcan_test_cpp03.dir/test/protocol/node_status_provider.cpp.o"
+  "CMakeFiles/libuavcan_test_cpp03.dir/test/protocol/node_status_provider.cpp.o.d"
+  "CMakeFiles/libuavcan_test_cpp03.dir/test/protocol/panic_broadcaster.cpp.o"
+  "CMakeFiles/libuavcan_test_cpp03.dir/test/protocol/panic_broadcaster.cpp.o.d"
+  "CMakeFiles/libuavcan_test_cpp03.dir/test/protocol/panic_listener.cpp.o"
+  "CMakeFiles/libuavcan_test_cpp03.dir/test/protocol/panic_listener.cpp.o.d"
+  "CMakeFiles/libuavcan_test_cpp03.dir/test/protocol/param_server.cpp.o"
+  "CMakeFiles/libuavcan_test_cpp03.dir/test/protocol/param_server.cpp.o.d"
+  "CMakeFiles/libuavcan_test_cpp03.dir/test/protocol/restart_request_server.cpp.o"
+  "CMakeFiles/libuavcan_test_cpp03.dir/test/protocol/restart_request_server.cpp.o.d"
+  "CMakeFiles/libuavcan_test_cpp03.dir/test/protocol/transport_stats_provider.cpp.o"
+  "CMakeFiles/libuavcan_test_cpp03.dir/test/protocol/transport_stats_provider.cpp.o.d"
+  "CMakeFiles/libuavcan_test_cpp03.dir/test/test_main.cpp.o"
+  "CMakeFiles/libuavcan_test_cpp03.dir/test/test_main.cpp.o.d"
+  "CMakeFiles/libuavcan_test_cpp03.dir/test/time.cpp.o"
+  "CMakeFiles/libuavcan_test_cpp03.dir/test/time.cpp.o.d"
+  "CMakeFiles/libuavcan_test_cpp03.dir/test/transport/arena_transfer_buffer.cpp.o"
+  "CMakeFiles/libuavcan_test_cpp03.dir/test/transport/arena_transfer_buffer.cpp.o.d"
+  "CMakeFiles/libuavcan_test_cpp03.dir/test/transport/can/can_driver.cpp.o"
+  "CMakeFiles/libuavcan_test_cpp03.dir/test/transport/can/can_driver.cpp.o.d"
+  "CMakeFiles/libuavcan_test_cpp03.dir/test/transport/can/iface_mock.cpp.o"
+  "CMakeFiles/libuavcan_test_cpp03.dir/test/transport/can/iface_mock.cpp.o.d"
+  "CMakeFiles/libuavcan_test_cpp03.dir/test/transport/can/io.cpp.o"
+  "CMakeFiles/libuavcan_test_cpp03.dir/test/transport/can/io.cpp.o.d"
+  "CMakeFiles/libuavcan_test_cpp03.dir/test/transport/can/tx_queue.cpp.o"
+  "CMakeFiles/libuavcan_test_cpp03.dir/test/transport/can/tx_queue.cpp.o.d"
+  "CMakeFiles/libuavcan_test_cpp03.dir/test/transport/can_acceptance_filter_builder.cpp.o"
+  "CMakeFiles/libuavcan_test_cpp03.dir/test/transport/can_acceptance_filter_builder.cpp.o.d"
+  "CMakeFiles/libuavcan_test_cpp03.dir/test/transport/crc.cpp.o"
+  "CMakeFiles/libuavcan_test_cpp03.dir/test/transport/crc.cpp.o.d"
+  "CMakeFiles/libuavcan_test_cpp03.dir/test/transport/dispatcher.cpp.o"
+  "CMakeFiles/libuavcan_test_cpp03.dir/test/transport/dispatcher.cpp.o.d"
+  "CMakeFiles/libuavcan_test_cpp03.dir/test/transport/frame.cpp.o"
+  "CMakeFiles/libuavcan_test_cpp03.dir/test/transport/frame.cpp.o.d"
+  "CMakeFiles/libuavcan_test_cpp03.dir/test/transport/incoming_transfer.cpp.o"
+  "CMakeFiles/libuavcan_test_cpp03.dir/test/transport/incoming_transfer.cpp.o.d"
+  "CMakeFiles/libuavcan_test_cpp03.dir/test/transport/outgoing_transfer_registry.cpp.o"
+  "CMakeFiles/libuavcan_test_cpp03.dir/test/transport/outgoing_transfer_registry.cpp.o.d"
+  "CMakeFiles/libuavcan_test_cpp03.dir/test/transport/transfer.cpp.o"
+  "CMakeFiles/libuavcan_test_cpp03.dir/test/transport/transfer.cpp.o.d"
+  "CMakeFiles/libuavcan_test_cpp03.dir/test/transport/transfer_buffer.cpp.o"
+  "CMakeFiles/libuavcan_test_cpp03.dir/test/transport/transfer_buffer.cpp.o.d"
+  "CMakeFiles/libuavcan_test_cpp03.dir/test/transport/transfer_listener.cpp.o"
+  "CMakeFiles/libuavcan_test_cpp03.dir/test/transport/transfer_listener.cpp.o.d"
+  "CMakeFiles/libuavcan_test_cpp03.dir/test/transport/transfer_receiver.cpp.o"
+  "CMakeFiles/libuavcan_test_cpp03.dir/test/transport/transfer_receiver.cpp.o.d"
+  "CMakeFiles/libuavcan_test_cpp03.dir/test/transport/transfer_receiver_store.cpp.o"
+  "CMakeFiles/libuavcan_test_cpp03.dir/test/transport/transfer_receiver_store.cpp.o.d"
+  "CMakeFiles/libuavcan_test_cpp03.dir/test/transport/transfer_sender.cpp.o"
+  "CMakeFiles/libuavcan_test_cpp03.dir/test/transport/transfer_sender.cpp.o.d"
+  "CMakeFiles/libuavcan_test_cpp03.dir/test/transport/transfer_test_helpers.cpp.o"
+  "CMakeFiles/libuavcan_test_cpp03.dir/test/transport/transfer_test_helpers.cpp.o.d"
+  "CMakeFiles/libuavcan_test_cpp03.dir/test/util/comparison.cpp.o"
+  "CMakeFiles/libuavcan_test_cpp03.dir/test/util/comparison.cpp.o.d"
+  "CMakeFiles/libuavcan_test_cpp03.dir/test/util/hash_map.cpp.o"
+  "CMakeFiles/libuavcan_test_cpp03.dir/test/util/hash_map.cpp.o.d"
+  "CMakeFiles/libuavcan_test_cpp03.dir/test/util/lazy_constructor.cpp.o"
+  "CMakeFiles/libuavcan_test_cpp03.dir/test/util/lazy_constructor.cpp.o.d"
+  "CMakeFiles/libuavcan_test_cpp03.dir/test/util/linked_list.cpp.o"
+  "CMakeFiles/libuavcan_test_cpp03.dir/test/util/linked_list.cpp.o.d"
+  "CMakeFiles/libuavcan_test_cpp03.dir/test/util/map.cpp.o"
+  "CMakeFiles/libuavcan_test_cpp03.dir/test/util/map.cpp.o.d"
+  "CMakeFiles/libuavcan_test_cpp03.dir/test/util/templates.cpp.o"
+  "CMakeFiles/libuavcan_test_cpp03.dir/test/util/templates.cpp.o.d"
+  "libuavcan_test_cpp03"
+  "libuavcan_test_cpp03.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/libuavcan_test_cpp03.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
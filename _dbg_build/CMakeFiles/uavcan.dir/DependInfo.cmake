@@ -0,0 +1,56 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/libuavcan/src/driver/uc_can.cpp" "CMakeFiles/uavcan.dir/src/driver/uc_can.cpp.o" "gcc" "CMakeFiles/uavcan.dir/src/driver/uc_can.cpp.o.d"
+  "/root/repo/libuavcan/src/marshal/uc_bit_array_copy.cpp" "CMakeFiles/uavcan.dir/src/marshal/uc_bit_array_copy.cpp.o" "gcc" "CMakeFiles/uavcan.dir/src/marshal/uc_bit_array_copy.cpp.o.d"
+  "/root/repo/libuavcan/src/marshal/uc_bit_stream.cpp" "CMakeFiles/uavcan.dir/src/marshal/uc_bit_stream.cpp.o" "gcc" "CMakeFiles/uavcan.dir/src/marshal/uc_bit_stream.cpp.o.d"
+  "/root/repo/libuavcan/src/marshal/uc_float_spec.cpp" "CMakeFiles/uavcan.dir/src/marshal/uc_float_spec.cpp.o" "gcc" "CMakeFiles/uavcan.dir/src/marshal/uc_float_spec.cpp.o.d"
+  "/root/repo/libuavcan/src/marshal/uc_scalar_codec.cpp" "CMakeFiles/uavcan.dir/src/marshal/uc_scalar_codec.cpp.o" "gcc" "CMakeFiles/uavcan.dir/src/marshal/uc_scalar_codec.cpp.o.d"
+  "/root/repo/libuavcan/src/node/uc_generic_publisher.cpp" "CMakeFiles/uavcan.dir/src/node/uc_generic_publisher.cpp.o" "gcc" "CMakeFiles/uavcan.dir/src/node/uc_generic_publisher.cpp.o.d"
+  "/root/repo/libuavcan/src/node/uc_generic_subscriber.cpp" "CMakeFiles/uavcan.dir/src/node/uc_generic_subscriber.cpp.o" "gcc" "CMakeFiles/uavcan.dir/src/node/uc_generic_subscriber.cpp.o.d"
+  "/root/repo/libuavcan/src/node/uc_global_data_type_registry.cpp" "CMakeFiles/uavcan.dir/src/node/uc_global_data_type_registry.cpp.o" "gcc" "CMakeFiles/uavcan.dir/src/node/uc_global_data_type_registry.cpp.o.d"
+  "/root/repo/libuavcan/src/node/uc_scheduler.cpp" "CMakeFiles/uavcan.dir/src/node/uc_scheduler.cpp.o" "gcc" "CMakeFiles/uavcan.dir/src/node/uc_scheduler.cpp.o.d"
+  "/root/repo/libuavcan/src/node/uc_service_client.cpp" "CMakeFiles/uavcan.dir/src/node/uc_service_client.cpp.o" "gcc" "CMakeFiles/uavcan.dir/src/node/uc_service_client.cpp.o.d"
+  "/root/repo/libuavcan/src/node/uc_timer.cpp" "CMakeFiles/uavcan.dir/src/node/uc_timer.cpp.o" "gcc" "CMakeFiles/uavcan.dir/src/node/uc_timer.cpp.o.d"
+  "/root/repo/libuavcan/src/protocol/uc_data_type_info_provider.cpp" "CMakeFiles/uavcan.dir/src/protocol/uc_data_type_info_provider.cpp.o" "gcc" "CMakeFiles/uavcan.dir/src/protocol/uc_data_type_info_provider.cpp.o.d"
+  "/root/repo/libuavcan/src/protocol/uc_global_time_sync_master.cpp" "CMakeFiles/uavcan.dir/src/protocol/uc_global_time_sync_master.cpp.o" "gcc" "CMakeFiles/uavcan.dir/src/protocol/uc_global_time_sync_master.cpp.o.d"
+  "/root/repo/libuavcan/src/protocol/uc_global_time_sync_slave.cpp" "CMakeFiles/uavcan.dir/src/protocol/uc_global_time_sync_slave.cpp.o" "gcc" "CMakeFiles/uavcan.dir/src/protocol/uc_global_time_sync_slave.cpp.o.d"
+  "/root/repo/libuavcan/src/protocol/uc_logger.cpp" "CMakeFiles/uavcan.dir/src/protocol/uc_logger.cpp.o" "gcc" "CMakeFiles/uavcan.dir/src/protocol/uc_logger.cpp.o.d"
+  "/root/repo/libuavcan/src/protocol/uc_network_compat_checker.cpp" "CMakeFiles/uavcan.dir/src/protocol/uc_network_compat_checker.cpp.o" "gcc" "CMakeFiles/uavcan.dir/src/protocol/uc_network_compat_checker.cpp.o.d"
+  "/root/repo/libuavcan/src/protocol/uc_node_status_monitor.cpp" "CMakeFiles/uavcan.dir/src/protocol/uc_node_status_monitor.cpp.o" "gcc" "CMakeFiles/uavcan.dir/src/protocol/uc_node_status_monitor.cpp.o.d"
+  "/root/repo/libuavcan/src/protocol/uc_node_status_provider.cpp" "CMakeFiles/uavcan.dir/src/protocol/uc_node_status_provider.cpp.o" "gcc" "CMakeFiles/uavcan.dir/src/protocol/uc_node_status_provider.cpp.o.d"
+  "/root/repo/libuavcan/src/protocol/uc_panic_broadcaster.cpp" "CMakeFiles/uavcan.dir/src/protocol/uc_panic_broadcaster.cpp.o" "gcc" "CMakeFiles/uavcan.dir/src/protocol/uc_panic_broadcaster.cpp.o.d"
+  "/root/repo/libuavcan/src/protocol/uc_param_server.cpp" "CMakeFiles/uavcan.dir/src/protocol/uc_param_server.cpp.o" "gcc" "CMakeFiles/uavcan.dir/src/protocol/uc_param_server.cpp.o.d"
+  "/root/repo/libuavcan/src/protocol/uc_restart_request_server.cpp" "CMakeFiles/uavcan.dir/src/protocol/uc_restart_request_server.cpp.o" "gcc" "CMakeFiles/uavcan.dir/src/protocol/uc_restart_request_server.cpp.o.d"
+  "/root/repo/libuavcan/src/protocol/uc_transport_stats_provider.cpp" "CMakeFiles/uavcan.dir/src/protocol/uc_transport_stats_provider.cpp.o" "gcc" "CMakeFiles/uavcan.dir/src/protocol/uc_transport_stats_provider.cpp.o.d"
+  "/root/repo/libuavcan/src/transport/uc_arena_transfer_buffer.cpp" "CMakeFiles/uavcan.dir/src/transport/uc_arena_transfer_buffer.cpp.o" "gcc" "CMakeFiles/uavcan.dir/src/transport/uc_arena_transfer_buffer.cpp.o.d"
+  "/root/repo/libuavcan/src/transport/uc_can_acceptance_filter_builder.cpp" "CMakeFiles/uavcan.dir/src/transport/uc_can_acceptance_filter_builder.cpp.o" "gcc" "CMakeFiles/uavcan.dir/src/transport/uc_can_acceptance_filter_builder.cpp.o.d"
+  "/root/repo/libuavcan/src/transport/uc_can_io.cpp" "CMakeFiles/uavcan.dir/src/transport/uc_can_io.cpp.o" "gcc" "CMakeFiles/uavcan.dir/src/transport/uc_can_io.cpp.o.d"
+  "/root/repo/libuavcan/src/transport/uc_crc.cpp" "CMakeFiles/uavcan.dir/src/transport/uc_crc.cpp.o" "gcc" "CMakeFiles/uavcan.dir/src/transport/uc_crc.cpp.o.d"
+  "/root/repo/libuavcan/src/transport/uc_dispatcher.cpp" "CMakeFiles/uavcan.dir/src/transport/uc_dispatcher.cpp.o" "gcc" "CMakeFiles/uavcan.dir/src/transport/uc_dispatcher.cpp.o.d"
+  "/root/repo/libuavcan/src/transport/uc_frame.cpp" "CMakeFiles/uavcan.dir/src/transport/uc_frame.cpp.o" "gcc" "CMakeFiles/uavcan.dir/src/transport/uc_frame.cpp.o.d"
+  "/root/repo/libuavcan/src/transport/uc_outgoing_transfer_registry.cpp" "CMakeFiles/uavcan.dir/src/transport/uc_outgoing_transfer_registry.cpp.o" "gcc" "CMakeFiles/uavcan.dir/src/transport/uc_outgoing_transfer_registry.cpp.o.d"
+  "/root/repo/libuavcan/src/transport/uc_transfer.cpp" "CMakeFiles/uavcan.dir/src/transport/uc_transfer.cpp.o" "gcc" "CMakeFiles/uavcan.dir/src/transport/uc_transfer.cpp.o.d"
+  "/root/repo/libuavcan/src/transport/uc_transfer_buffer.cpp" "CMakeFiles/uavcan.dir/src/transport/uc_transfer_buffer.cpp.o" "gcc" "CMakeFiles/uavcan.dir/src/transport/uc_transfer_buffer.cpp.o.d"
+  "/root/repo/libuavcan/src/transport/uc_transfer_listener.cpp" "CMakeFiles/uavcan.dir/src/transport/uc_transfer_listener.cpp.o" "gcc" "CMakeFiles/uavcan.dir/src/transport/uc_transfer_listener.cpp.o.d"
+  "/root/repo/libuavcan/src/transport/uc_transfer_receiver.cpp" "CMakeFiles/uavcan.dir/src/transport/uc_transfer_receiver.cpp.o" "gcc" "CMakeFiles/uavcan.dir/src/transport/uc_transfer_receiver.cpp.o.d"
+  "/root/repo/libuavcan/src/transport/uc_transfer_receiver_store.cpp" "CMakeFiles/uavcan.dir/src/transport/uc_transfer_receiver_store.cpp.o" "gcc" "CMakeFiles/uavcan.dir/src/transport/uc_transfer_receiver_store.cpp.o.d"
+  "/root/repo/libuavcan/src/transport/uc_transfer_sender.cpp" "CMakeFiles/uavcan.dir/src/transport/uc_transfer_sender.cpp.o" "gcc" "CMakeFiles/uavcan.dir/src/transport/uc_transfer_sender.cpp.o.d"
+  "/root/repo/libuavcan/src/uc_data_type.cpp" "CMakeFiles/uavcan.dir/src/uc_data_type.cpp.o" "gcc" "CMakeFiles/uavcan.dir/src/uc_data_type.cpp.o.d"
+  "/root/repo/libuavcan/src/uc_dynamic_memory.cpp" "CMakeFiles/uavcan.dir/src/uc_dynamic_memory.cpp.o" "gcc" "CMakeFiles/uavcan.dir/src/uc_dynamic_memory.cpp.o.d"
+  "/root/repo/libuavcan/src/uc_error.cpp" "CMakeFiles/uavcan.dir/src/uc_error.cpp.o" "gcc" "CMakeFiles/uavcan.dir/src/uc_error.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
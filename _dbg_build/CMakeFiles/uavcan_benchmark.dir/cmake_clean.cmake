@@ -0,0 +1,85 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/uavcan_benchmark.dir/src/driver/uc_can.cpp.o"
+  "CMakeFiles/uavcan_benchmark.dir/src/driver/uc_can.cpp.o.d"
+  "CMakeFiles/uavcan_benchmark.dir/src/marshal/uc_bit_array_copy.cpp.o"
+  "CMakeFiles/uavcan_benchmark.dir/src/marshal/uc_bit_array_copy.cpp.o.d"
+  "CMakeFiles/uavcan_benchmark.dir/src/marshal/uc_bit_stream.cpp.o"
+  "CMakeFiles/uavcan_benchmark.dir/src/marshal/uc_bit_stream.cpp.o.d"
+  "CMakeFiles/uavcan_benchmark.dir/src/marshal/uc_float_spec.cpp.o"
+  "CMakeFiles/uavcan_benchmark.dir/src/marshal/uc_float_spec.cpp.o.d"
+  "CMakeFiles/uavcan_benchmark.dir/src/marshal/uc_scalar_codec.cpp.o"
+  "CMakeFiles/uavcan_benchmark.dir/src/marshal/uc_scalar_codec.cpp.o.d"
+  "CMakeFiles/uavcan_benchmark.dir/src/node/uc_generic_publisher.cpp.o"
+  "CMakeFiles/uavcan_benchmark.dir/src/node/uc_generic_publisher.cpp.o.d"
+  "CMakeFiles/uavcan_benchmark.dir/src/node/uc_generic_subscriber.cpp.o"
+  "CMakeFiles/uavcan_benchmark.dir/src/node/uc_generic_subscriber.cpp.o.d"
+  "CMakeFiles/uavcan_benchmark.dir/src/node/uc_global_data_type_registry.cpp.o"
+  "CMakeFiles/uavcan_benchmark.dir/src/node/uc_global_data_type_registry.cpp.o.d"
+  "CMakeFiles/uavcan_benchmark.dir/src/node/uc_scheduler.cpp.o"
+  "CMakeFiles/uavcan_benchmark.dir/src/node/uc_scheduler.cpp.o.d"
+  "CMakeFiles/uavcan_benchmark.dir/src/node/uc_service_client.cpp.o"
+  "CMakeFiles/uavcan_benchmark.dir/src/node/uc_service_client.cpp.o.d"
+  "CMakeFiles/uavcan_benchmark.dir/src/node/uc_timer.cpp.o"
+  "CMakeFiles/uavcan_benchmark.dir/src/node/uc_timer.cpp.o.d"
+  "CMakeFiles/uavcan_benchmark.dir/src/protocol/uc_data_type_info_provider.cpp.o"
+  "CMakeFiles/uavcan_benchmark.dir/src/protocol/uc_data_type_info_provider.cpp.o.d"
+  "CMakeFiles/uavcan_benchmark.dir/src/protocol/uc_global_time_sync_master.cpp.o"
+  "CMakeFiles/uavcan_benchmark.dir/src/protocol/uc_global_time_sync_master.cpp.o.d"
+  "CMakeFiles/uavcan_benchmark.dir/src/protocol/uc_global_time_sync_slave.cpp.o"
+  "CMakeFiles/uavcan_benchmark.dir/src/protocol/uc_global_time_sync_slave.cpp.o.d"
+  "CMakeFiles/uavcan_benchmark.dir/src/protocol/uc_logger.cpp.o"
+  "CMakeFiles/uavcan_benchmark.dir/src/protocol/uc_logger.cpp.o.d"
+  "CMakeFiles/uavcan_benchmark.dir/src/protocol/uc_network_compat_checker.cpp.o"
+  "CMakeFiles/uavcan_benchmark.dir/src/protocol/uc_network_compat_checker.cpp.o.d"
+  "CMakeFiles/uavcan_benchmark.dir/src/protocol/uc_node_status_monitor.cpp.o"
+  "CMakeFiles/uavcan_benchmark.dir/src/protocol/uc_node_status_monitor.cpp.o.d"
+  "CMakeFiles/uavcan_benchmark.dir/src/protocol/uc_node_status_provider.cpp.o"
+  "CMakeFiles/uavcan_benchmark.dir/src/protocol/uc_node_status_provider.cpp.o.d"
+  "CMakeFiles/uavcan_benchmark.dir/src/protocol/uc_panic_broadcaster.cpp.o"
+  "CMakeFiles/uavcan_benchmark.dir/src/protocol/uc_panic_broadcaster.cpp.o.d"
+  "CMakeFiles/uavcan_benchmark.dir/src/protocol/uc_param_server.cpp.o"
+  "CMakeFiles/uavcan_benchmark.dir/src/protocol/uc_param_server.cpp.o.d"
+  "CMakeFiles/uavcan_benchmark.dir/src/protocol/uc_restart_request_server.cpp.o"
+  "CMakeFiles/uavcan_benchmark.dir/src/protocol/uc_restart_request_server.cpp.o.d"
+  "CMakeFiles/uavcan_benchmark.dir/src/protocol/uc_transport_stats_provider.cpp.o"
+  "CMakeFiles/uavcan_benchmark.dir/src/protocol/uc_transport_stats_provider.cpp.o.d"
+  "CMakeFiles/uavcan_benchmark.dir/src/transport/uc_arena_transfer_buffer.cpp.o"
+  "CMakeFiles/uavcan_benchmark.dir/src/transport/uc_arena_transfer_buffer.cpp.o.d"
+  "CMakeFiles/uavcan_benchmark.dir/src/transport/uc_can_acceptance_filter_builder.cpp.o"
+  "CMakeFiles/uavcan_benchmark.dir/src/transport/uc_can_acceptance_filter_builder.cpp.o.d"
+  "CMakeFiles/uavcan_benchmark.dir/src/transport/uc_can_io.cpp.o"
+  "CMakeFiles/uavcan_benchmark.dir/src/transport/uc_can_io.cpp.o.d"
+  "CMakeFiles/uavcan_benchmark.dir/src/transport/uc_crc.cpp.o"
+  "CMakeFiles/uavcan_benchmark.dir/src/transport/uc_crc.cpp.o.d"
+  "CMakeFiles/uavcan_benchmark.dir/src/transport/uc_dispatcher.cpp.o"
+  "CMakeFiles/uavcan_benchmark.dir/src/transport/uc_dispatcher.cpp.o.d"
+  "CMakeFiles/uavcan_benchmark.dir/src/transport/uc_frame.cpp.o"
+  "CMakeFiles/uavcan_benchmark.dir/src/transport/uc_frame.cpp.o.d"
+  "CMakeFiles/uavcan_benchmark.dir/src/transport/uc_outgoing_transfer_registry.cpp.o"
+  "CMakeFiles/uavcan_benchmark.dir/src/transport/uc_outgoing_transfer_registry.cpp.o.d"
+  "CMakeFiles/uavcan_benchmark.dir/src/transport/uc_transfer.cpp.o"
+  "CMakeFiles/uavcan_benchmark.dir/src/transport/uc_transfer.cpp.o.d"
+  "CMakeFiles/uavcan_benchmark.dir/src/transport/uc_transfer_buffer.cpp.o"
+  "CMakeFiles/uavcan_benchmark.dir/src/transport/uc_transfer_buffer.cpp.o.d"
+  "CMakeFiles/uavcan_benchmark.dir/src/transport/uc_transfer_listener.cpp.o"
+  "CMakeFiles/uavcan_benchmark.dir/src/transport/uc_transfer_listener.cpp.o.d"
+  "CMakeFiles/uavcan_benchmark.dir/src/transport/uc_transfer_receiver.cpp.o"
+  "CMakeFiles/uavcan_benchmark.dir/src/transport/uc_transfer_receiver.cpp.o.d"
+  "CMakeFiles/uavcan_benchmark.dir/src/transport/uc_transfer_receiver_store.cpp.o"
+  "CMakeFiles/uavcan_benchmark.dir/src/transport/uc_transfer_receiver_store.cpp.o.d"
+  "CMakeFiles/uavcan_benchmark.dir/src/transport/uc_transfer_sender.cpp.o"
+  "CMakeFiles/uavcan_benchmark.dir/src/transport/uc_transfer_sender.cpp.o.d"
+  "CMakeFiles/uavcan_benchmark.dir/src/uc_data_type.cpp.o"
+  "CMakeFiles/uavcan_benchmark.dir/src/uc_data_type.cpp.o.d"
+  "CMakeFiles/uavcan_benchmark.dir/src/uc_dynamic_memory.cpp.o"
+  "CMakeFiles/uavcan_benchmark.dir/src/uc_dynamic_memory.cpp.o.d"
+  "CMakeFiles/uavcan_benchmark.dir/src/uc_error.cpp.o"
+  "CMakeFiles/uavcan_benchmark.dir/src/uc_error.cpp.o.d"
+  "libuavcan_benchmark.a"
+  "libuavcan_benchmark.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/uavcan_benchmark.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,79 @@
+/*
+ * Copyright (C) 2014 Pavel Kirienko <pavel.kirienko@gmail.com>
+ */
+
+#include <uavcan/transport/arena_transfer_buffer.hpp>
+#include "benchmark.hpp"
+
+static const unsigned TransferLen = 439;
+static uint8_t TransferData[TransferLen];
+
+/**
+ * Reassembles the transfer frame by frame and reads it back in small chunks like deserialization does.
+ */
+template <typename BufferManager>
+static double benchmarkReassembly(BufferManager& mgr, unsigned num_transfers)
+{
+    const uavcan::TransferBufferManagerKey key(42, uavcan::TransferTypeMessageBroadcast);
+
+    const BenchmarkTimer timer;
+    unsigned checksum = 0;
+    for (unsigned i = 0; i < num_transfers; i++)
+    {
+        uavcan::ITransferBuffer* const tbb = mgr.create(key);
+        ENFORCE(tbb);
+        // The first frame carries 5 bytes of payload
+        unsigned offset = 0;
+        while (offset < TransferLen)
+        {
+            const unsigned len = uavcan::min((offset == 0) ? 5U : 7U, TransferLen - offset);
+            ENFORCE(int(len) == tbb->write(offset, TransferData + offset, len));
+            offset += len;
+        }
+        uint8_t buf[16];
+        offset = 0;
+        int res = 0;
+        while ((res = tbb->read(offset, buf, sizeof(buf))) > 0)
+        {
+            checksum += buf[0];
+            offset += unsigned(res);
+        }
+        ENFORCE(TransferLen == offset);
+        mgr.remove(key);
+    }
+    const double us = timer.getElapsedUSec() / double(num_transfers);
+
+    ENFORCE(mgr.isEmpty());
+    ENFORCE(checksum != 0);
+    return us;
+}
+
+static void benchmark()
+{
+    static const unsigned NumTransfers = 200000;
+
+    for (unsigned i = 0; i < TransferLen; i++)
+    {
+        TransferData[i] = uint8_t(i * 7 + 1);
+    }
+
+    static uavcan::PoolAllocator<uavcan::MemPoolBlockSize * 32, uavcan::MemPoolBlockSize> pool;
+    uavcan::PoolManager<1> poolmgr;
+    poolmgr.addPool(&pool);
+
+    uavcan::TransferBufferManager<512, 0> dynamic_mgr(poolmgr);
+    uavcan::TransferBufferManager<512, 1> static_mgr(poolmgr);
+    uavcan::ArenaTransferBufferManager<512, 1024, 2> arena_mgr;
+
+    const double dynamic_us = benchmarkReassembly(dynamic_mgr, NumTransfers);
+    const double static_us = benchmarkReassembly(static_mgr, NumTransfers);
+    const double arena_us = benchmarkReassembly(arena_mgr, NumTransfers);
+
+    std::cout << TransferLen << " byte transfer reassembly: pool blocks " << dynamic_us << " usec, static "
+              << static_us << " usec, arena " << arena_us << " usec" << std::endl;
+}
+
+int main()
+{
+    return runBenchmark(&benchmark);
+}
@@ -0,0 +1,52 @@
+/*
+ * Copyright (C) 2014 Pavel Kirienko <pavel.kirienko@gmail.com>
+ */
+
+#pragma once
+
+#include <iostream>
+#include <stdexcept>
+#include "../test/clock.hpp"
+
+/*
+ * Benchmarks are plain executables that print their results; they are not executed upon build.
+ * A failed check throws, so that a benchmark never reports timings of a broken run.
+ */
+#ifndef STRINGIZE
+#  define STRINGIZE2(x)   #x
+#  define STRINGIZE(x)    STRINGIZE2(x)
+#endif
+#define ENFORCE(x) if (!(x)) { throw std::runtime_error(__FILE__ ":" STRINGIZE(__LINE__) ": " #x); }
+
+class BenchmarkTimer
+{
+    SystemClockDriver clock_;
+    uavcan::MonotonicTime started_at_;
+
+public:
+    BenchmarkTimer() : started_at_(clock_.getMonotonic()) { }
+
+    double getElapsedUSec() const { return double((clock_.getMonotonic() - started_at_).toUSec()); }
+
+    double getNSecPer(unsigned num_operations) const
+    {
+        return getElapsedUSec() * 1000.0 / double(num_operations);
+    }
+};
+
+/**
+ * Runs the benchmark function, reporting the exception if any.
+ */
+inline int runBenchmark(void (*benchmark)())
+{
+    try
+    {
+        benchmark();
+        return 0;
+    }
+    catch (const std::exception& ex)
+    {
+        std::cerr << "Exception: " << ex.what() << std::endl;
+        return 1;
+    }
+}
@@ -0,0 +1,77 @@
+/*
+ * Copyright (C) 2014 Pavel Kirienko <pavel.kirienko@gmail.com>
+ */
+
+#include <cstdlib>
+#include <algorithm>
+#include <uavcan/marshal/bit_stream.hpp>
+#include "benchmark.hpp"
+
+static const unsigned MaxBytes = 64;
+static const unsigned Padding = 4;
+
+typedef void (*AlignedToUnalignedFunction)(const unsigned char*, unsigned, unsigned char*, unsigned);
+typedef void (*UnalignedToAlignedFunction)(const unsigned char*, unsigned, unsigned, unsigned char*);
+
+/*
+ * The generic bytewise copy, which was used for these cases before the word kernels.
+ */
+static void genericAlignedToUnaligned(const unsigned char* src, unsigned len, unsigned char* dst, unsigned dst_offset)
+{
+    uavcan::bitarrayCopy(src, 0, len, dst, dst_offset);
+}
+
+static void genericUnalignedToAligned(const unsigned char* src, unsigned src_offset, unsigned len, unsigned char* dst)
+{
+    uavcan::bitarrayCopy(src, src_offset, len, dst, 0);
+}
+
+/**
+ * Unaligned write followed by unaligned read, as the bit stream does for a field that is not byte aligned.
+ */
+static double benchmarkCopy(AlignedToUnalignedFunction a2u, UnalignedToAlignedFunction u2a, unsigned bitlen)
+{
+    static const unsigned NumIterations = 1000000;
+    uint8_t src[MaxBytes + Padding];
+    uint8_t dst[MaxBytes + Padding];
+    std::srand(0);
+    for (unsigned i = 0; i < sizeof(src); i++)
+    {
+        src[i] = uint8_t(std::rand());
+    }
+    std::fill(dst, dst + sizeof(dst), uint8_t(0));
+
+    const BenchmarkTimer timer;
+    for (unsigned i = 0; i < NumIterations; i++)
+    {
+        const unsigned offset = 1U + i % 7U;
+        a2u(src, bitlen, dst, offset);
+        u2a(dst, offset, bitlen, src);
+    }
+    const double ns = timer.getNSecPer(NumIterations);
+
+    ENFORCE((src[0] | dst[0]) != 0);
+    return ns;
+}
+
+static void benchmark()
+{
+    // Typical DSDL field widths, and some arrays
+    static const unsigned BitLens[] = { 1, 4, 7, 8, 13, 16, 24, 32, 56, 64, 128, 256, 448 };
+
+    for (unsigned i = 0; i < sizeof(BitLens) / sizeof(BitLens[0]); i++)
+    {
+        const double generic_ns = benchmarkCopy(&genericAlignedToUnaligned, &genericUnalignedToAligned, BitLens[i]);
+        const double word32_ns = benchmarkCopy(&uavcan::bitarrayCopyAlignedToUnalignedImpl<uint32_t>,
+                                               &uavcan::bitarrayCopyUnalignedToAlignedImpl<uint32_t>, BitLens[i]);
+        const double word64_ns = benchmarkCopy(&uavcan::bitarrayCopyAlignedToUnalignedImpl<uint64_t>,
+                                               &uavcan::bitarrayCopyUnalignedToAlignedImpl<uint64_t>, BitLens[i]);
+        std::cout << BitLens[i] << " bits, unaligned write + read: generic " << generic_ns << " ns, word32 "
+                  << word32_ns << " ns, word64 " << word64_ns << " ns" << std::endl;
+    }
+}
+
+int main()
+{
+    return runBenchmark(&benchmark);
+}
@@ -0,0 +1,65 @@
+/*
+ * Copyright (C) 2014 Pavel Kirienko <pavel.kirienko@gmail.com>
+ */
+
+#include <uavcan/transport/crc.hpp>
+#include "benchmark.hpp"
+
+/*
+ * This benchmark is built once per kernel, with UAVCAN_CRC_SLICE_BY set to 1, 4 and 8.
+ * The bytewise variant feeds the bytes one by one, which is the same in every build.
+ */
+static void benchmark()
+{
+    static const unsigned PayloadLens[] = { 7, 64, 439 };          // Single frame, typical, longest transfer
+    static const unsigned NumBytes = 10000000;
+
+    uint8_t data[439];
+    for (unsigned i = 0; i < sizeof(data); i++)
+    {
+        data[i] = uint8_t(i * 7);
+    }
+
+    for (unsigned p = 0; p < sizeof(PayloadLens) / sizeof(PayloadLens[0]); p++)
+    {
+        const unsigned len = PayloadLens[p];
+        const unsigned num_iterations = NumBytes / len;
+
+        data[0] = 0;
+        uint16_t bytewise_result = 0;
+        const BenchmarkTimer bytewise_timer;
+        for (unsigned i = 0; i < num_iterations; i++)
+        {
+            uavcan::TransferCRC crc;
+            for (unsigned k = 0; k < len; k++)
+            {
+                crc.add(data[k]);
+            }
+            bytewise_result = uint16_t(bytewise_result ^ crc.get());
+            data[0] = uint8_t(i);
+        }
+        const double bytewise_mbs = double(len * num_iterations) / bytewise_timer.getElapsedUSec();
+
+        data[0] = 0;
+        uint16_t bulk_result = 0;
+        const BenchmarkTimer bulk_timer;
+        for (unsigned i = 0; i < num_iterations; i++)
+        {
+            uavcan::TransferCRC crc;
+            crc.add(data, len);
+            bulk_result = uint16_t(bulk_result ^ crc.get());
+            data[0] = uint8_t(i);
+        }
+        const double bulk_mbs = double(len * num_iterations) / bulk_timer.getElapsedUSec();
+
+        ENFORCE(bytewise_result == bulk_result);
+
+        std::cout << "TransferCRC, " << len << " bytes: bytewise " << bytewise_mbs << " MB/s, slice-by-"
+                  << UAVCAN_CRC_SLICE_BY << " " << bulk_mbs << " MB/s" << std::endl;
+    }
+}
+
+int main()
+{
+    return runBenchmark(&benchmark);
+}
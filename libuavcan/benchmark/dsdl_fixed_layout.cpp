@@ -0,0 +1,85 @@
+/*
+ * Copyright (C) 2014 Pavel Kirienko <pavel.kirienko@gmail.com>
+ */
+
+#include <cstdlib>
+#include <uavcan/transport/transfer_buffer.hpp>
+#include <root_ns_a/A.hpp>
+#include <uavcan/protocol/NodeStatus.hpp>
+#include <uavcan/protocol/GlobalTimeSync.hpp>
+#include <uavcan/protocol/RestartNode.hpp>
+#include <uavcan/equipment/esc/Status.hpp>
+#include <uavcan/equipment/air_data/StaticPressure.hpp>
+#include <uavcan/equipment/camera_gimbal/AngularCommand.hpp>
+#include <uavcan/equipment/power/CircuitStatus.hpp>
+#include "benchmark.hpp"
+
+typedef uavcan::StaticTransferBuffer<uavcan::MaxTransferPayloadLen + 4> PayloadBuffer;
+
+/**
+ * Encode and decode of the same object, with either the fixed layout or the field by field codec.
+ */
+template <typename T>
+static double benchmarkCodec(const T& obj, bool fixed_layout)
+{
+    static const unsigned NumIterations = 1000000;
+    PayloadBuffer buf;
+    T decoded;
+
+    const BenchmarkTimer timer;
+    for (unsigned i = 0; i < NumIterations; i++)
+    {
+        uavcan::BitStream bs_wr(buf);
+        uavcan::ScalarCodec sc_wr(bs_wr);
+        const int encode_res = fixed_layout ? T::encode(obj, sc_wr) : T::encodeFieldByField(obj, sc_wr);
+
+        uavcan::BitStream bs_rd(buf);
+        uavcan::ScalarCodec sc_rd(bs_rd);
+        const int decode_res = fixed_layout ? T::decode(decoded, sc_rd) : T::decodeFieldByField(decoded, sc_rd);
+        ENFORCE(encode_res > 0 && decode_res > 0);
+    }
+    return timer.getNSecPer(NumIterations);
+}
+
+template <typename T>
+static void benchmarkType(const char* name)
+{
+    enum { PayloadLen = uavcan::BitLenToByteLen<T::MaxBitLen>::Result };
+
+    // The object is made of random bits
+    PayloadBuffer buf;
+    for (unsigned i = 0; i < unsigned(PayloadLen); i++)
+    {
+        const uint8_t byte = uint8_t(std::rand());
+        ENFORCE(1 == buf.write(i, &byte, 1));
+    }
+    T obj;
+    {
+        uavcan::BitStream bs(buf);
+        uavcan::ScalarCodec sc(bs);
+        ENFORCE(1 == T::decodeFieldByField(obj, sc));
+    }
+
+    const double generic_ns = benchmarkCodec(obj, false);
+    const double fixed_ns = benchmarkCodec(obj, true);
+    std::cout << name << " (" << unsigned(T::MaxBitLen) << " bits), encode + decode: field by field " << generic_ns
+              << " ns, fixed layout " << fixed_ns << " ns" << std::endl;
+}
+
+static void benchmark()
+{
+    std::srand(0);
+    benchmarkType<root_ns_a::A>("root_ns_a.A");
+    benchmarkType<uavcan::protocol::NodeStatus>("uavcan.protocol.NodeStatus");
+    benchmarkType<uavcan::protocol::GlobalTimeSync>("uavcan.protocol.GlobalTimeSync");
+    benchmarkType<uavcan::protocol::RestartNode::Request>("uavcan.protocol.RestartNode.Request");
+    benchmarkType<uavcan::equipment::esc::Status>("uavcan.equipment.esc.Status");
+    benchmarkType<uavcan::equipment::air_data::StaticPressure>("uavcan.equipment.air_data.StaticPressure");
+    benchmarkType<uavcan::equipment::camera_gimbal::AngularCommand>("uavcan.equipment.camera_gimbal.AngularCommand");
+    benchmarkType<uavcan::equipment::power::CircuitStatus>("uavcan.equipment.power.CircuitStatus");
+}
+
+int main()
+{
+    return runBenchmark(&benchmark);
+}
@@ -0,0 +1,80 @@
+/*
+ * Copyright (C) 2014 Pavel Kirienko <pavel.kirienko@gmail.com>
+ */
+
+#include <uavcan/dynamic_memory.hpp>
+#include "benchmark.hpp"
+
+/**
+ * Random allocations of 1 to 128 bytes and deallocations, with up to 32 blocks in use.
+ */
+template <typename Manager>
+static double benchmarkPoolManager(Manager& poolmgr, unsigned num_iterations)
+{
+    static const unsigned NumSlots = 32;
+    const void* slots[NumSlots] = { };
+    uint32_t rnd = 1;
+
+    const BenchmarkTimer timer;
+    for (unsigned i = 0; i < num_iterations; i++)
+    {
+        rnd = rnd * 1103515245U + 12345U;
+        const unsigned slot = (rnd >> 16) % NumSlots;
+        if (slots[slot] != NULL)
+        {
+            poolmgr.deallocate(slots[slot]);
+            slots[slot] = NULL;
+        }
+        else
+        {
+            slots[slot] = poolmgr.allocate(1U + ((rnd >> 8) % 128U));
+            ENFORCE(slots[slot]);
+        }
+    }
+    const double ns = timer.getNSecPer(num_iterations);
+
+    for (unsigned i = 0; i < NumSlots; i++)
+    {
+        poolmgr.deallocate(slots[i]);
+    }
+    return ns;
+}
+
+static void benchmark()
+{
+    static const unsigned NumIterations = 10000000;
+
+    static uavcan::PoolAllocator<16 * 32, 16> pool16;
+    static uavcan::PoolAllocator<32 * 32, 32> pool32;
+    static uavcan::PoolAllocator<64 * 32, 64> pool64;
+    static uavcan::PoolAllocator<128 * 32, 128> pool128;
+
+    double linear_ns = 0;
+    {
+        uavcan::PoolManager<4> poolmgr;
+        poolmgr.addPool(&pool128);
+        poolmgr.addPool(&pool64);
+        poolmgr.addPool(&pool32);
+        poolmgr.addPool(&pool16);
+        linear_ns = benchmarkPoolManager(poolmgr, NumIterations);
+    }
+    double indexed_ns = 0;
+    {
+        uavcan::IndexedPoolManager<4> poolmgr;
+        poolmgr.addPool(&pool128);
+        poolmgr.addPool(&pool64);
+        poolmgr.addPool(&pool32);
+        poolmgr.addPool(&pool16);
+        indexed_ns = benchmarkPoolManager(poolmgr, NumIterations);
+    }
+    ENFORCE(0 == pool16.getNumUsedBlocks() + pool32.getNumUsedBlocks() +
+                 pool64.getNumUsedBlocks() + pool128.getNumUsedBlocks());
+
+    std::cout << "Pool manager with 4 pools, allocation or deallocation: linear " << linear_ns
+              << " ns, indexed " << indexed_ns << " ns" << std::endl;
+}
+
+int main()
+{
+    return runBenchmark(&benchmark);
+}
@@ -0,0 +1,72 @@
+/*
+ * Copyright (C) 2014 Pavel Kirienko <pavel.kirienko@gmail.com>
+ */
+
+#include <uavcan/util/map.hpp>
+#include <uavcan/util/hash_map.hpp>
+#include "benchmark.hpp"
+
+/**
+ * Lookups of random present keys; every 8th lookup also removes and reinserts the key.
+ */
+template <typename MapType>
+static double benchmarkMap(MapType& map, unsigned num_keys)
+{
+    static const unsigned NumIterations = 2000000;
+
+    for (uint32_t i = 1; i <= num_keys; i++)
+    {
+        ENFORCE(map.insert(i, i));
+    }
+
+    const BenchmarkTimer timer;
+    uint32_t checksum = 0;
+    for (unsigned i = 0; i < NumIterations; i++)
+    {
+        const uint32_t key = 1U + (i * 7919U) % num_keys;
+        uint32_t* const value = map.access(key);
+        ENFORCE(value);
+        checksum += *value;
+        if (i % 8 == 0)
+        {
+            map.remove(key);
+            ENFORCE(map.insert(key, key));
+        }
+    }
+    const double ns = timer.getNSecPer(NumIterations);
+
+    ENFORCE(checksum != 0);
+    map.removeAll();
+    return ns;
+}
+
+static void benchmark()
+{
+    static uavcan::PoolAllocator<uavcan::MemPoolBlockSize * 1024, uavcan::MemPoolBlockSize> pool;
+    uavcan::PoolManager<1> poolmgr;
+    poolmgr.addPool(&pool);
+
+    static const unsigned NumKeys[] = { 10, 100, 1000 };
+    for (unsigned i = 0; i < sizeof(NumKeys) / sizeof(NumKeys[0]); i++)
+    {
+        double map_ns = 0;
+        {
+            uavcan::Map<uint32_t, uint32_t, 10> map(poolmgr);
+            map_ns = benchmarkMap(map, NumKeys[i]);
+        }
+        double hash_map_ns = 0;
+        {
+            uavcan::HashMap<uint32_t, uint32_t, 10, 512> hash_map(poolmgr);
+            hash_map_ns = benchmarkMap(hash_map, NumKeys[i]);
+        }
+        ENFORCE(0 == pool.getNumUsedBlocks());
+
+        std::cout << NumKeys[i] << " keys: Map " << map_ns << " ns, HashMap " << hash_map_ns
+                  << " ns per access" << std::endl;
+    }
+}
+
+int main()
+{
+    return runBenchmark(&benchmark);
+}
@@ -0,0 +1,82 @@
+/*
+ * Copyright (C) 2014 Pavel Kirienko <pavel.kirienko@gmail.com>
+ */
+
+#include <vector>
+#include <uavcan/transport/transfer_listener.hpp>
+#include "benchmark.hpp"
+
+template <template <unsigned> class ReceiverStore>
+class CountingListener : public uavcan::TransferListener<0, 0, 0, ReceiverStore>
+{
+public:
+    unsigned num_transfers;
+
+    CountingListener(uavcan::TransferPerfCounter& perf, const uavcan::DataTypeDescriptor& data_type,
+                     uavcan::IPoolAllocator& allocator)
+        : uavcan::TransferListener<0, 0, 0, ReceiverStore>(perf, data_type, allocator)
+        , num_transfers(0)
+    { }
+
+    void handleIncomingTransfer(uavcan::IncomingTransfer&) { num_transfers++; }
+};
+
+template <template <unsigned> class ReceiverStore>
+static double benchmarkReceiverStore(const std::vector<std::vector<uavcan::RxFrame> >& rounds)
+{
+    const uavcan::DataTypeDescriptor type(uavcan::DataTypeKindMessage, 123, uavcan::DataTypeSignature(123456789), "A");
+
+    static uavcan::PoolAllocator<uavcan::MemPoolBlockSize * 256, uavcan::MemPoolBlockSize> pool;
+    uavcan::PoolManager<1> poolmgr;
+    poolmgr.addPool(&pool);
+    uavcan::TransferPerfCounter perf;
+    CountingListener<ReceiverStore> listener(perf, type, poolmgr);
+
+    const BenchmarkTimer timer;
+    unsigned num_frames = 0;
+    for (unsigned r = 0; r < rounds.size(); r++)
+    {
+        for (unsigned i = 0; i < rounds[r].size(); i++)
+        {
+            listener.handleFrame(rounds[r][i]);
+            num_frames++;
+        }
+    }
+    const double ns = timer.getNSecPer(num_frames);
+
+    ENFORCE(num_frames == listener.num_transfers);
+    return ns;
+}
+
+/**
+ * Every node publishes single frame transfers of the same type; all nodes are active in every round.
+ */
+static void benchmark()
+{
+    static const unsigned NumRounds = 400;
+
+    std::vector<std::vector<uavcan::RxFrame> > rounds(NumRounds);
+    for (unsigned r = 0; r < NumRounds; r++)
+    {
+        for (uint8_t node_id = 1; node_id <= uavcan::NodeID::Max; node_id++)
+        {
+            uavcan::Frame frame(123, uavcan::TransferTypeMessageBroadcast, node_id, uavcan::NodeID::Broadcast, 0,
+                                uavcan::TransferID(uint8_t(r % 8)), true);
+            const uint8_t payload[] = { 1, 2, 3, 4, 5, 6, 7 };
+            frame.setPayload(payload, sizeof(payload));
+            rounds[r].push_back(uavcan::RxFrame(frame, tsMono(1000 + r * 100000), tsUtc(0), 0));
+        }
+    }
+
+    const double map_ns = benchmarkReceiverStore<uavcan::TransferReceiverMap>(rounds);
+    const double hash_map_ns = benchmarkReceiverStore<uavcan::TransferReceiverHashMap>(rounds);
+    const double table_ns = benchmarkReceiverStore<uavcan::TransferReceiverTable>(rounds);
+
+    std::cout << int(uavcan::NodeID::Max) << " publishers, per frame: Map " << map_ns << " ns, HashMap "
+              << hash_map_ns << " ns, Table " << table_ns << " ns" << std::endl;
+}
+
+int main()
+{
+    return runBenchmark(&benchmark);
+}
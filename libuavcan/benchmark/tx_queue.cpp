@@ -0,0 +1,121 @@
+/*
+ * Copyright (C) 2014 Pavel Kirienko <pavel.kirienko@gmail.com>
+ */
+
+#include <cstdlib>
+#include <vector>
+#include <uavcan/transport/can_io.hpp>
+#include <uavcan/util/linked_list.hpp>
+#include "benchmark.hpp"
+
+/**
+ * Reference implementation of the TX queue ordering that was used before: sorted singly linked list.
+ */
+class SortedListTxQueue
+{
+    struct Entry : public uavcan::LinkedListNode<Entry>
+    {
+        uavcan::CanFrame frame;
+        uavcan::MonotonicTime deadline;
+    };
+
+    struct PriorityInsertionComparator
+    {
+        const uavcan::CanFrame& frm;
+        explicit PriorityInsertionComparator(const uavcan::CanFrame& arg_frm) : frm(arg_frm) { }
+        bool operator()(const Entry* entry) const { return frm.priorityHigherThan(entry->frame); }
+    };
+
+    uavcan::LinkedListRoot<Entry> queue_;
+    uavcan::IPoolAllocator& allocator_;
+
+public:
+    explicit SortedListTxQueue(uavcan::IPoolAllocator& allocator) : allocator_(allocator) { }
+
+    void push(const uavcan::CanFrame& frame, uavcan::MonotonicTime deadline)
+    {
+        void* const praw = allocator_.allocate(sizeof(Entry));
+        ENFORCE(praw);
+        Entry* const entry = new (praw) Entry();
+        entry->frame = frame;
+        entry->deadline = deadline;
+        queue_.insertBefore(entry, PriorityInsertionComparator(frame));
+    }
+
+    bool pop()
+    {
+        Entry* const entry = queue_.get();
+        if (entry == NULL)
+        {
+            return false;
+        }
+        queue_.remove(entry);
+        entry->~Entry();
+        allocator_.deallocate(entry);
+        return true;
+    }
+};
+
+static void benchmark()
+{
+    using uavcan::CanTxQueue;
+
+    static const unsigned MaxFrames = 1024;
+    static const unsigned Depths[] = { 16, 128, 1024 };
+    static const unsigned Iterations = 20;
+
+    typedef uavcan::PoolAllocator<uavcan::MemPoolBlockSize * MaxFrames, uavcan::MemPoolBlockSize> Pool;
+    static Pool pool;
+
+    std::srand(0);
+    std::vector<uavcan::CanFrame> frames;
+    const uint8_t payload[] = { 1, 2, 3, 4, 5, 6, 7, 8 };
+    for (unsigned i = 0; i < MaxFrames; i++)
+    {
+        const uint32_t id = (uint32_t(std::rand()) & uavcan::CanFrame::MaskExtID) | uavcan::CanFrame::FlagEFF;
+        frames.push_back(uavcan::CanFrame(id, payload, sizeof(payload)));
+    }
+
+    for (unsigned d = 0; d < sizeof(Depths) / sizeof(Depths[0]); d++)
+    {
+        const unsigned depth = Depths[d];
+
+        const BenchmarkTimer list_timer;
+        for (unsigned it = 0; it < Iterations; it++)
+        {
+            SortedListTxQueue list(pool);
+            for (unsigned i = 0; i < depth; i++)
+            {
+                list.push(frames[i], tsMono(1000000));
+            }
+            while (list.pop()) { }
+        }
+        const double list_ns = list_timer.getNSecPer(depth * Iterations);
+
+        const BenchmarkTimer tree_timer;
+        for (unsigned it = 0; it < Iterations; it++)
+        {
+            SystemClockMock clockmock(1);
+            CanTxQueue queue(pool, clockmock, MaxFrames);
+            for (unsigned i = 0; i < depth; i++)
+            {
+                queue.push(frames[i], tsMono(1000000), (i % 2) ? CanTxQueue::Volatile : CanTxQueue::Persistent, 0);
+            }
+            while (CanTxQueue::Entry* entry = queue.peek())
+            {
+                queue.remove(entry);
+            }
+        }
+        const double tree_ns = tree_timer.getNSecPer(depth * Iterations);
+
+        ENFORCE(0 == pool.getNumUsedBlocks());
+
+        std::cout << "TX queue depth " << depth << ", push+pop per frame: sorted list " << list_ns
+                  << " ns, tree " << tree_ns << " ns" << std::endl;
+    }
+}
+
+int main()
+{
+    return runBenchmark(&benchmark);
+}
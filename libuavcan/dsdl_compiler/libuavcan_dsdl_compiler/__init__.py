@@ -26,6 +26,9 @@ OUTPUT_FILE_EXTENSION = 'hpp'
 OUTPUT_FILE_PERMISSIONS = 0o444  # Read only for all
 TEMPLATE_FILENAME = os.path.join(os.path.dirname(__file__), 'data_type_template.tmpl')
 
+# Fixed layout types with more scalars than this use the generic codec, to keep the generated code compact
+FIXED_LAYOUT_MAX_SCALARS = 64
+
 __all__ = ['run', 'logger', 'DsdlCompilerException']
 
 class DsdlCompilerException(Exception):
@@ -161,6 +164,69 @@ def type_to_cpp_type(t):
     else:
         raise DsdlCompilerException('Unknown type category: %s' % t.category)
 
+def fixed_layout_scalar_count(fields):
+    '''
+    Returns the number of scalars in the structure if the bit offset of every field is a compile-time constant,
+    i.e. if there are no dynamic arrays at any depth; otherwise returns None.
+    '''
+    def count(t):
+        if t.category == t.CATEGORY_PRIMITIVE:
+            return 1
+        if t.category == t.CATEGORY_ARRAY:
+            if t.mode != t.MODE_STATIC:
+                return None
+            value_count = count(t.value_type)
+            return None if value_count is None else value_count * t.max_size
+        if t.category == t.CATEGORY_COMPOUND:
+            return fixed_layout_scalar_count(t.fields)
+        raise DsdlCompilerException('Unknown type category: %s' % t.category)
+    total = 0
+    for a in fields:
+        field_count = count(a.type)
+        if field_count is None:
+            return None
+        total += field_count
+    return total
+
+class FixedLayout:
+    '''
+    Straight-line pack/unpack statements for a structure with fixed layout, see uavcan/marshal/fixed_layout.hpp.
+    Fields:
+        pack      List of C++ statements that pack the structure "self" into the byte array "buf"
+        unpack    List of C++ statements that unpack the structure "self" from the byte array "buf"
+    '''
+    def __init__(self, fields):
+        self.pack = []
+        self.unpack = []
+        bit_offset = 0
+        for a in fields:
+            if a.type.category == a.type.CATEGORY_ARRAY:
+                for index in range(a.type.max_size):
+                    self._add(a.type.value_type, 'typename FieldTypes::%s::RawValueType' % a.name,
+                              'self.%s[%d]' % (a.name, index), bit_offset)
+                    bit_offset += a.type.value_type.get_max_bitlen()
+            else:
+                self._add(a.type, 'typename FieldTypes::%s' % a.name, 'self.%s' % a.name, bit_offset)
+                bit_offset += a.type.get_max_bitlen()
+
+    def _add(self, t, cpp_type, access, bit_offset):
+        if t.get_max_bitlen() == 0:
+            return  # Nested empty structures have nothing to pack
+        offset = 'BitOffset + %d' % bit_offset if bit_offset else 'BitOffset'
+        if t.category == t.CATEGORY_PRIMITIVE:
+            self.pack.append('::uavcan::packFixedLayoutScalar< %s, %s >(buf, %s);' % (cpp_type, offset, access))
+            self.unpack.append('%s = ::uavcan::unpackFixedLayoutScalar< %s, %s >(buf);' % (access, cpp_type, offset))
+        else:
+            scope = cpp_type[len('typename '):]
+            self.pack.append('%s::template packFixedLayout< %s >(%s, buf);' % (scope, offset, access))
+            self.unpack.append('%s::template unpackFixedLayout< %s >(%s, buf);' % (scope, offset, access))
+
+def make_fixed_layout(fields):
+    scalar_count = fixed_layout_scalar_count(fields)
+    if scalar_count and scalar_count <= FIXED_LAYOUT_MAX_SCALARS:
+        return FixedLayout(fields)
+    return None
+
 def generate_one_type(template_expander, t):
     t.short_name = t.full_name.split('.')[-1]
     t.cpp_type_name = t.short_name + '_'
@@ -218,6 +284,13 @@ def generate_one_type(template_expander, t):
         inject_constant_info(t.request_constants)
         inject_constant_info(t.response_constants)
 
+    # Fixed layout codec, if applicable
+    if t.kind == t.KIND_MESSAGE:
+        t.fixed_layout = make_fixed_layout(t.fields)
+    else:
+        t.request_fixed_layout = make_fixed_layout(t.request_fields)
+        t.response_fixed_layout = make_fixed_layout(t.response_fields)
+
     # Data type kind
     t.cpp_kind = {
         t.KIND_MESSAGE: '::uavcan::DataTypeKindMessage',
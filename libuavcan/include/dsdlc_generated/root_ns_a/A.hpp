@@ -0,0 +1,340 @@
+/*
+ * UAVCAN data structure definition for libuavcan.
+ *
+ * Autogenerated, do not edit.
+ *
+ * Source file: /root/repo/libuavcan/test/dsdl_test/root_ns_a/A.uavcan
+ */
+
+#ifndef ROOT_NS_A_A_HPP_INCLUDED
+#define ROOT_NS_A_A_HPP_INCLUDED
+
+#include <uavcan/build_config.hpp>
+#include <uavcan/node/global_data_type_registry.hpp>
+#include <uavcan/marshal/types.hpp>
+
+#include <root_ns_a/B.hpp>
+
+/******************************* Source text **********************************
+#
+# Nested type.
+# Energy and capacity are expressed in watt hours (Joules are infeasible because of range limitations).
+# Unknown values should be represented as NAN.
+#
+
+float32 scalar
+B[3] vector
+******************************************************************************/
+
+/********************* DSDL signature source definition ***********************
+root_ns_a.A
+saturated float32 scalar
+root_ns_a.B[3] vector
+******************************************************************************/
+
+#undef scalar
+#undef vector
+
+#ifndef UAVCAN_PACK_STRUCTS
+# error UAVCAN_PACK_STRUCTS
+#endif
+
+namespace root_ns_a
+{
+
+#if UAVCAN_PACK_STRUCTS
+UAVCAN_PACKED_BEGIN
+#endif
+
+template <int _tmpl>
+struct UAVCAN_EXPORT A_
+{
+    typedef const A_<_tmpl>& ParameterType;
+    typedef A_<_tmpl>& ReferenceType;
+
+    struct ConstantTypes
+    {
+    };
+
+    struct FieldTypes
+    {
+        typedef ::uavcan::FloatSpec< 32, ::uavcan::CastModeSaturate > scalar;
+        typedef ::uavcan::Array< ::root_ns_a::B, ::uavcan::ArrayModeStatic, 3 > vector;
+    };
+
+    enum
+    {
+        MinBitLen
+            = FieldTypes::scalar::MinBitLen
+            + FieldTypes::vector::MinBitLen
+    };
+
+    enum
+    {
+        MaxBitLen
+            = FieldTypes::scalar::MaxBitLen
+            + FieldTypes::vector::MaxBitLen
+    };
+
+    // Constants
+
+    // Fields
+    typename ::uavcan::StorageType< typename FieldTypes::scalar >::Type scalar;
+    typename ::uavcan::StorageType< typename FieldTypes::vector >::Type vector;
+
+    A_()
+        : scalar()
+        , vector()
+    {
+        enum { MaxByteLen = ::uavcan::BitLenToByteLen<MaxBitLen>::Result };
+        ::uavcan::StaticAssert<int(MaxByteLen) <= int(::uavcan::MaxTransferPayloadLen)>::check();
+
+        ::uavcan::StaticAssert<_tmpl == 0>::check();  // Usage check
+
+#if UAVCAN_DEBUG
+        /*
+         * Cross-checking MaxBitLen provided by the DSDL compiler.
+         * This check shall never be performed in user code because MaxBitLen value
+         * actually depends on the nested types, thus it is not invariant.
+         */
+        ::uavcan::StaticAssert<848 == MaxBitLen>::check();
+#endif
+    }
+
+    bool operator==(ParameterType rhs) const;
+    bool operator!=(ParameterType rhs) const { return !operator==(rhs); }
+
+    /**
+     * This comparison is based on @ref uavcan::areClose(), which ensures proper comparison of
+     * floating point fields at any depth.
+     */
+    bool isClose(ParameterType rhs) const;
+
+    static int encode(ParameterType self, ::uavcan::ScalarCodec& codec,
+                      ::uavcan::TailArrayOptimizationMode tao_mode = ::uavcan::TailArrayOptEnabled);
+
+    static int decode(ReferenceType self, ::uavcan::ScalarCodec& codec,
+                      ::uavcan::TailArrayOptimizationMode tao_mode = ::uavcan::TailArrayOptEnabled);
+
+    /**
+     * This type has no dynamic arrays, so the bit offset of every field is a compile-time constant.
+     * Encoding and decoding are performed via a plain byte array, see uavcan/marshal/fixed_layout.hpp.
+     * The field by field codec methods implement the generic approach; they are intended for testing.
+     */
+    typedef void FixedLayoutTag;
+
+    template <unsigned BitOffset>
+    static void packFixedLayout(ParameterType self, ::uavcan::uint8_t* buf);
+
+    template <unsigned BitOffset>
+    static void unpackFixedLayout(ReferenceType self, const ::uavcan::uint8_t* buf);
+
+    static int encodeFieldByField(ParameterType self, ::uavcan::ScalarCodec& codec,
+                                  ::uavcan::TailArrayOptimizationMode tao_mode = ::uavcan::TailArrayOptEnabled);
+
+    static int decodeFieldByField(ReferenceType self, ::uavcan::ScalarCodec& codec,
+                                  ::uavcan::TailArrayOptimizationMode tao_mode = ::uavcan::TailArrayOptEnabled);
+
+    /*
+     * Static type info
+     */
+    enum { DataTypeKind = ::uavcan::DataTypeKindMessage };
+    // This type has no default data type ID
+
+    static const char* getDataTypeFullName()
+    {
+        return "root_ns_a.A";
+    }
+
+    static void extendDataTypeSignature(::uavcan::DataTypeSignature& signature)
+    {
+        signature.extend(getDataTypeSignature());
+    }
+
+    static ::uavcan::DataTypeSignature getDataTypeSignature();
+
+};
+
+#if UAVCAN_PACK_STRUCTS
+UAVCAN_PACKED_END
+#endif
+
+/*
+ * Out of line struct method definitions
+ */
+
+template <int _tmpl>
+bool A_<_tmpl>::operator==(ParameterType rhs) const
+{
+    return
+        scalar == rhs.scalar &&
+        vector == rhs.vector;
+}
+
+template <int _tmpl>
+bool A_<_tmpl>::isClose(ParameterType rhs) const
+{
+    return
+        ::uavcan::areClose(scalar, rhs.scalar) &&
+        ::uavcan::areClose(vector, rhs.vector);
+}
+
+template <int _tmpl>
+int A_<_tmpl>::encodeFieldByField(ParameterType self, ::uavcan::ScalarCodec& codec,
+    ::uavcan::TailArrayOptimizationMode tao_mode)
+{
+    (void)self;
+    (void)codec;
+    (void)tao_mode;
+    int res = 1;
+    res = FieldTypes::scalar::encode(self.scalar, codec,  ::uavcan::TailArrayOptDisabled);
+    if (res <= 0)
+    {
+        return res;
+    }
+    res = FieldTypes::vector::encode(self.vector, codec,  tao_mode);
+    return res;
+}
+
+template <int _tmpl>
+int A_<_tmpl>::decodeFieldByField(ReferenceType self, ::uavcan::ScalarCodec& codec,
+    ::uavcan::TailArrayOptimizationMode tao_mode)
+{
+    (void)self;
+    (void)codec;
+    (void)tao_mode;
+    int res = 1;
+    res = FieldTypes::scalar::decode(self.scalar, codec,  ::uavcan::TailArrayOptDisabled);
+    if (res <= 0)
+    {
+        return res;
+    }
+    res = FieldTypes::vector::decode(self.vector, codec,  tao_mode);
+    return res;
+}
+
+template <int _tmpl>
+template <unsigned BitOffset>
+void A_<_tmpl>::packFixedLayout(ParameterType self, ::uavcan::uint8_t* buf)
+{
+    ::uavcan::packFixedLayoutScalar< typename FieldTypes::scalar, BitOffset >(buf, self.scalar);
+    FieldTypes::vector::RawValueType::template packFixedLayout< BitOffset + 32 >(self.vector[0], buf);
+    FieldTypes::vector::RawValueType::template packFixedLayout< BitOffset + 304 >(self.vector[1], buf);
+    FieldTypes::vector::RawValueType::template packFixedLayout< BitOffset + 576 >(self.vector[2], buf);
+}
+
+template <int _tmpl>
+template <unsigned BitOffset>
+void A_<_tmpl>::unpackFixedLayout(ReferenceType self, const ::uavcan::uint8_t* buf)
+{
+    self.scalar = ::uavcan::unpackFixedLayoutScalar< typename FieldTypes::scalar, BitOffset >(buf);
+    FieldTypes::vector::RawValueType::template unpackFixedLayout< BitOffset + 32 >(self.vector[0], buf);
+    FieldTypes::vector::RawValueType::template unpackFixedLayout< BitOffset + 304 >(self.vector[1], buf);
+    FieldTypes::vector::RawValueType::template unpackFixedLayout< BitOffset + 576 >(self.vector[2], buf);
+}
+
+template <int _tmpl>
+int A_<_tmpl>::encode(ParameterType self, ::uavcan::ScalarCodec& codec,
+    ::uavcan::TailArrayOptimizationMode tao_mode)
+{
+    (void)tao_mode;
+    ::uavcan::uint8_t buf[::uavcan::BitLenToByteLen<MaxBitLen>::Result] = { };
+    packFixedLayout<0>(self, buf);
+    return codec.encodeBits(buf, MaxBitLen);
+}
+
+template <int _tmpl>
+int A_<_tmpl>::decode(ReferenceType self, ::uavcan::ScalarCodec& codec,
+    ::uavcan::TailArrayOptimizationMode tao_mode)
+{
+    (void)tao_mode;
+    ::uavcan::uint8_t buf[::uavcan::BitLenToByteLen<MaxBitLen>::Result];
+    const int res = codec.decodeBits(buf, MaxBitLen);
+    if (res > 0)
+    {
+        unpackFixedLayout<0>(self, buf);
+    }
+    return res;
+}
+
+/*
+ * Out of line type method definitions
+ */
+template <int _tmpl>
+::uavcan::DataTypeSignature A_<_tmpl>::getDataTypeSignature()
+{
+    ::uavcan::DataTypeSignature signature(0xC5CA4E073FC98003ULL);
+
+    FieldTypes::scalar::extendDataTypeSignature(signature);
+    FieldTypes::vector::extendDataTypeSignature(signature);
+
+    return signature;
+}
+
+/*
+ * Out of line constant definitions
+ */
+
+/*
+ * Final typedef
+ */
+typedef A_<0> A;
+
+// No default registration
+
+} // Namespace root_ns_a
+
+/*
+ * YAML streamer specialization
+ */
+namespace uavcan
+{
+
+template <>
+class UAVCAN_EXPORT YamlStreamer< ::root_ns_a::A >
+{
+public:
+    template <typename Stream>
+    static void stream(Stream& s, ::root_ns_a::A::ParameterType obj, const int level);
+};
+
+template <typename Stream>
+void YamlStreamer< ::root_ns_a::A >::stream(Stream& s, ::root_ns_a::A::ParameterType obj, const int level)
+{
+    (void)s;
+    (void)obj;
+    (void)level;
+    if (level > 0)
+    {
+        s << '\n';
+        for (int pos = 0; pos < level; pos++)
+        {
+            s << "  ";
+        }
+    }
+    s << "scalar: ";
+    YamlStreamer< ::root_ns_a::A::FieldTypes::scalar >::stream(s, obj.scalar, level + 1);
+    s << '\n';
+    for (int pos = 0; pos < level; pos++)
+    {
+        s << "  ";
+    }
+    s << "vector: ";
+    YamlStreamer< ::root_ns_a::A::FieldTypes::vector >::stream(s, obj.vector, level + 1);
+}
+
+}
+
+namespace root_ns_a
+{
+
+template <typename Stream>
+inline Stream& operator<<(Stream& s, ::root_ns_a::A::ParameterType obj)
+{
+    ::uavcan::YamlStreamer< ::root_ns_a::A >::stream(s, obj, 0);
+    return s;
+}
+
+}
+
+#endif // ROOT_NS_A_A_HPP_INCLUDED
\ No newline at end of file
@@ -0,0 +1,364 @@
+/*
+ * UAVCAN data structure definition for libuavcan.
+ *
+ * Autogenerated, do not edit.
+ *
+ * Source file: /root/repo/libuavcan/test/dsdl_test/root_ns_a/B.uavcan
+ */
+
+#ifndef ROOT_NS_A_B_HPP_INCLUDED
+#define ROOT_NS_A_B_HPP_INCLUDED
+
+#include <uavcan/build_config.hpp>
+#include <uavcan/node/global_data_type_registry.hpp>
+#include <uavcan/marshal/types.hpp>
+
+/******************************* Source text **********************************
+float64[4] vector
+bool[16] bools
+******************************************************************************/
+
+/********************* DSDL signature source definition ***********************
+root_ns_a.B
+saturated float64[4] vector
+saturated bool[16] bools
+******************************************************************************/
+
+#undef vector
+#undef bools
+
+#ifndef UAVCAN_PACK_STRUCTS
+# error UAVCAN_PACK_STRUCTS
+#endif
+
+namespace root_ns_a
+{
+
+#if UAVCAN_PACK_STRUCTS
+UAVCAN_PACKED_BEGIN
+#endif
+
+template <int _tmpl>
+struct UAVCAN_EXPORT B_
+{
+    typedef const B_<_tmpl>& ParameterType;
+    typedef B_<_tmpl>& ReferenceType;
+
+    struct ConstantTypes
+    {
+    };
+
+    struct FieldTypes
+    {
+        typedef ::uavcan::Array< ::uavcan::FloatSpec< 64, ::uavcan::CastModeSaturate >, ::uavcan::ArrayModeStatic, 4 > vector;
+        typedef ::uavcan::Array< ::uavcan::IntegerSpec< 1, ::uavcan::SignednessUnsigned, ::uavcan::CastModeSaturate >, ::uavcan::ArrayModeStatic, 16 > bools;
+    };
+
+    enum
+    {
+        MinBitLen
+            = FieldTypes::vector::MinBitLen
+            + FieldTypes::bools::MinBitLen
+    };
+
+    enum
+    {
+        MaxBitLen
+            = FieldTypes::vector::MaxBitLen
+            + FieldTypes::bools::MaxBitLen
+    };
+
+    // Constants
+
+    // Fields
+    typename ::uavcan::StorageType< typename FieldTypes::vector >::Type vector;
+    typename ::uavcan::StorageType< typename FieldTypes::bools >::Type bools;
+
+    B_()
+        : vector()
+        , bools()
+    {
+        enum { MaxByteLen = ::uavcan::BitLenToByteLen<MaxBitLen>::Result };
+        ::uavcan::StaticAssert<int(MaxByteLen) <= int(::uavcan::MaxTransferPayloadLen)>::check();
+
+        ::uavcan::StaticAssert<_tmpl == 0>::check();  // Usage check
+
+#if UAVCAN_DEBUG
+        /*
+         * Cross-checking MaxBitLen provided by the DSDL compiler.
+         * This check shall never be performed in user code because MaxBitLen value
+         * actually depends on the nested types, thus it is not invariant.
+         */
+        ::uavcan::StaticAssert<272 == MaxBitLen>::check();
+#endif
+    }
+
+    bool operator==(ParameterType rhs) const;
+    bool operator!=(ParameterType rhs) const { return !operator==(rhs); }
+
+    /**
+     * This comparison is based on @ref uavcan::areClose(), which ensures proper comparison of
+     * floating point fields at any depth.
+     */
+    bool isClose(ParameterType rhs) const;
+
+    static int encode(ParameterType self, ::uavcan::ScalarCodec& codec,
+                      ::uavcan::TailArrayOptimizationMode tao_mode = ::uavcan::TailArrayOptEnabled);
+
+    static int decode(ReferenceType self, ::uavcan::ScalarCodec& codec,
+                      ::uavcan::TailArrayOptimizationMode tao_mode = ::uavcan::TailArrayOptEnabled);
+
+    /**
+     * This type has no dynamic arrays, so the bit offset of every field is a compile-time constant.
+     * Encoding and decoding are performed via a plain byte array, see uavcan/marshal/fixed_layout.hpp.
+     * The field by field codec methods implement the generic approach; they are intended for testing.
+     */
+    typedef void FixedLayoutTag;
+
+    template <unsigned BitOffset>
+    static void packFixedLayout(ParameterType self, ::uavcan::uint8_t* buf);
+
+    template <unsigned BitOffset>
+    static void unpackFixedLayout(ReferenceType self, const ::uavcan::uint8_t* buf);
+
+    static int encodeFieldByField(ParameterType self, ::uavcan::ScalarCodec& codec,
+                                  ::uavcan::TailArrayOptimizationMode tao_mode = ::uavcan::TailArrayOptEnabled);
+
+    static int decodeFieldByField(ReferenceType self, ::uavcan::ScalarCodec& codec,
+                                  ::uavcan::TailArrayOptimizationMode tao_mode = ::uavcan::TailArrayOptEnabled);
+
+    /*
+     * Static type info
+     */
+    enum { DataTypeKind = ::uavcan::DataTypeKindMessage };
+    // This type has no default data type ID
+
+    static const char* getDataTypeFullName()
+    {
+        return "root_ns_a.B";
+    }
+
+    static void extendDataTypeSignature(::uavcan::DataTypeSignature& signature)
+    {
+        signature.extend(getDataTypeSignature());
+    }
+
+    static ::uavcan::DataTypeSignature getDataTypeSignature();
+
+};
+
+#if UAVCAN_PACK_STRUCTS
+UAVCAN_PACKED_END
+#endif
+
+/*
+ * Out of line struct method definitions
+ */
+
+template <int _tmpl>
+bool B_<_tmpl>::operator==(ParameterType rhs) const
+{
+    return
+        vector == rhs.vector &&
+        bools == rhs.bools;
+}
+
+template <int _tmpl>
+bool B_<_tmpl>::isClose(ParameterType rhs) const
+{
+    return
+        ::uavcan::areClose(vector, rhs.vector) &&
+        ::uavcan::areClose(bools, rhs.bools);
+}
+
+template <int _tmpl>
+int B_<_tmpl>::encodeFieldByField(ParameterType self, ::uavcan::ScalarCodec& codec,
+    ::uavcan::TailArrayOptimizationMode tao_mode)
+{
+    (void)self;
+    (void)codec;
+    (void)tao_mode;
+    int res = 1;
+    res = FieldTypes::vector::encode(self.vector, codec,  ::uavcan::TailArrayOptDisabled);
+    if (res <= 0)
+    {
+        return res;
+    }
+    res = FieldTypes::bools::encode(self.bools, codec,  tao_mode);
+    return res;
+}
+
+template <int _tmpl>
+int B_<_tmpl>::decodeFieldByField(ReferenceType self, ::uavcan::ScalarCodec& codec,
+    ::uavcan::TailArrayOptimizationMode tao_mode)
+{
+    (void)self;
+    (void)codec;
+    (void)tao_mode;
+    int res = 1;
+    res = FieldTypes::vector::decode(self.vector, codec,  ::uavcan::TailArrayOptDisabled);
+    if (res <= 0)
+    {
+        return res;
+    }
+    res = FieldTypes::bools::decode(self.bools, codec,  tao_mode);
+    return res;
+}
+
+template <int _tmpl>
+template <unsigned BitOffset>
+void B_<_tmpl>::packFixedLayout(ParameterType self, ::uavcan::uint8_t* buf)
+{
+    ::uavcan::packFixedLayoutScalar< typename FieldTypes::vector::RawValueType, BitOffset >(buf, self.vector[0]);
+    ::uavcan::packFixedLayoutScalar< typename FieldTypes::vector::RawValueType, BitOffset + 64 >(buf, self.vector[1]);
+    ::uavcan::packFixedLayoutScalar< typename FieldTypes::vector::RawValueType, BitOffset + 128 >(buf, self.vector[2]);
+    ::uavcan::packFixedLayoutScalar< typename FieldTypes::vector::RawValueType, BitOffset + 192 >(buf, self.vector[3]);
+    ::uavcan::packFixedLayoutScalar< typename FieldTypes::bools::RawValueType, BitOffset + 256 >(buf, self.bools[0]);
+    ::uavcan::packFixedLayoutScalar< typename FieldTypes::bools::RawValueType, BitOffset + 257 >(buf, self.bools[1]);
+    ::uavcan::packFixedLayoutScalar< typename FieldTypes::bools::RawValueType, BitOffset + 258 >(buf, self.bools[2]);
+    ::uavcan::packFixedLayoutScalar< typename FieldTypes::bools::RawValueType, BitOffset + 259 >(buf, self.bools[3]);
+    ::uavcan::packFixedLayoutScalar< typename FieldTypes::bools::RawValueType, BitOffset + 260 >(buf, self.bools[4]);
+    ::uavcan::packFixedLayoutScalar< typename FieldTypes::bools::RawValueType, BitOffset + 261 >(buf, self.bools[5]);
+    ::uavcan::packFixedLayoutScalar< typename FieldTypes::bools::RawValueType, BitOffset + 262 >(buf, self.bools[6]);
+    ::uavcan::packFixedLayoutScalar< typename FieldTypes::bools::RawValueType, BitOffset + 263 >(buf, self.bools[7]);
+    ::uavcan::packFixedLayoutScalar< typename FieldTypes::bools::RawValueType, BitOffset + 264 >(buf, self.bools[8]);
+    ::uavcan::packFixedLayoutScalar< typename FieldTypes::bools::RawValueType, BitOffset + 265 >(buf, self.bools[9]);
+    ::uavcan::packFixedLayoutScalar< typename FieldTypes::bools::RawValueType, BitOffset + 266 >(buf, self.bools[10]);
+    ::uavcan::packFixedLayoutScalar< typename FieldTypes::bools::RawValueType, BitOffset + 267 >(buf, self.bools[11]);
+    ::uavcan::packFixedLayoutScalar< typename FieldTypes::bools::RawValueType, BitOffset + 268 >(buf, self.bools[12]);
+    ::uavcan::packFixedLayoutScalar< typename FieldTypes::bools::RawValueType, BitOffset + 269 >(buf, self.bools[13]);
+    ::uavcan::packFixedLayoutScalar< typename FieldTypes::bools::RawValueType, BitOffset + 270 >(buf, self.bools[14]);
+    ::uavcan::packFixedLayoutScalar< typename FieldTypes::bools::RawValueType, BitOffset + 271 >(buf, self.bools[15]);
+}
+
+template <int _tmpl>
+template <unsigned BitOffset>
+void B_<_tmpl>::unpackFixedLayout(ReferenceType self, const ::uavcan::uint8_t* buf)
+{
+    self.vector[0] = ::uavcan::unpackFixedLayoutScalar< typename FieldTypes::vector::RawValueType, BitOffset >(buf);
+    self.vector[1] = ::uavcan::unpackFixedLayoutScalar< typename FieldTypes::vector::RawValueType, BitOffset + 64 >(buf);
+    self.vector[2] = ::uavcan::unpackFixedLayoutScalar< typename FieldTypes::vector::RawValueType, BitOffset + 128 >(buf);
+    self.vector[3] = ::uavcan::unpackFixedLayoutScalar< typename FieldTypes::vector::RawValueType, BitOffset + 192 >(buf);
+    self.bools[0] = ::uavcan::unpackFixedLayoutScalar< typename FieldTypes::bools::RawValueType, BitOffset + 256 >(buf);
+    self.bools[1] = ::uavcan::unpackFixedLayoutScalar< typename FieldTypes::bools::RawValueType, BitOffset + 257 >(buf);
+    self.bools[2] = ::uavcan::unpackFixedLayoutScalar< typename FieldTypes::bools::RawValueType, BitOffset + 258 >(buf);
+    self.bools[3] = ::uavcan::unpackFixedLayoutScalar< typename FieldTypes::bools::RawValueType, BitOffset + 259 >(buf);
+    self.bools[4] = ::uavcan::unpackFixedLayoutScalar< typename FieldTypes::bools::RawValueType, BitOffset + 260 >(buf);
+    self.bools[5] = ::uavcan::unpackFixedLayoutScalar< typename FieldTypes::bools::RawValueType, BitOffset + 261 >(buf);
+    self.bools[6] = ::uavcan::unpackFixedLayoutScalar< typename FieldTypes::bools::RawValueType, BitOffset + 262 >(buf);
+    self.bools[7] = ::uavcan::unpackFixedLayoutScalar< typename FieldTypes::bools::RawValueType, BitOffset + 263 >(buf);
+    self.bools[8] = ::uavcan::unpackFixedLayoutScalar< typename FieldTypes::bools::RawValueType, BitOffset + 264 >(buf);
+    self.bools[9] = ::uavcan::unpackFixedLayoutScalar< typename FieldTypes::bools::RawValueType, BitOffset + 265 >(buf);
+    self.bools[10] = ::uavcan::unpackFixedLayoutScalar< typename FieldTypes::bools::RawValueType, BitOffset + 266 >(buf);
+    self.bools[11] = ::uavcan::unpackFixedLayoutScalar< typename FieldTypes::bools::RawValueType, BitOffset + 267 >(buf);
+    self.bools[12] = ::uavcan::unpackFixedLayoutScalar< typename FieldTypes::bools::RawValueType, BitOffset + 268 >(buf);
+    self.bools[13] = ::uavcan::unpackFixedLayoutScalar< typename FieldTypes::bools::RawValueType, BitOffset + 269 >(buf);
+    self.bools[14] = ::uavcan::unpackFixedLayoutScalar< typename FieldTypes::bools::RawValueType, BitOffset + 270 >(buf);
+    self.bools[15] = ::uavcan::unpackFixedLayoutScalar< typename FieldTypes::bools::RawValueType, BitOffset + 271 >(buf);
+}
+
+template <int _tmpl>
+int B_<_tmpl>::encode(ParameterType self, ::uavcan::ScalarCodec& codec,
+    ::uavcan::TailArrayOptimizationMode tao_mode)
+{
+    (void)tao_mode;
+    ::uavcan::uint8_t buf[::uavcan::BitLenToByteLen<MaxBitLen>::Result] = { };
+    packFixedLayout<0>(self, buf);
+    return codec.encodeBits(buf, MaxBitLen);
+}
+
+template <int _tmpl>
+int B_<_tmpl>::decode(ReferenceType self, ::uavcan::ScalarCodec& codec,
+    ::uavcan::TailArrayOptimizationMode tao_mode)
+{
+    (void)tao_mode;
+    ::uavcan::uint8_t buf[::uavcan::BitLenToByteLen<MaxBitLen>::Result];
+    const int res = codec.decodeBits(buf, MaxBitLen);
+    if (res > 0)
+    {
+        unpackFixedLayout<0>(self, buf);
+    }
+    return res;
+}
+
+/*
+ * Out of line type method definitions
+ */
+template <int _tmpl>
+::uavcan::DataTypeSignature B_<_tmpl>::getDataTypeSignature()
+{
+    ::uavcan::DataTypeSignature signature(0xE07DCD088407D31DULL);
+
+    FieldTypes::vector::extendDataTypeSignature(signature);
+    FieldTypes::bools::extendDataTypeSignature(signature);
+
+    return signature;
+}
+
+/*
+ * Out of line constant definitions
+ */
+
+/*
+ * Final typedef
+ */
+typedef B_<0> B;
+
+// No default registration
+
+} // Namespace root_ns_a
+
+/*
+ * YAML streamer specialization
+ */
+namespace uavcan
+{
+
+template <>
+class UAVCAN_EXPORT YamlStreamer< ::root_ns_a::B >
+{
+public:
+    template <typename Stream>
+    static void stream(Stream& s, ::root_ns_a::B::ParameterType obj, const int level);
+};
+
+template <typename Stream>
+void YamlStreamer< ::root_ns_a::B >::stream(Stream& s, ::root_ns_a::B::ParameterType obj, const int level)
+{
+    (void)s;
+    (void)obj;
+    (void)level;
+    if (level > 0)
+    {
+        s << '\n';
+        for (int pos = 0; pos < level; pos++)
+        {
+            s << "  ";
+        }
+    }
+    s << "vector: ";
+    YamlStreamer< ::root_ns_a::B::FieldTypes::vector >::stream(s, obj.vector, level + 1);
+    s << '\n';
+    for (int pos = 0; pos < level; pos++)
+    {
+        s << "  ";
+    }
+    s << "bools: ";
+    YamlStreamer< ::root_ns_a::B::FieldTypes::bools >::stream(s, obj.bools, level + 1);
+}
+
+}
+
+namespace root_ns_a
+{
+
+template <typename Stream>
+inline Stream& operator<<(Stream& s, ::root_ns_a::B::ParameterType obj)
+{
+    ::uavcan::YamlStreamer< ::root_ns_a::B >::stream(s, obj, 0);
+    return s;
+}
+
+}
+
+#endif // ROOT_NS_A_B_HPP_INCLUDED
\ No newline at end of file
@@ -0,0 +1,223 @@
+/*
+ * UAVCAN data structure definition for libuavcan.
+ *
+ * Autogenerated, do not edit.
+ *
+ * Source file: /root/repo/libuavcan/test/dsdl_test/root_ns_a/8.EmptyMessage.uavcan
+ */
+
+#ifndef ROOT_NS_A_EMPTYMESSAGE_HPP_INCLUDED
+#define ROOT_NS_A_EMPTYMESSAGE_HPP_INCLUDED
+
+#include <uavcan/build_config.hpp>
+#include <uavcan/node/global_data_type_registry.hpp>
+#include <uavcan/marshal/types.hpp>
+
+/******************************* Source text **********************************
+******************************************************************************/
+
+/********************* DSDL signature source definition ***********************
+root_ns_a.EmptyMessage
+******************************************************************************/
+
+#ifndef UAVCAN_PACK_STRUCTS
+# error UAVCAN_PACK_STRUCTS
+#endif
+
+namespace root_ns_a
+{
+
+#if UAVCAN_PACK_STRUCTS
+UAVCAN_PACKED_BEGIN
+#endif
+
+template <int _tmpl>
+struct UAVCAN_EXPORT EmptyMessage_
+{
+    typedef const EmptyMessage_<_tmpl>& ParameterType;
+    typedef EmptyMessage_<_tmpl>& ReferenceType;
+
+    struct ConstantTypes
+    {
+    };
+
+    struct FieldTypes
+    {
+    };
+
+    enum
+    {
+        MinBitLen
+    };
+
+    enum
+    {
+        MaxBitLen
+    };
+
+    // Constants
+
+    // Fields
+
+    EmptyMessage_()
+    {
+        enum { MaxByteLen = ::uavcan::BitLenToByteLen<MaxBitLen>::Result };
+        ::uavcan::StaticAssert<int(MaxByteLen) <= int(::uavcan::MaxTransferPayloadLen)>::check();
+
+        ::uavcan::StaticAssert<_tmpl == 0>::check();  // Usage check
+
+#if UAVCAN_DEBUG
+        /*
+         * Cross-checking MaxBitLen provided by the DSDL compiler.
+         * This check shall never be performed in user code because MaxBitLen value
+         * actually depends on the nested types, thus it is not invariant.
+         */
+        ::uavcan::StaticAssert<0 == MaxBitLen>::check();
+#endif
+    }
+
+    bool operator==(ParameterType rhs) const;
+    bool operator!=(ParameterType rhs) const { return !operator==(rhs); }
+
+    /**
+     * This comparison is based on @ref uavcan::areClose(), which ensures proper comparison of
+     * floating point fields at any depth.
+     */
+    bool isClose(ParameterType rhs) const;
+
+    static int encode(ParameterType self, ::uavcan::ScalarCodec& codec,
+                      ::uavcan::TailArrayOptimizationMode tao_mode = ::uavcan::TailArrayOptEnabled);
+
+    static int decode(ReferenceType self, ::uavcan::ScalarCodec& codec,
+                      ::uavcan::TailArrayOptimizationMode tao_mode = ::uavcan::TailArrayOptEnabled);
+
+    /*
+     * Static type info
+     */
+    enum { DataTypeKind = ::uavcan::DataTypeKindMessage };
+    enum { DefaultDataTypeID = 8 };
+
+    static const char* getDataTypeFullName()
+    {
+        return "root_ns_a.EmptyMessage";
+    }
+
+    static void extendDataTypeSignature(::uavcan::DataTypeSignature& signature)
+    {
+        signature.extend(getDataTypeSignature());
+    }
+
+    static ::uavcan::DataTypeSignature getDataTypeSignature();
+
+};
+
+#if UAVCAN_PACK_STRUCTS
+UAVCAN_PACKED_END
+#endif
+
+/*
+ * Out of line struct method definitions
+ */
+
+template <int _tmpl>
+bool EmptyMessage_<_tmpl>::operator==(ParameterType rhs) const
+{
+    (void)rhs;
+    return true;
+}
+
+template <int _tmpl>
+bool EmptyMessage_<_tmpl>::isClose(ParameterType rhs) const
+{
+    (void)rhs;
+    return true;
+}
+
+template <int _tmpl>
+int EmptyMessage_<_tmpl>::encode(ParameterType self, ::uavcan::ScalarCodec& codec,
+    ::uavcan::TailArrayOptimizationMode tao_mode)
+{
+    (void)self;
+    (void)codec;
+    (void)tao_mode;
+    int res = 1;
+    return res;
+}
+
+template <int _tmpl>
+int EmptyMessage_<_tmpl>::decode(ReferenceType self, ::uavcan::ScalarCodec& codec,
+    ::uavcan::TailArrayOptimizationMode tao_mode)
+{
+    (void)self;
+    (void)codec;
+    (void)tao_mode;
+    int res = 1;
+    return res;
+}
+
+/*
+ * Out of line type method definitions
+ */
+template <int _tmpl>
+::uavcan::DataTypeSignature EmptyMessage_<_tmpl>::getDataTypeSignature()
+{
+    ::uavcan::DataTypeSignature signature(0x8E6F580D21F482CULL);
+
+    return signature;
+}
+
+/*
+ * Out of line constant definitions
+ */
+
+/*
+ * Final typedef
+ */
+typedef EmptyMessage_<0> EmptyMessage;
+
+namespace
+{
+
+const ::uavcan::DefaultDataTypeRegistrator< ::root_ns_a::EmptyMessage > _uavcan_gdtr_registrator_EmptyMessage;
+
+}
+
+} // Namespace root_ns_a
+
+/*
+ * YAML streamer specialization
+ */
+namespace uavcan
+{
+
+template <>
+class UAVCAN_EXPORT YamlStreamer< ::root_ns_a::EmptyMessage >
+{
+public:
+    template <typename Stream>
+    static void stream(Stream& s, ::root_ns_a::EmptyMessage::ParameterType obj, const int level);
+};
+
+template <typename Stream>
+void YamlStreamer< ::root_ns_a::EmptyMessage >::stream(Stream& s, ::root_ns_a::EmptyMessage::ParameterType obj, const int level)
+{
+    (void)s;
+    (void)obj;
+    (void)level;
+}
+
+}
+
+namespace root_ns_a
+{
+
+template <typename Stream>
+inline Stream& operator<<(Stream& s, ::root_ns_a::EmptyMessage::ParameterType obj)
+{
+    ::uavcan::YamlStreamer< ::root_ns_a::EmptyMessage >::stream(s, obj, 0);
+    return s;
+}
+
+}
+
+#endif // ROOT_NS_A_EMPTYMESSAGE_HPP_INCLUDED
\ No newline at end of file
@@ -0,0 +1,372 @@
+/*
+ * UAVCAN data structure definition for libuavcan.
+ *
+ * Autogenerated, do not edit.
+ *
+ * Source file: /root/repo/libuavcan/test/dsdl_test/root_ns_b/ServiceWithEmptyResponse.uavcan
+ */
+
+#ifndef ROOT_NS_B_SERVICEWITHEMPTYRESPONSE_HPP_INCLUDED
+#define ROOT_NS_B_SERVICEWITHEMPTYRESPONSE_HPP_INCLUDED
+
+#include <uavcan/build_config.hpp>
+#include <uavcan/node/global_data_type_registry.hpp>
+#include <uavcan/marshal/types.hpp>
+
+/******************************* Source text **********************************
+float16[<=9] covariance
+---
+******************************************************************************/
+
+/********************* DSDL signature source definition ***********************
+root_ns_b.ServiceWithEmptyResponse
+saturated float16[<=9] covariance
+---
+******************************************************************************/
+
+#undef covariance
+
+#ifndef UAVCAN_PACK_STRUCTS
+# error UAVCAN_PACK_STRUCTS
+#endif
+
+namespace root_ns_b
+{
+
+#if UAVCAN_PACK_STRUCTS
+UAVCAN_PACKED_BEGIN
+#endif
+
+struct UAVCAN_EXPORT ServiceWithEmptyResponse_
+{
+    template <int _tmpl>
+    struct Request_
+    {
+        typedef const Request_<_tmpl>& ParameterType;
+        typedef Request_<_tmpl>& ReferenceType;
+
+        struct ConstantTypes
+        {
+        };
+
+        struct FieldTypes
+        {
+            typedef ::uavcan::Array< ::uavcan::FloatSpec< 16, ::uavcan::CastModeSaturate >, ::uavcan::ArrayModeDynamic, 9 > covariance;
+        };
+
+        enum
+        {
+            MinBitLen
+                = FieldTypes::covariance::MinBitLen
+        };
+
+        enum
+        {
+            MaxBitLen
+                = FieldTypes::covariance::MaxBitLen
+        };
+
+        // Constants
+
+        // Fields
+        typename ::uavcan::StorageType< typename FieldTypes::covariance >::Type covariance;
+
+        Request_()
+            : covariance()
+        {
+            enum { MaxByteLen = ::uavcan::BitLenToByteLen<MaxBitLen>::Result };
+            ::uavcan::StaticAssert<int(MaxByteLen) <= int(::uavcan::MaxTransferPayloadLen)>::check();
+
+            ::uavcan::StaticAssert<_tmpl == 0>::check();  // Usage check
+
+    #if UAVCAN_DEBUG
+            /*
+             * Cross-checking MaxBitLen provided by the DSDL compiler.
+             * This check shall never be performed in user code because MaxBitLen value
+             * actually depends on the nested types, thus it is not invariant.
+             */
+            ::uavcan::StaticAssert<148 == MaxBitLen>::check();
+    #endif
+        }
+
+        bool operator==(ParameterType rhs) const;
+        bool operator!=(ParameterType rhs) const { return !operator==(rhs); }
+
+        /**
+         * This comparison is based on @ref uavcan::areClose(), which ensures proper comparison of
+         * floating point fields at any depth.
+         */
+        bool isClose(ParameterType rhs) const;
+
+        static int encode(ParameterType self, ::uavcan::ScalarCodec& codec,
+                          ::uavcan::TailArrayOptimizationMode tao_mode = ::uavcan::TailArrayOptEnabled);
+
+        static int decode(ReferenceType self, ::uavcan::ScalarCodec& codec,
+                          ::uavcan::TailArrayOptimizationMode tao_mode = ::uavcan::TailArrayOptEnabled);
+
+    };
+
+    template <int _tmpl>
+    struct Response_
+    {
+        typedef const Response_<_tmpl>& ParameterType;
+        typedef Response_<_tmpl>& ReferenceType;
+
+        struct ConstantTypes
+        {
+        };
+
+        struct FieldTypes
+        {
+        };
+
+        enum
+        {
+            MinBitLen
+        };
+
+        enum
+        {
+            MaxBitLen
+        };
+
+        // Constants
+
+        // Fields
+
+        Response_()
+        {
+            enum { MaxByteLen = ::uavcan::BitLenToByteLen<MaxBitLen>::Result };
+            ::uavcan::StaticAssert<int(MaxByteLen) <= int(::uavcan::MaxTransferPayloadLen)>::check();
+
+            ::uavcan::StaticAssert<_tmpl == 0>::check();  // Usage check
+
+    #if UAVCAN_DEBUG
+            /*
+             * Cross-checking MaxBitLen provided by the DSDL compiler.
+             * This check shall never be performed in user code because MaxBitLen value
+             * actually depends on the nested types, thus it is not invariant.
+             */
+            ::uavcan::StaticAssert<0 == MaxBitLen>::check();
+    #endif
+        }
+
+        bool operator==(ParameterType rhs) const;
+        bool operator!=(ParameterType rhs) const { return !operator==(rhs); }
+
+        /**
+         * This comparison is based on @ref uavcan::areClose(), which ensures proper comparison of
+         * floating point fields at any depth.
+         */
+        bool isClose(ParameterType rhs) const;
+
+        static int encode(ParameterType self, ::uavcan::ScalarCodec& codec,
+                          ::uavcan::TailArrayOptimizationMode tao_mode = ::uavcan::TailArrayOptEnabled);
+
+        static int decode(ReferenceType self, ::uavcan::ScalarCodec& codec,
+                          ::uavcan::TailArrayOptimizationMode tao_mode = ::uavcan::TailArrayOptEnabled);
+
+    };
+
+    typedef Request_<0> Request;
+    typedef Response_<0> Response;
+
+    /*
+     * Static type info
+     */
+    enum { DataTypeKind = ::uavcan::DataTypeKindService };
+    // This type has no default data type ID
+
+    static const char* getDataTypeFullName()
+    {
+        return "root_ns_b.ServiceWithEmptyResponse";
+    }
+
+    static void extendDataTypeSignature(::uavcan::DataTypeSignature& signature)
+    {
+        signature.extend(getDataTypeSignature());
+    }
+
+    static ::uavcan::DataTypeSignature getDataTypeSignature();
+
+private:
+    ServiceWithEmptyResponse_(); // Don't create objects of this type. Use Request/Response instead.
+};
+
+#if UAVCAN_PACK_STRUCTS
+UAVCAN_PACKED_END
+#endif
+
+/*
+ * Out of line struct method definitions
+ */
+
+template <int _tmpl>
+bool ServiceWithEmptyResponse_::Request_<_tmpl>::operator==(ParameterType rhs) const
+{
+    return
+        covariance == rhs.covariance;
+}
+
+template <int _tmpl>
+bool ServiceWithEmptyResponse_::Request_<_tmpl>::isClose(ParameterType rhs) const
+{
+    return
+        ::uavcan::areClose(covariance, rhs.covariance);
+}
+
+template <int _tmpl>
+int ServiceWithEmptyResponse_::Request_<_tmpl>::encode(ParameterType self, ::uavcan::ScalarCodec& codec,
+    ::uavcan::TailArrayOptimizationMode tao_mode)
+{
+    (void)self;
+    (void)codec;
+    (void)tao_mode;
+    int res = 1;
+    res = FieldTypes::covariance::encode(self.covariance, codec,  tao_mode);
+    return res;
+}
+
+template <int _tmpl>
+int ServiceWithEmptyResponse_::Request_<_tmpl>::decode(ReferenceType self, ::uavcan::ScalarCodec& codec,
+    ::uavcan::TailArrayOptimizationMode tao_mode)
+{
+    (void)self;
+    (void)codec;
+    (void)tao_mode;
+    int res = 1;
+    res = FieldTypes::covariance::decode(self.covariance, codec,  tao_mode);
+    return res;
+}
+
+template <int _tmpl>
+bool ServiceWithEmptyResponse_::Response_<_tmpl>::operator==(ParameterType rhs) const
+{
+    (void)rhs;
+    return true;
+}
+
+template <int _tmpl>
+bool ServiceWithEmptyResponse_::Response_<_tmpl>::isClose(ParameterType rhs) const
+{
+    (void)rhs;
+    return true;
+}
+
+template <int _tmpl>
+int ServiceWithEmptyResponse_::Response_<_tmpl>::encode(ParameterType self, ::uavcan::ScalarCodec& codec,
+    ::uavcan::TailArrayOptimizationMode tao_mode)
+{
+    (void)self;
+    (void)codec;
+    (void)tao_mode;
+    int res = 1;
+    return res;
+}
+
+template <int _tmpl>
+int ServiceWithEmptyResponse_::Response_<_tmpl>::decode(ReferenceType self, ::uavcan::ScalarCodec& codec,
+    ::uavcan::TailArrayOptimizationMode tao_mode)
+{
+    (void)self;
+    (void)codec;
+    (void)tao_mode;
+    int res = 1;
+    return res;
+}
+
+/*
+ * Out of line type method definitions
+ */
+inline ::uavcan::DataTypeSignature ServiceWithEmptyResponse_::getDataTypeSignature()
+{
+    ::uavcan::DataTypeSignature signature(0xD738378161A9FF63ULL);
+
+    Request::FieldTypes::covariance::extendDataTypeSignature(signature);
+
+    return signature;
+}
+
+/*
+ * Out of line constant definitions
+ */
+
+/*
+ * Final typedef
+ */
+typedef ServiceWithEmptyResponse_ ServiceWithEmptyResponse;
+
+// No default registration
+
+} // Namespace root_ns_b
+
+/*
+ * YAML streamer specialization
+ */
+namespace uavcan
+{
+
+template <>
+class UAVCAN_EXPORT YamlStreamer< ::root_ns_b::ServiceWithEmptyResponse::Request >
+{
+public:
+    template <typename Stream>
+    static void stream(Stream& s, ::root_ns_b::ServiceWithEmptyResponse::Request::ParameterType obj, const int level);
+};
+
+template <typename Stream>
+void YamlStreamer< ::root_ns_b::ServiceWithEmptyResponse::Request >::stream(Stream& s, ::root_ns_b::ServiceWithEmptyResponse::Request::ParameterType obj, const int level)
+{
+    (void)s;
+    (void)obj;
+    (void)level;
+    if (level > 0)
+    {
+        s << '\n';
+        for (int pos = 0; pos < level; pos++)
+        {
+            s << "  ";
+        }
+    }
+    s << "covariance: ";
+    YamlStreamer< ::root_ns_b::ServiceWithEmptyResponse::Request::FieldTypes::covariance >::stream(s, obj.covariance, level + 1);
+}
+
+template <>
+class UAVCAN_EXPORT YamlStreamer< ::root_ns_b::ServiceWithEmptyResponse::Response >
+{
+public:
+    template <typename Stream>
+    static void stream(Stream& s, ::root_ns_b::ServiceWithEmptyResponse::Response::ParameterType obj, const int level);
+};
+
+template <typename Stream>
+void YamlStreamer< ::root_ns_b::ServiceWithEmptyResponse::Response >::stream(Stream& s, ::root_ns_b::ServiceWithEmptyResponse::Response::ParameterType obj, const int level)
+{
+    (void)s;
+    (void)obj;
+    (void)level;
+}
+
+}
+
+namespace root_ns_b
+{
+
+template <typename Stream>
+inline Stream& operator<<(Stream& s, ::root_ns_b::ServiceWithEmptyResponse::Request::ParameterType obj)
+{
+    ::uavcan::YamlStreamer< ::root_ns_b::ServiceWithEmptyResponse::Request >::stream(s, obj, 0);
+    return s;
+}
+
+template <typename Stream>
+inline Stream& operator<<(Stream& s, ::root_ns_b::ServiceWithEmptyResponse::Response::ParameterType obj)
+{
+    ::uavcan::YamlStreamer< ::root_ns_b::ServiceWithEmptyResponse::Response >::stream(s, obj, 0);
+    return s;
+}
+
+}
+
+#endif // ROOT_NS_B_SERVICEWITHEMPTYRESPONSE_HPP_INCLUDED
\ No newline at end of file
@@ -0,0 +1,235 @@
+/*
+ * UAVCAN data structure definition for libuavcan.
+ *
+ * Autogenerated, do not edit.
+ *
+ * Source file: /root/repo/libuavcan/test/dsdl_test/root_ns_b/T.uavcan
+ */
+
+#ifndef ROOT_NS_B_T_HPP_INCLUDED
+#define ROOT_NS_B_T_HPP_INCLUDED
+
+#include <uavcan/build_config.hpp>
+#include <uavcan/node/global_data_type_registry.hpp>
+#include <uavcan/marshal/types.hpp>
+
+/******************************* Source text **********************************
+bool T = true
+bool F = false
+******************************************************************************/
+
+/********************* DSDL signature source definition ***********************
+root_ns_b.T
+******************************************************************************/
+
+#undef T
+#undef F
+
+#ifndef UAVCAN_PACK_STRUCTS
+# error UAVCAN_PACK_STRUCTS
+#endif
+
+namespace root_ns_b
+{
+
+#if UAVCAN_PACK_STRUCTS
+UAVCAN_PACKED_BEGIN
+#endif
+
+template <int _tmpl>
+struct UAVCAN_EXPORT T_
+{
+    typedef const T_<_tmpl>& ParameterType;
+    typedef T_<_tmpl>& ReferenceType;
+
+    struct ConstantTypes
+    {
+        typedef ::uavcan::IntegerSpec< 1, ::uavcan::SignednessUnsigned, ::uavcan::CastModeSaturate > T;
+        typedef ::uavcan::IntegerSpec< 1, ::uavcan::SignednessUnsigned, ::uavcan::CastModeSaturate > F;
+    };
+
+    struct FieldTypes
+    {
+    };
+
+    enum
+    {
+        MinBitLen
+    };
+
+    enum
+    {
+        MaxBitLen
+    };
+
+    // Constants
+    static const typename ::uavcan::StorageType< typename ConstantTypes::T >::Type T; // true
+    static const typename ::uavcan::StorageType< typename ConstantTypes::F >::Type F; // false
+
+    // Fields
+
+    T_()
+    {
+        enum { MaxByteLen = ::uavcan::BitLenToByteLen<MaxBitLen>::Result };
+        ::uavcan::StaticAssert<int(MaxByteLen) <= int(::uavcan::MaxTransferPayloadLen)>::check();
+
+        ::uavcan::StaticAssert<_tmpl == 0>::check();  // Usage check
+
+#if UAVCAN_DEBUG
+        /*
+         * Cross-checking MaxBitLen provided by the DSDL compiler.
+         * This check shall never be performed in user code because MaxBitLen value
+         * actually depends on the nested types, thus it is not invariant.
+         */
+        ::uavcan::StaticAssert<0 == MaxBitLen>::check();
+#endif
+    }
+
+    bool operator==(ParameterType rhs) const;
+    bool operator!=(ParameterType rhs) const { return !operator==(rhs); }
+
+    /**
+     * This comparison is based on @ref uavcan::areClose(), which ensures proper comparison of
+     * floating point fields at any depth.
+     */
+    bool isClose(ParameterType rhs) const;
+
+    static int encode(ParameterType self, ::uavcan::ScalarCodec& codec,
+                      ::uavcan::TailArrayOptimizationMode tao_mode = ::uavcan::TailArrayOptEnabled);
+
+    static int decode(ReferenceType self, ::uavcan::ScalarCodec& codec,
+                      ::uavcan::TailArrayOptimizationMode tao_mode = ::uavcan::TailArrayOptEnabled);
+
+    /*
+     * Static type info
+     */
+    enum { DataTypeKind = ::uavcan::DataTypeKindMessage };
+    // This type has no default data type ID
+
+    static const char* getDataTypeFullName()
+    {
+        return "root_ns_b.T";
+    }
+
+    static void extendDataTypeSignature(::uavcan::DataTypeSignature& signature)
+    {
+        signature.extend(getDataTypeSignature());
+    }
+
+    static ::uavcan::DataTypeSignature getDataTypeSignature();
+
+};
+
+#if UAVCAN_PACK_STRUCTS
+UAVCAN_PACKED_END
+#endif
+
+/*
+ * Out of line struct method definitions
+ */
+
+template <int _tmpl>
+bool T_<_tmpl>::operator==(ParameterType rhs) const
+{
+    (void)rhs;
+    return true;
+}
+
+template <int _tmpl>
+bool T_<_tmpl>::isClose(ParameterType rhs) const
+{
+    (void)rhs;
+    return true;
+}
+
+template <int _tmpl>
+int T_<_tmpl>::encode(ParameterType self, ::uavcan::ScalarCodec& codec,
+    ::uavcan::TailArrayOptimizationMode tao_mode)
+{
+    (void)self;
+    (void)codec;
+    (void)tao_mode;
+    int res = 1;
+    return res;
+}
+
+template <int _tmpl>
+int T_<_tmpl>::decode(ReferenceType self, ::uavcan::ScalarCodec& codec,
+    ::uavcan::TailArrayOptimizationMode tao_mode)
+{
+    (void)self;
+    (void)codec;
+    (void)tao_mode;
+    int res = 1;
+    return res;
+}
+
+/*
+ * Out of line type method definitions
+ */
+template <int _tmpl>
+::uavcan::DataTypeSignature T_<_tmpl>::getDataTypeSignature()
+{
+    ::uavcan::DataTypeSignature signature(0xBA23E9F1F0D9F3C4ULL);
+
+    return signature;
+}
+
+/*
+ * Out of line constant definitions
+ */
+
+template <int _tmpl>
+const typename ::uavcan::StorageType< typename T_<_tmpl>::ConstantTypes::T >::Type
+    T_<_tmpl>::T = 1; // true
+
+template <int _tmpl>
+const typename ::uavcan::StorageType< typename T_<_tmpl>::ConstantTypes::F >::Type
+    T_<_tmpl>::F = 0; // false
+
+/*
+ * Final typedef
+ */
+typedef T_<0> T;
+
+// No default registration
+
+} // Namespace root_ns_b
+
+/*
+ * YAML streamer specialization
+ */
+namespace uavcan
+{
+
+template <>
+class UAVCAN_EXPORT YamlStreamer< ::root_ns_b::T >
+{
+public:
+    template <typename Stream>
+    static void stream(Stream& s, ::root_ns_b::T::ParameterType obj, const int level);
+};
+
+template <typename Stream>
+void YamlStreamer< ::root_ns_b::T >::stream(Stream& s, ::root_ns_b::T::ParameterType obj, const int level)
+{
+    (void)s;
+    (void)obj;
+    (void)level;
+}
+
+}
+
+namespace root_ns_b
+{
+
+template <typename Stream>
+inline Stream& operator<<(Stream& s, ::root_ns_b::T::ParameterType obj)
+{
+    ::uavcan::YamlStreamer< ::root_ns_b::T >::stream(s, obj, 0);
+    return s;
+}
+
+}
+
+#endif // ROOT_NS_B_T_HPP_INCLUDED
\ No newline at end of file
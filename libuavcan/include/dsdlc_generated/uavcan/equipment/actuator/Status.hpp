@@ -0,0 +1,453 @@
+/*
+ * UAVCAN data structure definition for libuavcan.
+ *
+ * Autogenerated, do not edit.
+ *
+ * Source file: /root/repo/dsdl/uavcan/equipment/actuator/600.Status.uavcan
+ */
+
+#ifndef UAVCAN_EQUIPMENT_ACTUATOR_STATUS_HPP_INCLUDED
+#define UAVCAN_EQUIPMENT_ACTUATOR_STATUS_HPP_INCLUDED
+
+#include <uavcan/build_config.hpp>
+#include <uavcan/node/global_data_type_registry.hpp>
+#include <uavcan/marshal/types.hpp>
+
+/******************************* Source text **********************************
+#
+# Generic actuator feedback, if available.
+# Unknown fields should be set to NAN.
+#
+
+uint8 actuator_id
+
+#
+# Whether the units are linear or angular depends on the actuator type (refer to the Command data type).
+#
+float16 position        # meter or radian
+float16 force           # Newton or Newton metre
+float16 speed           # meter per second or radian per second
+
+uint7 POWER_RATING_PCT_UNKNOWN = 127
+uint7 power_rating_pct                # 0 - unloaded, 100 - full load
+******************************************************************************/
+
+/********************* DSDL signature source definition ***********************
+uavcan.equipment.actuator.Status
+saturated uint8 actuator_id
+saturated float16 position
+saturated float16 force
+saturated float16 speed
+saturated uint7 power_rating_pct
+******************************************************************************/
+
+#undef actuator_id
+#undef position
+#undef force
+#undef speed
+#undef power_rating_pct
+#undef POWER_RATING_PCT_UNKNOWN
+
+#ifndef UAVCAN_PACK_STRUCTS
+# error UAVCAN_PACK_STRUCTS
+#endif
+
+namespace uavcan
+{
+namespace equipment
+{
+namespace actuator
+{
+
+#if UAVCAN_PACK_STRUCTS
+UAVCAN_PACKED_BEGIN
+#endif
+
+template <int _tmpl>
+struct UAVCAN_EXPORT Status_
+{
+    typedef const Status_<_tmpl>& ParameterType;
+    typedef Status_<_tmpl>& ReferenceType;
+
+    struct ConstantTypes
+    {
+        typedef ::uavcan::IntegerSpec< 7, ::uavcan::SignednessUnsigned, ::uavcan::CastModeSaturate > POWER_RATING_PCT_UNKNOWN;
+    };
+
+    struct FieldTypes
+    {
+        typedef ::uavcan::IntegerSpec< 8, ::uavcan::SignednessUnsigned, ::uavcan::CastModeSaturate > actuator_id;
+        typedef ::uavcan::FloatSpec< 16, ::uavcan::CastModeSaturate > position;
+        typedef ::uavcan::FloatSpec< 16, ::uavcan::CastModeSaturate > force;
+        typedef ::uavcan::FloatSpec< 16, ::uavcan::CastModeSaturate > speed;
+        typedef ::uavcan::IntegerSpec< 7, ::uavcan::SignednessUnsigned, ::uavcan::CastModeSaturate > power_rating_pct;
+    };
+
+    enum
+    {
+        MinBitLen
+            = FieldTypes::actuator_id::MinBitLen
+            + FieldTypes::position::MinBitLen
+            + FieldTypes::force::MinBitLen
+            + FieldTypes::speed::MinBitLen
+            + FieldTypes::power_rating_pct::MinBitLen
+    };
+
+    enum
+    {
+        MaxBitLen
+            = FieldTypes::actuator_id::MaxBitLen
+            + FieldTypes::position::MaxBitLen
+            + FieldTypes::force::MaxBitLen
+            + FieldTypes::speed::MaxBitLen
+            + FieldTypes::power_rating_pct::MaxBitLen
+    };
+
+    // Constants
+    static const typename ::uavcan::StorageType< typename ConstantTypes::POWER_RATING_PCT_UNKNOWN >::Type POWER_RATING_PCT_UNKNOWN; // 127
+
+    // Fields
+    typename ::uavcan::StorageType< typename FieldTypes::actuator_id >::Type actuator_id;
+    typename ::uavcan::StorageType< typename FieldTypes::position >::Type position;
+    typename ::uavcan::StorageType< typename FieldTypes::force >::Type force;
+    typename ::uavcan::StorageType< typename FieldTypes::speed >::Type speed;
+    typename ::uavcan::StorageType< typename FieldTypes::power_rating_pct >::Type power_rating_pct;
+
+    Status_()
+        : actuator_id()
+        , position()
+        , force()
+        , speed()
+        , power_rating_pct()
+    {
+        enum { MaxByteLen = ::uavcan::BitLenToByteLen<MaxBitLen>::Result };
+        ::uavcan::StaticAssert<int(MaxByteLen) <= int(::uavcan::MaxTransferPayloadLen)>::check();
+
+        ::uavcan::StaticAssert<_tmpl == 0>::check();  // Usage check
+
+#if UAVCAN_DEBUG
+        /*
+         * Cross-checking MaxBitLen provided by the DSDL compiler.
+         * This check shall never be performed in user code because MaxBitLen value
+         * actually depends on the nested types, thus it is not invariant.
+         */
+        ::uavcan::StaticAssert<63 == MaxBitLen>::check();
+#endif
+    }
+
+    bool operator==(ParameterType rhs) const;
+    bool operator!=(ParameterType rhs) const { return !operator==(rhs); }
+
+    /**
+     * This comparison is based on @ref uavcan::areClose(), which ensures proper comparison of
+     * floating point fields at any depth.
+     */
+    bool isClose(ParameterType rhs) const;
+
+    static int encode(ParameterType self, ::uavcan::ScalarCodec& codec,
+                      ::uavcan::TailArrayOptimizationMode tao_mode = ::uavcan::TailArrayOptEnabled);
+
+    static int decode(ReferenceType self, ::uavcan::ScalarCodec& codec,
+                      ::uavcan::TailArrayOptimizationMode tao_mode = ::uavcan::TailArrayOptEnabled);
+
+    /**
+     * This type has no dynamic arrays, so the bit offset of every field is a compile-time constant.
+     * Encoding and decoding are performed via a plain byte array, see uavcan/marshal/fixed_layout.hpp.
+     * The field by field codec methods implement the generic approach; they are intended for testing.
+     */
+    typedef void FixedLayoutTag;
+
+    template <unsigned BitOffset>
+    static void packFixedLayout(ParameterType self, ::uavcan::uint8_t* buf);
+
+    template <unsigned BitOffset>
+    static void unpackFixedLayout(ReferenceType self, const ::uavcan::uint8_t* buf);
+
+    static int encodeFieldByField(ParameterType self, ::uavcan::ScalarCodec& codec,
+                                  ::uavcan::TailArrayOptimizationMode tao_mode = ::uavcan::TailArrayOptEnabled);
+
+    static int decodeFieldByField(ReferenceType self, ::uavcan::ScalarCodec& codec,
+                                  ::uavcan::TailArrayOptimizationMode tao_mode = ::uavcan::TailArrayOptEnabled);
+
+    /*
+     * Static type info
+     */
+    enum { DataTypeKind = ::uavcan::DataTypeKindMessage };
+    enum { DefaultDataTypeID = 600 };
+
+    static const char* getDataTypeFullName()
+    {
+        return "uavcan.equipment.actuator.Status";
+    }
+
+    static void extendDataTypeSignature(::uavcan::DataTypeSignature& signature)
+    {
+        signature.extend(getDataTypeSignature());
+    }
+
+    static ::uavcan::DataTypeSignature getDataTypeSignature();
+
+};
+
+#if UAVCAN_PACK_STRUCTS
+UAVCAN_PACKED_END
+#endif
+
+/*
+ * Out of line struct method definitions
+ */
+
+template <int _tmpl>
+bool Status_<_tmpl>::operator==(ParameterType rhs) const
+{
+    return
+        actuator_id == rhs.actuator_id &&
+        position == rhs.position &&
+        force == rhs.force &&
+        speed == rhs.speed &&
+        power_rating_pct == rhs.power_rating_pct;
+}
+
+template <int _tmpl>
+bool Status_<_tmpl>::isClose(ParameterType rhs) const
+{
+    return
+        ::uavcan::areClose(actuator_id, rhs.actuator_id) &&
+        ::uavcan::areClose(position, rhs.position) &&
+        ::uavcan::areClose(force, rhs.force) &&
+        ::uavcan::areClose(speed, rhs.speed) &&
+        ::uavcan::areClose(power_rating_pct, rhs.power_rating_pct);
+}
+
+template <int _tmpl>
+int Status_<_tmpl>::encodeFieldByField(ParameterType self, ::uavcan::ScalarCodec& codec,
+    ::uavcan::TailArrayOptimizationMode tao_mode)
+{
+    (void)self;
+    (void)codec;
+    (void)tao_mode;
+    int res = 1;
+    res = FieldTypes::actuator_id::encode(self.actuator_id, codec,  ::uavcan::TailArrayOptDisabled);
+    if (res <= 0)
+    {
+        return res;
+    }
+    res = FieldTypes::position::encode(self.position, codec,  ::uavcan::TailArrayOptDisabled);
+    if (res <= 0)
+    {
+        return res;
+    }
+    res = FieldTypes::force::encode(self.force, codec,  ::uavcan::TailArrayOptDisabled);
+    if (res <= 0)
+    {
+        return res;
+    }
+    res = FieldTypes::speed::encode(self.speed, codec,  ::uavcan::TailArrayOptDisabled);
+    if (res <= 0)
+    {
+        return res;
+    }
+    res = FieldTypes::power_rating_pct::encode(self.power_rating_pct, codec,  tao_mode);
+    return res;
+}
+
+template <int _tmpl>
+int Status_<_tmpl>::decodeFieldByField(ReferenceType self, ::uavcan::ScalarCodec& codec,
+    ::uavcan::TailArrayOptimizationMode tao_mode)
+{
+    (void)self;
+    (void)codec;
+    (void)tao_mode;
+    int res = 1;
+    res = FieldTypes::actuator_id::decode(self.actuator_id, codec,  ::uavcan::TailArrayOptDisabled);
+    if (res <= 0)
+    {
+        return res;
+    }
+    res = FieldTypes::position::decode(self.position, codec,  ::uavcan::TailArrayOptDisabled);
+    if (res <= 0)
+    {
+        return res;
+    }
+    res = FieldTypes::force::decode(self.force, codec,  ::uavcan::TailArrayOptDisabled);
+    if (res <= 0)
+    {
+        return res;
+    }
+    res = FieldTypes::speed::decode(self.speed, codec,  ::uavcan::TailArrayOptDisabled);
+    if (res <= 0)
+    {
+        return res;
+    }
+    res = FieldTypes::power_rating_pct::decode(self.power_rating_pct, codec,  tao_mode);
+    return res;
+}
+
+template <int _tmpl>
+template <unsigned BitOffset>
+void Status_<_tmpl>::packFixedLayout(ParameterType self, ::uavcan::uint8_t* buf)
+{
+    ::uavcan::packFixedLayoutScalar< typename FieldTypes::actuator_id, BitOffset >(buf, self.actuator_id);
+    ::uavcan::packFixedLayoutScalar< typename FieldTypes::position, BitOffset + 8 >(buf, self.position);
+    ::uavcan::packFixedLayoutScalar< typename FieldTypes::force, BitOffset + 24 >(buf, self.force);
+    ::uavcan::packFixedLayoutScalar< typename FieldTypes::speed, BitOffset + 40 >(buf, self.speed);
+    ::uavcan::packFixedLayoutScalar< typename FieldTypes::power_rating_pct, BitOffset + 56 >(buf, self.power_rating_pct);
+}
+
+template <int _tmpl>
+template <unsigned BitOffset>
+void Status_<_tmpl>::unpackFixedLayout(ReferenceType self, const ::uavcan::uint8_t* buf)
+{
+    self.actuator_id = ::uavcan::unpackFixedLayoutScalar< typename FieldTypes::actuator_id, BitOffset >(buf);
+    self.position = ::uavcan::unpackFixedLayoutScalar< typename FieldTypes::position, BitOffset + 8 >(buf);
+    self.force = ::uavcan::unpackFixedLayoutScalar< typename FieldTypes::force, BitOffset + 24 >(buf);
+    self.speed = ::uavcan::unpackFixedLayoutScalar< typename FieldTypes::speed, BitOffset + 40 >(buf);
+    self.power_rating_pct = ::uavcan::unpackFixedLayoutScalar< typename FieldTypes::power_rating_pct, BitOffset + 56 >(buf);
+}
+
+template <int _tmpl>
+int Status_<_tmpl>::encode(ParameterType self, ::uavcan::ScalarCodec& codec,
+    ::uavcan::TailArrayOptimizationMode tao_mode)
+{
+    (void)tao_mode;
+    ::uavcan::uint8_t buf[::uavcan::BitLenToByteLen<MaxBitLen>::Result] = { };
+    packFixedLayout<0>(self, buf);
+    return codec.encodeBits(buf, MaxBitLen);
+}
+
+template <int _tmpl>
+int Status_<_tmpl>::decode(ReferenceType self, ::uavcan::ScalarCodec& codec,
+    ::uavcan::TailArrayOptimizationMode tao_mode)
+{
+    (void)tao_mode;
+    ::uavcan::uint8_t buf[::uavcan::BitLenToByteLen<MaxBitLen>::Result];
+    const int res = codec.decodeBits(buf, MaxBitLen);
+    if (res > 0)
+    {
+        unpackFixedLayout<0>(self, buf);
+    }
+    return res;
+}
+
+/*
+ * Out of line type method definitions
+ */
+template <int _tmpl>
+::uavcan::DataTypeSignature Status_<_tmpl>::getDataTypeSignature()
+{
+    ::uavcan::DataTypeSignature signature(0xE09186B4F837A665ULL);
+
+    FieldTypes::actuator_id::extendDataTypeSignature(signature);
+    FieldTypes::position::extendDataTypeSignature(signature);
+    FieldTypes::force::extendDataTypeSignature(signature);
+    FieldTypes::speed::extendDataTypeSignature(signature);
+    FieldTypes::power_rating_pct::extendDataTypeSignature(signature);
+
+    return signature;
+}
+
+/*
+ * Out of line constant definitions
+ */
+
+template <int _tmpl>
+const typename ::uavcan::StorageType< typename Status_<_tmpl>::ConstantTypes::POWER_RATING_PCT_UNKNOWN >::Type
+    Status_<_tmpl>::POWER_RATING_PCT_UNKNOWN = 127U; // 127
+
+/*
+ * Final typedef
+ */
+typedef Status_<0> Status;
+
+namespace
+{
+
+const ::uavcan::DefaultDataTypeRegistrator< ::uavcan::equipment::actuator::Status > _uavcan_gdtr_registrator_Status;
+
+}
+
+} // Namespace uavcan
+} // Namespace equipment
+} // Namespace actuator
+
+/*
+ * YAML streamer specialization
+ */
+namespace uavcan
+{
+
+template <>
+class UAVCAN_EXPORT YamlStreamer< ::uavcan::equipment::actuator::Status >
+{
+public:
+    template <typename Stream>
+    static void stream(Stream& s, ::uavcan::equipment::actuator::Status::ParameterType obj, const int level);
+};
+
+template <typename Stream>
+void YamlStreamer< ::uavcan::equipment::actuator::Status >::stream(Stream& s, ::uavcan::equipment::actuator::Status::ParameterType obj, const int level)
+{
+    (void)s;
+    (void)obj;
+    (void)level;
+    if (level > 0)
+    {
+        s << '\n';
+        for (int pos = 0; pos < level; pos++)
+        {
+            s << "  ";
+        }
+    }
+    s << "actuator_id: ";
+    YamlStreamer< ::uavcan::equipment::actuator::Status::FieldTypes::actuator_id >::stream(s, obj.actuator_id, level + 1);
+    s << '\n';
+    for (int pos = 0; pos < level; pos++)
+    {
+        s << "  ";
+    }
+    s << "position: ";
+    YamlStreamer< ::uavcan::equipment::actuator::Status::FieldTypes::position >::stream(s, obj.position, level + 1);
+    s << '\n';
+    for (int pos = 0; pos < level; pos++)
+    {
+        s << "  ";
+    }
+    s << "force: ";
+    YamlStreamer< ::uavcan::equipment::actuator::Status::FieldTypes::force >::stream(s, obj.force, level + 1);
+    s << '\n';
+    for (int pos = 0; pos < level; pos++)
+    {
+        s << "  ";
+    }
+    s << "speed: ";
+    YamlStreamer< ::uavcan::equipment::actuator::Status::FieldTypes::speed >::stream(s, obj.speed, level + 1);
+    s << '\n';
+    for (int pos = 0; pos < level; pos++)
+    {
+        s << "  ";
+    }
+    s << "power_rating_pct: ";
+    YamlStreamer< ::uavcan::equipment::actuator::Status::FieldTypes::power_rating_pct >::stream(s, obj.power_rating_pct, level + 1);
+}
+
+}
+
+namespace uavcan
+{
+namespace equipment
+{
+namespace actuator
+{
+
+template <typename Stream>
+inline Stream& operator<<(Stream& s, ::uavcan::equipment::actuator::Status::ParameterType obj)
+{
+    ::uavcan::YamlStreamer< ::uavcan::equipment::actuator::Status >::stream(s, obj, 0);
+    return s;
+}
+
+}
+}
+}
+
+#endif // UAVCAN_EQUIPMENT_ACTUATOR_STATUS_HPP_INCLUDED
\ No newline at end of file
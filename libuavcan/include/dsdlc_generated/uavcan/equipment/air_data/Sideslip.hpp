@@ -0,0 +1,350 @@
+/*
+ * UAVCAN data structure definition for libuavcan.
+ *
+ * Autogenerated, do not edit.
+ *
+ * Source file: /root/repo/dsdl/uavcan/equipment/air_data/296.Sideslip.uavcan
+ */
+
+#ifndef UAVCAN_EQUIPMENT_AIR_DATA_SIDESLIP_HPP_INCLUDED
+#define UAVCAN_EQUIPMENT_AIR_DATA_SIDESLIP_HPP_INCLUDED
+
+#include <uavcan/build_config.hpp>
+#include <uavcan/node/global_data_type_registry.hpp>
+#include <uavcan/marshal/types.hpp>
+
+/******************************* Source text **********************************
+#
+# Body sideslip in radians.
+# Yaw right: +, yaw left: -
+#
+
+float16 sideslip_angle          # Radians
+float16 sideslip_angle_variance # Radians^2
+******************************************************************************/
+
+/********************* DSDL signature source definition ***********************
+uavcan.equipment.air_data.Sideslip
+saturated float16 sideslip_angle
+saturated float16 sideslip_angle_variance
+******************************************************************************/
+
+#undef sideslip_angle
+#undef sideslip_angle_variance
+
+#ifndef UAVCAN_PACK_STRUCTS
+# error UAVCAN_PACK_STRUCTS
+#endif
+
+namespace uavcan
+{
+namespace equipment
+{
+namespace air_data
+{
+
+#if UAVCAN_PACK_STRUCTS
+UAVCAN_PACKED_BEGIN
+#endif
+
+template <int _tmpl>
+struct UAVCAN_EXPORT Sideslip_
+{
+    typedef const Sideslip_<_tmpl>& ParameterType;
+    typedef Sideslip_<_tmpl>& ReferenceType;
+
+    struct ConstantTypes
+    {
+    };
+
+    struct FieldTypes
+    {
+        typedef ::uavcan::FloatSpec< 16, ::uavcan::CastModeSaturate > sideslip_angle;
+        typedef ::uavcan::FloatSpec< 16, ::uavcan::CastModeSaturate > sideslip_angle_variance;
+    };
+
+    enum
+    {
+        MinBitLen
+            = FieldTypes::sideslip_angle::MinBitLen
+            + FieldTypes::sideslip_angle_variance::MinBitLen
+    };
+
+    enum
+    {
+        MaxBitLen
+            = FieldTypes::sideslip_angle::MaxBitLen
+            + FieldTypes::sideslip_angle_variance::MaxBitLen
+    };
+
+    // Constants
+
+    // Fields
+    typename ::uavcan::StorageType< typename FieldTypes::sideslip_angle >::Type sideslip_angle;
+    typename ::uavcan::StorageType< typename FieldTypes::sideslip_angle_variance >::Type sideslip_angle_variance;
+
+    Sideslip_()
+        : sideslip_angle()
+        , sideslip_angle_variance()
+    {
+        enum { MaxByteLen = ::uavcan::BitLenToByteLen<MaxBitLen>::Result };
+        ::uavcan::StaticAssert<int(MaxByteLen) <= int(::uavcan::MaxTransferPayloadLen)>::check();
+
+        ::uavcan::StaticAssert<_tmpl == 0>::check();  // Usage check
+
+#if UAVCAN_DEBUG
+        /*
+         * Cross-checking MaxBitLen provided by the DSDL compiler.
+         * This check shall never be performed in user code because MaxBitLen value
+         * actually depends on the nested types, thus it is not invariant.
+         */
+        ::uavcan::StaticAssert<32 == MaxBitLen>::check();
+#endif
+    }
+
+    bool operator==(ParameterType rhs) const;
+    bool operator!=(ParameterType rhs) const { return !operator==(rhs); }
+
+    /**
+     * This comparison is based on @ref uavcan::areClose(), which ensures proper comparison of
+     * floating point fields at any depth.
+     */
+    bool isClose(ParameterType rhs) const;
+
+    static int encode(ParameterType self, ::uavcan::ScalarCodec& codec,
+                      ::uavcan::TailArrayOptimizationMode tao_mode = ::uavcan::TailArrayOptEnabled);
+
+    static int decode(ReferenceType self, ::uavcan::ScalarCodec& codec,
+                      ::uavcan::TailArrayOptimizationMode tao_mode = ::uavcan::TailArrayOptEnabled);
+
+    /**
+     * This type has no dynamic arrays, so the bit offset of every field is a compile-time constant.
+     * Encoding and decoding are performed via a plain byte array, see uavcan/marshal/fixed_layout.hpp.
+     * The field by field codec methods implement the generic approach; they are intended for testing.
+     */
+    typedef void FixedLayoutTag;
+
+    template <unsigned BitOffset>
+    static void packFixedLayout(ParameterType self, ::uavcan::uint8_t* buf);
+
+    template <unsigned BitOffset>
+    static void unpackFixedLayout(ReferenceType self, const ::uavcan::uint8_t* buf);
+
+    static int encodeFieldByField(ParameterType self, ::uavcan::ScalarCodec& codec,
+                                  ::uavcan::TailArrayOptimizationMode tao_mode = ::uavcan::TailArrayOptEnabled);
+
+    static int decodeFieldByField(ReferenceType self, ::uavcan::ScalarCodec& codec,
+                                  ::uavcan::TailArrayOptimizationMode tao_mode = ::uavcan::TailArrayOptEnabled);
+
+    /*
+     * Static type info
+     */
+    enum { DataTypeKind = ::uavcan::DataTypeKindMessage };
+    enum { DefaultDataTypeID = 296 };
+
+    static const char* getDataTypeFullName()
+    {
+        return "uavcan.equipment.air_data.Sideslip";
+    }
+
+    static void extendDataTypeSignature(::uavcan::DataTypeSignature& signature)
+    {
+        signature.extend(getDataTypeSignature());
+    }
+
+    static ::uavcan::DataTypeSignature getDataTypeSignature();
+
+};
+
+#if UAVCAN_PACK_STRUCTS
+UAVCAN_PACKED_END
+#endif
+
+/*
+ * Out of line struct method definitions
+ */
+
+template <int _tmpl>
+bool Sideslip_<_tmpl>::operator==(ParameterType rhs) const
+{
+    return
+        sideslip_angle == rhs.sideslip_angle &&
+        sideslip_angle_variance == rhs.sideslip_angle_variance;
+}
+
+template <int _tmpl>
+bool Sideslip_<_tmpl>::isClose(ParameterType rhs) const
+{
+    return
+        ::uavcan::areClose(sideslip_angle, rhs.sideslip_angle) &&
+        ::uavcan::areClose(sideslip_angle_variance, rhs.sideslip_angle_variance);
+}
+
+template <int _tmpl>
+int Sideslip_<_tmpl>::encodeFieldByField(ParameterType self, ::uavcan::ScalarCodec& codec,
+    ::uavcan::TailArrayOptimizationMode tao_mode)
+{
+    (void)self;
+    (void)codec;
+    (void)tao_mode;
+    int res = 1;
+    res = FieldTypes::sideslip_angle::encode(self.sideslip_angle, codec,  ::uavcan::TailArrayOptDisabled);
+    if (res <= 0)
+    {
+        return res;
+    }
+    res = FieldTypes::sideslip_angle_variance::encode(self.sideslip_angle_variance, codec,  tao_mode);
+    return res;
+}
+
+template <int _tmpl>
+int Sideslip_<_tmpl>::decodeFieldByField(ReferenceType self, ::uavcan::ScalarCodec& codec,
+    ::uavcan::TailArrayOptimizationMode tao_mode)
+{
+    (void)self;
+    (void)codec;
+    (void)tao_mode;
+    int res = 1;
+    res = FieldTypes::sideslip_angle::decode(self.sideslip_angle, codec,  ::uavcan::TailArrayOptDisabled);
+    if (res <= 0)
+    {
+        return res;
+    }
+    res = FieldTypes::sideslip_angle_variance::decode(self.sideslip_angle_variance, codec,  tao_mode);
+    return res;
+}
+
+template <int _tmpl>
+template <unsigned BitOffset>
+void Sideslip_<_tmpl>::packFixedLayout(ParameterType self, ::uavcan::uint8_t* buf)
+{
+    ::uavcan::packFixedLayoutScalar< typename FieldTypes::sideslip_angle, BitOffset >(buf, self.sideslip_angle);
+    ::uavcan::packFixedLayoutScalar< typename FieldTypes::sideslip_angle_variance, BitOffset + 16 >(buf, self.sideslip_angle_variance);
+}
+
+template <int _tmpl>
+template <unsigned BitOffset>
+void Sideslip_<_tmpl>::unpackFixedLayout(ReferenceType self, const ::uavcan::uint8_t* buf)
+{
+    self.sideslip_angle = ::uavcan::unpackFixedLayoutScalar< typename FieldTypes::sideslip_angle, BitOffset >(buf);
+    self.sideslip_angle_variance = ::uavcan::unpackFixedLayoutScalar< typename FieldTypes::sideslip_angle_variance, BitOffset + 16 >(buf);
+}
+
+template <int _tmpl>
+int Sideslip_<_tmpl>::encode(ParameterType self, ::uavcan::ScalarCodec& codec,
+    ::uavcan::TailArrayOptimizationMode tao_mode)
+{
+    (void)tao_mode;
+    ::uavcan::uint8_t buf[::uavcan::BitLenToByteLen<MaxBitLen>::Result] = { };
+    packFixedLayout<0>(self, buf);
+    return codec.encodeBits(buf, MaxBitLen);
+}
+
+template <int _tmpl>
+int Sideslip_<_tmpl>::decode(ReferenceType self, ::uavcan::ScalarCodec& codec,
+    ::uavcan::TailArrayOptimizationMode tao_mode)
+{
+    (void)tao_mode;
+    ::uavcan::uint8_t buf[::uavcan::BitLenToByteLen<MaxBitLen>::Result];
+    const int res = codec.decodeBits(buf, MaxBitLen);
+    if (res > 0)
+    {
+        unpackFixedLayout<0>(self, buf);
+    }
+    return res;
+}
+
+/*
+ * Out of line type method definitions
+ */
+template <int _tmpl>
+::uavcan::DataTypeSignature Sideslip_<_tmpl>::getDataTypeSignature()
+{
+    ::uavcan::DataTypeSignature signature(0x7B48E55FCFF42A57ULL);
+
+    FieldTypes::sideslip_angle::extendDataTypeSignature(signature);
+    FieldTypes::sideslip_angle_variance::extendDataTypeSignature(signature);
+
+    return signature;
+}
+
+/*
+ * Out of line constant definitions
+ */
+
+/*
+ * Final typedef
+ */
+typedef Sideslip_<0> Sideslip;
+
+namespace
+{
+
+const ::uavcan::DefaultDataTypeRegistrator< ::uavcan::equipment::air_data::Sideslip > _uavcan_gdtr_registrator_Sideslip;
+
+}
+
+} // Namespace uavcan
+} // Namespace equipment
+} // Namespace air_data
+
+/*
+ * YAML streamer specialization
+ */
+namespace uavcan
+{
+
+template <>
+class UAVCAN_EXPORT YamlStreamer< ::uavcan::equipment::air_data::Sideslip >
+{
+public:
+    template <typename Stream>
+    static void stream(Stream& s, ::uavcan::equipment::air_data::Sideslip::ParameterType obj, const int level);
+};
+
+template <typename Stream>
+void YamlStreamer< ::uavcan::equipment::air_data::Sideslip >::stream(Stream& s, ::uavcan::equipment::air_data::Sideslip::ParameterType obj, const int level)
+{
+    (void)s;
+    (void)obj;
+    (void)level;
+    if (level > 0)
+    {
+        s << '\n';
+        for (int pos = 0; pos < level; pos++)
+        {
+            s << "  ";
+        }
+    }
+    s << "sideslip_angle: ";
+    YamlStreamer< ::uavcan::equipment::air_data::Sideslip::FieldTypes::sideslip_angle >::stream(s, obj.sideslip_angle, level + 1);
+    s << '\n';
+    for (int pos = 0; pos < level; pos++)
+    {
+        s << "  ";
+    }
+    s << "sideslip_angle_variance: ";
+    YamlStreamer< ::uavcan::equipment::air_data::Sideslip::FieldTypes::sideslip_angle_variance >::stream(s, obj.sideslip_angle_variance, level + 1);
+}
+
+}
+
+namespace uavcan
+{
+namespace equipment
+{
+namespace air_data
+{
+
+template <typename Stream>
+inline Stream& operator<<(Stream& s, ::uavcan::equipment::air_data::Sideslip::ParameterType obj)
+{
+    ::uavcan::YamlStreamer< ::uavcan::equipment::air_data::Sideslip >::stream(s, obj, 0);
+    return s;
+}
+
+}
+}
+}
+
+#endif // UAVCAN_EQUIPMENT_AIR_DATA_SIDESLIP_HPP_INCLUDED
\ No newline at end of file
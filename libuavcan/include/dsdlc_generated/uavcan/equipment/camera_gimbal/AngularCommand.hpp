@@ -0,0 +1,371 @@
+/*
+ * UAVCAN data structure definition for libuavcan.
+ *
+ * Autogenerated, do not edit.
+ *
+ * Source file: /root/repo/dsdl/uavcan/equipment/camera_gimbal/400.AngularCommand.uavcan
+ */
+
+#ifndef UAVCAN_EQUIPMENT_CAMERA_GIMBAL_ANGULARCOMMAND_HPP_INCLUDED
+#define UAVCAN_EQUIPMENT_CAMERA_GIMBAL_ANGULARCOMMAND_HPP_INCLUDED
+
+#include <uavcan/build_config.hpp>
+#include <uavcan/node/global_data_type_registry.hpp>
+#include <uavcan/marshal/types.hpp>
+
+#include <uavcan/equipment/camera_gimbal/Mode.hpp>
+
+/******************************* Source text **********************************
+#
+# Generic camera gimbal control.
+#
+# This message can only be used in the following modes:
+#  - COMMAND_MODE_ANGULAR_VELOCITY
+#  - COMMAND_MODE_ORIENTATION_FIXED_FRAME
+#  - COMMAND_MODE_ORIENTATION_BODY_FRAME
+#
+
+#
+# Target operation mode - how to handle this message.
+# See the list of acceptable modes above.
+#
+Mode mode
+
+#
+# In the angular velocity mode, this field contains a rate quaternion.
+# In the orientation mode, this field contains orientation either in fixed frame or in body frame.
+#
+float16[4] quaternion_xyzw
+******************************************************************************/
+
+/********************* DSDL signature source definition ***********************
+uavcan.equipment.camera_gimbal.AngularCommand
+uavcan.equipment.camera_gimbal.Mode mode
+saturated float16[4] quaternion_xyzw
+******************************************************************************/
+
+#undef mode
+#undef quaternion_xyzw
+
+#ifndef UAVCAN_PACK_STRUCTS
+# error UAVCAN_PACK_STRUCTS
+#endif
+
+namespace uavcan
+{
+namespace equipment
+{
+namespace camera_gimbal
+{
+
+#if UAVCAN_PACK_STRUCTS
+UAVCAN_PACKED_BEGIN
+#endif
+
+template <int _tmpl>
+struct UAVCAN_EXPORT AngularCommand_
+{
+    typedef const AngularCommand_<_tmpl>& ParameterType;
+    typedef AngularCommand_<_tmpl>& ReferenceType;
+
+    struct ConstantTypes
+    {
+    };
+
+    struct FieldTypes
+    {
+        typedef ::uavcan::equipment::camera_gimbal::Mode mode;
+        typedef ::uavcan::Array< ::uavcan::FloatSpec< 16, ::uavcan::CastModeSaturate >, ::uavcan::ArrayModeStatic, 4 > quaternion_xyzw;
+    };
+
+    enum
+    {
+        MinBitLen
+            = FieldTypes::mode::MinBitLen
+            + FieldTypes::quaternion_xyzw::MinBitLen
+    };
+
+    enum
+    {
+        MaxBitLen
+            = FieldTypes::mode::MaxBitLen
+            + FieldTypes::quaternion_xyzw::MaxBitLen
+    };
+
+    // Constants
+
+    // Fields
+    typename ::uavcan::StorageType< typename FieldTypes::mode >::Type mode;
+    typename ::uavcan::StorageType< typename FieldTypes::quaternion_xyzw >::Type quaternion_xyzw;
+
+    AngularCommand_()
+        : mode()
+        , quaternion_xyzw()
+    {
+        enum { MaxByteLen = ::uavcan::BitLenToByteLen<MaxBitLen>::Result };
+        ::uavcan::StaticAssert<int(MaxByteLen) <= int(::uavcan::MaxTransferPayloadLen)>::check();
+
+        ::uavcan::StaticAssert<_tmpl == 0>::check();  // Usage check
+
+#if UAVCAN_DEBUG
+        /*
+         * Cross-checking MaxBitLen provided by the DSDL compiler.
+         * This check shall never be performed in user code because MaxBitLen value
+         * actually depends on the nested types, thus it is not invariant.
+         */
+        ::uavcan::StaticAssert<72 == MaxBitLen>::check();
+#endif
+    }
+
+    bool operator==(ParameterType rhs) const;
+    bool operator!=(ParameterType rhs) const { return !operator==(rhs); }
+
+    /**
+     * This comparison is based on @ref uavcan::areClose(), which ensures proper comparison of
+     * floating point fields at any depth.
+     */
+    bool isClose(ParameterType rhs) const;
+
+    static int encode(ParameterType self, ::uavcan::ScalarCodec& codec,
+                      ::uavcan::TailArrayOptimizationMode tao_mode = ::uavcan::TailArrayOptEnabled);
+
+    static int decode(ReferenceType self, ::uavcan::ScalarCodec& codec,
+                      ::uavcan::TailArrayOptimizationMode tao_mode = ::uavcan::TailArrayOptEnabled);
+
+    /**
+     * This type has no dynamic arrays, so the bit offset of every field is a compile-time constant.
+     * Encoding and decoding are performed via a plain byte array, see uavcan/marshal/fixed_layout.hpp.
+     * The field by field codec methods implement the generic approach; they are intended for testing.
+     */
+    typedef void FixedLayoutTag;
+
+    template <unsigned BitOffset>
+    static void packFixedLayout(ParameterType self, ::uavcan::uint8_t* buf);
+
+    template <unsigned BitOffset>
+    static void unpackFixedLayout(ReferenceType self, const ::uavcan::uint8_t* buf);
+
+    static int encodeFieldByField(ParameterType self, ::uavcan::ScalarCodec& codec,
+                                  ::uavcan::TailArrayOptimizationMode tao_mode = ::uavcan::TailArrayOptEnabled);
+
+    static int decodeFieldByField(ReferenceType self, ::uavcan::ScalarCodec& codec,
+                                  ::uavcan::TailArrayOptimizationMode tao_mode = ::uavcan::TailArrayOptEnabled);
+
+    /*
+     * Static type info
+     */
+    enum { DataTypeKind = ::uavcan::DataTypeKindMessage };
+    enum { DefaultDataTypeID = 400 };
+
+    static const char* getDataTypeFullName()
+    {
+        return "uavcan.equipment.camera_gimbal.AngularCommand";
+    }
+
+    static void extendDataTypeSignature(::uavcan::DataTypeSignature& signature)
+    {
+        signature.extend(getDataTypeSignature());
+    }
+
+    static ::uavcan::DataTypeSignature getDataTypeSignature();
+
+};
+
+#if UAVCAN_PACK_STRUCTS
+UAVCAN_PACKED_END
+#endif
+
+/*
+ * Out of line struct method definitions
+ */
+
+template <int _tmpl>
+bool AngularCommand_<_tmpl>::operator==(ParameterType rhs) const
+{
+    return
+        mode == rhs.mode &&
+        quaternion_xyzw == rhs.quaternion_xyzw;
+}
+
+template <int _tmpl>
+bool AngularCommand_<_tmpl>::isClose(ParameterType rhs) const
+{
+    return
+        ::uavcan::areClose(mode, rhs.mode) &&
+        ::uavcan::areClose(quaternion_xyzw, rhs.quaternion_xyzw);
+}
+
+template <int _tmpl>
+int AngularCommand_<_tmpl>::encodeFieldByField(ParameterType self, ::uavcan::ScalarCodec& codec,
+    ::uavcan::TailArrayOptimizationMode tao_mode)
+{
+    (void)self;
+    (void)codec;
+    (void)tao_mode;
+    int res = 1;
+    res = FieldTypes::mode::encode(self.mode, codec,  ::uavcan::TailArrayOptDisabled);
+    if (res <= 0)
+    {
+        return res;
+    }
+    res = FieldTypes::quaternion_xyzw::encode(self.quaternion_xyzw, codec,  tao_mode);
+    return res;
+}
+
+template <int _tmpl>
+int AngularCommand_<_tmpl>::decodeFieldByField(ReferenceType self, ::uavcan::ScalarCodec& codec,
+    ::uavcan::TailArrayOptimizationMode tao_mode)
+{
+    (void)self;
+    (void)codec;
+    (void)tao_mode;
+    int res = 1;
+    res = FieldTypes::mode::decode(self.mode, codec,  ::uavcan::TailArrayOptDisabled);
+    if (res <= 0)
+    {
+        return res;
+    }
+    res = FieldTypes::quaternion_xyzw::decode(self.quaternion_xyzw, codec,  tao_mode);
+    return res;
+}
+
+template <int _tmpl>
+template <unsigned BitOffset>
+void AngularCommand_<_tmpl>::packFixedLayout(ParameterType self, ::uavcan::uint8_t* buf)
+{
+    FieldTypes::mode::template packFixedLayout< BitOffset >(self.mode, buf);
+    ::uavcan::packFixedLayoutScalar< typename FieldTypes::quaternion_xyzw::RawValueType, BitOffset + 8 >(buf, self.quaternion_xyzw[0]);
+    ::uavcan::packFixedLayoutScalar< typename FieldTypes::quaternion_xyzw::RawValueType, BitOffset + 24 >(buf, self.quaternion_xyzw[1]);
+    ::uavcan::packFixedLayoutScalar< typename FieldTypes::quaternion_xyzw::RawValueType, BitOffset + 40 >(buf, self.quaternion_xyzw[2]);
+    ::uavcan::packFixedLayoutScalar< typename FieldTypes::quaternion_xyzw::RawValueType, BitOffset + 56 >(buf, self.quaternion_xyzw[3]);
+}
+
+template <int _tmpl>
+template <unsigned BitOffset>
+void AngularCommand_<_tmpl>::unpackFixedLayout(ReferenceType self, const ::uavcan::uint8_t* buf)
+{
+    FieldTypes::mode::template unpackFixedLayout< BitOffset >(self.mode, buf);
+    self.quaternion_xyzw[0] = ::uavcan::unpackFixedLayoutScalar< typename FieldTypes::quaternion_xyzw::RawValueType, BitOffset + 8 >(buf);
+    self.quaternion_xyzw[1] = ::uavcan::unpackFixedLayoutScalar< typename FieldTypes::quaternion_xyzw::RawValueType, BitOffset + 24 >(buf);
+    self.quaternion_xyzw[2] = ::uavcan::unpackFixedLayoutScalar< typename FieldTypes::quaternion_xyzw::RawValueType, BitOffset + 40 >(buf);
+    self.quaternion_xyzw[3] = ::uavcan::unpackFixedLayoutScalar< typename FieldTypes::quaternion_xyzw::RawValueType, BitOffset + 56 >(buf);
+}
+
+template <int _tmpl>
+int AngularCommand_<_tmpl>::encode(ParameterType self, ::uavcan::ScalarCodec& codec,
+    ::uavcan::TailArrayOptimizationMode tao_mode)
+{
+    (void)tao_mode;
+    ::uavcan::uint8_t buf[::uavcan::BitLenToByteLen<MaxBitLen>::Result] = { };
+    packFixedLayout<0>(self, buf);
+    return codec.encodeBits(buf, MaxBitLen);
+}
+
+template <int _tmpl>
+int AngularCommand_<_tmpl>::decode(ReferenceType self, ::uavcan::ScalarCodec& codec,
+    ::uavcan::TailArrayOptimizationMode tao_mode)
+{
+    (void)tao_mode;
+    ::uavcan::uint8_t buf[::uavcan::BitLenToByteLen<MaxBitLen>::Result];
+    const int res = codec.decodeBits(buf, MaxBitLen);
+    if (res > 0)
+    {
+        unpackFixedLayout<0>(self, buf);
+    }
+    return res;
+}
+
+/*
+ * Out of line type method definitions
+ */
+template <int _tmpl>
+::uavcan::DataTypeSignature AngularCommand_<_tmpl>::getDataTypeSignature()
+{
+    ::uavcan::DataTypeSignature signature(0xB291EB191A5BC8CEULL);
+
+    FieldTypes::mode::extendDataTypeSignature(signature);
+    FieldTypes::quaternion_xyzw::extendDataTypeSignature(signature);
+
+    return signature;
+}
+
+/*
+ * Out of line constant definitions
+ */
+
+/*
+ * Final typedef
+ */
+typedef AngularCommand_<0> AngularCommand;
+
+namespace
+{
+
+const ::uavcan::DefaultDataTypeRegistrator< ::uavcan::equipment::camera_gimbal::AngularCommand > _uavcan_gdtr_registrator_AngularCommand;
+
+}
+
+} // Namespace uavcan
+} // Namespace equipment
+} // Namespace camera_gimbal
+
+/*
+ * YAML streamer specialization
+ */
+namespace uavcan
+{
+
+template <>
+class UAVCAN_EXPORT YamlStreamer< ::uavcan::equipment::camera_gimbal::AngularCommand >
+{
+public:
+    template <typename Stream>
+    static void stream(Stream& s, ::uavcan::equipment::camera_gimbal::AngularCommand::ParameterType obj, const int level);
+};
+
+template <typename Stream>
+void YamlStreamer< ::uavcan::equipment::camera_gimbal::AngularCommand >::stream(Stream& s, ::uavcan::equipment::camera_gimbal::AngularCommand::ParameterType obj, const int level)
+{
+    (void)s;
+    (void)obj;
+    (void)level;
+    if (level > 0)
+    {
+        s << '\n';
+        for (int pos = 0; pos < level; pos++)
+        {
+            s << "  ";
+        }
+    }
+    s << "mode: ";
+    YamlStreamer< ::uavcan::equipment::camera_gimbal::AngularCommand::FieldTypes::mode >::stream(s, obj.mode, level + 1);
+    s << '\n';
+    for (int pos = 0; pos < level; pos++)
+    {
+        s << "  ";
+    }
+    s << "quaternion_xyzw: ";
+    YamlStreamer< ::uavcan::equipment::camera_gimbal::AngularCommand::FieldTypes::quaternion_xyzw >::stream(s, obj.quaternion_xyzw, level + 1);
+}
+
+}
+
+namespace uavcan
+{
+namespace equipment
+{
+namespace camera_gimbal
+{
+
+template <typename Stream>
+inline Stream& operator<<(Stream& s, ::uavcan::equipment::camera_gimbal::AngularCommand::ParameterType obj)
+{
+    ::uavcan::YamlStreamer< ::uavcan::equipment::camera_gimbal::AngularCommand >::stream(s, obj, 0);
+    return s;
+}
+
+}
+}
+}
+
+#endif // UAVCAN_EQUIPMENT_CAMERA_GIMBAL_ANGULARCOMMAND_HPP_INCLUDED
\ No newline at end of file
@@ -0,0 +1,263 @@
+/*
+ * UAVCAN data structure definition for libuavcan.
+ *
+ * Autogenerated, do not edit.
+ *
+ * Source file: /root/repo/dsdl/uavcan/equipment/gnss/745.RTCMStream.uavcan
+ */
+
+#ifndef UAVCAN_EQUIPMENT_GNSS_RTCMSTREAM_HPP_INCLUDED
+#define UAVCAN_EQUIPMENT_GNSS_RTCMSTREAM_HPP_INCLUDED
+
+#include <uavcan/build_config.hpp>
+#include <uavcan/node/global_data_type_registry.hpp>
+#include <uavcan/marshal/types.hpp>
+
+/******************************* Source text **********************************
+#
+# GNSS RTCM SC-104 protocol raw stream container.
+# RTCM messages that are longer than max data size can be split over multiple consecutive messages.
+#
+
+uint8[<=400] data
+******************************************************************************/
+
+/********************* DSDL signature source definition ***********************
+uavcan.equipment.gnss.RTCMStream
+saturated uint8[<=400] data
+******************************************************************************/
+
+#undef data
+
+#ifndef UAVCAN_PACK_STRUCTS
+# error UAVCAN_PACK_STRUCTS
+#endif
+
+namespace uavcan
+{
+namespace equipment
+{
+namespace gnss
+{
+
+#if UAVCAN_PACK_STRUCTS
+UAVCAN_PACKED_BEGIN
+#endif
+
+template <int _tmpl>
+struct UAVCAN_EXPORT RTCMStream_
+{
+    typedef const RTCMStream_<_tmpl>& ParameterType;
+    typedef RTCMStream_<_tmpl>& ReferenceType;
+
+    struct ConstantTypes
+    {
+    };
+
+    struct FieldTypes
+    {
+        typedef ::uavcan::Array< ::uavcan::IntegerSpec< 8, ::uavcan::SignednessUnsigned, ::uavcan::CastModeSaturate >, ::uavcan::ArrayModeDynamic, 400 > data;
+    };
+
+    enum
+    {
+        MinBitLen
+            = FieldTypes::data::MinBitLen
+    };
+
+    enum
+    {
+        MaxBitLen
+            = FieldTypes::data::MaxBitLen
+    };
+
+    // Constants
+
+    // Fields
+    typename ::uavcan::StorageType< typename FieldTypes::data >::Type data;
+
+    RTCMStream_()
+        : data()
+    {
+        enum { MaxByteLen = ::uavcan::BitLenToByteLen<MaxBitLen>::Result };
+        ::uavcan::StaticAssert<int(MaxByteLen) <= int(::uavcan::MaxTransferPayloadLen)>::check();
+
+        ::uavcan::StaticAssert<_tmpl == 0>::check();  // Usage check
+
+#if UAVCAN_DEBUG
+        /*
+         * Cross-checking MaxBitLen provided by the DSDL compiler.
+         * This check shall never be performed in user code because MaxBitLen value
+         * actually depends on the nested types, thus it is not invariant.
+         */
+        ::uavcan::StaticAssert<3209 == MaxBitLen>::check();
+#endif
+    }
+
+    bool operator==(ParameterType rhs) const;
+    bool operator!=(ParameterType rhs) const { return !operator==(rhs); }
+
+    /**
+     * This comparison is based on @ref uavcan::areClose(), which ensures proper comparison of
+     * floating point fields at any depth.
+     */
+    bool isClose(ParameterType rhs) const;
+
+    static int encode(ParameterType self, ::uavcan::ScalarCodec& codec,
+                      ::uavcan::TailArrayOptimizationMode tao_mode = ::uavcan::TailArrayOptEnabled);
+
+    static int decode(ReferenceType self, ::uavcan::ScalarCodec& codec,
+                      ::uavcan::TailArrayOptimizationMode tao_mode = ::uavcan::TailArrayOptEnabled);
+
+    /*
+     * Static type info
+     */
+    enum { DataTypeKind = ::uavcan::DataTypeKindMessage };
+    enum { DefaultDataTypeID = 745 };
+
+    static const char* getDataTypeFullName()
+    {
+        return "uavcan.equipment.gnss.RTCMStream";
+    }
+
+    static void extendDataTypeSignature(::uavcan::DataTypeSignature& signature)
+    {
+        signature.extend(getDataTypeSignature());
+    }
+
+    static ::uavcan::DataTypeSignature getDataTypeSignature();
+
+};
+
+#if UAVCAN_PACK_STRUCTS
+UAVCAN_PACKED_END
+#endif
+
+/*
+ * Out of line struct method definitions
+ */
+
+template <int _tmpl>
+bool RTCMStream_<_tmpl>::operator==(ParameterType rhs) const
+{
+    return
+        data == rhs.data;
+}
+
+template <int _tmpl>
+bool RTCMStream_<_tmpl>::isClose(ParameterType rhs) const
+{
+    return
+        ::uavcan::areClose(data, rhs.data);
+}
+
+template <int _tmpl>
+int RTCMStream_<_tmpl>::encode(ParameterType self, ::uavcan::ScalarCodec& codec,
+    ::uavcan::TailArrayOptimizationMode tao_mode)
+{
+    (void)self;
+    (void)codec;
+    (void)tao_mode;
+    int res = 1;
+    res = FieldTypes::data::encode(self.data, codec,  tao_mode);
+    return res;
+}
+
+template <int _tmpl>
+int RTCMStream_<_tmpl>::decode(ReferenceType self, ::uavcan::ScalarCodec& codec,
+    ::uavcan::TailArrayOptimizationMode tao_mode)
+{
+    (void)self;
+    (void)codec;
+    (void)tao_mode;
+    int res = 1;
+    res = FieldTypes::data::decode(self.data, codec,  tao_mode);
+    return res;
+}
+
+/*
+ * Out of line type method definitions
+ */
+template <int _tmpl>
+::uavcan::DataTypeSignature RTCMStream_<_tmpl>::getDataTypeSignature()
+{
+    ::uavcan::DataTypeSignature signature(0xD772595160C3D272ULL);
+
+    FieldTypes::data::extendDataTypeSignature(signature);
+
+    return signature;
+}
+
+/*
+ * Out of line constant definitions
+ */
+
+/*
+ * Final typedef
+ */
+typedef RTCMStream_<0> RTCMStream;
+
+namespace
+{
+
+const ::uavcan::DefaultDataTypeRegistrator< ::uavcan::equipment::gnss::RTCMStream > _uavcan_gdtr_registrator_RTCMStream;
+
+}
+
+} // Namespace uavcan
+} // Namespace equipment
+} // Namespace gnss
+
+/*
+ * YAML streamer specialization
+ */
+namespace uavcan
+{
+
+template <>
+class UAVCAN_EXPORT YamlStreamer< ::uavcan::equipment::gnss::RTCMStream >
+{
+public:
+    template <typename Stream>
+    static void stream(Stream& s, ::uavcan::equipment::gnss::RTCMStream::ParameterType obj, const int level);
+};
+
+template <typename Stream>
+void YamlStreamer< ::uavcan::equipment::gnss::RTCMStream >::stream(Stream& s, ::uavcan::equipment::gnss::RTCMStream::ParameterType obj, const int level)
+{
+    (void)s;
+    (void)obj;
+    (void)level;
+    if (level > 0)
+    {
+        s << '\n';
+        for (int pos = 0; pos < level; pos++)
+        {
+            s << "  ";
+        }
+    }
+    s << "data: ";
+    YamlStreamer< ::uavcan::equipment::gnss::RTCMStream::FieldTypes::data >::stream(s, obj.data, level + 1);
+}
+
+}
+
+namespace uavcan
+{
+namespace equipment
+{
+namespace gnss
+{
+
+template <typename Stream>
+inline Stream& operator<<(Stream& s, ::uavcan::equipment::gnss::RTCMStream::ParameterType obj)
+{
+    ::uavcan::YamlStreamer< ::uavcan::equipment::gnss::RTCMStream >::stream(s, obj, 0);
+    return s;
+}
+
+}
+}
+}
+
+#endif // UAVCAN_EQUIPMENT_GNSS_RTCMSTREAM_HPP_INCLUDED
\ No newline at end of file
@@ -0,0 +1,572 @@
+/*
+ * UAVCAN data structure definition for libuavcan.
+ *
+ * Autogenerated, do not edit.
+ *
+ * Source file: /root/repo/dsdl/uavcan/equipment/range_sensor/380.RangeMeasurement.uavcan
+ */
+
+#ifndef UAVCAN_EQUIPMENT_RANGE_SENSOR_RANGEMEASUREMENT_HPP_INCLUDED
+#define UAVCAN_EQUIPMENT_RANGE_SENSOR_RANGEMEASUREMENT_HPP_INCLUDED
+
+#include <uavcan/build_config.hpp>
+#include <uavcan/node/global_data_type_registry.hpp>
+#include <uavcan/marshal/types.hpp>
+
+#include <uavcan/Timestamp.hpp>
+#include <uavcan/equipment/CoarseOrientation.hpp>
+
+/******************************* Source text **********************************
+#
+# Generic narrow-beam range sensor data.
+#
+
+uavcan.Timestamp timestamp
+
+uint8 sensor_id
+
+uavcan.equipment.CoarseOrientation beam_orientation   # In body frame
+
+float16 field_of_view                # Radians
+
+uint5 SENSOR_TYPE_UNDEFINED = 0
+uint5 SENSOR_TYPE_SONAR     = 1
+uint5 SENSOR_TYPE_LIDAR     = 2
+uint5 SENSOR_TYPE_RADAR     = 3
+uint5 sensor_type
+
+uint3 READING_TYPE_UNDEFINED   = 0   # Range is unknown
+uint3 READING_TYPE_VALID_RANGE = 1   # Range field contains valid distance
+uint3 READING_TYPE_TOO_CLOSE   = 2   # Range field contains min range for the sensor
+uint3 READING_TYPE_TOO_FAR     = 3   # Range field contains max range for the sensor
+uint3 reading_type
+
+float16 range                        # Meters
+******************************************************************************/
+
+/********************* DSDL signature source definition ***********************
+uavcan.equipment.range_sensor.RangeMeasurement
+uavcan.Timestamp timestamp
+saturated uint8 sensor_id
+uavcan.equipment.CoarseOrientation beam_orientation
+saturated float16 field_of_view
+saturated uint5 sensor_type
+saturated uint3 reading_type
+saturated float16 range
+******************************************************************************/
+
+#undef timestamp
+#undef sensor_id
+#undef beam_orientation
+#undef field_of_view
+#undef sensor_type
+#undef reading_type
+#undef range
+#undef SENSOR_TYPE_UNDEFINED
+#undef SENSOR_TYPE_SONAR
+#undef SENSOR_TYPE_LIDAR
+#undef SENSOR_TYPE_RADAR
+#undef READING_TYPE_UNDEFINED
+#undef READING_TYPE_VALID_RANGE
+#undef READING_TYPE_TOO_CLOSE
+#undef READING_TYPE_TOO_FAR
+
+#ifndef UAVCAN_PACK_STRUCTS
+# error UAVCAN_PACK_STRUCTS
+#endif
+
+namespace uavcan
+{
+namespace equipment
+{
+namespace range_sensor
+{
+
+#if UAVCAN_PACK_STRUCTS
+UAVCAN_PACKED_BEGIN
+#endif
+
+template <int _tmpl>
+struct UAVCAN_EXPORT RangeMeasurement_
+{
+    typedef const RangeMeasurement_<_tmpl>& ParameterType;
+    typedef RangeMeasurement_<_tmpl>& ReferenceType;
+
+    struct ConstantTypes
+    {
+        typedef ::uavcan::IntegerSpec< 5, ::uavcan::SignednessUnsigned, ::uavcan::CastModeSaturate > SENSOR_TYPE_UNDEFINED;
+        typedef ::uavcan::IntegerSpec< 5, ::uavcan::SignednessUnsigned, ::uavcan::CastModeSaturate > SENSOR_TYPE_SONAR;
+        typedef ::uavcan::IntegerSpec< 5, ::uavcan::SignednessUnsigned, ::uavcan::CastModeSaturate > SENSOR_TYPE_LIDAR;
+        typedef ::uavcan::IntegerSpec< 5, ::uavcan::SignednessUnsigned, ::uavcan::CastModeSaturate > SENSOR_TYPE_RADAR;
+        typedef ::uavcan::IntegerSpec< 3, ::uavcan::SignednessUnsigned, ::uavcan::CastModeSaturate > READING_TYPE_UNDEFINED;
+        typedef ::uavcan::IntegerSpec< 3, ::uavcan::SignednessUnsigned, ::uavcan::CastModeSaturate > READING_TYPE_VALID_RANGE;
+        typedef ::uavcan::IntegerSpec< 3, ::uavcan::SignednessUnsigned, ::uavcan::CastModeSaturate > READING_TYPE_TOO_CLOSE;
+        typedef ::uavcan::IntegerSpec< 3, ::uavcan::SignednessUnsigned, ::uavcan::CastModeSaturate > READING_TYPE_TOO_FAR;
+    };
+
+    struct FieldTypes
+    {
+        typedef ::uavcan::Timestamp timestamp;
+        typedef ::uavcan::IntegerSpec< 8, ::uavcan::SignednessUnsigned, ::uavcan::CastModeSaturate > sensor_id;
+        typedef ::uavcan::equipment::CoarseOrientation beam_orientation;
+        typedef ::uavcan::FloatSpec< 16, ::uavcan::CastModeSaturate > field_of_view;
+        typedef ::uavcan::IntegerSpec< 5, ::uavcan::SignednessUnsigned, ::uavcan::CastModeSaturate > sensor_type;
+        typedef ::uavcan::IntegerSpec< 3, ::uavcan::SignednessUnsigned, ::uavcan::CastModeSaturate > reading_type;
+        typedef ::uavcan::FloatSpec< 16, ::uavcan::CastModeSaturate > range;
+    };
+
+    enum
+    {
+        MinBitLen
+            = FieldTypes::timestamp::MinBitLen
+            + FieldTypes::sensor_id::MinBitLen
+            + FieldTypes::beam_orientation::MinBitLen
+            + FieldTypes::field_of_view::MinBitLen
+            + FieldTypes::sensor_type::MinBitLen
+            + FieldTypes::reading_type::MinBitLen
+            + FieldTypes::range::MinBitLen
+    };
+
+    enum
+    {
+        MaxBitLen
+            = FieldTypes::timestamp::MaxBitLen
+            + FieldTypes::sensor_id::MaxBitLen
+            + FieldTypes::beam_orientation::MaxBitLen
+            + FieldTypes::field_of_view::MaxBitLen
+            + FieldTypes::sensor_type::MaxBitLen
+            + FieldTypes::reading_type::MaxBitLen
+            + FieldTypes::range::MaxBitLen
+    };
+
+    // Constants
+    static const typename ::uavcan::StorageType< typename ConstantTypes::SENSOR_TYPE_UNDEFINED >::Type SENSOR_TYPE_UNDEFINED; // 0
+    static const typename ::uavcan::StorageType< typename ConstantTypes::SENSOR_TYPE_SONAR >::Type SENSOR_TYPE_SONAR; // 1
+    static const typename ::uavcan::StorageType< typename ConstantTypes::SENSOR_TYPE_LIDAR >::Type SENSOR_TYPE_LIDAR; // 2
+    static const typename ::uavcan::StorageType< typename ConstantTypes::SENSOR_TYPE_RADAR >::Type SENSOR_TYPE_RADAR; // 3
+    static const typename ::uavcan::StorageType< typename ConstantTypes::READING_TYPE_UNDEFINED >::Type READING_TYPE_UNDEFINED; // 0
+    static const typename ::uavcan::StorageType< typename ConstantTypes::READING_TYPE_VALID_RANGE >::Type READING_TYPE_VALID_RANGE; // 1
+    static const typename ::uavcan::StorageType< typename ConstantTypes::READING_TYPE_TOO_CLOSE >::Type READING_TYPE_TOO_CLOSE; // 2
+    static const typename ::uavcan::StorageType< typename ConstantTypes::READING_TYPE_TOO_FAR >::Type READING_TYPE_TOO_FAR; // 3
+
+    // Fields
+    typename ::uavcan::StorageType< typename FieldTypes::timestamp >::Type timestamp;
+    typename ::uavcan::StorageType< typename FieldTypes::sensor_id >::Type sensor_id;
+    typename ::uavcan::StorageType< typename FieldTypes::beam_orientation >::Type beam_orientation;
+    typename ::uavcan::StorageType< typename FieldTypes::field_of_view >::Type field_of_view;
+    typename ::uavcan::StorageType< typename FieldTypes::sensor_type >::Type sensor_type;
+    typename ::uavcan::StorageType< typename FieldTypes::reading_type >::Type reading_type;
+    typename ::uavcan::StorageType< typename FieldTypes::range >::Type range;
+
+    RangeMeasurement_()
+        : timestamp()
+        , sensor_id()
+        , beam_orientation()
+        , field_of_view()
+        , sensor_type()
+        , reading_type()
+        , range()
+    {
+        enum { MaxByteLen = ::uavcan::BitLenToByteLen<MaxBitLen>::Result };
+        ::uavcan::StaticAssert<int(MaxByteLen) <= int(::uavcan::MaxTransferPayloadLen)>::check();
+
+        ::uavcan::StaticAssert<_tmpl == 0>::check();  // Usage check
+
+#if UAVCAN_DEBUG
+        /*
+         * Cross-checking MaxBitLen provided by the DSDL compiler.
+         * This check shall never be performed in user code because MaxBitLen value
+         * actually depends on the nested types, thus it is not invariant.
+         */
+        ::uavcan::StaticAssert<112 == MaxBitLen>::check();
+#endif
+    }
+
+    bool operator==(ParameterType rhs) const;
+    bool operator!=(ParameterType rhs) const { return !operator==(rhs); }
+
+    /**
+     * This comparison is based on @ref uavcan::areClose(), which ensures proper comparison of
+     * floating point fields at any depth.
+     */
+    bool isClose(ParameterType rhs) const;
+
+    static int encode(ParameterType self, ::uavcan::ScalarCodec& codec,
+                      ::uavcan::TailArrayOptimizationMode tao_mode = ::uavcan::TailArrayOptEnabled);
+
+    static int decode(ReferenceType self, ::uavcan::ScalarCodec& codec,
+                      ::uavcan::TailArrayOptimizationMode tao_mode = ::uavcan::TailArrayOptEnabled);
+
+    /**
+     * This type has no dynamic arrays, so the bit offset of every field is a compile-time constant.
+     * Encoding and decoding are performed via a plain byte array, see uavcan/marshal/fixed_layout.hpp.
+     * The field by field codec methods implement the generic approach; they are intended for testing.
+     */
+    typedef void FixedLayoutTag;
+
+    template <unsigned BitOffset>
+    static void packFixedLayout(ParameterType self, ::uavcan::uint8_t* buf);
+
+    template <unsigned BitOffset>
+    static void unpackFixedLayout(ReferenceType self, const ::uavcan::uint8_t* buf);
+
+    static int encodeFieldByField(ParameterType self, ::uavcan::ScalarCodec& codec,
+                                  ::uavcan::TailArrayOptimizationMode tao_mode = ::uavcan::TailArrayOptEnabled);
+
+    static int decodeFieldByField(ReferenceType self, ::uavcan::ScalarCodec& codec,
+                                  ::uavcan::TailArrayOptimizationMode tao_mode = ::uavcan::TailArrayOptEnabled);
+
+    /*
+     * Static type info
+     */
+    enum { DataTypeKind = ::uavcan::DataTypeKindMessage };
+    enum { DefaultDataTypeID = 380 };
+
+    static const char* getDataTypeFullName()
+    {
+        return "uavcan.equipment.range_sensor.RangeMeasurement";
+    }
+
+    static void extendDataTypeSignature(::uavcan::DataTypeSignature& signature)
+    {
+        signature.extend(getDataTypeSignature());
+    }
+
+    static ::uavcan::DataTypeSignature getDataTypeSignature();
+
+};
+
+#if UAVCAN_PACK_STRUCTS
+UAVCAN_PACKED_END
+#endif
+
+/*
+ * Out of line struct method definitions
+ */
+
+template <int _tmpl>
+bool RangeMeasurement_<_tmpl>::operator==(ParameterType rhs) const
+{
+    return
+        timestamp == rhs.timestamp &&
+        sensor_id == rhs.sensor_id &&
+        beam_orientation == rhs.beam_orientation &&
+        field_of_view == rhs.field_of_view &&
+        sensor_type == rhs.sensor_type &&
+        reading_type == rhs.reading_type &&
+        range == rhs.range;
+}
+
+template <int _tmpl>
+bool RangeMeasurement_<_tmpl>::isClose(ParameterType rhs) const
+{
+    return
+        ::uavcan::areClose(timestamp, rhs.timestamp) &&
+        ::uavcan::areClose(sensor_id, rhs.sensor_id) &&
+        ::uavcan::areClose(beam_orientation, rhs.beam_orientation) &&
+        ::uavcan::areClose(field_of_view, rhs.field_of_view) &&
+        ::uavcan::areClose(sensor_type, rhs.sensor_type) &&
+        ::uavcan::areClose(reading_type, rhs.reading_type) &&
+        ::uavcan::areClose(range, rhs.range);
+}
+
+template <int _tmpl>
+int RangeMeasurement_<_tmpl>::encodeFieldByField(ParameterType self, ::uavcan::ScalarCodec& codec,
+    ::uavcan::TailArrayOptimizationMode tao_mode)
+{
+    (void)self;
+    (void)codec;
+    (void)tao_mode;
+    int res = 1;
+    res = FieldTypes::timestamp::encode(self.timestamp, codec,  ::uavcan::TailArrayOptDisabled);
+    if (res <= 0)
+    {
+        return res;
+    }
+    res = FieldTypes::sensor_id::encode(self.sensor_id, codec,  ::uavcan::TailArrayOptDisabled);
+    if (res <= 0)
+    {
+        return res;
+    }
+    res = FieldTypes::beam_orientation::encode(self.beam_orientation, codec,  ::uavcan::TailArrayOptDisabled);
+    if (res <= 0)
+    {
+        return res;
+    }
+    res = FieldTypes::field_of_view::encode(self.field_of_view, codec,  ::uavcan::TailArrayOptDisabled);
+    if (res <= 0)
+    {
+        return res;
+    }
+    res = FieldTypes::sensor_type::encode(self.sensor_type, codec,  ::uavcan::TailArrayOptDisabled);
+    if (res <= 0)
+    {
+        return res;
+    }
+    res = FieldTypes::reading_type::encode(self.reading_type, codec,  ::uavcan::TailArrayOptDisabled);
+    if (res <= 0)
+    {
+        return res;
+    }
+    res = FieldTypes::range::encode(self.range, codec,  tao_mode);
+    return res;
+}
+
+template <int _tmpl>
+int RangeMeasurement_<_tmpl>::decodeFieldByField(ReferenceType self, ::uavcan::ScalarCodec& codec,
+    ::uavcan::TailArrayOptimizationMode tao_mode)
+{
+    (void)self;
+    (void)codec;
+    (void)tao_mode;
+    int res = 1;
+    res = FieldTypes::timestamp::decode(self.timestamp, codec,  ::uavcan::TailArrayOptDisabled);
+    if (res <= 0)
+    {
+        return res;
+    }
+    res = FieldTypes::sensor_id::decode(self.sensor_id, codec,  ::uavcan::TailArrayOptDisabled);
+    if (res <= 0)
+    {
+        return res;
+    }
+    res = FieldTypes::beam_orientation::decode(self.beam_orientation, codec,  ::uavcan::TailArrayOptDisabled);
+    if (res <= 0)
+    {
+        return res;
+    }
+    res = FieldTypes::field_of_view::decode(self.field_of_view, codec,  ::uavcan::TailArrayOptDisabled);
+    if (res <= 0)
+    {
+        return res;
+    }
+    res = FieldTypes::sensor_type::decode(self.sensor_type, codec,  ::uavcan::TailArrayOptDisabled);
+    if (res <= 0)
+    {
+        return res;
+    }
+    res = FieldTypes::reading_type::decode(self.reading_type, codec,  ::uavcan::TailArrayOptDisabled);
+    if (res <= 0)
+    {
+        return res;
+    }
+    res = FieldTypes::range::decode(self.range, codec,  tao_mode);
+    return res;
+}
+
+template <int _tmpl>
+template <unsigned BitOffset>
+void RangeMeasurement_<_tmpl>::packFixedLayout(ParameterType self, ::uavcan::uint8_t* buf)
+{
+    FieldTypes::timestamp::template packFixedLayout< BitOffset >(self.timestamp, buf);
+    ::uavcan::packFixedLayoutScalar< typename FieldTypes::sensor_id, BitOffset + 48 >(buf, self.sensor_id);
+    FieldTypes::beam_orientation::template packFixedLayout< BitOffset + 56 >(self.beam_orientation, buf);
+    ::uavcan::packFixedLayoutScalar< typename FieldTypes::field_of_view, BitOffset + 72 >(buf, self.field_of_view);
+    ::uavcan::packFixedLayoutScalar< typename FieldTypes::sensor_type, BitOffset + 88 >(buf, self.sensor_type);
+    ::uavcan::packFixedLayoutScalar< typename FieldTypes::reading_type, BitOffset + 93 >(buf, self.reading_type);
+    ::uavcan::packFixedLayoutScalar< typename FieldTypes::range, BitOffset + 96 >(buf, self.range);
+}
+
+template <int _tmpl>
+template <unsigned BitOffset>
+void RangeMeasurement_<_tmpl>::unpackFixedLayout(ReferenceType self, const ::uavcan::uint8_t* buf)
+{
+    FieldTypes::timestamp::template unpackFixedLayout< BitOffset >(self.timestamp, buf);
+    self.sensor_id = ::uavcan::unpackFixedLayoutScalar< typename FieldTypes::sensor_id, BitOffset + 48 >(buf);
+    FieldTypes::beam_orientation::template unpackFixedLayout< BitOffset + 56 >(self.beam_orientation, buf);
+    self.field_of_view = ::uavcan::unpackFixedLayoutScalar< typename FieldTypes::field_of_view, BitOffset + 72 >(buf);
+    self.sensor_type = ::uavcan::unpackFixedLayoutScalar< typename FieldTypes::sensor_type, BitOffset + 88 >(buf);
+    self.reading_type = ::uavcan::unpackFixedLayoutScalar< typename FieldTypes::reading_type, BitOffset + 93 >(buf);
+    self.range = ::uavcan::unpackFixedLayoutScalar< typename FieldTypes::range, BitOffset + 96 >(buf);
+}
+
+template <int _tmpl>
+int RangeMeasurement_<_tmpl>::encode(ParameterType self, ::uavcan::ScalarCodec& codec,
+    ::uavcan::TailArrayOptimizationMode tao_mode)
+{
+    (void)tao_mode;
+    ::uavcan::uint8_t buf[::uavcan::BitLenToByteLen<MaxBitLen>::Result] = { };
+    packFixedLayout<0>(self, buf);
+    return codec.encodeBits(buf, MaxBitLen);
+}
+
+template <int _tmpl>
+int RangeMeasurement_<_tmpl>::decode(ReferenceType self, ::uavcan::ScalarCodec& codec,
+    ::uavcan::TailArrayOptimizationMode tao_mode)
+{
+    (void)tao_mode;
+    ::uavcan::uint8_t buf[::uavcan::BitLenToByteLen<MaxBitLen>::Result];
+    const int res = codec.decodeBits(buf, MaxBitLen);
+    if (res > 0)
+    {
+        unpackFixedLayout<0>(self, buf);
+    }
+    return res;
+}
+
+/*
+ * Out of line type method definitions
+ */
+template <int _tmpl>
+::uavcan::DataTypeSignature RangeMeasurement_<_tmpl>::getDataTypeSignature()
+{
+    ::uavcan::DataTypeSignature signature(0x5C1EAC11D52D152DULL);
+
+    FieldTypes::timestamp::extendDataTypeSignature(signature);
+    FieldTypes::sensor_id::extendDataTypeSignature(signature);
+    FieldTypes::beam_orientation::extendDataTypeSignature(signature);
+    FieldTypes::field_of_view::extendDataTypeSignature(signature);
+    FieldTypes::sensor_type::extendDataTypeSignature(signature);
+    FieldTypes::reading_type::extendDataTypeSignature(signature);
+    FieldTypes::range::extendDataTypeSignature(signature);
+
+    return signature;
+}
+
+/*
+ * Out of line constant definitions
+ */
+
+template <int _tmpl>
+const typename ::uavcan::StorageType< typename RangeMeasurement_<_tmpl>::ConstantTypes::SENSOR_TYPE_UNDEFINED >::Type
+    RangeMeasurement_<_tmpl>::SENSOR_TYPE_UNDEFINED = 0U; // 0
+
+template <int _tmpl>
+const typename ::uavcan::StorageType< typename RangeMeasurement_<_tmpl>::ConstantTypes::SENSOR_TYPE_SONAR >::Type
+    RangeMeasurement_<_tmpl>::SENSOR_TYPE_SONAR = 1U; // 1
+
+template <int _tmpl>
+const typename ::uavcan::StorageType< typename RangeMeasurement_<_tmpl>::ConstantTypes::SENSOR_TYPE_LIDAR >::Type
+    RangeMeasurement_<_tmpl>::SENSOR_TYPE_LIDAR = 2U; // 2
+
+template <int _tmpl>
+const typename ::uavcan::StorageType< typename RangeMeasurement_<_tmpl>::ConstantTypes::SENSOR_TYPE_RADAR >::Type
+    RangeMeasurement_<_tmpl>::SENSOR_TYPE_RADAR = 3U; // 3
+
+template <int _tmpl>
+const typename ::uavcan::StorageType< typename RangeMeasurement_<_tmpl>::ConstantTypes::READING_TYPE_UNDEFINED >::Type
+    RangeMeasurement_<_tmpl>::READING_TYPE_UNDEFINED = 0U; // 0
+
+template <int _tmpl>
+const typename ::uavcan::StorageType< typename RangeMeasurement_<_tmpl>::ConstantTypes::READING_TYPE_VALID_RANGE >::Type
+    RangeMeasurement_<_tmpl>::READING_TYPE_VALID_RANGE = 1U; // 1
+
+template <int _tmpl>
+const typename ::uavcan::StorageType< typename RangeMeasurement_<_tmpl>::ConstantTypes::READING_TYPE_TOO_CLOSE >::Type
+    RangeMeasurement_<_tmpl>::READING_TYPE_TOO_CLOSE = 2U; // 2
+
+template <int _tmpl>
+const typename ::uavcan::StorageType< typename RangeMeasurement_<_tmpl>::ConstantTypes::READING_TYPE_TOO_FAR >::Type
+    RangeMeasurement_<_tmpl>::READING_TYPE_TOO_FAR = 3U; // 3
+
+/*
+ * Final typedef
+ */
+typedef RangeMeasurement_<0> RangeMeasurement;
+
+namespace
+{
+
+const ::uavcan::DefaultDataTypeRegistrator< ::uavcan::equipment::range_sensor::RangeMeasurement > _uavcan_gdtr_registrator_RangeMeasurement;
+
+}
+
+} // Namespace uavcan
+} // Namespace equipment
+} // Namespace range_sensor
+
+/*
+ * YAML streamer specialization
+ */
+namespace uavcan
+{
+
+template <>
+class UAVCAN_EXPORT YamlStreamer< ::uavcan::equipment::range_sensor::RangeMeasurement >
+{
+public:
+    template <typename Stream>
+    static void stream(Stream& s, ::uavcan::equipment::range_sensor::RangeMeasurement::ParameterType obj, const int level);
+};
+
+template <typename Stream>
+void YamlStreamer< ::uavcan::equipment::range_sensor::RangeMeasurement >::stream(Stream& s, ::uavcan::equipment::range_sensor::RangeMeasurement::ParameterType obj, const int level)
+{
+    (void)s;
+    (void)obj;
+    (void)level;
+    if (level > 0)
+    {
+        s << '\n';
+        for (int pos = 0; pos < level; pos++)
+        {
+            s << "  ";
+        }
+    }
+    s << "timestamp: ";
+    YamlStreamer< ::uavcan::equipment::range_sensor::RangeMeasurement::FieldTypes::timestamp >::stream(s, obj.timestamp, level + 1);
+    s << '\n';
+    for (int pos = 0; pos < level; pos++)
+    {
+        s << "  ";
+    }
+    s << "sensor_id: ";
+    YamlStreamer< ::uavcan::equipment::range_sensor::RangeMeasurement::FieldTypes::sensor_id >::stream(s, obj.sensor_id, level + 1);
+    s << '\n';
+    for (int pos = 0; pos < level; pos++)
+    {
+        s << "  ";
+    }
+    s << "beam_orientation: ";
+    YamlStreamer< ::uavcan::equipment::range_sensor::RangeMeasurement::FieldTypes::beam_orientation >::stream(s, obj.beam_orientation, level + 1);
+    s << '\n';
+    for (int pos = 0; pos < level; pos++)
+    {
+        s << "  ";
+    }
+    s << "field_of_view: ";
+    YamlStreamer< ::uavcan::equipment::range_sensor::RangeMeasurement::FieldTypes::field_of_view >::stream(s, obj.field_of_view, level + 1);
+    s << '\n';
+    for (int pos = 0; pos < level; pos++)
+    {
+        s << "  ";
+    }
+    s << "sensor_type: ";
+    YamlStreamer< ::uavcan::equipment::range_sensor::RangeMeasurement::FieldTypes::sensor_type >::stream(s, obj.sensor_type, level + 1);
+    s << '\n';
+    for (int pos = 0; pos < level; pos++)
+    {
+        s << "  ";
+    }
+    s << "reading_type: ";
+    YamlStreamer< ::uavcan::equipment::range_sensor::RangeMeasurement::FieldTypes::reading_type >::stream(s, obj.reading_type, level + 1);
+    s << '\n';
+    for (int pos = 0; pos < level; pos++)
+    {
+        s << "  ";
+    }
+    s << "range: ";
+    YamlStreamer< ::uavcan::equipment::range_sensor::RangeMeasurement::FieldTypes::range >::stream(s, obj.range, level + 1);
+}
+
+}
+
+namespace uavcan
+{
+namespace equipment
+{
+namespace range_sensor
+{
+
+template <typename Stream>
+inline Stream& operator<<(Stream& s, ::uavcan::equipment::range_sensor::RangeMeasurement::ParameterType obj)
+{
+    ::uavcan::YamlStreamer< ::uavcan::equipment::range_sensor::RangeMeasurement >::stream(s, obj, 0);
+    return s;
+}
+
+}
+}
+}
+
+#endif // UAVCAN_EQUIPMENT_RANGE_SENSOR_RANGEMEASUREMENT_HPP_INCLUDED
\ No newline at end of file
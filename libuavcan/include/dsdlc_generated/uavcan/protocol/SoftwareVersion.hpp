@@ -0,0 +1,452 @@
+/*
+ * UAVCAN data structure definition for libuavcan.
+ *
+ * Autogenerated, do not edit.
+ *
+ * Source file: /root/repo/dsdl/uavcan/protocol/SoftwareVersion.uavcan
+ */
+
+#ifndef UAVCAN_PROTOCOL_SOFTWAREVERSION_HPP_INCLUDED
+#define UAVCAN_PROTOCOL_SOFTWAREVERSION_HPP_INCLUDED
+
+#include <uavcan/build_config.hpp>
+#include <uavcan/node/global_data_type_registry.hpp>
+#include <uavcan/marshal/types.hpp>
+
+/******************************* Source text **********************************
+#
+# Nested type.
+# Generic software version information.
+#
+
+# Primary version numbers for humans. Can be both set to zeros if not available.
+uint8 major
+uint8 minor
+
+# This mask indicates which optional fields are set.
+uint8 OPTIONAL_FIELD_MASK_VCS_COMMIT = 1
+uint8 OPTIONAL_FIELD_MASK_IMAGE_CRC  = 2
+uint8 optional_field_mask
+
+# VCS commit hash or revision number, e.g. git short commit hash. Useful for the developers. Optional.
+uint32 vcs_commit
+
+# CRC-64-WE of the firmware image. CRC function is the same as in the data type signature. Optional.
+uint64 image_crc
+******************************************************************************/
+
+/********************* DSDL signature source definition ***********************
+uavcan.protocol.SoftwareVersion
+saturated uint8 major
+saturated uint8 minor
+saturated uint8 optional_field_mask
+saturated uint32 vcs_commit
+saturated uint64 image_crc
+******************************************************************************/
+
+#undef major
+#undef minor
+#undef optional_field_mask
+#undef vcs_commit
+#undef image_crc
+#undef OPTIONAL_FIELD_MASK_VCS_COMMIT
+#undef OPTIONAL_FIELD_MASK_IMAGE_CRC
+
+#ifndef UAVCAN_PACK_STRUCTS
+# error UAVCAN_PACK_STRUCTS
+#endif
+
+namespace uavcan
+{
+namespace protocol
+{
+
+#if UAVCAN_PACK_STRUCTS
+UAVCAN_PACKED_BEGIN
+#endif
+
+template <int _tmpl>
+struct UAVCAN_EXPORT SoftwareVersion_
+{
+    typedef const SoftwareVersion_<_tmpl>& ParameterType;
+    typedef SoftwareVersion_<_tmpl>& ReferenceType;
+
+    struct ConstantTypes
+    {
+        typedef ::uavcan::IntegerSpec< 8, ::uavcan::SignednessUnsigned, ::uavcan::CastModeSaturate > OPTIONAL_FIELD_MASK_VCS_COMMIT;
+        typedef ::uavcan::IntegerSpec< 8, ::uavcan::SignednessUnsigned, ::uavcan::CastModeSaturate > OPTIONAL_FIELD_MASK_IMAGE_CRC;
+    };
+
+    struct FieldTypes
+    {
+        typedef ::uavcan::IntegerSpec< 8, ::uavcan::SignednessUnsigned, ::uavcan::CastModeSaturate > major;
+        typedef ::uavcan::IntegerSpec< 8, ::uavcan::SignednessUnsigned, ::uavcan::CastModeSaturate > minor;
+        typedef ::uavcan::IntegerSpec< 8, ::uavcan::SignednessUnsigned, ::uavcan::CastModeSaturate > optional_field_mask;
+        typedef ::uavcan::IntegerSpec< 32, ::uavcan::SignednessUnsigned, ::uavcan::CastModeSaturate > vcs_commit;
+        typedef ::uavcan::IntegerSpec< 64, ::uavcan::SignednessUnsigned, ::uavcan::CastModeSaturate > image_crc;
+    };
+
+    enum
+    {
+        MinBitLen
+            = FieldTypes::major::MinBitLen
+            + FieldTypes::minor::MinBitLen
+            + FieldTypes::optional_field_mask::MinBitLen
+            + FieldTypes::vcs_commit::MinBitLen
+            + FieldTypes::image_crc::MinBitLen
+    };
+
+    enum
+    {
+        MaxBitLen
+            = FieldTypes::major::MaxBitLen
+            + FieldTypes::minor::MaxBitLen
+            + FieldTypes::optional_field_mask::MaxBitLen
+            + FieldTypes::vcs_commit::MaxBitLen
+            + FieldTypes::image_crc::MaxBitLen
+    };
+
+    // Constants
+    static const typename ::uavcan::StorageType< typename ConstantTypes::OPTIONAL_FIELD_MASK_VCS_COMMIT >::Type OPTIONAL_FIELD_MASK_VCS_COMMIT; // 1
+    static const typename ::uavcan::StorageType< typename ConstantTypes::OPTIONAL_FIELD_MASK_IMAGE_CRC >::Type OPTIONAL_FIELD_MASK_IMAGE_CRC; // 2
+
+    // Fields
+    typename ::uavcan::StorageType< typename FieldTypes::major >::Type major;
+    typename ::uavcan::StorageType< typename FieldTypes::minor >::Type minor;
+    typename ::uavcan::StorageType< typename FieldTypes::optional_field_mask >::Type optional_field_mask;
+    typename ::uavcan::StorageType< typename FieldTypes::vcs_commit >::Type vcs_commit;
+    typename ::uavcan::StorageType< typename FieldTypes::image_crc >::Type image_crc;
+
+    SoftwareVersion_()
+        : major()
+        , minor()
+        , optional_field_mask()
+        , vcs_commit()
+        , image_crc()
+    {
+        enum { MaxByteLen = ::uavcan::BitLenToByteLen<MaxBitLen>::Result };
+        ::uavcan::StaticAssert<int(MaxByteLen) <= int(::uavcan::MaxTransferPayloadLen)>::check();
+
+        ::uavcan::StaticAssert<_tmpl == 0>::check();  // Usage check
+
+#if UAVCAN_DEBUG
+        /*
+         * Cross-checking MaxBitLen provided by the DSDL compiler.
+         * This check shall never be performed in user code because MaxBitLen value
+         * actually depends on the nested types, thus it is not invariant.
+         */
+        ::uavcan::StaticAssert<120 == MaxBitLen>::check();
+#endif
+    }
+
+    bool operator==(ParameterType rhs) const;
+    bool operator!=(ParameterType rhs) const { return !operator==(rhs); }
+
+    /**
+     * This comparison is based on @ref uavcan::areClose(), which ensures proper comparison of
+     * floating point fields at any depth.
+     */
+    bool isClose(ParameterType rhs) const;
+
+    static int encode(ParameterType self, ::uavcan::ScalarCodec& codec,
+                      ::uavcan::TailArrayOptimizationMode tao_mode = ::uavcan::TailArrayOptEnabled);
+
+    static int decode(ReferenceType self, ::uavcan::ScalarCodec& codec,
+                      ::uavcan::TailArrayOptimizationMode tao_mode = ::uavcan::TailArrayOptEnabled);
+
+    /**
+     * This type has no dynamic arrays, so the bit offset of every field is a compile-time constant.
+     * Encoding and decoding are performed via a plain byte array, see uavcan/marshal/fixed_layout.hpp.
+     * The field by field codec methods implement the generic approach; they are intended for testing.
+     */
+    typedef void FixedLayoutTag;
+
+    template <unsigned BitOffset>
+    static void packFixedLayout(ParameterType self, ::uavcan::uint8_t* buf);
+
+    template <unsigned BitOffset>
+    static void unpackFixedLayout(ReferenceType self, const ::uavcan::uint8_t* buf);
+
+    static int encodeFieldByField(ParameterType self, ::uavcan::ScalarCodec& codec,
+                                  ::uavcan::TailArrayOptimizationMode tao_mode = ::uavcan::TailArrayOptEnabled);
+
+    static int decodeFieldByField(ReferenceType self, ::uavcan::ScalarCodec& codec,
+                                  ::uavcan::TailArrayOptimizationMode tao_mode = ::uavcan::TailArrayOptEnabled);
+
+    /*
+     * Static type info
+     */
+    enum { DataTypeKind = ::uavcan::DataTypeKindMessage };
+    // This type has no default data type ID
+
+    static const char* getDataTypeFullName()
+    {
+        return "uavcan.protocol.SoftwareVersion";
+    }
+
+    static void extendDataTypeSignature(::uavcan::DataTypeSignature& signature)
+    {
+        signature.extend(getDataTypeSignature());
+    }
+
+    static ::uavcan::DataTypeSignature getDataTypeSignature();
+
+};
+
+#if UAVCAN_PACK_STRUCTS
+UAVCAN_PACKED_END
+#endif
+
+/*
+ * Out of line struct method definitions
+ */
+
+template <int _tmpl>
+bool SoftwareVersion_<_tmpl>::operator==(ParameterType rhs) const
+{
+    return
+        major == rhs.major &&
+        minor == rhs.minor &&
+        optional_field_mask == rhs.optional_field_mask &&
+        vcs_commit == rhs.vcs_commit &&
+        image_crc == rhs.image_crc;
+}
+
+template <int _tmpl>
+bool SoftwareVersion_<_tmpl>::isClose(ParameterType rhs) const
+{
+    return
+        ::uavcan::areClose(major, rhs.major) &&
+        ::uavcan::areClose(minor, rhs.minor) &&
+        ::uavcan::areClose(optional_field_mask, rhs.optional_field_mask) &&
+        ::uavcan::areClose(vcs_commit, rhs.vcs_commit) &&
+        ::uavcan::areClose(image_crc, rhs.image_crc);
+}
+
+template <int _tmpl>
+int SoftwareVersion_<_tmpl>::encodeFieldByField(ParameterType self, ::uavcan::ScalarCodec& codec,
+    ::uavcan::TailArrayOptimizationMode tao_mode)
+{
+    (void)self;
+    (void)codec;
+    (void)tao_mode;
+    int res = 1;
+    res = FieldTypes::major::encode(self.major, codec,  ::uavcan::TailArrayOptDisabled);
+    if (res <= 0)
+    {
+        return res;
+    }
+    res = FieldTypes::minor::encode(self.minor, codec,  ::uavcan::TailArrayOptDisabled);
+    if (res <= 0)
+    {
+        return res;
+    }
+    res = FieldTypes::optional_field_mask::encode(self.optional_field_mask, codec,  ::uavcan::TailArrayOptDisabled);
+    if (res <= 0)
+    {
+        return res;
+    }
+    res = FieldTypes::vcs_commit::encode(self.vcs_commit, codec,  ::uavcan::TailArrayOptDisabled);
+    if (res <= 0)
+    {
+        return res;
+    }
+    res = FieldTypes::image_crc::encode(self.image_crc, codec,  tao_mode);
+    return res;
+}
+
+template <int _tmpl>
+int SoftwareVersion_<_tmpl>::decodeFieldByField(ReferenceType self, ::uavcan::ScalarCodec& codec,
+    ::uavcan::TailArrayOptimizationMode tao_mode)
+{
+    (void)self;
+    (void)codec;
+    (void)tao_mode;
+    int res = 1;
+    res = FieldTypes::major::decode(self.major, codec,  ::uavcan::TailArrayOptDisabled);
+    if (res <= 0)
+    {
+        return res;
+    }
+    res = FieldTypes::minor::decode(self.minor, codec,  ::uavcan::TailArrayOptDisabled);
+    if (res <= 0)
+    {
+        return res;
+    }
+    res = FieldTypes::optional_field_mask::decode(self.optional_field_mask, codec,  ::uavcan::TailArrayOptDisabled);
+    if (res <= 0)
+    {
+        return res;
+    }
+    res = FieldTypes::vcs_commit::decode(self.vcs_commit, codec,  ::uavcan::TailArrayOptDisabled);
+    if (res <= 0)
+    {
+        return res;
+    }
+    res = FieldTypes::image_crc::decode(self.image_crc, codec,  tao_mode);
+    return res;
+}
+
+template <int _tmpl>
+template <unsigned BitOffset>
+void SoftwareVersion_<_tmpl>::packFixedLayout(ParameterType self, ::uavcan::uint8_t* buf)
+{
+    ::uavcan::packFixedLayoutScalar< typename FieldTypes::major, BitOffset >(buf, self.major);
+    ::uavcan::packFixedLayoutScalar< typename FieldTypes::minor, BitOffset + 8 >(buf, self.minor);
+    ::uavcan::packFixedLayoutScalar< typename FieldTypes::optional_field_mask, BitOffset + 16 >(buf, self.optional_field_mask);
+    ::uavcan::packFixedLayoutScalar< typename FieldTypes::vcs_commit, BitOffset + 24 >(buf, self.vcs_commit);
+    ::uavcan::packFixedLayoutScalar< typename FieldTypes::image_crc, BitOffset + 56 >(buf, self.image_crc);
+}
+
+template <int _tmpl>
+template <unsigned BitOffset>
+void SoftwareVersion_<_tmpl>::unpackFixedLayout(ReferenceType self, const ::uavcan::uint8_t* buf)
+{
+    self.major = ::uavcan::unpackFixedLayoutScalar< typename FieldTypes::major, BitOffset >(buf);
+    self.minor = ::uavcan::unpackFixedLayoutScalar< typename FieldTypes::minor, BitOffset + 8 >(buf);
+    self.optional_field_mask = ::uavcan::unpackFixedLayoutScalar< typename FieldTypes::optional_field_mask, BitOffset + 16 >(buf);
+    self.vcs_commit = ::uavcan::unpackFixedLayoutScalar< typename FieldTypes::vcs_commit, BitOffset + 24 >(buf);
+    self.image_crc = ::uavcan::unpackFixedLayoutScalar< typename FieldTypes::image_crc, BitOffset + 56 >(buf);
+}
+
+template <int _tmpl>
+int SoftwareVersion_<_tmpl>::encode(ParameterType self, ::uavcan::ScalarCodec& codec,
+    ::uavcan::TailArrayOptimizationMode tao_mode)
+{
+    (void)tao_mode;
+    ::uavcan::uint8_t buf[::uavcan::BitLenToByteLen<MaxBitLen>::Result] = { };
+    packFixedLayout<0>(self, buf);
+    return codec.encodeBits(buf, MaxBitLen);
+}
+
+template <int _tmpl>
+int SoftwareVersion_<_tmpl>::decode(ReferenceType self, ::uavcan::ScalarCodec& codec,
+    ::uavcan::TailArrayOptimizationMode tao_mode)
+{
+    (void)tao_mode;
+    ::uavcan::uint8_t buf[::uavcan::BitLenToByteLen<MaxBitLen>::Result];
+    const int res = codec.decodeBits(buf, MaxBitLen);
+    if (res > 0)
+    {
+        unpackFixedLayout<0>(self, buf);
+    }
+    return res;
+}
+
+/*
+ * Out of line type method definitions
+ */
+template <int _tmpl>
+::uavcan::DataTypeSignature SoftwareVersion_<_tmpl>::getDataTypeSignature()
+{
+    ::uavcan::DataTypeSignature signature(0xEA5E2A85CEE46902ULL);
+
+    FieldTypes::major::extendDataTypeSignature(signature);
+    FieldTypes::minor::extendDataTypeSignature(signature);
+    FieldTypes::optional_field_mask::extendDataTypeSignature(signature);
+    FieldTypes::vcs_commit::extendDataTypeSignature(signature);
+    FieldTypes::image_crc::extendDataTypeSignature(signature);
+
+    return signature;
+}
+
+/*
+ * Out of line constant definitions
+ */
+
+template <int _tmpl>
+const typename ::uavcan::StorageType< typename SoftwareVersion_<_tmpl>::ConstantTypes::OPTIONAL_FIELD_MASK_VCS_COMMIT >::Type
+    SoftwareVersion_<_tmpl>::OPTIONAL_FIELD_MASK_VCS_COMMIT = 1U; // 1
+
+template <int _tmpl>
+const typename ::uavcan::StorageType< typename SoftwareVersion_<_tmpl>::ConstantTypes::OPTIONAL_FIELD_MASK_IMAGE_CRC >::Type
+    SoftwareVersion_<_tmpl>::OPTIONAL_FIELD_MASK_IMAGE_CRC = 2U; // 2
+
+/*
+ * Final typedef
+ */
+typedef SoftwareVersion_<0> SoftwareVersion;
+
+// No default registration
+
+} // Namespace uavcan
+} // Namespace protocol
+
+/*
+ * YAML streamer specialization
+ */
+namespace uavcan
+{
+
+template <>
+class UAVCAN_EXPORT YamlStreamer< ::uavcan::protocol::SoftwareVersion >
+{
+public:
+    template <typename Stream>
+    static void stream(Stream& s, ::uavcan::protocol::SoftwareVersion::ParameterType obj, const int level);
+};
+
+template <typename Stream>
+void YamlStreamer< ::uavcan::protocol::SoftwareVersion >::stream(Stream& s, ::uavcan::protocol::SoftwareVersion::ParameterType obj, const int level)
+{
+    (void)s;
+    (void)obj;
+    (void)level;
+    if (level > 0)
+    {
+        s << '\n';
+        for (int pos = 0; pos < level; pos++)
+        {
+            s << "  ";
+        }
+    }
+    s << "major: ";
+    YamlStreamer< ::uavcan::protocol::SoftwareVersion::FieldTypes::major >::stream(s, obj.major, level + 1);
+    s << '\n';
+    for (int pos = 0; pos < level; pos++)
+    {
+        s << "  ";
+    }
+    s << "minor: ";
+    YamlStreamer< ::uavcan::protocol::SoftwareVersion::FieldTypes::minor >::stream(s, obj.minor, level + 1);
+    s << '\n';
+    for (int pos = 0; pos < level; pos++)
+    {
+        s << "  ";
+    }
+    s << "optional_field_mask: ";
+    YamlStreamer< ::uavcan::protocol::SoftwareVersion::FieldTypes::optional_field_mask >::stream(s, obj.optional_field_mask, level + 1);
+    s << '\n';
+    for (int pos = 0; pos < level; pos++)
+    {
+        s << "  ";
+    }
+    s << "vcs_commit: ";
+    YamlStreamer< ::uavcan::protocol::SoftwareVersion::FieldTypes::vcs_commit >::stream(s, obj.vcs_commit, level + 1);
+    s << '\n';
+    for (int pos = 0; pos < level; pos++)
+    {
+        s << "  ";
+    }
+    s << "image_crc: ";
+    YamlStreamer< ::uavcan::protocol::SoftwareVersion::FieldTypes::image_crc >::stream(s, obj.image_crc, level + 1);
+}
+
+}
+
+namespace uavcan
+{
+namespace protocol
+{
+
+template <typename Stream>
+inline Stream& operator<<(Stream& s, ::uavcan::protocol::SoftwareVersion::ParameterType obj)
+{
+    ::uavcan::YamlStreamer< ::uavcan::protocol::SoftwareVersion >::stream(s, obj, 0);
+    return s;
+}
+
+}
+}
+
+#endif // UAVCAN_PROTOCOL_SOFTWAREVERSION_HPP_INCLUDED
\ No newline at end of file
@@ -108,13 +108,25 @@
 # define UAVCAN_TINY 0
 #endif
 
+/**
+ * Whether the target is a hosted platform, i.e. NOT a resource constrained one.
+ * The defaults of the options below that trade RAM/ROM for speed or diagnostics depend on it.
+ * If the autodetect fails, the platform is assumed to be resource constrained, so it's pretty safe by default.
+ */
+#ifndef UAVCAN_HOSTED_PLATFORM
+# if defined(__linux__) || defined(__linux) || defined(__APPLE__) || defined(_WIN64) || defined(_WIN32)
+#  define UAVCAN_HOSTED_PLATFORM 1
+# else
+#  define UAVCAN_HOSTED_PLATFORM 0
+# endif
+#endif
+
 /**
  * It might make sense to remove toString() methods for an embedded system.
  * If the autodetect fails, toString() will be disabled, so it's pretty safe by default.
  */
 #ifndef UAVCAN_TOSTRING
-// Objective is to make sure that we're NOT on a resource constrained platform
-# if defined(__linux__) || defined(__linux) || defined(__APPLE__) || defined(_WIN64) || defined(_WIN32)
+# if UAVCAN_HOSTED_PLATFORM
 #  define UAVCAN_TOSTRING 1
 # else
 #  define UAVCAN_TOSTRING 0
@@ -142,6 +154,42 @@
 # define UAVCAN_USE_EXTERNAL_SNPRINTF   0
 #endif
 
+/**
+ * Per-owner accounting in PoolAllocator.
+ * If enabled, every pool block remembers which library subsystem has allocated it (see PoolAllocationTag), so that
+ * the pool usage can be broken down by owner. This costs one byte of RAM per block.
+ * Defaults to UAVCAN_HOSTED_PLATFORM; always disabled in UAVCAN_TINY mode.
+ */
+#ifndef UAVCAN_POOL_ALLOCATION_TAGS
+# if UAVCAN_TINY
+#  define UAVCAN_POOL_ALLOCATION_TAGS   0
+# elif UAVCAN_HOSTED_PLATFORM
+#  define UAVCAN_POOL_ALLOCATION_TAGS   1
+# else
+#  define UAVCAN_POOL_ALLOCATION_TAGS   0
+# endif
+#endif
+
+/**
+ * Storage class of the current allocation tag (see PoolAllocationTagScope).
+ * The tag is kept per thread, so that nodes running in different threads (e.g. sharing one
+ * uavcan_linux::LockFreePoolAllocator for their buffers) don't race on it. Resolves to nothing if the compiler
+ * doesn't support thread local storage or the platform is not hosted; the tags are single-threaded then.
+ */
+#ifndef UAVCAN_POOL_ALLOCATION_TAG_STORAGE
+# if !UAVCAN_POOL_ALLOCATION_TAGS || !UAVCAN_HOSTED_PLATFORM
+#  define UAVCAN_POOL_ALLOCATION_TAG_STORAGE
+# elif UAVCAN_CPP_VERSION >= UAVCAN_CPP11
+#  define UAVCAN_POOL_ALLOCATION_TAG_STORAGE    thread_local
+# elif defined(__GNUC__)
+#  define UAVCAN_POOL_ALLOCATION_TAG_STORAGE    __thread
+# elif defined(_MSC_VER)
+#  define UAVCAN_POOL_ALLOCATION_TAG_STORAGE    __declspec(thread)
+# else
+#  define UAVCAN_POOL_ALLOCATION_TAG_STORAGE
+# endif
+#endif
+
 /**
  * Run time checks.
  * Resolves to the standard assert() by default.
@@ -158,6 +206,76 @@
 # endif
 #endif
 
+/**
+ * Listener lookup table of the dispatcher.
+ * UAVCAN_DISPATCHER_HEAD_TABLE=1 enables a table of pointers indexed by data type ID in every listener registry,
+ * so that the listeners of a data type are located in constant time. It costs 1024 pointers per registry, and
+ * there are three registries, i.e. 12 KB of RAM on a 32-bit platform; without the table the listener list is
+ * searched linearly. Defaults to UAVCAN_HOSTED_PLATFORM; ignored in UAVCAN_TINY mode.
+ */
+#ifndef UAVCAN_DISPATCHER_HEAD_TABLE
+# if UAVCAN_TINY
+#  define UAVCAN_DISPATCHER_HEAD_TABLE  0
+# elif UAVCAN_HOSTED_PLATFORM
+#  define UAVCAN_DISPATCHER_HEAD_TABLE  1
+# else
+#  define UAVCAN_DISPATCHER_HEAD_TABLE  0
+# endif
+#endif
+
+/**
+ * Transfer CRC kernel.
+ * UAVCAN_CRC_SLICE_BY defines the number of bytes processed per iteration of the table-driven kernel: 1, 4 or 8.
+ * Each extra slice costs 512 bytes of ROM. Defaults to 8 if UAVCAN_HOSTED_PLATFORM, otherwise to 1;
+ * ignored in UAVCAN_TINY mode.
+ */
+#ifndef UAVCAN_CRC_SLICE_BY
+# if UAVCAN_TINY
+#  define UAVCAN_CRC_SLICE_BY   1
+# elif UAVCAN_HOSTED_PLATFORM
+#  define UAVCAN_CRC_SLICE_BY   8
+# else
+#  define UAVCAN_CRC_SLICE_BY   1
+# endif
+#endif
+#if (UAVCAN_CRC_SLICE_BY != 1) && (UAVCAN_CRC_SLICE_BY != 4) && (UAVCAN_CRC_SLICE_BY != 8)
+# error UAVCAN_CRC_SLICE_BY must be 1, 4 or 8
+#endif
+
+/**
+ * Float16 conversion kernels.
+ * UAVCAN_FLOAT16_TABLES=1 enables the table-driven conversions, which cost 768 bytes of ROM and require the
+ * native float to be IEEE754 binary32; otherwise the portable algorithm is used. Defaults to UAVCAN_HOSTED_PLATFORM.
+ * UAVCAN_FLOAT16_F16C=1 enables the x86 F16C kernels for float16 arrays (needs -mf16c); by default it is enabled
+ * whenever the compiler targets F16C, e.g. with -march=native, and the tables are enabled.
+ * Both options are ignored in UAVCAN_TINY mode; the results are bit exact with the portable algorithm in any case.
+ */
+#ifndef UAVCAN_FLOAT16_TABLES
+# if UAVCAN_TINY
+#  define UAVCAN_FLOAT16_TABLES 0
+# elif UAVCAN_HOSTED_PLATFORM
+#  define UAVCAN_FLOAT16_TABLES 1
+# else
+#  define UAVCAN_FLOAT16_TABLES 0
+# endif
+#endif
+#if UAVCAN_FLOAT16_TABLES && !UAVCAN_TINY && defined(__FLT_MANT_DIG__) && defined(__FLT_MAX_EXP__)
+# if (__FLT_MANT_DIG__ != 24) || (__FLT_MAX_EXP__ != 128)
+#  error UAVCAN_FLOAT16_TABLES requires IEEE754 binary32 float
+# endif
+#endif
+
+#ifndef UAVCAN_FLOAT16_F16C
+# if defined(__F16C__) && UAVCAN_FLOAT16_TABLES
+#  define UAVCAN_FLOAT16_F16C   1
+# else
+#  define UAVCAN_FLOAT16_F16C   0
+# endif
+#endif
+#if UAVCAN_FLOAT16_F16C && !UAVCAN_TINY && !(defined(__F16C__) && UAVCAN_FLOAT16_TABLES)
+# error UAVCAN_FLOAT16_F16C requires x86 with F16C enabled and UAVCAN_FLOAT16_TABLES
+#endif
+
 namespace uavcan
 {
 /**
@@ -207,6 +325,19 @@ struct UAVCAN_EXPORT IsDynamicallyAllocatable
     }
 };
 
+/**
+ * Maximum number of CAN frames that the dispatcher fetches from the driver per one select() call.
+ * Every frame of the burst costs about 40 bytes of stack in Dispatcher::spin().
+ * Value 1 makes the library process received frames one by one.
+ */
+#ifdef UAVCAN_RX_BURST_LEN
+static const unsigned RxBurstLen = UAVCAN_RX_BURST_LEN;
+#elif UAVCAN_TINY
+static const unsigned RxBurstLen = 1;
+#else
+static const unsigned RxBurstLen = 8;
+#endif
+
 /**
  * Float comparison precision.
  * For details refer to:
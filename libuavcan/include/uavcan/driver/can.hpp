@@ -13,6 +13,11 @@
 
 namespace uavcan
 {
+/**
+ * Maximum number of CAN interfaces the library can work with.
+ */
+enum { MaxCanIfaces = 3 };
+
 /**
  * Raw CAN frame, as passed to/from the CAN driver.
  */
@@ -108,6 +113,27 @@ struct UAVCAN_EXPORT CanSelectMasks
 typedef uint16_t CanIOFlags;
 static const CanIOFlags CanIOFlagLoopback = 1; ///< Send the frame back to RX with true TX timestamps
 
+/**
+ * Received CAN frame together with its reception metadata.
+ * This is the unit of data exchanged via @ref ICanIface::receiveBurst().
+ */
+struct UAVCAN_EXPORT CanRxFrame : public CanFrame
+{
+    MonotonicTime ts_mono;
+    UtcTime ts_utc;
+    CanIOFlags flags;
+    uint8_t iface_index;
+
+    CanRxFrame()
+        : flags(0)
+        , iface_index(0)
+    { }
+
+#if UAVCAN_TOSTRING
+    std::string toString(StringRepresentation mode = StrTight) const;
+#endif
+};
+
 /**
  * Single non-blocking CAN interface.
  */
@@ -138,6 +164,18 @@ public:
     virtual int16_t receive(CanFrame& out_frame, MonotonicTime& out_ts_monotonic, UtcTime& out_ts_utc,
                             CanIOFlags& out_flags) = 0;
 
+    /**
+     * Non-blocking reception of several frames at once.
+     * Drivers that can fetch multiple frames cheaper than one by one (e.g. from a hardware RX FIFO or from
+     * a software RX queue) should override this method. The default implementation fetches one frame via
+     * @ref receive(), so that the driver is never asked to read more than @ref ICanDriver::select() reported.
+     * Field iface_index of the output frames will be set by the library and can be ignored by the driver.
+     * @param [out] out_frames  Array of at least max_frames elements.
+     * @param [in]  max_frames  Maximum number of frames to fetch, at least one.
+     * @return Number of frames received, 0 = RX buffer empty, negative for error.
+     */
+    virtual int16_t receiveBurst(CanRxFrame* out_frames, uint16_t max_frames);
+
     /**
      * Configure the hardware CAN filters. @ref CanFilterConfig.
      * @return 0 = success, negative for error.
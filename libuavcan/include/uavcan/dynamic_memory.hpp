@@ -30,6 +30,74 @@ public:
 
     virtual std::size_t getBlockSize() const = 0;
     virtual std::size_t getNumBlocks() const = 0;
+
+    /**
+     * Returns the address range [begin, end) of the memory managed by this allocator, if it is contiguous.
+     * This allows pool managers to find the owner of a block without asking every pool.
+     * Allocators that can't provide it should return false, which is the default behavior.
+     */
+    virtual bool getAddressRange(const void*& out_begin, const void*& out_end) const
+    {
+        (void)out_begin;
+        (void)out_end;
+        return false;
+    }
+};
+
+/**
+ * Library subsystems that allocate memory from the pool.
+ * Used for per-owner accounting, see PoolAllocationTagScope.
+ */
+enum PoolAllocationTag
+{
+    PoolAllocationTagUnattributed,          ///< Allocated by the application or by a subsystem not listed here
+    PoolAllocationTagTxQueue,               ///< CAN TX queue entries
+    PoolAllocationTagReceivers,             ///< Transfer receivers
+    PoolAllocationTagBuffers,               ///< Transfer reassembly buffers
+    PoolAllocationTagOutgoingTransfers,     ///< Outgoing transfer registry
+    PoolAllocationTagMap,                   ///< Map<> groups that were not attributed to any of the above
+    NumPoolAllocationTags
+};
+
+/**
+ * While an object of this class exists, all pool blocks allocated by PoolAllocator<> are attributed to the given
+ * subsystem. Scopes can be nested; the innermost one wins, unless it was created with override_outer = false.
+ * The current tag is thread local where supported, see UAVCAN_POOL_ALLOCATION_TAG_STORAGE.
+ * Only the memory pool is accounted. Memory that the library doesn't take from the pool is not attributed to any
+ * tag; that includes static buffers of containers and the arenas of ArenaTransferBufferManager, which report
+ * their own usage with getNumUsedChunks().
+ * Does nothing if UAVCAN_POOL_ALLOCATION_TAGS is disabled.
+ */
+class UAVCAN_EXPORT PoolAllocationTagScope : Noncopyable
+{
+#if UAVCAN_POOL_ALLOCATION_TAGS
+    static UAVCAN_POOL_ALLOCATION_TAG_STORAGE PoolAllocationTag current_;
+    const PoolAllocationTag prev_;
+
+public:
+    explicit PoolAllocationTagScope(PoolAllocationTag tag, bool override_outer = true)
+        : prev_(current_)
+    {
+        if (override_outer || (current_ == PoolAllocationTagUnattributed))
+        {
+            current_ = tag;
+        }
+    }
+
+    ~PoolAllocationTagScope() { current_ = prev_; }
+
+    static PoolAllocationTag getCurrent() { return current_; }
+
+    /**
+     * Human readable name of the tag, for periodic usage dumps.
+     */
+    static const char* getTagName(PoolAllocationTag tag);
+#else
+public:
+    explicit PoolAllocationTagScope(PoolAllocationTag, bool = true) { }
+
+    static PoolAllocationTag getCurrent() { return PoolAllocationTagUnattributed; }
+#endif
 };
 
 /**
@@ -71,8 +139,60 @@ public:
     virtual std::size_t getNumBlocks() const;
 };
 
+/**
+ * Same as PoolManager<>, but the pool is found in constant time:
+ *  - Allocations are routed through a size class lookup table, which is rebuilt by addPool(). If the pool of the
+ *    matching size class is exhausted, the next larger pools are tried, as in PoolManager<>.
+ *  - Deallocations are routed through a table of pool address ranges sorted by address (binary search), see
+ *    IPoolAllocator::getAddressRange(). Pools that don't report their address range are checked with isInPool().
+ */
+template <unsigned MaxPools>
+class UAVCAN_EXPORT IndexedPoolManager : public IPoolAllocator, Noncopyable
+{
+    enum { NumSizeClasses = 16 };
+
+    IPoolAllocator* pools_[MaxPools];           ///< Sorted by block size
+    std::size_t block_sizes_[MaxPools];
+    uint8_t size_class_lut_[NumSizeClasses];    ///< Size class --> index of the smallest suitable pool
+    uint8_t size_class_shift_;
+    uint8_t num_pools_;
+
+    const uint8_t* range_begin_[MaxPools];      ///< Sorted by address
+    const uint8_t* range_end_[MaxPools];
+    uint8_t range_pool_[MaxPools];
+    uint8_t num_ranges_;
+
+    void rebuildTables();
+
+    int findPoolIndex(const void* ptr) const;
+
+public:
+    IndexedPoolManager()
+        : size_class_shift_(0)
+        , num_pools_(0)
+        , num_ranges_(0)
+    {
+        StaticAssert<(MaxPools > 0) && (MaxPools <= 255)>::check();
+        fill(size_class_lut_, size_class_lut_ + NumSizeClasses, uint8_t(0));
+    }
+
+    bool addPool(IPoolAllocator* pool);
+
+    virtual void* allocate(std::size_t size);
+    virtual void deallocate(const void* ptr);
+
+    virtual bool isInPool(const void* ptr) const;
+
+    virtual std::size_t getBlockSize() const { return 0; }
+    virtual std::size_t getNumBlocks() const;
+};
+
 /**
  * Classic implementation of a pool allocator (Meyers).
+ *
+ * Keeps track of the number of used blocks and of its high-water mark, which helps to choose the pool size.
+ * If UAVCAN_POOL_ALLOCATION_TAGS is enabled, the same counters are also maintained per owner subsystem,
+ * see PoolAllocationTagScope.
  */
 template <std::size_t PoolSize, std::size_t BlockSize>
 class UAVCAN_EXPORT PoolAllocator : public IPoolAllocator, Noncopyable
@@ -84,6 +204,12 @@ class UAVCAN_EXPORT PoolAllocator : public IPoolAllocator, Noncopyable
     };
 
     Node* free_list_;
+    unsigned used_blocks_;
+    unsigned peak_used_blocks_;
+#if UAVCAN_POOL_ALLOCATION_TAGS
+    unsigned tag_used_blocks_[NumPoolAllocationTags];
+    unsigned tag_peak_used_blocks_[NumPoolAllocationTags];
+#endif
     union
     {
          uint8_t bytes[PoolSize];
@@ -95,6 +221,12 @@ class UAVCAN_EXPORT PoolAllocator : public IPoolAllocator, Noncopyable
 public:
     static const unsigned NumBlocks = unsigned(PoolSize / BlockSize);
 
+private:
+#if UAVCAN_POOL_ALLOCATION_TAGS
+    uint8_t block_tags_[NumBlocks];
+#endif
+
+public:
     PoolAllocator();
 
     virtual void* allocate(std::size_t size);
@@ -105,24 +237,59 @@ public:
     virtual std::size_t getBlockSize() const { return BlockSize; }
     virtual std::size_t getNumBlocks() const { return NumBlocks; }
 
-    unsigned getNumFreeBlocks() const;
-    unsigned getNumUsedBlocks() const { return NumBlocks - getNumFreeBlocks(); }
+    virtual bool getAddressRange(const void*& out_begin, const void*& out_end) const
+    {
+        out_begin = pool_.bytes;
+        out_end = pool_.bytes + PoolSize;
+        return true;
+    }
+
+    unsigned getNumFreeBlocks() const { return NumBlocks - used_blocks_; }
+    unsigned getNumUsedBlocks() const { return used_blocks_; }
+
+    /**
+     * Maximum number of blocks that were in use at the same time since construction or since the last reset.
+     */
+    unsigned getPeakNumUsedBlocks() const { return peak_used_blocks_; }
+
+    /**
+     * Sets the high-water marks, including the per-owner ones, to the current usage.
+     */
+    void resetPeakNumUsedBlocks();
+
+#if UAVCAN_POOL_ALLOCATION_TAGS
+    /**
+     * Per-owner usage; the sum of getNumUsedBlocks(tag) over all tags equals getNumUsedBlocks().
+     * Per-owner peaks are tracked independently, so their sum can exceed getPeakNumUsedBlocks().
+     */
+    unsigned getNumUsedBlocks(PoolAllocationTag tag) const
+    {
+        return (tag < NumPoolAllocationTags) ? tag_used_blocks_[tag] : 0;
+    }
+    unsigned getPeakNumUsedBlocks(PoolAllocationTag tag) const
+    {
+        return (tag < NumPoolAllocationTags) ? tag_peak_used_blocks_[tag] : 0;
+    }
+#endif
 };
 
 /**
  * Limits the maximum number of blocks that can be allocated in a given allocator.
+ * Keeps track of the number of used blocks and of its high-water mark.
  */
 class LimitedPoolAllocator : public IPoolAllocator
 {
     IPoolAllocator& allocator_;
     const std::size_t max_blocks_;
     std::size_t used_blocks_;
+    std::size_t peak_used_blocks_;
 
 public:
     LimitedPoolAllocator(IPoolAllocator& allocator, std::size_t max_blocks)
         : allocator_(allocator)
         , max_blocks_(max_blocks)
         , used_blocks_(0)
+        , peak_used_blocks_(0)
     {
         UAVCAN_ASSERT(max_blocks_ > 0);
     }
@@ -134,6 +301,10 @@ public:
 
     virtual std::size_t getBlockSize() const;
     virtual std::size_t getNumBlocks() const;
+
+    std::size_t getNumUsedBlocks() const { return used_blocks_; }
+    std::size_t getPeakNumUsedBlocks() const { return peak_used_blocks_; }
+    void resetPeakNumUsedBlocks() { peak_used_blocks_ = used_blocks_; }
 };
 
 // ----------------------------------------------------------------------------
@@ -235,13 +406,204 @@ std::size_t PoolManager<MaxPools>::getNumBlocks() const
     return ret;
 }
 
+/*
+ * IndexedPoolManager<>
+ */
+template <unsigned MaxPools>
+void IndexedPoolManager<MaxPools>::rebuildTables()
+{
+    /*
+     * Size classes are equally sized and cover all sizes up to the largest block size
+     */
+    const std::size_t max_block_size = (num_pools_ > 0) ? block_sizes_[num_pools_ - 1] : 0;
+    size_class_shift_ = 0;
+    while ((max_block_size >> size_class_shift_) >= std::size_t(NumSizeClasses))
+    {
+        size_class_shift_++;
+    }
+    uint8_t index = 0;
+    for (unsigned cls = 0; cls < NumSizeClasses; cls++)
+    {
+        const std::size_t min_size = (std::size_t(cls) << size_class_shift_) + 1U;
+        while ((index < num_pools_) && (block_sizes_[index] < min_size))
+        {
+            index++;
+        }
+        size_class_lut_[cls] = index;
+    }
+
+    /*
+     * Address ranges are kept sorted with insertion sort, since there are just a few of them
+     */
+    num_ranges_ = 0;
+    for (uint8_t i = 0; i < num_pools_; i++)
+    {
+        const void* begin = NULL;
+        const void* end = NULL;
+        if (!pools_[i]->getAddressRange(begin, end))
+        {
+            continue;
+        }
+        unsigned pos = num_ranges_;
+        while ((pos > 0) && (range_begin_[pos - 1] > static_cast<const uint8_t*>(begin)))
+        {
+            range_begin_[pos] = range_begin_[pos - 1];
+            range_end_[pos] = range_end_[pos - 1];
+            range_pool_[pos] = range_pool_[pos - 1];
+            pos--;
+        }
+        range_begin_[pos] = static_cast<const uint8_t*>(begin);
+        range_end_[pos] = static_cast<const uint8_t*>(end);
+        range_pool_[pos] = i;
+        num_ranges_++;
+    }
+}
+
+template <unsigned MaxPools>
+int IndexedPoolManager<MaxPools>::findPoolIndex(const void* ptr) const
+{
+    const uint8_t* const p = static_cast<const uint8_t*>(ptr);
+
+    // Last range that begins at or below the pointer
+    unsigned lo = 0;
+    unsigned hi = num_ranges_;
+    while (lo < hi)
+    {
+        const unsigned mid = (lo + hi) / 2U;
+        if (range_begin_[mid] <= p)
+        {
+            lo = mid + 1U;
+        }
+        else
+        {
+            hi = mid;
+        }
+    }
+    if ((lo > 0) && (p < range_end_[lo - 1]))
+    {
+        return range_pool_[lo - 1];
+    }
+
+    if (num_ranges_ < num_pools_)
+    {
+        for (uint8_t i = 0; i < num_pools_; i++)
+        {
+            if (pools_[i]->isInPool(ptr))
+            {
+                return i;
+            }
+        }
+    }
+    return -1;
+}
+
+template <unsigned MaxPools>
+bool IndexedPoolManager<MaxPools>::addPool(IPoolAllocator* pool)
+{
+    UAVCAN_ASSERT(pool);
+    if ((pool == NULL) || (num_pools_ >= MaxPools))
+    {
+        return false;
+    }
+    for (uint8_t i = 0; i < num_pools_; i++)
+    {
+        if (pools_[i] == pool)
+        {
+            UAVCAN_ASSERT(0);
+            return false;
+        }
+    }
+
+    // Smallest blocks go first; pools of the same block size are tried in the order of insertion
+    const std::size_t block_size = pool->getBlockSize();
+    unsigned pos = num_pools_;
+    while ((pos > 0) && (block_sizes_[pos - 1] > block_size))
+    {
+        pools_[pos] = pools_[pos - 1];
+        block_sizes_[pos] = block_sizes_[pos - 1];
+        pos--;
+    }
+    pools_[pos] = pool;
+    block_sizes_[pos] = block_size;
+    num_pools_++;
+
+    rebuildTables();
+    return true;
+}
+
+template <unsigned MaxPools>
+void* IndexedPoolManager<MaxPools>::allocate(std::size_t size)
+{
+    if ((num_pools_ == 0) || (size > block_sizes_[num_pools_ - 1]))
+    {
+        return NULL;
+    }
+    const std::size_t cls = (size > 0) ? ((size - 1U) >> size_class_shift_) : 0U;
+    UAVCAN_ASSERT(cls < std::size_t(NumSizeClasses));
+
+    unsigned i = size_class_lut_[cls];
+    while (block_sizes_[i] < size)      // The class may start with a pool that is too small for this size
+    {
+        i++;
+    }
+    for (; i < num_pools_; i++)
+    {
+        void* const pmem = pools_[i]->allocate(size);
+        if (pmem != NULL)
+        {
+            return pmem;
+        }
+    }
+    return NULL;
+}
+
+template <unsigned MaxPools>
+void IndexedPoolManager<MaxPools>::deallocate(const void* ptr)
+{
+    if (ptr == NULL)
+    {
+        return;
+    }
+    const int index = findPoolIndex(ptr);
+    if (index < 0)
+    {
+        UAVCAN_ASSERT(0);
+        return;
+    }
+    pools_[index]->deallocate(ptr);
+}
+
+template <unsigned MaxPools>
+bool IndexedPoolManager<MaxPools>::isInPool(const void* ptr) const
+{
+    return findPoolIndex(ptr) >= 0;
+}
+
+template <unsigned MaxPools>
+std::size_t IndexedPoolManager<MaxPools>::getNumBlocks() const
+{
+    std::size_t ret = 0;
+    for (uint8_t i = 0; i < num_pools_; i++)
+    {
+        ret += pools_[i]->getNumBlocks();
+    }
+    return ret;
+}
+
 /*
  * PoolAllocator<>
  */
 template <std::size_t PoolSize, std::size_t BlockSize>
 PoolAllocator<PoolSize, BlockSize>::PoolAllocator()
     : free_list_(reinterpret_cast<Node*>(pool_.bytes))
+    , used_blocks_(0)
+    , peak_used_blocks_(0)
 {
+#if UAVCAN_POOL_ALLOCATION_TAGS
+    fill(tag_used_blocks_, tag_used_blocks_ + NumPoolAllocationTags, 0U);
+    fill(tag_peak_used_blocks_, tag_peak_used_blocks_ + NumPoolAllocationTags, 0U);
+    fill(block_tags_, block_tags_ + NumBlocks, uint8_t(PoolAllocationTagUnattributed));
+#endif
     (void)std::memset(pool_.bytes, 0, PoolSize);
     for (unsigned i = 0; (i + 1) < (NumBlocks - 1 + 1); i++) // -Werror=type-limits
     {
@@ -260,6 +622,16 @@ void* PoolAllocator<PoolSize, BlockSize>::allocate(std::size_t size)
     }
     void* pmem = free_list_;
     free_list_ = free_list_->next;
+
+    used_blocks_++;
+    UAVCAN_ASSERT(used_blocks_ <= NumBlocks);
+    peak_used_blocks_ = max(peak_used_blocks_, used_blocks_);
+#if UAVCAN_POOL_ALLOCATION_TAGS
+    const PoolAllocationTag tag = PoolAllocationTagScope::getCurrent();
+    block_tags_[std::size_t(static_cast<uint8_t*>(pmem) - pool_.bytes) / BlockSize] = uint8_t(tag);
+    tag_used_blocks_[tag]++;
+    tag_peak_used_blocks_[tag] = max(tag_peak_used_blocks_[tag], tag_used_blocks_[tag]);
+#endif
     return pmem;
 }
 
@@ -273,6 +645,14 @@ void PoolAllocator<PoolSize, BlockSize>::deallocate(const void* ptr)
     Node* p = static_cast<Node*>(const_cast<void*>(ptr));
     p->next = free_list_;
     free_list_ = p;
+
+    UAVCAN_ASSERT(used_blocks_ > 0);
+    used_blocks_--;
+#if UAVCAN_POOL_ALLOCATION_TAGS
+    const uint8_t tag = block_tags_[std::size_t(static_cast<const uint8_t*>(ptr) - pool_.bytes) / BlockSize];
+    UAVCAN_ASSERT(tag_used_blocks_[tag] > 0);
+    tag_used_blocks_[tag]--;
+#endif
 }
 
 template <std::size_t PoolSize, std::size_t BlockSize>
@@ -283,17 +663,12 @@ bool PoolAllocator<PoolSize, BlockSize>::isInPool(const void* ptr) const
 }
 
 template <std::size_t PoolSize, std::size_t BlockSize>
-unsigned PoolAllocator<PoolSize, BlockSize>::getNumFreeBlocks() const
+void PoolAllocator<PoolSize, BlockSize>::resetPeakNumUsedBlocks()
 {
-    unsigned num = 0;
-    Node* p = free_list_;
-    while (p)
-    {
-        num++;
-        UAVCAN_ASSERT(num <= NumBlocks);
-        p = p->next;
-    }
-    return num;
+    peak_used_blocks_ = used_blocks_;
+#if UAVCAN_POOL_ALLOCATION_TAGS
+    copy(tag_used_blocks_, tag_used_blocks_ + NumPoolAllocationTags, tag_peak_used_blocks_);
+#endif
 }
 
 }
@@ -15,6 +15,7 @@
 #include <uavcan/build_config.hpp>
 #include <uavcan/marshal/type_util.hpp>
 #include <uavcan/marshal/integer_spec.hpp>
+#include <uavcan/marshal/float_spec.hpp>
 #include <uavcan/std.hpp>
 
 #ifndef UAVCAN_CPP_VERSION
@@ -118,6 +119,15 @@ protected:
         }
     }
 
+    /**
+     * Changes the size without initializing the new elements; for bulk decoding.
+     */
+    void setSizeUninitialized(SizeType new_size)
+    {
+        UAVCAN_ASSERT(new_size <= MaxSize);
+        size_ = min(new_size, SizeType(MaxSize));
+    }
+
 public:
     enum { SizeBitLen = RawSizeType::BitLen };
 
@@ -297,9 +307,76 @@ class UAVCAN_EXPORT Array : public ArrayImpl<T, ArrayMode, MaxSize_>
         return (T::MinBitLen >= 8) && (tao_mode == TailArrayOptEnabled);
     }
 
+    /*
+     * Arrays of 8-bit integers are copied in bulk rather than element by element.
+     */
+    int encodeBytes(ScalarCodec& codec, TrueType) const
+    {
+        return codec.encodeBytes(reinterpret_cast<const uint8_t*>(Base::begin()), size());
+    }
+
+    int decodeBytes(ScalarCodec& codec, TrueType)
+    {
+        return codec.decodeBytes(reinterpret_cast<uint8_t*>(Base::begin()), size());
+    }
+
+    int decodeTailBytes(ScalarCodec& codec, TrueType)
+    {
+        StaticAssert<IsDynamic>::check();
+        UAVCAN_ASSERT(codec.isByteAligned());
+        const int res = codec.decodeRemainingBytes(reinterpret_cast<uint8_t*>(Base::begin()), MaxSize_);
+        if (res < 0)
+        {
+            return res;
+        }
+        Base::setSizeUninitialized(SizeType(res));
+        if (size() == MaxSize_)
+        {
+            uint8_t extra = 0;
+            const int extra_res = codec.decode<8>(extra);
+            if (extra_res < 0)
+            {
+                return extra_res;
+            }
+            if (extra_res > 0)    // Error: Max array length reached, but the end of stream is not
+            {
+                return -ErrInvalidMarshalData;
+            }
+        }
+        return 1;
+    }
+
+    int encodeBytes(ScalarCodec&, FalseType) const { UAVCAN_ASSERT(0); return -ErrLogic; }
+    int decodeBytes(ScalarCodec&, FalseType) { UAVCAN_ASSERT(0); return -ErrLogic; }
+    int decodeTailBytes(ScalarCodec&, FalseType) { UAVCAN_ASSERT(0); return -ErrLogic; }
+
+    /*
+     * Arrays of float16 are converted in bulk, see FloatSpec::encodeArray().
+     */
+    int encodeHalves(ScalarCodec& codec, TrueType) const
+    {
+        return RawValueType::encodeArray(Base::begin(), size(), codec);
+    }
+
+    int decodeHalves(ScalarCodec& codec, TrueType)
+    {
+        return RawValueType::decodeArray(Base::begin(), size(), codec);
+    }
+
+    int encodeHalves(ScalarCodec&, FalseType) const { UAVCAN_ASSERT(0); return -ErrLogic; }
+    int decodeHalves(ScalarCodec&, FalseType) { UAVCAN_ASSERT(0); return -ErrLogic; }
+
     int encodeImpl(ScalarCodec& codec, const TailArrayOptimizationMode tao_mode, FalseType) const  /// Static
     {
         UAVCAN_ASSERT(size() > 0);
+        if (IsByteArray)
+        {
+            return encodeBytes(codec, BooleanType<IsByteArray>());
+        }
+        if (IsHalfArray)
+        {
+            return encodeHalves(codec, BooleanType<IsHalfArray>());
+        }
         for (SizeType i = 0; i < size(); i++)
         {
             const bool last_item = i == (size() - 1);
@@ -334,6 +411,14 @@ class UAVCAN_EXPORT Array : public ArrayImpl<T, ArrayMode, MaxSize_>
     int decodeImpl(ScalarCodec& codec, const TailArrayOptimizationMode tao_mode, FalseType)  /// Static
     {
         UAVCAN_ASSERT(size() > 0);
+        if (IsByteArray)
+        {
+            return decodeBytes(codec, BooleanType<IsByteArray>());
+        }
+        if (IsHalfArray)
+        {
+            return decodeHalves(codec, BooleanType<IsHalfArray>());
+        }
         for (SizeType i = 0; i < size(); i++)
         {
             const bool last_item = i == (size() - 1);
@@ -354,6 +439,10 @@ class UAVCAN_EXPORT Array : public ArrayImpl<T, ArrayMode, MaxSize_>
         Base::clear();
         if (isOptimizedTailArray(tao_mode))
         {
+            if (IsByteArray && codec.isByteAligned())
+            {
+                return decodeTailBytes(codec, BooleanType<IsByteArray>());
+            }
             while (true)
             {
                 ValueType value = ValueType();
@@ -385,7 +474,14 @@ class UAVCAN_EXPORT Array : public ArrayImpl<T, ArrayMode, MaxSize_>
             {
                 return -ErrInvalidMarshalData;
             }
-            resize(sz);
+            if (IsByteArray)
+            {
+                Base::setSizeUninitialized(sz);     // Will be overwritten by decodeBytes() anyway
+            }
+            else
+            {
+                resize(sz);
+            }
             if (sz == 0)
             {
                 return 1;
@@ -508,6 +604,8 @@ public:
 
     enum { IsDynamic = ArrayMode == ArrayModeDynamic };
     enum { MaxSize = MaxSize_ };
+    enum { IsByteArray = IsIntegerSpec<T>::Result && (T::MaxBitLen == 8) };
+    enum { IsHalfArray = IsFloatSpec<T>::Result && (T::MaxBitLen == 16) };
     enum
     {
         MinBitLen = (IsDynamic == 0)
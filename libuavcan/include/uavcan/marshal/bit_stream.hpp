@@ -14,9 +14,9 @@
 namespace uavcan
 {
 
-#if UAVCAN_TINY
 /**
  * This function implements fast copy of unaligned bit arrays. It isn't part of the library API, so it is not exported.
+ * It processes one byte at a time; this is the only implementation available in UAVCAN_TINY mode.
  * @param src_org       Source array
  * @param src_offset    Bit offset of the first source byte
  * @param src_len       Number of bits to copy
@@ -25,15 +25,29 @@ namespace uavcan
  */
 void bitarrayCopy(const unsigned char* src_org, unsigned src_offset, unsigned src_len,
                   unsigned char* dst_org, unsigned dst_offset);
-#else
+
+#if !UAVCAN_TINY
 /**
  * Special cases of @ref bitarrayCopy() - either source or destination must be aligned.
+ * These functions process one machine word at a time. The bits of the destination outside of the copied range
+ * are preserved, and the source is never read past its last byte that contains the data.
  * These functions aren't part of the library API, so they are not exported.
  */
 void bitarrayCopyAlignedToUnaligned(const unsigned char* src_org, unsigned src_len,
                                     unsigned char* dst_org, unsigned dst_offset);
 void bitarrayCopyUnalignedToAligned(const unsigned char* src_org, unsigned src_offset, unsigned src_len,
                                     unsigned char* dst_org);
+
+/**
+ * Implementations of the above with the specified word type; instantiated for uint32_t and uint64_t.
+ * The functions above use the native word of the platform.
+ */
+template <typename Word>
+void bitarrayCopyAlignedToUnalignedImpl(const unsigned char* src_org, unsigned src_len,
+                                        unsigned char* dst_org, unsigned dst_offset);
+template <typename Word>
+void bitarrayCopyUnalignedToAlignedImpl(const unsigned char* src_org, unsigned src_offset, unsigned src_len,
+                                        unsigned char* dst_org);
 #endif
 
 /**
@@ -111,6 +125,24 @@ public:
     int write(const uint8_t* bytes, const unsigned bitlen);
     int read(uint8_t* bytes, const unsigned bitlen);
 
+    /**
+     * Bulk write/read of byte arrays of any length.
+     * If the current bit offset is byte aligned, the bytes are copied in one call to the underlying buffer;
+     * otherwise they are processed in chunks through write()/read().
+     * Return values are the same as for write()/read().
+     */
+    int writeBytes(const uint8_t* bytes, const unsigned len);
+    int readBytes(uint8_t* bytes, const unsigned len);
+
+    /**
+     * Reads up to max_len bytes until the end of the buffer; used for tail arrays.
+     * The current bit offset must be byte aligned, see @ref isByteAligned().
+     * Returns the number of bytes read, or a negative error code.
+     */
+    int readRemainingBytes(uint8_t* bytes, const unsigned max_len);
+
+    bool isByteAligned() const { return (bit_offset_ % 8) == 0; }
+
 #if UAVCAN_TOSTRING
     std::string toString() const;
 #endif
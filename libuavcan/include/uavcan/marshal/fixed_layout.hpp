@@ -0,0 +1,135 @@
+/*
+ * Copyright (C) 2014 Pavel Kirienko <pavel.kirienko@gmail.com>
+ */
+
+#ifndef UAVCAN_MARSHAL_FIXED_LAYOUT_HPP_INCLUDED
+#define UAVCAN_MARSHAL_FIXED_LAYOUT_HPP_INCLUDED
+
+#include <uavcan/std.hpp>
+#include <uavcan/build_config.hpp>
+#include <uavcan/util/templates.hpp>
+
+namespace uavcan
+{
+/**
+ * Packing/unpacking helpers for data types that contain no dynamic arrays, where the bit offset of every
+ * field is known at compile time. The DSDL compiler emits one call per scalar field; because both the offset
+ * and the length are template arguments, every call collapses into a few constant shifts and masks.
+ *
+ * The resulting layout is exactly the same as produced by @ref ScalarCodec and @ref BitStream:
+ * scalars are split into little endian bytes, the last byte carries the remaining most significant bits,
+ * and each byte is placed into the bit array MSB first.
+ *
+ * The destination buffer must be zero initialized before packing.
+ */
+template <unsigned BitOffset, unsigned ChunkLen, bool SpansTwoBytes = (((BitOffset % 8) + ChunkLen) > 8)>
+struct UAVCAN_EXPORT FixedLayoutChunk
+{
+    enum { Index = BitOffset / 8 };
+    enum { Shift = 8 - (BitOffset % 8) - ChunkLen };
+    enum { Mask = (1U << ChunkLen) - 1U };
+
+    static void pack(uint8_t* buf, uint8_t chunk)
+    {
+        buf[Index] = uint8_t(buf[Index] | (chunk << Shift));
+    }
+
+    static uint8_t unpack(const uint8_t* buf)
+    {
+        return uint8_t((buf[Index] >> Shift) & Mask);
+    }
+};
+
+template <unsigned BitOffset, unsigned ChunkLen>
+struct UAVCAN_EXPORT FixedLayoutChunk<BitOffset, ChunkLen, true>
+{
+    enum { Index = BitOffset / 8 };
+    enum { LowLen = (BitOffset % 8) + ChunkLen - 8 };   ///< Number of bits that go into the second byte
+    enum { Mask = (1U << ChunkLen) - 1U };
+
+    static void pack(uint8_t* buf, uint8_t chunk)
+    {
+        buf[Index] = uint8_t(buf[Index] | (chunk >> LowLen));
+        buf[Index + 1] = uint8_t(buf[Index + 1] | (chunk << (8 - LowLen)));
+    }
+
+    static uint8_t unpack(const uint8_t* buf)
+    {
+        return uint8_t(((buf[Index] << LowLen) | (buf[Index + 1] >> (8 - LowLen))) & Mask);
+    }
+};
+
+/**
+ * Packs/unpacks the lower BitLen bits of an unsigned raw value, one byte per recursion step.
+ */
+template <unsigned BitOffset, unsigned BitLen, unsigned Chunk = 0, bool Done = ((Chunk * 8) >= BitLen)>
+struct UAVCAN_EXPORT FixedLayoutScalar
+{
+    enum { ChunkLen = ((BitLen - Chunk * 8) >= 8) ? 8 : (BitLen - Chunk * 8) };
+
+    typedef FixedLayoutChunk<BitOffset + Chunk * 8, ChunkLen> ThisChunk;
+    typedef FixedLayoutScalar<BitOffset, BitLen, Chunk + 1> NextChunk;
+
+    template <typename T>
+    static void pack(uint8_t* buf, T raw)
+    {
+        ThisChunk::pack(buf, uint8_t((raw >> (Chunk * 8)) & T(ThisChunk::Mask)));
+        NextChunk::pack(buf, raw);
+    }
+
+    template <typename T>
+    static void unpack(const uint8_t* buf, T& raw)
+    {
+        raw = T(raw | (T(ThisChunk::unpack(buf)) << (Chunk * 8)));
+        NextChunk::unpack(buf, raw);
+    }
+};
+
+template <unsigned BitOffset, unsigned BitLen, unsigned Chunk>
+struct UAVCAN_EXPORT FixedLayoutScalar<BitOffset, BitLen, Chunk, true>
+{
+    template <typename T>
+    static void pack(uint8_t*, T) { }
+
+    template <typename T>
+    static void unpack(const uint8_t*, T&) { }
+};
+
+/**
+ * Entry points for the generated code.
+ * Spec is a primitive type specification, e.g. @ref IntegerSpec or @ref FloatSpec; its toRaw()/fromRaw()
+ * apply the same cast mode and conversion as its encode()/decode().
+ */
+template <typename Spec, unsigned BitOffset>
+inline void packFixedLayoutScalar(uint8_t* buf, typename Spec::StorageType value)
+{
+    FixedLayoutScalar<BitOffset, Spec::BitLen>::pack(buf, Spec::toRaw(value));
+}
+
+template <typename Spec, unsigned BitOffset>
+inline typename Spec::StorageType unpackFixedLayoutScalar(const uint8_t* buf)
+{
+    typename Spec::RawType raw = 0;
+    FixedLayoutScalar<BitOffset, Spec::BitLen>::unpack(buf, raw);
+    return Spec::fromRaw(raw);
+}
+
+/**
+ * Compile-time: whether T is a generated data structure with fixed layout, i.e. whether it provides
+ * packFixedLayout() and unpackFixedLayout(). Such types are marked with the nested type FixedLayoutTag.
+ */
+template <typename T, typename Enable = void>
+struct UAVCAN_EXPORT IsFixedLayout
+{
+    enum { Result = 0 };
+};
+
+template <typename T>
+struct UAVCAN_EXPORT IsFixedLayout<T, typename EnableIfType<typename T::FixedLayoutTag>::Type>
+{
+    enum { Result = 1 };
+};
+
+}
+
+#endif // UAVCAN_MARSHAL_FIXED_LAYOUT_HPP_INCLUDED
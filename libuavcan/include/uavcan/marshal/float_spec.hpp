@@ -37,12 +37,30 @@ struct NativeFloatSelector
 class UAVCAN_EXPORT IEEE754Converter
 {
     // TODO: Non-IEEE float support for float32 and float64
-    static uint16_t nativeNonIeeeToHalf(float value);
-    static float halfToNativeNonIeee(uint16_t value);
+#if UAVCAN_FLOAT16_TABLES && !UAVCAN_TINY
+    static const uint16_t SingleToHalfTable[256];   ///< By float32 exponent: float16 exponent base | mantissa shift
+    static const uint32_t HalfToSingleTable[64];    ///< By float16 sign and exponent: float32 sign and exponent
+#endif
 
     IEEE754Converter();
 
 public:
+    /**
+     * Portable float16 conversion that makes no assumptions about the native float format.
+     * This is the reference for the faster kernels, which must produce bit exact results.
+     */
+    static uint16_t nativeNonIeeeToHalf(float value);
+    static float halfToNativeNonIeee(uint16_t value);
+
+    /**
+     * Float16 conversion using the fastest kernel available, see UAVCAN_FLOAT16_TABLES and UAVCAN_FLOAT16_F16C.
+     * Array conversions are equivalent to the scalar ones applied element by element.
+     */
+    static uint16_t nativeToHalf(float value);
+    static float halfToNative(uint16_t value);
+    static void nativeToHalf(const float* src, uint16_t* dst, unsigned count);
+    static void halfToNative(const uint16_t* src, float* dst, unsigned count);
+
 #if UAVCAN_CPP_VERSION >= UAVCAN_CPP11
     /// UAVCAN requires rounding to nearest for all float conversions
     static std::float_round_style roundstyle() { return std::round_to_nearest; }
@@ -80,13 +98,13 @@ template <>
 inline typename IntegerSpec<16, SignednessUnsigned, CastModeTruncate>::StorageType
 IEEE754Converter::toIeee<16>(typename NativeFloatSelector<16>::Type value)
 {
-    return nativeNonIeeeToHalf(value);
+    return nativeToHalf(value);
 }
 template <>
 inline typename NativeFloatSelector<16>::Type
 IEEE754Converter::toNative<16>(typename IntegerSpec<16, SignednessUnsigned, CastModeTruncate>::StorageType value)
 {
-    return halfToNativeNonIeee(value);
+    return halfToNative(value);
 }
 
 
@@ -123,6 +141,7 @@ public:
     enum { IsPrimitive = 1 };
 
     typedef typename NativeFloatSelector<BitLen>::Type StorageType;
+    typedef typename IntegerSpec<BitLen, SignednessUnsigned, CastModeTruncate>::StorageType RawType;
 
 #if UAVCAN_CPP_VERSION < UAVCAN_CPP11
     enum { IsExactRepresentation = (sizeof(StorageType) * 8 == BitLen) };
@@ -138,15 +157,7 @@ public:
 
     static int encode(StorageType value, ScalarCodec& codec, TailArrayOptimizationMode)
     {
-        // cppcheck-suppress duplicateExpression
-        if (CastMode == CastModeSaturate)
-        {
-            saturate(value);
-        }
-        else
-        {
-            truncate(value);
-        }
+        applyCastMode(value);
         return codec.encode<BitLen>(IEEE754Converter::toIeee<BitLen>(value));
     }
 
@@ -162,9 +173,95 @@ public:
         return res;
     }
 
+    /**
+     * Conversion to/from the raw bit pattern, used by the fixed layout codec (see uavcan/marshal/fixed_layout.hpp).
+     */
+    static RawType toRaw(StorageType value)
+    {
+        applyCastMode(value);
+        return IEEE754Converter::toIeee<BitLen>(value);
+    }
+
+    static StorageType fromRaw(RawType raw) { return IEEE754Converter::toNative<BitLen>(raw); }
+
+    /**
+     * Bulk codec for float16 arrays (see @ref Array): values are converted in chunks with the array kernels
+     * of @ref IEEE754Converter and then copied into the bit stream as little endian bytes.
+     * The output and the return value are the same as of a sequence of encode()/decode() calls.
+     */
+    static int encodeArray(const StorageType* values, unsigned count, ScalarCodec& codec)
+    {
+        StaticAssert<BitLen == 16>::check();
+        while (count > 0)
+        {
+            const unsigned chunk_len = min(count, unsigned(ArrayChunkLen));
+            StorageType native[ArrayChunkLen];
+            for (unsigned i = 0; i < chunk_len; i++)
+            {
+                native[i] = values[i];
+                applyCastMode(native[i]);
+            }
+            uint16_t halves[ArrayChunkLen];
+            IEEE754Converter::nativeToHalf(native, halves, chunk_len);
+            uint8_t bytes[ArrayChunkLen * 2];
+            for (unsigned i = 0; i < chunk_len; i++)
+            {
+                bytes[i * 2] = uint8_t(halves[i] & 0xFFU);
+                bytes[i * 2 + 1] = uint8_t(halves[i] >> 8);
+            }
+            const int res = codec.encodeBytes(bytes, chunk_len * 2);
+            if (res <= 0)
+            {
+                return res;
+            }
+            values += chunk_len;
+            count -= chunk_len;
+        }
+        return 1;
+    }
+
+    static int decodeArray(StorageType* values, unsigned count, ScalarCodec& codec)
+    {
+        StaticAssert<BitLen == 16>::check();
+        while (count > 0)
+        {
+            const unsigned chunk_len = min(count, unsigned(ArrayChunkLen));
+            uint8_t bytes[ArrayChunkLen * 2];
+            const int res = codec.decodeBytes(bytes, chunk_len * 2);
+            if (res <= 0)
+            {
+                return res;
+            }
+            uint16_t halves[ArrayChunkLen];
+            for (unsigned i = 0; i < chunk_len; i++)
+            {
+                halves[i] = uint16_t(bytes[i * 2] | (bytes[i * 2 + 1] << 8));
+            }
+            IEEE754Converter::halfToNative(halves, values, chunk_len);
+            values += chunk_len;
+            count -= chunk_len;
+        }
+        return 1;
+    }
+
     static void extendDataTypeSignature(DataTypeSignature&) { }
 
 private:
+    enum { ArrayChunkLen = 16 };
+
+    static inline void applyCastMode(StorageType& value)
+    {
+        // cppcheck-suppress duplicateExpression
+        if (CastMode == CastModeSaturate)
+        {
+            saturate(value);
+        }
+        else
+        {
+            truncate(value);
+        }
+    }
+
     static inline void saturate(StorageType& value)
     {
         if ((IsExactRepresentation == 0) && isFinite(value))
@@ -205,6 +302,19 @@ private:
 };
 
 
+template <typename T>
+struct IsFloatSpec
+{
+    enum { Result = 0 };
+};
+
+template <unsigned BitLen, CastMode CastMode>
+struct IsFloatSpec<FloatSpec<BitLen, CastMode> >
+{
+    enum { Result = 1 };
+};
+
+
 template <unsigned BitLen, CastMode CastMode>
 class UAVCAN_EXPORT YamlStreamer<FloatSpec<BitLen, CastMode> >
 {
@@ -35,6 +35,7 @@ public:
                               ErrorNoSuchInteger>::Result>::Result>::Result>::Result StorageType;
 
     typedef typename IntegerSpec<BitLen, SignednessUnsigned, CastMode>::StorageType UnsignedStorageType;
+    typedef UnsignedStorageType RawType;
 
 private:
     IntegerSpec();
@@ -124,6 +125,35 @@ public:
         return codec.decode<BitLen>(out_value);
     }
 
+    /**
+     * Conversion to/from the raw bit pattern, used by the fixed layout codec (see uavcan/marshal/fixed_layout.hpp).
+     * The cast mode is applied the same way as in encode().
+     */
+    static RawType toRaw(StorageType value)
+    {
+        validate();
+        // cppcheck-suppress duplicateExpression
+        if (CastMode == CastModeSaturate)
+        {
+            saturate(value);
+        }
+        else
+        {
+            truncate(value);
+        }
+        return RawType(value);
+    }
+
+    static StorageType fromRaw(RawType raw)
+    {
+        validate();
+        if (IsSigned && (raw & (RawType(1) << (BitLen - 1))))     // The most significant bit is set --> negative
+        {
+            raw = RawType(raw | RawType(~mask()));
+        }
+        return StorageType(raw);
+    }
+
     static void extendDataTypeSignature(DataTypeSignature&) { }
 };
 
@@ -96,6 +96,26 @@ public:
 
     template <unsigned BitLen, typename T>
     int decode(T& value);
+
+    /**
+     * Bulk encoding/decoding of 8-bit arrays; see @ref BitStream::writeBytes() and @ref BitStream::readBytes().
+     */
+    int encodeBytes(const uint8_t* bytes, unsigned len) { return stream_.writeBytes(bytes, len); }
+    int decodeBytes(uint8_t* bytes, unsigned len) { return stream_.readBytes(bytes, len); }
+
+    /**
+     * Decodes the rest of the stream into a byte array; see @ref BitStream::readRemainingBytes().
+     */
+    int decodeRemainingBytes(uint8_t* bytes, unsigned max_len) { return stream_.readRemainingBytes(bytes, max_len); }
+
+    /**
+     * Bulk encoding/decoding of a bit array of arbitrary length, e.g. a data structure that was packed
+     * by the fixed layout codec (see uavcan/marshal/fixed_layout.hpp).
+     */
+    int encodeBits(const uint8_t* bytes, unsigned bitlen);
+    int decodeBits(uint8_t* bytes, unsigned bitlen);
+
+    bool isByteAligned() const { return stream_.isByteAligned(); }
 };
 
 // ----------------------------------------------------------------------------
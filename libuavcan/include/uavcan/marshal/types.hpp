@@ -9,5 +9,6 @@
 #include <uavcan/marshal/float_spec.hpp>
 #include <uavcan/marshal/array.hpp>
 #include <uavcan/marshal/type_util.hpp>
+#include <uavcan/marshal/fixed_layout.hpp>
 
 #endif // UAVCAN_MARSHAL_TYPES_HPP_INCLUDED
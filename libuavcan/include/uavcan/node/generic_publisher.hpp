@@ -9,9 +9,11 @@
 #include <uavcan/node/abstract_node.hpp>
 #include <uavcan/data_type.hpp>
 #include <uavcan/node/global_data_type_registry.hpp>
+#include <uavcan/util/templates.hpp>
 #include <uavcan/util/lazy_constructor.hpp>
 #include <uavcan/debug.hpp>
 #include <uavcan/transport/transfer_sender.hpp>
+#include <uavcan/transport/transfer_buffer.hpp>
 #include <uavcan/marshal/scalar_codec.hpp>
 #include <uavcan/marshal/types.hpp>
 
@@ -51,6 +53,18 @@ protected:
     int genericPublish(const IMarshalBuffer& buffer, TransferType transfer_type, NodeID dst_node_id,
                        TransferID* tid, MonotonicTime blocking_deadline);
 
+    int genericPublish(const uint8_t* payload, unsigned payload_len, TransferType transfer_type, NodeID dst_node_id,
+                       TransferID* tid, MonotonicTime blocking_deadline);
+
+    /**
+     * Max payload length of a single frame transfer of the given type.
+     */
+    static unsigned getSingleFramePayloadCapacity(TransferType transfer_type)
+    {
+        return (transfer_type == TransferTypeMessageBroadcast) ?
+               unsigned(sizeof(CanFrame::data)) : unsigned(MaxSingleFrameTransferPayloadLen);
+    }
+
     TransferSender* getTransferSender();
 
 public:
@@ -77,10 +91,27 @@ class UAVCAN_EXPORT GenericPublisher : public GenericPublisherBase
               CanTxQueue::Volatile : CanTxQueue::Persistent
     };
 
+    /*
+     * Data structures that may fit one CAN frame are encoded into a small buffer on the stack and sent as a
+     * single frame transfer, bypassing the marshal buffer provider. Whether the data structure fits is known
+     * at compile time if its max length doesn't exceed 7 bytes (MaxBitLen <= 56); otherwise the encoding is
+     * attempted, and if the output turns out to be too long, the generic path is taken instead.
+     * Fixed layout data structures are packed directly, without the bit stream.
+     */
+    enum { MaxByteLen = BitLenToByteLen<DataStruct::MaxBitLen>::Result };
+    enum { MinByteLen = BitLenToByteLen<DataStruct::MinBitLen>::Result };
+    enum { MayFitSingleFrame = int(MinByteLen) <= int(sizeof(CanFrame::data)) };
+    enum { AlwaysFitsSingleFrame = int(MaxByteLen) <= int(MaxSingleFrameTransferPayloadLen) };
+
     int checkInit();
 
     int doEncode(const DataStruct& message, IMarshalBuffer& buffer) const;
 
+    int doEncodeSingleFrame(const DataStruct& message, uint8_t* payload, unsigned capacity,
+                            unsigned& out_payload_len, TrueType) const;
+    int doEncodeSingleFrame(const DataStruct& message, uint8_t* payload, unsigned capacity,
+                            unsigned& out_payload_len, FalseType) const;
+
     int genericPublish(const DataStruct& message, TransferType transfer_type, NodeID dst_node_id,
                        TransferID* tid, MonotonicTime blocking_deadline);
 
@@ -149,6 +180,40 @@ int GenericPublisher<DataSpec, DataStruct>::doEncode(const DataStruct& message,
     return encode_res;
 }
 
+template <typename DataSpec, typename DataStruct>
+int GenericPublisher<DataSpec, DataStruct>::doEncodeSingleFrame(const DataStruct& message, uint8_t* payload,
+                                                                unsigned capacity, unsigned& out_payload_len,
+                                                                TrueType) const
+{
+    if (unsigned(MaxByteLen) > capacity)
+    {
+        return 0;
+    }
+    fill(payload, payload + unsigned(MaxByteLen), uint8_t(0));
+    DataStruct::template packFixedLayout<0>(message, payload);
+    out_payload_len = MaxByteLen;
+    return 1;
+}
+
+template <typename DataSpec, typename DataStruct>
+int GenericPublisher<DataSpec, DataStruct>::doEncodeSingleFrame(const DataStruct& message, uint8_t* payload,
+                                                                unsigned capacity, unsigned& out_payload_len,
+                                                                FalseType) const
+{
+    StaticTransferBufferImpl buffer(payload, uint16_t(capacity));
+    BitStream bitstream(buffer);
+    ScalarCodec codec(bitstream);
+    const int encode_res = DataStruct::encode(message, codec);
+    if (encode_res < 0)
+    {
+        UAVCAN_ASSERT(0);   // Impossible, internal error
+        return -ErrInvalidMarshalData;
+    }
+    UAVCAN_ASSERT((encode_res > 0) || !AlwaysFitsSingleFrame);
+    out_payload_len = buffer.getMaxWritePos();
+    return encode_res;      // Zero means that the encoded data structure doesn't fit
+}
+
 template <typename DataSpec, typename DataStruct>
 int GenericPublisher<DataSpec, DataStruct>::genericPublish(const DataStruct& message, TransferType transfer_type,
                                                            NodeID dst_node_id, TransferID* tid,
@@ -159,7 +224,23 @@ int GenericPublisher<DataSpec, DataStruct>::genericPublish(const DataStruct& mes
     {
         return res;
     }
-    IMarshalBuffer* const buf = getBuffer(BitLenToByteLen<DataStruct::MaxBitLen>::Result);
+    if (MayFitSingleFrame)
+    {
+        uint8_t payload[sizeof(CanFrame::data)];
+        unsigned payload_len = 0;
+        const int encode_res = doEncodeSingleFrame(message, payload, getSingleFramePayloadCapacity(transfer_type),
+                                                   payload_len, BooleanType<IsFixedLayout<DataStruct>::Result>());
+        if (encode_res < 0)
+        {
+            return encode_res;
+        }
+        if (encode_res > 0)
+        {
+            return GenericPublisherBase::genericPublish(payload, payload_len, transfer_type, dst_node_id, tid,
+                                                        blocking_deadline);
+        }
+    }
+    IMarshalBuffer* const buf = getBuffer(MaxByteLen);
     if (!buf)
     {
         return -ErrMemory;
@@ -89,10 +89,12 @@ class GenericSubscriberBase : Noncopyable
 protected:
     INode& node_;
     uint32_t failure_count_;
+    TransferReceiver::ReassemblyMode reassembly_mode_;
 
     explicit GenericSubscriberBase(INode& node)
         : node_(node)
         , failure_count_(0)
+        , reassembly_mode_(TransferReceiver::ReassemblySingleIface)
     { }
 
     ~GenericSubscriberBase() { }
@@ -109,6 +111,11 @@ public:
      */
     uint32_t getFailureCount() const { return failure_count_; }
 
+    /**
+     * Cross iface reassembly is recommended for redundant interfaces. Refer to TransferReceiver::ReassemblyMode.
+     */
+    TransferReceiver::ReassemblyMode getReassemblyMode() const { return reassembly_mode_; }
+
     INode& getNode() const { return node_; }
 };
 
@@ -118,7 +125,10 @@ public:
 template <typename DataStruct_,
           unsigned NumStaticReceivers_,
           unsigned NumStaticBufs_,
-          template<unsigned, unsigned, unsigned> class TransferListenerTemplate = TransferListener
+          template<unsigned, unsigned, unsigned, template<unsigned> class, template<uint16_t, uint8_t> class>
+              class TransferListenerTemplate = TransferListener,
+          template<unsigned> class ReceiverStore = TransferReceiverMap,
+          template<uint16_t, uint8_t> class BufferManager = TransferBufferManager
          >
 class UAVCAN_EXPORT TransferListenerInstantiationHelper
 {
@@ -134,7 +144,8 @@ class UAVCAN_EXPORT TransferListenerInstantiationHelper
 #endif
 
 public:
-    typedef TransferListenerTemplate<BufferSize, NumStaticBufs, NumStaticReceivers> Type;
+    typedef TransferListenerTemplate<BufferSize, NumStaticBufs, NumStaticReceivers, ReceiverStore, BufferManager>
+        Type;
 };
 
 
@@ -165,11 +176,24 @@ class UAVCAN_EXPORT GenericSubscriber : public GenericSubscriberBase
         using ReceivedDataStructure<DataStruct>::setTransfer;
     };
 
+    /*
+     * Fixed layout data structures that fit one CAN frame are unpacked straight from the frame payload
+     * of single frame transfers; other data structures are decoded via the bit stream.
+     */
+    enum
+    {
+        DecodableInPlace = IsFixedLayout<DataStruct>::Result &&
+                           (int(BitLenToByteLen<DataStruct::MaxBitLen>::Result) <= int(sizeof(CanFrame::data)))
+    };
+
     LazyConstructor<TransferForwarder> forwarder_;
     ReceivedDataStructureSpec message_;
 
     int checkInit();
 
+    int decode(IncomingTransfer& transfer, TrueType);
+    int decode(IncomingTransfer& transfer, FalseType);
+
     bool decodeTransfer(IncomingTransfer& transfer);
 
     void handleIncomingTransfer(IncomingTransfer& transfer);
@@ -185,6 +209,21 @@ protected:
 
     virtual void handleReceivedDataStruct(ReceivedDataStructure<DataStruct>&) = 0;
 
+public:
+    /**
+     * Applied when the subscription is started, or immediately if it is started already.
+     * Should be set before the first transfer is received. Refer to TransferListenerBase::setReassemblyMode().
+     */
+    void setReassemblyMode(TransferReceiver::ReassemblyMode mode)
+    {
+        reassembly_mode_ = mode;
+        if (forwarder_)
+        {
+            forwarder_->setReassemblyMode(mode);
+        }
+    }
+
+protected:
     int startAsMessageListener()
     {
         return genericStart(&Dispatcher::registerMessageListener);
@@ -243,18 +282,37 @@ int GenericSubscriber<DataSpec, DataStruct, TransferListenerType>::checkInit()
     }
     forwarder_.template construct<SelfType&, const DataTypeDescriptor&, IPoolAllocator&>
         (*this, *descr, node_.getAllocator());
+    forwarder_->setReassemblyMode(reassembly_mode_);
     return 0;
 }
 
 template <typename DataSpec, typename DataStruct, typename TransferListenerType>
-bool GenericSubscriber<DataSpec, DataStruct, TransferListenerType>::decodeTransfer(IncomingTransfer& transfer)
+int GenericSubscriber<DataSpec, DataStruct, TransferListenerType>::decode(IncomingTransfer& transfer, TrueType)
+{
+    const uint8_t* const payload = transfer.getSingleFramePayloadPtr();
+    if ((payload == NULL) ||
+        (transfer.getSingleFramePayloadLen() < unsigned(BitLenToByteLen<DataStruct::MaxBitLen>::Result)))
+    {
+        return decode(transfer, FalseType());
+    }
+    DataStruct::template unpackFixedLayout<0>(message_, payload);
+    return 1;
+}
+
+template <typename DataSpec, typename DataStruct, typename TransferListenerType>
+int GenericSubscriber<DataSpec, DataStruct, TransferListenerType>::decode(IncomingTransfer& transfer, FalseType)
 {
     BitStream bitstream(transfer);
     ScalarCodec codec(bitstream);
+    return DataStruct::decode(message_, codec);
+}
 
+template <typename DataSpec, typename DataStruct, typename TransferListenerType>
+bool GenericSubscriber<DataSpec, DataStruct, TransferListenerType>::decodeTransfer(IncomingTransfer& transfer)
+{
     message_.setTransfer(&transfer);
 
-    const int decode_res = DataStruct::decode(message_, codec);
+    const int decode_res = decode(transfer, BooleanType<DecodableInPlace>());
     // We don't need the data anymore, the memory can be reused from the callback:
     transfer.release();
     if (decode_res <= 0)
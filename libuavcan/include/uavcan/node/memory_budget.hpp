@@ -0,0 +1,457 @@
+/*
+ * Copyright (C) 2014 Pavel Kirienko <pavel.kirienko@gmail.com>
+ */
+
+#ifndef UAVCAN_NODE_MEMORY_BUDGET_HPP_INCLUDED
+#define UAVCAN_NODE_MEMORY_BUDGET_HPP_INCLUDED
+
+#include <uavcan/build_config.hpp>
+#include <uavcan/dynamic_memory.hpp>
+#include <uavcan/marshal/type_util.hpp>
+#include <uavcan/transport/transfer.hpp>
+#include <uavcan/transport/transfer_buffer.hpp>
+#include <uavcan/transport/transfer_receiver.hpp>
+#include <uavcan/transport/transfer_receiver_store.hpp>
+#include <uavcan/transport/outgoing_transfer_registry.hpp>
+#include <uavcan/util/map.hpp>
+#include <uavcan/util/hash_map.hpp>
+#include <uavcan/util/templates.hpp>
+#include <uavcan/protocol/NodeStatus.hpp>
+#include <uavcan/protocol/GlobalDiscoveryRequest.hpp>
+#include <uavcan/protocol/GetNodeInfo.hpp>
+#include <uavcan/protocol/ComputeAggregateTypeSignature.hpp>
+#include <uavcan/protocol/GetDataTypeInfo.hpp>
+#if !UAVCAN_TINY
+# include <uavcan/protocol/debug/LogMessage.hpp>
+# include <uavcan/protocol/RestartNode.hpp>
+# include <uavcan/protocol/GetTransportStats.hpp>
+#endif
+
+/*
+ * Compile-time calculator of the worst case memory pool usage.
+ *
+ * The application lists what the node does, and the calculator computes the number of pool blocks that will be
+ * needed in the worst case, when all expected remote nodes are transmitting at the same time:
+ *
+ *   typedef uavcan::MemoryBudget<
+ *       uavcan::SubscriberMemoryBudget<uavcan::protocol::NodeStatus, 20>,         // 20 nodes publish NodeStatus
+ *       uavcan::PublisherMemoryBudget<uavcan::equipment::gnss::Fix>,
+ *       uavcan::ServiceServerMemoryBudget<uavcan::protocol::param::GetSet, 2>,     // Up to 2 clients at once
+ *       uavcan::TxQueueMemoryBudget<100, 2>                                       // 100 frames per iface, 2 ifaces
+ *   > Budget;
+ *
+ *   typedef uavcan::NodeMemoryBudget<Budget, 20> NodeBudget;   // Includes the node's own services
+ *
+ *   uavcan::Node<NodeBudget::MemPoolSize> node(can_driver, system_clock, 100);     // TX queue quota per iface
+ *
+ * Or, if the pool size is chosen otherwise, NodeBudget::checkPoolSize<MemPoolSize>() fails to compile if the pool
+ * is too small. The enum values can also be printed to see where the memory goes.
+ *
+ * The store types default to the ones of the library's default configuration; if the application uses other ones
+ * (e.g. TransferReceiverTable, ArenaBuffers<> or HashedOutgoingTransferRegistry), the same types must be passed
+ * to the budgets. Per source trackers of the cross iface reassembly mode are not accounted for.
+ */
+namespace uavcan
+{
+/**
+ * Internal. Number of segments of HashMap<> once NumEntries entries have been inserted into it, starting from
+ * NumSegments segments. Follows the logic of HashMapBase<>::insert() and grow().
+ */
+template <unsigned NumKVPerSegment, unsigned NumStaticSlots, unsigned MaxSegments, unsigned NumEntries,
+          unsigned NumSegments,
+          bool Fits = ((NumEntries * 4U) <= ((NumStaticSlots + NumSegments * NumKVPerSegment) * 3U)) ||
+                      (NumSegments >= MaxSegments)>
+class UAVCAN_EXPORT HashMapSegmentsMemoryBudget
+{
+    enum { Capacity = NumStaticSlots + NumSegments * NumKVPerSegment };
+    enum { SizeAtGrowth = unsigned(Capacity) * 3U / 4U };       // Size when the table doesn't accept one more entry
+    enum { MinWantedCapacity = ((unsigned(SizeAtGrowth) + 1U) * 4U + 2U) / 3U + 1U };
+    enum
+    {
+        WantedCapacity = ((unsigned(Capacity) * 2U) > unsigned(MinWantedCapacity)) ?
+                         (unsigned(Capacity) * 2U) : unsigned(MinWantedCapacity)
+    };
+    enum
+    {
+        WantedSegments = (unsigned(WantedCapacity) - NumStaticSlots + NumKVPerSegment - 1U) / NumKVPerSegment
+    };
+    enum
+    {
+        NewNumSegments = (unsigned(WantedSegments) > NumSegments) ?
+                         ((unsigned(WantedSegments) < MaxSegments) ? unsigned(WantedSegments) : MaxSegments) :
+                         (NumSegments + 1U)
+    };
+
+public:
+    enum
+    {
+        Result = HashMapSegmentsMemoryBudget<NumKVPerSegment, NumStaticSlots, MaxSegments, NumEntries,
+                                             NewNumSegments>::Result
+    };
+};
+
+template <unsigned NumKVPerSegment, unsigned NumStaticSlots, unsigned MaxSegments, unsigned NumEntries,
+          unsigned NumSegments>
+class UAVCAN_EXPORT HashMapSegmentsMemoryBudget<NumKVPerSegment, NumStaticSlots, MaxSegments, NumEntries,
+                                                NumSegments, true>
+{
+public:
+    enum { Result = NumSegments };
+};
+
+/**
+ * Worst case number of pool blocks used by HashMap<Key, Value, NumStaticEntries, MaxSegments> that holds
+ * NumEntries entries: the segments and the directory blocks.
+ */
+template <typename Key, typename Value, unsigned NumStaticEntries, unsigned NumEntries, unsigned MaxSegments = 128>
+class UAVCAN_EXPORT HashMapMemoryBudget
+{
+    typedef HashMapBase<Key, Value> Base;
+
+public:
+    enum
+    {
+        NumSegments = HashMapSegmentsMemoryBudget<Base::NumKVPerPoolBlock,
+                                                  HashMap<Key, Value, NumStaticEntries, MaxSegments>::NumStaticSlots,
+                                                  MaxSegments, NumEntries, 0>::Result
+    };
+    enum
+    {
+        NumBlocks = unsigned(NumSegments) +
+                    (unsigned(NumSegments) + unsigned(Base::NumSegmentsPerDirectoryBlock) - 1U) /
+                    unsigned(Base::NumSegmentsPerDirectoryBlock)
+    };
+};
+
+/**
+ * Internal. Worst case number of pool blocks used by ReceiverStore<NumStaticReceivers> that holds NumReceivers
+ * receivers. Defined for the receiver stores of the library only.
+ */
+template <template <unsigned> class ReceiverStore, unsigned NumStaticReceivers, unsigned NumReceivers>
+class UAVCAN_EXPORT TransferReceiverStoreMemoryBudget;
+
+template <unsigned NumStaticReceivers, unsigned NumReceivers>
+class UAVCAN_EXPORT TransferReceiverStoreMemoryBudget<TransferReceiverMap, NumStaticReceivers, NumReceivers>
+{
+    enum { ReceiversPerBlock = MapBase<TransferBufferManagerKey, TransferReceiver>::NumKVPerPoolBlock };
+    enum { NumDynamic = (NumReceivers > NumStaticReceivers) ? (NumReceivers - NumStaticReceivers) : 0 };
+
+public:
+    enum { NumBlocks = (unsigned(NumDynamic) + unsigned(ReceiversPerBlock) - 1U) / unsigned(ReceiversPerBlock) };
+};
+
+template <unsigned NumStaticReceivers, unsigned NumReceivers>
+class UAVCAN_EXPORT TransferReceiverStoreMemoryBudget<TransferReceiverHashMap, NumStaticReceivers, NumReceivers>
+{
+public:
+    enum
+    {
+        NumBlocks = HashMapMemoryBudget<TransferBufferManagerKey, TransferReceiver, NumStaticReceivers,
+                                        NumReceivers>::NumBlocks
+    };
+};
+
+template <unsigned NumStaticReceivers, unsigned NumReceivers>
+class UAVCAN_EXPORT TransferReceiverStoreMemoryBudget<TransferReceiverTable, NumStaticReceivers, NumReceivers>
+{
+public:
+    // One block per receiver
+    enum { NumBlocks = (NumReceivers > NumStaticReceivers) ? (NumReceivers - NumStaticReceivers) : 0 };
+};
+
+/**
+ * Internal. Worst case number of pool blocks used by the buffer manager BufferManagerType that holds NumBuffers
+ * buffers at once. Buffer managers other than TransferBufferManager, i.e. ArenaBuffers<>::Manager, don't use
+ * the pool.
+ */
+template <typename BufferManagerType, unsigned NumBuffers>
+class UAVCAN_EXPORT TransferBufferManagerMemoryBudget
+{
+public:
+    enum { BlocksPerBuffer = 0 };
+    enum { NumBlocks = 0 };
+};
+
+template <uint16_t MaxBufSize, uint8_t NumStaticBufs, unsigned NumBuffers>
+class UAVCAN_EXPORT TransferBufferManagerMemoryBudget<TransferBufferManager<MaxBufSize, NumStaticBufs>, NumBuffers>
+{
+    enum { BufferBytesPerBlock = DynamicTransferBufferManagerEntry::PayloadBytesPerPoolBlock };
+    enum
+    {
+        NumDynamicBufs = ((MaxBufSize > 0) && (NumBuffers > NumStaticBufs)) ? (NumBuffers - NumStaticBufs) : 0
+    };
+
+public:
+    enum
+    {
+        BlocksPerBuffer = 1U + (unsigned(MaxBufSize) + unsigned(BufferBytesPerBlock) - 1U) /
+                          unsigned(BufferBytesPerBlock)
+    };
+    enum { NumBlocks = unsigned(NumDynamicBufs) * unsigned(BlocksPerBuffer) };
+};
+
+/**
+ * Internal. Worst case number of pool blocks used by a transfer listener that receives DataStruct from
+ * NumRemoteNodes at the same time. Follows the logic of TransferListenerInstantiationHelper.
+ */
+template <typename DataStruct, unsigned NumRemoteNodes, unsigned NumStaticReceivers_, unsigned NumStaticBufs_,
+          template <unsigned> class ReceiverStore = TransferReceiverMap,
+          template <uint16_t, uint8_t> class BufferManager = TransferBufferManager>
+class UAVCAN_EXPORT TransferListenerMemoryBudget
+{
+    enum { MaxByteLen = BitLenToByteLen<DataStruct::MaxBitLen>::Result };
+    enum { NeedsBuffer = unsigned(MaxByteLen) > MaxSingleFrameTransferPayloadLen };
+    enum { BufferSize = NeedsBuffer ? MaxByteLen : 0 };
+#if UAVCAN_TINY
+    enum { NumStaticReceivers = 0 };
+    enum { NumStaticBufs = 0 };
+#else
+    enum { NumStaticReceivers = NumStaticReceivers_ };
+    enum { NumStaticBufs = NeedsBuffer ? NumStaticBufs_ : 0 };
+#endif
+
+    typedef TransferReceiverStoreMemoryBudget<ReceiverStore, NumStaticReceivers, NumRemoteNodes> ReceiverBudget;
+    typedef TransferBufferManagerMemoryBudget<BufferManager<BufferSize, NumStaticBufs>, NumRemoteNodes> BufferBudget;
+
+public:
+    enum { ReceiverBlocks = ReceiverBudget::NumBlocks };
+    enum { BlocksPerBuffer = BufferBudget::BlocksPerBuffer };
+    enum { BufferBlocks = BufferBudget::NumBlocks };
+    enum { NumBlocks = unsigned(ReceiverBlocks) + unsigned(BufferBlocks) };
+    enum { NumOutgoingTransfers = 0 };
+};
+
+/**
+ * Subscriber<DataType> that receives messages from NumPublishers nodes.
+ * Static receivers, buffers and the store types must be the same as in the Subscriber<> declaration.
+ */
+template <typename DataType,
+          unsigned NumPublishers,
+#if UAVCAN_TINY
+          unsigned NumStaticReceivers = 0,
+          unsigned NumStaticBufs = 0,
+#else
+          unsigned NumStaticReceivers = 2,
+          unsigned NumStaticBufs = 1,
+#endif
+          template <unsigned> class ReceiverStore = TransferReceiverMap,
+          template <uint16_t, uint8_t> class BufferManager = TransferBufferManager
+          >
+class UAVCAN_EXPORT SubscriberMemoryBudget
+    : public TransferListenerMemoryBudget<DataType, NumPublishers, NumStaticReceivers, NumStaticBufs,
+                                          ReceiverStore, BufferManager>
+{ };
+
+/**
+ * ServiceServer<DataType> that serves NumClients nodes at the same time.
+ * Responses don't need outgoing transfer registry entries.
+ */
+template <typename DataType,
+          unsigned NumClients,
+#if UAVCAN_TINY
+          unsigned NumStaticReceivers = 0,
+          unsigned NumStaticBufs = 0,
+#else
+          unsigned NumStaticReceivers = 2,
+          unsigned NumStaticBufs = 1,
+#endif
+          template <unsigned> class ReceiverStore = TransferReceiverMap,
+          template <uint16_t, uint8_t> class BufferManager = TransferBufferManager
+          >
+class UAVCAN_EXPORT ServiceServerMemoryBudget
+    : public TransferListenerMemoryBudget<typename DataType::Request, NumClients, NumStaticReceivers, NumStaticBufs,
+                                          ReceiverStore, BufferManager>
+{ };
+
+/**
+ * ServiceClient<DataType> that calls NumServers nodes.
+ * Every server takes one outgoing transfer registry entry.
+ */
+template <typename DataType, unsigned NumServers = 1,
+          template <uint16_t, uint8_t> class BufferManager = TransferBufferManager>
+class UAVCAN_EXPORT ServiceClientMemoryBudget
+{
+    typedef TransferListenerMemoryBudget<typename DataType::Response, NumServers, 1, 1,
+                                         TransferReceiverMap, BufferManager> ListenerBudget;
+
+public:
+    enum { NumBlocks = ListenerBudget::NumBlocks };
+    enum { NumOutgoingTransfers = NumServers };
+};
+
+/**
+ * Publisher<DataType> that publishes broadcast messages, and unicast messages to NumUnicastDestinations nodes.
+ * Every destination takes one outgoing transfer registry entry.
+ */
+template <typename DataType, unsigned NumUnicastDestinations = 0>
+class UAVCAN_EXPORT PublisherMemoryBudget
+{
+public:
+    enum { NumBlocks = 0 };
+    enum { NumOutgoingTransfers = 1 + NumUnicastDestinations };
+};
+
+/**
+ * CAN TX queue that holds up to NumFramesPerIface frames per interface. A frame takes one block regardless of the
+ * number of interfaces it is sent to, but in the worst case every interface has its own frames pending.
+ * The same number must be passed to the Node<> constructor as tx_queue_blocks_per_iface; otherwise the quota is
+ * derived from the pool size, and the queue may take most of the pool regardless of this budget.
+ */
+template <unsigned NumFramesPerIface, unsigned NumIfaces = 1>
+class UAVCAN_EXPORT TxQueueMemoryBudget
+{
+public:
+    enum { NumBlocks = NumFramesPerIface * NumIfaces };
+    enum { NumOutgoingTransfers = 0 };
+};
+
+/**
+ * Placeholder for unused arguments of MemoryBudget<>.
+ */
+class UAVCAN_EXPORT NoMemoryBudget
+{
+public:
+    enum { NumBlocks = 0 };
+    enum { NumOutgoingTransfers = 0 };
+};
+
+/**
+ * Sum of up to 12 budgets. Can be nested if more are needed.
+ */
+template <typename B0,
+          typename B1 = NoMemoryBudget, typename B2 = NoMemoryBudget, typename B3 = NoMemoryBudget,
+          typename B4 = NoMemoryBudget, typename B5 = NoMemoryBudget, typename B6 = NoMemoryBudget,
+          typename B7 = NoMemoryBudget, typename B8 = NoMemoryBudget, typename B9 = NoMemoryBudget,
+          typename B10 = NoMemoryBudget, typename B11 = NoMemoryBudget>
+class UAVCAN_EXPORT MemoryBudget
+{
+public:
+    enum
+    {
+        NumBlocks = unsigned(B0::NumBlocks) + unsigned(B1::NumBlocks) + unsigned(B2::NumBlocks) +
+                    unsigned(B3::NumBlocks) + unsigned(B4::NumBlocks) + unsigned(B5::NumBlocks) +
+                    unsigned(B6::NumBlocks) + unsigned(B7::NumBlocks) + unsigned(B8::NumBlocks) +
+                    unsigned(B9::NumBlocks) + unsigned(B10::NumBlocks) + unsigned(B11::NumBlocks)
+    };
+    enum
+    {
+        NumOutgoingTransfers =
+            unsigned(B0::NumOutgoingTransfers) + unsigned(B1::NumOutgoingTransfers) +
+            unsigned(B2::NumOutgoingTransfers) + unsigned(B3::NumOutgoingTransfers) +
+            unsigned(B4::NumOutgoingTransfers) + unsigned(B5::NumOutgoingTransfers) +
+            unsigned(B6::NumOutgoingTransfers) + unsigned(B7::NumOutgoingTransfers) +
+            unsigned(B8::NumOutgoingTransfers) + unsigned(B9::NumOutgoingTransfers) +
+            unsigned(B10::NumOutgoingTransfers) + unsigned(B11::NumOutgoingTransfers)
+    };
+};
+
+/**
+ * Services that are started by Node<>::start(), for NumRemoteNodes nodes that may use them at the same time.
+ */
+template <unsigned NumRemoteNodes>
+class UAVCAN_EXPORT NodeProtocolMemoryBudget
+    : public MemoryBudget<PublisherMemoryBudget<protocol::NodeStatus>,
+                          SubscriberMemoryBudget<protocol::GlobalDiscoveryRequest, NumRemoteNodes>,
+                          ServiceServerMemoryBudget<protocol::GetNodeInfo, NumRemoteNodes>,
+                          ServiceServerMemoryBudget<protocol::ComputeAggregateTypeSignature, NumRemoteNodes>,
+                          ServiceServerMemoryBudget<protocol::GetDataTypeInfo, NumRemoteNodes>
+#if !UAVCAN_TINY
+                          , PublisherMemoryBudget<protocol::debug::LogMessage>
+                          , ServiceServerMemoryBudget<protocol::RestartNode, NumRemoteNodes>
+                          , ServiceServerMemoryBudget<protocol::GetTransportStats, NumRemoteNodes>
+#endif
+                          >
+{ };
+
+/**
+ * Internal. Worst case number of pool blocks used by the outgoing transfer registry RegistryType that tracks
+ * NumTransfers transfers. Defined for the registries of the library only.
+ */
+template <typename RegistryType, unsigned NumTransfers>
+class UAVCAN_EXPORT OutgoingTransferRegistryMemoryBudget;
+
+template <int NumStaticEntries, unsigned NumTransfers>
+class UAVCAN_EXPORT OutgoingTransferRegistryMemoryBudget<OutgoingTransferRegistry<NumStaticEntries>, NumTransfers>
+{
+    enum { EntriesPerBlock = OutgoingTransferRegistry<NumStaticEntries>::NumEntriesPerPoolBlock };
+    enum
+    {
+        NumDynamic = (NumTransfers > unsigned(NumStaticEntries)) ? (NumTransfers - unsigned(NumStaticEntries)) : 0
+    };
+
+public:
+    enum { NumBlocks = (unsigned(NumDynamic) + unsigned(EntriesPerBlock) - 1U) / unsigned(EntriesPerBlock) };
+};
+
+template <unsigned NumStaticEntries, unsigned IndexSize, unsigned NumTransfers>
+class UAVCAN_EXPORT OutgoingTransferRegistryMemoryBudget<HashedOutgoingTransferRegistry<NumStaticEntries, IndexSize>,
+                                                         NumTransfers>
+{
+    typedef HashedOutgoingTransferRegistry<NumStaticEntries, IndexSize> Registry;
+
+    enum { EntriesPerOverflowBlock = Registry::NumOverflowEntriesPerPoolBlock };
+    enum
+    {
+        NumIndexed = (NumTransfers < unsigned(Registry::MaxEntries)) ? NumTransfers : unsigned(Registry::MaxEntries)
+    };
+    enum { NumOverflow = NumTransfers - unsigned(NumIndexed) };
+
+public:
+    // One block per entry in the index past the static ones, the rest goes to the overflow list
+    enum { IndexBlocks = (unsigned(NumIndexed) > NumStaticEntries) ? (unsigned(NumIndexed) - NumStaticEntries) : 0 };
+    enum
+    {
+        OverflowBlocks = (unsigned(NumOverflow) + unsigned(EntriesPerOverflowBlock) - 1U) /
+                         unsigned(EntriesPerOverflowBlock)
+    };
+    enum { NumBlocks = unsigned(IndexBlocks) + unsigned(OverflowBlocks) };
+};
+
+/**
+ * Memory pool requirement of Node<>.
+ *
+ * @tparam Budget                                   Sum of the application's budgets, see MemoryBudget<>.
+ * @tparam NumRemoteNodes                           Number of nodes that may use the node's own services at once.
+ * @tparam OutgoingTransferRegistryStaticEntries    Same as in the Node<> declaration.
+ * @tparam OutgoingTransferRegistryType             Same as in the Node<> declaration.
+ */
+template <typename Budget,
+          unsigned NumRemoteNodes,
+#if UAVCAN_TINY
+          unsigned OutgoingTransferRegistryStaticEntries = 0,
+#else
+          unsigned OutgoingTransferRegistryStaticEntries = 10,
+#endif
+          typename OutgoingTransferRegistryType = OutgoingTransferRegistry<int(OutgoingTransferRegistryStaticEntries)>
+          >
+class UAVCAN_EXPORT NodeMemoryBudget
+{
+    typedef MemoryBudget<Budget, NodeProtocolMemoryBudget<NumRemoteNodes> > TotalBudget;
+
+public:
+    enum { NumOutgoingTransfers = TotalBudget::NumOutgoingTransfers };
+    enum
+    {
+        OutgoingTransferBlocks =
+            OutgoingTransferRegistryMemoryBudget<OutgoingTransferRegistryType, NumOutgoingTransfers>::NumBlocks
+    };
+    enum { NumBlocks = unsigned(TotalBudget::NumBlocks) + unsigned(OutgoingTransferBlocks) };
+
+    /**
+     * Minimal value of the MemPoolSize parameter of Node<>.
+     */
+    enum { MemPoolSize = unsigned(NumBlocks) * unsigned(MemPoolBlockSize) };
+
+    /**
+     * Fails to compile if the pool is smaller than required.
+     */
+    template <std::size_t ActualMemPoolSize>
+    static void checkPoolSize()
+    {
+        StaticAssert<(ActualMemPoolSize >= std::size_t(MemPoolSize))>::check();
+    }
+};
+
+}
+
+#endif // UAVCAN_NODE_MEMORY_BUDGET_HPP_INCLUDED
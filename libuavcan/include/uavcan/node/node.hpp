@@ -38,6 +38,8 @@ namespace uavcan
  *                          For simple nodes this number can be reduced.
  *                          For high-traffic nodes the recommended minimum is
  *                          like 16K * (number of CAN ifaces + 1).
+ *                          The actual requirement can be found at run time with
+ *                          getAllocator().getPeakNumUsedBlocks() and its per-owner overloads.
  *
  * @tparam OutgoingTransferRegistryStaticEntries    Number of statically allocated objects
  *                                                  to track Transfer ID for outgoing transfers.
@@ -53,15 +55,23 @@ namespace uavcan
  *                                          Note that in tiny mode the default value is actually
  *                                          smaller than @ref MaxTransferPayloadLen (may cause
  *                                          run-time failures).
+ *
+ * @tparam OutgoingTransferRegistryType     Container that tracks Transfer ID of outgoing transfers; it must be
+ *                                          constructible from @ref IPoolAllocator. The default is compact.
+ *                                          Nodes that keep many outgoing transfers at once (e.g. a gateway that
+ *                                          calls services of many nodes) may use @ref HashedOutgoingTransferRegistry,
+ *                                          which has constant lookup time up to a fixed capacity; refer to its docs.
+ *                                          OutgoingTransferRegistryStaticEntries doesn't apply to custom types.
  */
 template <std::size_t MemPoolSize_,
 #if UAVCAN_TINY
           unsigned OutgoingTransferRegistryStaticEntries = 0,
-          unsigned OutgoingTransferMaxPayloadLen = 264
+          unsigned OutgoingTransferMaxPayloadLen = 264,
 #else
           unsigned OutgoingTransferRegistryStaticEntries = 10,
-          unsigned OutgoingTransferMaxPayloadLen = MaxTransferPayloadLen
+          unsigned OutgoingTransferMaxPayloadLen = MaxTransferPayloadLen,
 #endif
+          typename OutgoingTransferRegistryType = OutgoingTransferRegistry<OutgoingTransferRegistryStaticEntries>
           >
 class UAVCAN_EXPORT Node : public INode
 {
@@ -74,7 +84,7 @@ class UAVCAN_EXPORT Node : public INode
 
     Allocator pool_allocator_;
     MarshalBufferProvider<OutgoingTransferMaxPayloadLen> marsh_buf_;
-    OutgoingTransferRegistry<OutgoingTransferRegistryStaticEntries> outgoing_trans_reg_;
+    OutgoingTransferRegistryType outgoing_trans_reg_;
     Scheduler scheduler_;
 
     DataTypeInfoProvider proto_dtp_;
@@ -101,9 +111,15 @@ protected:
     virtual IMarshalBufferProvider& getMarshalBufferProvider() { return marsh_buf_; }
 
 public:
-    Node(ICanDriver& can_driver, ISystemClock& system_clock)
+    /**
+     * @param tx_queue_blocks_per_iface     Max number of frames pending in the TX queue per interface, one memory
+     *                                      block each. Zero means (number of pool blocks) / (number of
+     *                                      interfaces + 1) + 1. Must be set if the pool size is computed by
+     *                                      NodeMemoryBudget<>, refer to TxQueueMemoryBudget<>.
+     */
+    Node(ICanDriver& can_driver, ISystemClock& system_clock, std::size_t tx_queue_blocks_per_iface = 0)
         : outgoing_trans_reg_(pool_allocator_)
-        , scheduler_(can_driver, pool_allocator_, system_clock, outgoing_trans_reg_)
+        , scheduler_(can_driver, pool_allocator_, system_clock, outgoing_trans_reg_, tx_queue_blocks_per_iface)
         , proto_dtp_(*this)
         , proto_nsp_(*this)
 #if !UAVCAN_TINY
@@ -259,8 +275,9 @@ public:
 // ----------------------------------------------------------------------------
 
 template <std::size_t MemPoolSize_, unsigned OutgoingTransferRegistryStaticEntries,
-          unsigned OutgoingTransferMaxPayloadLen>
-int Node<MemPoolSize_, OutgoingTransferRegistryStaticEntries, OutgoingTransferMaxPayloadLen>::start()
+          unsigned OutgoingTransferMaxPayloadLen, typename OutgoingTransferRegistryType>
+int Node<MemPoolSize_, OutgoingTransferRegistryStaticEntries, OutgoingTransferMaxPayloadLen,
+         OutgoingTransferRegistryType>::start()
 {
     if (started_)
     {
@@ -306,8 +323,9 @@ fail:
 #if !UAVCAN_TINY
 
 template <std::size_t MemPoolSize_, unsigned OutgoingTransferRegistryStaticEntries,
-          unsigned OutgoingTransferMaxPayloadLen>
-int Node<MemPoolSize_, OutgoingTransferRegistryStaticEntries, OutgoingTransferMaxPayloadLen>::
+          unsigned OutgoingTransferMaxPayloadLen, typename OutgoingTransferRegistryType>
+int Node<MemPoolSize_, OutgoingTransferRegistryStaticEntries, OutgoingTransferMaxPayloadLen,
+         OutgoingTransferRegistryType>::
 checkNetworkCompatibility(NetworkCompatibilityCheckResult& result)
 {
     if (!started_)
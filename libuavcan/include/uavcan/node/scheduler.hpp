@@ -69,22 +69,33 @@ class UAVCAN_EXPORT Scheduler : Noncopyable
     enum { MinCleanupPeriodMs = 10 };
     enum { MaxCleanupPeriodMs = 10000 };
 
+    enum { DefaultCleanupTimeSliceUs = 500 };
+    enum { MaxCleanupTimeSliceMs = 100 };
+
     DeadlineScheduler deadline_scheduler_;
     Dispatcher dispatcher_;
     MonotonicTime prev_cleanup_ts_;
     MonotonicDuration deadline_resolution_;
     MonotonicDuration cleanup_period_;
+    MonotonicDuration cleanup_time_slice_;
+    bool cleanup_in_progress_;
     bool inside_spin_;
 
     MonotonicTime computeDispatcherSpinDeadline(MonotonicTime spin_deadline) const;
     void pollCleanup(MonotonicTime mono_ts, uint32_t num_frames_processed_with_last_spin);
 
 public:
-    Scheduler(ICanDriver& can_driver, IPoolAllocator& allocator, ISystemClock& sysclock, IOutgoingTransferRegistry& otr)
-        : dispatcher_(can_driver, allocator, sysclock, otr)
+    /**
+     * @param tx_queue_blocks_per_iface     Refer to CanIOManager::CanIOManager(), mem_blocks_per_iface.
+     */
+    Scheduler(ICanDriver& can_driver, IPoolAllocator& allocator, ISystemClock& sysclock, IOutgoingTransferRegistry& otr,
+              std::size_t tx_queue_blocks_per_iface = 0)
+        : dispatcher_(can_driver, allocator, sysclock, otr, tx_queue_blocks_per_iface)
         , prev_cleanup_ts_(sysclock.getMonotonic())
         , deadline_resolution_(MonotonicDuration::fromMSec(DefaultDeadlineResolutionMs))
         , cleanup_period_(MonotonicDuration::fromMSec(DefaultCleanupPeriodMs))
+        , cleanup_time_slice_(MonotonicDuration::fromUSec(DefaultCleanupTimeSliceUs))
+        , cleanup_in_progress_(false)
         , inside_spin_(false)
     { }
 
@@ -128,6 +139,23 @@ public:
         period = max(period, MonotonicDuration::fromMSec(MinCleanupPeriodMs));
         cleanup_period_ = period;
     }
+
+    /**
+     * Time after which one spin iteration stops starting new cleanup steps.
+     * Once the cleanup period expires, the cleanup is carried out in steps over as many spin iterations as
+     * necessary. Zero means one step per spin iteration.
+     * This is not a hard bound: a step that has been started is always completed, so the time spent on cleanup
+     * per spin iteration is up to the time slice plus the duration of the longest step. The steps are:
+     *  - the outgoing transfer registry, linear in the number of registered outgoing transfers;
+     *  - the listeners of one data type ID, linear in the total number of their receivers.
+     */
+    MonotonicDuration getCleanupTimeSlice() const { return cleanup_time_slice_; }
+    void setCleanupTimeSlice(MonotonicDuration time_slice)
+    {
+        time_slice = min(time_slice, MonotonicDuration::fromMSec(MaxCleanupTimeSliceMs));
+        time_slice = max(time_slice, MonotonicDuration());
+        cleanup_time_slice_ = time_slice;
+    }
 };
 
 }
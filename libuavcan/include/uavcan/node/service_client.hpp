@@ -20,12 +20,13 @@
 namespace uavcan
 {
 
-template <typename ServiceDataType>
+template <typename ServiceDataType, template <uint16_t, uint8_t> class BufferManager = TransferBufferManager>
 class UAVCAN_EXPORT ServiceResponseTransferListenerInstantiationHelper
 {
 public: // so much templating it hurts
     typedef typename TransferListenerInstantiationHelper<typename ServiceDataType::Response,
-                                                         1, 1, ServiceResponseTransferListener>::Type Type;
+                                                         1, 1, ServiceResponseTransferListener,
+                                                         TransferReceiverMap, BufferManager>::Type Type;
 };
 
 /**
@@ -126,17 +127,22 @@ public:
  *                          In C++11 mode this type defaults to std::function<>.
  *                          In C++03 mode this type defaults to a plain function pointer; use binder to
  *                          call member functions as callbacks.
+ *
+ * @tparam BufferManager    Manager of the response buffer, @ref TransferBufferManager by default.
+ *                          Refer to @ref Subscriber<> for details.
  */
 template <typename DataType_,
 #if UAVCAN_CPP_VERSION >= UAVCAN_CPP11
-          typename Callback_ = std::function<void (const ServiceCallResult<DataType_>&)>
+          typename Callback_ = std::function<void (const ServiceCallResult<DataType_>&)>,
 #else
-          typename Callback_ = void (*)(const ServiceCallResult<DataType_>&)
+          typename Callback_ = void (*)(const ServiceCallResult<DataType_>&),
 #endif
+          template <uint16_t, uint8_t> class BufferManager = TransferBufferManager
           >
 class UAVCAN_EXPORT ServiceClient
     : public GenericSubscriber<DataType_, typename DataType_::Response,
-                               typename ServiceResponseTransferListenerInstantiationHelper<DataType_>::Type >
+                               typename ServiceResponseTransferListenerInstantiationHelper<DataType_,
+                                                                                           BufferManager>::Type >
     , public ServiceClientBase
 {
 public:
@@ -147,9 +153,10 @@ public:
     typedef Callback_ Callback;
 
 private:
-    typedef ServiceClient<DataType, Callback> SelfType;
+    typedef ServiceClient<DataType, Callback, BufferManager> SelfType;
     typedef GenericPublisher<DataType, RequestType> PublisherType;
-    typedef typename ServiceResponseTransferListenerInstantiationHelper<DataType>::Type TransferListenerType;
+    typedef typename ServiceResponseTransferListenerInstantiationHelper<DataType, BufferManager>::Type
+        TransferListenerType;
     typedef GenericSubscriber<DataType, ResponseType, TransferListenerType> SubscriberType;
 
     PublisherType publisher_;
@@ -243,8 +250,8 @@ public:
 
 // ----------------------------------------------------------------------------
 
-template <typename DataType_, typename Callback_>
-void ServiceClient<DataType_, Callback_>::invokeCallback(ServiceCallResultType& result)
+template <typename DataType_, typename Callback_, template <uint16_t, uint8_t> class BufferManager>
+void ServiceClient<DataType_, Callback_, BufferManager>::invokeCallback(ServiceCallResultType& result)
 {
     if (isCallbackValid())
     {
@@ -256,8 +263,9 @@ void ServiceClient<DataType_, Callback_>::invokeCallback(ServiceCallResultType&
     }
 }
 
-template <typename DataType_, typename Callback_>
-void ServiceClient<DataType_, Callback_>::handleReceivedDataStruct(ReceivedDataStructure<ResponseType>& response)
+template <typename DataType_, typename Callback_, template <uint16_t, uint8_t> class BufferManager>
+void ServiceClient<DataType_, Callback_, BufferManager>::
+handleReceivedDataStruct(ReceivedDataStructure<ResponseType>& response)
 {
     UAVCAN_ASSERT(response.getTransferType() == TransferTypeServiceResponse);
     const TransferListenerType* const listener = SubscriberType::getTransferListener();
@@ -275,8 +283,8 @@ void ServiceClient<DataType_, Callback_>::handleReceivedDataStruct(ReceivedDataS
     }
 }
 
-template <typename DataType_, typename Callback_>
-void ServiceClient<DataType_, Callback_>::handleDeadline(MonotonicTime)
+template <typename DataType_, typename Callback_, template <uint16_t, uint8_t> class BufferManager>
+void ServiceClient<DataType_, Callback_, BufferManager>::handleDeadline(MonotonicTime)
 {
     const TransferListenerType* const listener = SubscriberType::getTransferListener();
     if (listener)
@@ -297,8 +305,8 @@ void ServiceClient<DataType_, Callback_>::handleDeadline(MonotonicTime)
     }
 }
 
-template <typename DataType_, typename Callback_>
-int ServiceClient<DataType_, Callback_>::call(NodeID server_node_id, const RequestType& request)
+template <typename DataType_, typename Callback_, template <uint16_t, uint8_t> class BufferManager>
+int ServiceClient<DataType_, Callback_, BufferManager>::call(NodeID server_node_id, const RequestType& request)
 {
     cancel();
     if (!isCallbackValid())
@@ -355,8 +363,8 @@ int ServiceClient<DataType_, Callback_>::call(NodeID server_node_id, const Reque
     return publisher_res;
 }
 
-template <typename DataType_, typename Callback_>
-void ServiceClient<DataType_, Callback_>::cancel()
+template <typename DataType_, typename Callback_, template <uint16_t, uint8_t> class BufferManager>
+void ServiceClient<DataType_, Callback_, BufferManager>::cancel()
 {
     pending_ = false;
     SubscriberType::stop();
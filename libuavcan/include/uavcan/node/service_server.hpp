@@ -38,6 +38,10 @@ namespace uavcan
  *
  * @tparam NumStaticBufs        Number of statically allocated receiver buffers. If there's more concurrent
  *                              incoming transfers, extra buffers will be allocated in the memory pool.
+ *
+ * @tparam ReceiverStore        Container of receiver objects, refer to @ref Subscriber<>.
+ *
+ * @tparam BufferManager        Manager of the request buffers, refer to @ref Subscriber<>.
  */
 template <typename DataType_,
 #if UAVCAN_CPP_VERSION >= UAVCAN_CPP11
@@ -49,16 +53,20 @@ template <typename DataType_,
 #endif
 #if UAVCAN_TINY
           unsigned NumStaticReceivers = 0,
-          unsigned NumStaticBufs = 0
+          unsigned NumStaticBufs = 0,
 #else
           unsigned NumStaticReceivers = 2,
-          unsigned NumStaticBufs = 1
+          unsigned NumStaticBufs = 1,
 #endif
+          template <unsigned> class ReceiverStore = TransferReceiverMap,
+          template <uint16_t, uint8_t> class BufferManager = TransferBufferManager
           >
 class UAVCAN_EXPORT ServiceServer
     : public GenericSubscriber<DataType_, typename DataType_::Request,
                                typename TransferListenerInstantiationHelper<typename DataType_::Request,
-                                                                            NumStaticReceivers, NumStaticBufs>::Type>
+                                                                            NumStaticReceivers, NumStaticBufs,
+                                                                            TransferListener, ReceiverStore,
+                                                                            BufferManager>::Type>
 {
 public:
     typedef DataType_ DataType;
@@ -67,7 +75,8 @@ public:
     typedef Callback_ Callback;
 
 private:
-    typedef typename TransferListenerInstantiationHelper<RequestType, NumStaticReceivers, NumStaticBufs>::Type
+    typedef typename TransferListenerInstantiationHelper<RequestType, NumStaticReceivers, NumStaticBufs,
+                                                         TransferListener, ReceiverStore, BufferManager>::Type
         TransferListenerType;
     typedef GenericSubscriber<DataType, RequestType, TransferListenerType> SubscriberType;
     typedef GenericPublisher<DataType, ResponseType> PublisherType;
@@ -40,6 +40,14 @@ namespace uavcan
  *
  * @tparam NumStaticBufs        Number of statically allocated receiver buffers. If there's more concurrent
  *                              incoming transfers, extra buffers will be allocated in the memory pool.
+ *
+ * @tparam ReceiverStore        Container of receiver objects. The default is @ref TransferReceiverMap, which
+ *                              is compact; @ref TransferReceiverHashMap and @ref TransferReceiverTable offer
+ *                              constant time lookup, which is preferable if the message is published by many nodes.
+ *
+ * @tparam BufferManager        Manager of the buffers for multi-frame messages. The default is
+ *                              @ref TransferBufferManager, which takes extra buffers from the memory pool;
+ *                              ArenaBuffers<ArenaSize>::Manager keeps up to NumStaticBufs buffers in one arena.
  */
 template <typename DataType_,
 #if UAVCAN_CPP_VERSION >= UAVCAN_CPP11
@@ -49,22 +57,26 @@ template <typename DataType_,
 #endif
 #if UAVCAN_TINY
           unsigned NumStaticReceivers = 0,
-          unsigned NumStaticBufs = 0
+          unsigned NumStaticBufs = 0,
 #else
           unsigned NumStaticReceivers = 2,
-          unsigned NumStaticBufs = 1
+          unsigned NumStaticBufs = 1,
 #endif
+          template <unsigned> class ReceiverStore = TransferReceiverMap,
+          template <uint16_t, uint8_t> class BufferManager = TransferBufferManager
           >
 class UAVCAN_EXPORT Subscriber
     : public GenericSubscriber<DataType_, DataType_,
                                typename TransferListenerInstantiationHelper<DataType_, NumStaticReceivers,
-                                                                            NumStaticBufs>::Type>
+                                                                            NumStaticBufs, TransferListener,
+                                                                            ReceiverStore, BufferManager>::Type>
 {
 public:
     typedef Callback_ Callback;
 
 private:
-    typedef typename TransferListenerInstantiationHelper<DataType_, NumStaticReceivers, NumStaticBufs>::Type
+    typedef typename TransferListenerInstantiationHelper<DataType_, NumStaticReceivers, NumStaticBufs,
+                                                         TransferListener, ReceiverStore, BufferManager>::Type
         TransferListenerType;
     typedef GenericSubscriber<DataType_, DataType_, TransferListenerType> BaseType;
 
@@ -0,0 +1,154 @@
+/*
+ * Copyright (C) 2014 Pavel Kirienko <pavel.kirienko@gmail.com>
+ */
+
+#ifndef UAVCAN_TRANSPORT_ARENA_TRANSFER_BUFFER_HPP_INCLUDED
+#define UAVCAN_TRANSPORT_ARENA_TRANSFER_BUFFER_HPP_INCLUDED
+
+#include <uavcan/std.hpp>
+#include <uavcan/build_config.hpp>
+#include <uavcan/transport/transfer_buffer.hpp>
+#include <uavcan/util/templates.hpp>
+
+namespace uavcan
+{
+
+class ArenaTransferBufferManagerImpl;
+
+/**
+ * Internal for ArenaTransferBufferManager.
+ * Contiguous storage that occupies a run of arena chunks.
+ */
+class UAVCAN_EXPORT ArenaTransferBufferManagerEntry : public TransferBufferManagerEntry
+{
+    friend class ArenaTransferBufferManagerImpl;
+
+    ArenaTransferBufferManagerImpl* owner_;
+    uint16_t first_chunk_;
+    uint16_t num_chunks_;
+    uint16_t max_write_pos_;
+
+    virtual void resetImpl();
+
+public:
+    ArenaTransferBufferManagerEntry()
+        : owner_(NULL)
+        , first_chunk_(0)
+        , num_chunks_(0)
+        , max_write_pos_(0)
+    { }
+
+    virtual int read(unsigned offset, uint8_t* data, unsigned len) const;
+    virtual int write(unsigned offset, const uint8_t* data, unsigned len);
+
+    unsigned getNumChunks() const { return num_chunks_; }
+};
+
+/**
+ * Buffer manager that keeps every buffer in one contiguous piece of memory, so that reads and writes are
+ * done with memcpy() regardless of the buffer size.
+ *
+ * The arena is divided into chunks of ChunkSize bytes. A new buffer takes one chunk; when it needs to grow,
+ * it takes the next size class (twice as many chunks, up to the max buffer size), either in place if the adjacent
+ * chunks are free, or by moving into a free run of chunks.
+ *
+ * Unlike TransferBufferManager, this class doesn't use the memory pool. It can be used wherever
+ * ITransferBufferManager is accepted; use @ref ArenaBuffers to plug it into transfer listeners.
+ */
+class UAVCAN_EXPORT ArenaTransferBufferManagerImpl : public ITransferBufferManager, Noncopyable
+{
+    friend class ArenaTransferBufferManagerEntry;
+
+public:
+    enum { ChunkSize = 32 };
+
+private:
+    uint8_t* const arena_;
+    uint32_t* const chunk_bitmap_;
+    ArenaTransferBufferManagerEntry* const entries_;
+    const uint16_t num_chunks_;
+    const uint16_t max_buf_size_;
+    const uint8_t num_entries_;
+
+    ArenaTransferBufferManagerEntry* find(const TransferBufferManagerKey& key) const;
+
+    bool isChunkUsed(unsigned index) const
+    {
+        return (chunk_bitmap_[index / 32U] & (1UL << (index % 32U))) != 0;
+    }
+    void markChunks(unsigned first, unsigned num, bool used);
+    bool areChunksFree(unsigned first, unsigned num) const;
+    int findFreeChunks(unsigned num) const;
+
+    bool reserve(ArenaTransferBufferManagerEntry& entry, unsigned size);
+    void release(ArenaTransferBufferManagerEntry& entry);
+
+    uint8_t* getChunkPtr(unsigned index) const { return arena_ + index * unsigned(ChunkSize); }
+
+protected:
+    ArenaTransferBufferManagerImpl(uint16_t max_buf_size, uint8_t* arena, uint16_t num_chunks, uint32_t* chunk_bitmap,
+                                   ArenaTransferBufferManagerEntry* entries, uint8_t num_entries);
+
+public:
+    virtual ITransferBuffer* access(const TransferBufferManagerKey& key);
+    virtual ITransferBuffer* create(const TransferBufferManagerKey& key);
+    virtual void remove(const TransferBufferManagerKey& key);
+    virtual bool isEmpty() const;
+
+    unsigned getNumBuffers() const;
+    unsigned getNumUsedChunks() const;
+    unsigned getNumChunks() const { return num_chunks_; }
+};
+
+/**
+ * @tparam MaxBufSize   Maximum size of one buffer, same as for TransferBufferManager.
+ * @tparam ArenaSize    Total amount of memory for all buffers, bytes. Rounded up to the chunk size.
+ * @tparam MaxBuffers   Maximum number of buffers that can exist at the same time.
+ */
+template <uint16_t MaxBufSize, uint16_t ArenaSize, uint8_t MaxBuffers>
+class UAVCAN_EXPORT ArenaTransferBufferManager : public ArenaTransferBufferManagerImpl
+{
+    enum { NumChunks = (unsigned(ArenaSize) + unsigned(ChunkSize) - 1U) / unsigned(ChunkSize) };
+    enum { NumBitmapWords = (unsigned(NumChunks) + 31U) / 32U };
+
+    uint8_t arena_[unsigned(NumChunks) * unsigned(ChunkSize)];
+    uint32_t chunk_bitmap_[NumBitmapWords];
+    ArenaTransferBufferManagerEntry entries_[MaxBuffers];
+
+public:
+    ArenaTransferBufferManager()
+        : ArenaTransferBufferManagerImpl(MaxBufSize, arena_, NumChunks, chunk_bitmap_, entries_, MaxBuffers)
+    {
+        StaticAssert<(MaxBufSize > 0)>::check();
+        StaticAssert<(ArenaSize >= MaxBufSize)>::check();
+        StaticAssert<(MaxBuffers > 0)>::check();
+    }
+};
+
+/**
+ * Plugs the arena into TransferListener<> and the classes built on it, via their BufferManager template argument:
+ *
+ *     uavcan::Subscriber<Msg, Callback, 2, 4, uavcan::TransferReceiverMap, uavcan::ArenaBuffers<512>::Manager>
+ *
+ * The number of static buffers of the listener becomes the maximum number of buffers in the arena, and the memory
+ * pool is never used. Listeners of single frame data types need no buffers, so they get no arena at all.
+ *
+ * @tparam ArenaSize    Total amount of memory for all buffers of one listener, bytes.
+ */
+template <uint16_t ArenaSize>
+struct UAVCAN_EXPORT ArenaBuffers
+{
+    template <uint16_t MaxBufSize, uint8_t NumBufs>
+    class UAVCAN_EXPORT Manager
+        : public Select<(MaxBufSize == 0),
+                        TransferBufferManager<0, 0>,
+                        ArenaTransferBufferManager<MaxBufSize, ArenaSize, NumBufs> >::Result
+    {
+    public:
+        explicit Manager(IPoolAllocator&) { }
+    };
+};
+
+}
+
+#endif // UAVCAN_TRANSPORT_ARENA_TRANSFER_BUFFER_HPP_INCLUDED
@@ -0,0 +1,79 @@
+/*
+ * Copyright (C) 2014 Pavel Kirienko <pavel.kirienko@gmail.com>
+ */
+
+#ifndef UAVCAN_TRANSPORT_CAN_ACCEPTANCE_FILTER_BUILDER_HPP_INCLUDED
+#define UAVCAN_TRANSPORT_CAN_ACCEPTANCE_FILTER_BUILDER_HPP_INCLUDED
+
+#include <uavcan/std.hpp>
+#include <uavcan/build_config.hpp>
+#include <uavcan/data_type.hpp>
+#include <uavcan/driver/can.hpp>
+#include <uavcan/transport/transfer.hpp>
+#include <uavcan/util/templates.hpp>
+
+namespace uavcan
+{
+/**
+ * Collects acceptance rules into a limited number of hardware filter configs.
+ * A frame is accepted by a config if (frame.id & mask) == (config.id & mask).
+ *
+ * If the number of rules exceeds the capacity, the pair of configs that loses the least number of mask bits when
+ * merged is replaced with the merged config. Merging only widens the set of accepted frames, so every frame that
+ * matches any of the added rules is guaranteed to be accepted by the resulting configuration.
+ */
+class UAVCAN_EXPORT CanAcceptanceFilterBuilder : Noncopyable
+{
+    CanFilterConfig* const configs_;
+    const unsigned capacity_;
+    unsigned num_configs_;
+
+    static unsigned getNumMaskBits(uint32_t mask);
+    static CanFilterConfig merge(const CanFilterConfig& a, const CanFilterConfig& b);
+    static bool covers(const CanFilterConfig& wide, const CanFilterConfig& narrow);
+
+public:
+    /**
+     * @param storage   Output array of at least capacity elements.
+     * @param capacity  Maximum number of configs to produce; zero is allowed.
+     */
+    CanAcceptanceFilterBuilder(CanFilterConfig* storage, unsigned capacity)
+        : configs_(storage)
+        , capacity_(capacity)
+        , num_configs_(0)
+    { }
+
+    void add(const CanFilterConfig& config);
+
+    /**
+     * Accept frames of the given transfer type and data type.
+     */
+    void addTransferFilter(DataTypeID dtid, TransferType transfer_type);
+
+    /**
+     * Accept both broadcast and unicast message frames of the given data type.
+     */
+    void addMessageFilter(DataTypeID dtid);
+
+    /**
+     * Accept all frames of the given transfer type, regardless of the data type.
+     */
+    void addTransferTypeFilter(TransferType transfer_type);
+
+    /**
+     * Accept all frames emitted by the given node.
+     */
+    void addSourceNodeFilter(NodeID node_id);
+
+    const CanFilterConfig* getConfigs() const { return configs_; }
+    unsigned getNumConfigs() const { return num_configs_; }
+
+    static bool accepts(const CanFilterConfig& config, uint32_t can_id)
+    {
+        return ((can_id ^ config.id) & config.mask) == 0;
+    }
+};
+
+}
+
+#endif // UAVCAN_TRANSPORT_CAN_ACCEPTANCE_FILTER_BUILDER_HPP_INCLUDED
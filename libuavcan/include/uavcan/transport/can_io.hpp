@@ -9,7 +9,6 @@
 #include <cassert>
 #include <uavcan/error.hpp>
 #include <uavcan/std.hpp>
-#include <uavcan/util/linked_list.hpp>
 #include <uavcan/dynamic_memory.hpp>
 #include <uavcan/build_config.hpp>
 #include <uavcan/util/templates.hpp>
@@ -21,41 +20,137 @@
 namespace uavcan
 {
 
-enum { MaxCanIfaces = 3 };
+/**
+ * Provides CAN frames of one outgoing transfer on demand. Every frame is built straight into the memory where
+ * it is needed - the TX queue entry, or the frame that is passed to the driver - so nothing is copied in between.
+ * Frames must be transmitted in the order of their indices.
+ */
+class UAVCAN_EXPORT ICanTxFrameSource
+{
+public:
+    virtual ~ICanTxFrameSource() { }
 
-struct UAVCAN_EXPORT CanRxFrame : public CanFrame
+    virtual unsigned getNumFrames() const = 0;
+
+    /**
+     * @param index         Frame index, less than getNumFrames().
+     * @param out_frame     The frame will be written here.
+     */
+    virtual void buildFrame(unsigned index, CanFrame& out_frame) const = 0;
+};
+
+/**
+ * Adapter for transmission of a single prebuilt CAN frame.
+ */
+class UAVCAN_EXPORT SingleCanTxFrameSource : public ICanTxFrameSource
 {
-    MonotonicTime ts_mono;
-    UtcTime ts_utc;
-    uint8_t iface_index;
+    const CanFrame& frame_;
 
-    CanRxFrame()
-        : iface_index(0)
+public:
+    explicit SingleCanTxFrameSource(const CanFrame& frame)
+        : frame_(frame)
     { }
 
-#if UAVCAN_TOSTRING
-    std::string toString(StringRepresentation mode = StrTight) const;
-#endif
-};
+    virtual unsigned getNumFrames() const { return 1; }
 
+    virtual void buildFrame(unsigned index, CanFrame& out_frame) const
+    {
+        (void)index;
+        UAVCAN_ASSERT(index == 0);
+        out_frame = frame_;
+    }
+};
 
+/**
+ * Prioritized TX queue.
+ *
+ * Entries of each QoS level are kept in a separate intrusive AVL tree ordered by CAN frame priority, so that
+ * the highest priority frame, the lowest QoS frame and any expired frame can be located in O(log N).
+ * Every tree node also keeps the earliest deadline found in its subtree, which serves as the deadline index.
+ * Frames of equal priority are transmitted in FIFO order.
+ *
+ * Frames of a multi frame transfer are admitted all or none, and they share a transfer tag. If one of them is
+ * dropped (expired or replaced by a higher QoS frame), the rest of the transfer is purged, because the receivers
+ * would discard it anyway. Purged frames that were not expired yet are accounted as saved bus time.
+ * Frames of one transfer normally share the CAN ID, so they are adjacent in the tree and the rest of the transfer
+ * is found next to the dropped frame; otherwise the whole tree has to be traversed.
+ *
+ * One queue serves all CAN interfaces: every entry keeps the mask of interfaces it is still pending on, so a frame
+ * that goes to several redundant interfaces occupies only one memory block. The entry is freed once it has been
+ * transmitted on every interface of its mask, or dropped. Every tree node also keeps the union of the pending masks
+ * found in its subtree, so that the top entry of any interface can be located in O(log N).
+ * The number of frames pending on each interface is limited separately from the memory quota, so that an interface
+ * that can't transmit (e.g. bus off) can't take the queue over and starve the other interfaces.
+ * Arguments related to the interfaces default to the first interface, for single interface usage.
+ */
 class UAVCAN_EXPORT CanTxQueue : Noncopyable
 {
 public:
     enum Qos { Volatile, Persistent };
 
-    struct Entry : public LinkedListNode<Entry>  // Not required to be packed - fits the block in any case
+    struct Entry  // Not required to be packed - fits the block in any case
     {
+    private:
+        friend class CanTxQueue;
+
+        Entry* left_;
+        Entry* right_;
+        Entry* parent_;
+        MonotonicTime subtree_min_deadline_;
+
+        // Fields are ordered to avoid padding; the entry must fit one memory block
+    public:
         MonotonicTime deadline;
         CanFrame frame;
         uint8_t qos;
+
+    private:
+        uint8_t height_;
+
+    public:
         CanIOFlags flags;
 
-        Entry(const CanFrame& arg_frame, MonotonicTime arg_deadline, Qos arg_qos, CanIOFlags arg_flags)
-            : deadline(arg_deadline)
+    private:
+        uint16_t transfer_tag_;         ///< Same for all frames of one multi frame transfer, zero otherwise
+        uint8_t pending_mask_;          ///< Interfaces where the frame is not transmitted yet
+        uint8_t subtree_pending_mask_;
+
+    public:
+
+        Entry(const CanFrame& arg_frame, MonotonicTime arg_deadline, Qos arg_qos, CanIOFlags arg_flags,
+              uint8_t arg_iface_mask = 1)
+            : left_(NULL)
+            , right_(NULL)
+            , parent_(NULL)
+            , subtree_min_deadline_(arg_deadline)
+            , deadline(arg_deadline)
             , frame(arg_frame)
             , qos(uint8_t(arg_qos))
+            , height_(1)
             , flags(arg_flags)
+            , transfer_tag_(0)
+            , pending_mask_(arg_iface_mask)
+            , subtree_pending_mask_(arg_iface_mask)
+        {
+            UAVCAN_ASSERT((qos == Volatile) || (qos == Persistent));
+            IsDynamicallyAllocatable<Entry>::check();
+        }
+
+        /**
+         * The frame is to be written by the caller.
+         */
+        Entry(MonotonicTime arg_deadline, Qos arg_qos, CanIOFlags arg_flags, uint8_t arg_iface_mask)
+            : left_(NULL)
+            , right_(NULL)
+            , parent_(NULL)
+            , subtree_min_deadline_(arg_deadline)
+            , deadline(arg_deadline)
+            , qos(uint8_t(arg_qos))
+            , height_(1)
+            , flags(arg_flags)
+            , transfer_tag_(0)
+            , pending_mask_(arg_iface_mask)
+            , subtree_pending_mask_(arg_iface_mask)
         {
             UAVCAN_ASSERT((qos == Volatile) || (qos == Persistent));
             IsDynamicallyAllocatable<Entry>::check();
@@ -65,6 +160,8 @@ public:
 
         bool isExpired(MonotonicTime timestamp) const { return timestamp > deadline; }
 
+        uint8_t getPendingIfaceMask() const { return pending_mask_; }
+
         bool qosHigherThan(const CanFrame& rhs_frame, Qos rhs_qos) const;
         bool qosLowerThan(const CanFrame& rhs_frame, Qos rhs_qos) const;
         bool qosHigherThan(const Entry& rhs) const { return qosHigherThan(rhs.frame, Qos(rhs.qos)); }
@@ -76,44 +173,167 @@ public:
     };
 
 private:
-    class PriorityInsertionComparator
-    {
-        const CanFrame& frm_;
-    public:
-        explicit PriorityInsertionComparator(const CanFrame& frm) : frm_(frm) { }
-        bool operator()(const Entry* entry)
-        {
-            UAVCAN_ASSERT(entry);
-            return frm_.priorityHigherThan(entry->frame);
-        }
-    };
+    enum { NumQosLevels = 2 };
+    enum { MaxTransferTag = 0x7FFF };
+    enum { TransferTagScattered = 0x8000 };     ///< Frames of the transfer don't share the CAN ID
 
-    LinkedListRoot<Entry> queue_;
+    Entry* roots_[NumQosLevels];    ///< Indexed by QoS
     LimitedPoolAllocator allocator_;
     ISystemClock& sysclock_;
-    uint32_t rejected_frames_cnt_;
-
-    void registerRejectedFrame();
+    uint32_t rejected_frames_cnt_[MaxCanIfaces];
+    uint32_t purged_frames_cnt_[MaxCanIfaces];
+    uint64_t saved_bus_bits_[MaxCanIfaces];
+    unsigned num_pending_[MaxCanIfaces];
+    const unsigned iface_quota_;
+    unsigned num_entries_;
+    uint16_t next_transfer_tag_;
+
+    void registerRejectedFrames(uint8_t iface_mask, unsigned num);
+    void registerPendingFrames(uint8_t iface_mask, bool added);
+    void rejectTransfer(unsigned num_frames, const unsigned (&first_index)[MaxCanIfaces], uint8_t iface_mask);
+    static unsigned estimateFrameBitLength(const CanFrame& frame);
+
+    static uint8_t getHeight(const Entry* node) { return (node == NULL) ? 0 : node->height_; }
+    static void updateNode(Entry* node);
+    static void updatePathToRoot(Entry* node);
+    static void replaceChild(Entry* parent, const Entry* old_child, Entry* new_child, Entry*& root);
+    static Entry* rotateLeft(Entry* node, Entry*& root);
+    static Entry* rotateRight(Entry* node, Entry*& root);
+    static Entry* rebalance(Entry* node, Entry*& root);
+    static void retrace(Entry* node, Entry*& root);
+    static Entry* findLeftmost(Entry* node);
+    static Entry* findRightmost(Entry* node);
+    static Entry* findPredecessor(Entry* node);
+    static Entry* findSuccessor(Entry* node);
+    static Entry* findFirstNotHigherThan(Entry* node, const CanFrame& frame);
+    static Entry* findFirstPendingNotHigherThan(Entry* node, const CanFrame& frame, uint8_t iface_mask);
+    static Entry* findLeftmostPending(Entry* node, uint8_t iface_mask);
+    static Entry* findRightmostPending(Entry* node, uint8_t iface_mask);
+    static Entry* findExpired(Entry* node, MonotonicTime timestamp);
+    static bool containsInSubtree(const Entry* node, const CanFrame& frame);
+
+    void insert(Entry* entry);
+    void unlink(Entry* entry);
+    void destroy(Entry*& entry);
+    void release(Entry*& entry, uint8_t iface_mask);
+    void removeExpired(MonotonicTime timestamp);
+    void drop(Entry* entry, uint8_t iface_mask, MonotonicTime timestamp);
+    void drop(Entry* entry, MonotonicTime timestamp) { drop(entry, entry->pending_mask_, timestamp); }
+    void purge(Entry* entry, uint8_t iface_mask, MonotonicTime timestamp);
+    void purgeTransfer(Entry* dropped, uint8_t iface_mask, MonotonicTime timestamp);
+    Entry* findTop(uint8_t iface_index) const;
+    Entry* findLowestQos() const;
+    Entry* findLowestQos(uint8_t iface_index) const;
+    unsigned countEvictable(const CanFrame& frame, Qos qos, unsigned limit, uint8_t iface_mask = 0) const;
+    static void findLowestPriorityFrame(const ICanTxFrameSource& source, unsigned first_index, CanFrame& out_frame);
+    bool admitToIface(uint8_t iface_index, const ICanTxFrameSource& source, unsigned first_index, Qos qos,
+                      MonotonicTime timestamp);
 
 public:
-    CanTxQueue(IPoolAllocator& allocator, ISystemClock& sysclock, std::size_t allocator_quota)
+    /**
+     * @param allocator_quota   Maximum number of memory blocks taken by the queue.
+     * @param iface_quota       Maximum number of frames pending on one interface; zero means the allocator quota.
+     */
+    CanTxQueue(IPoolAllocator& allocator, ISystemClock& sysclock, std::size_t allocator_quota,
+               std::size_t iface_quota = 0)
         : allocator_(allocator, allocator_quota)
         , sysclock_(sysclock)
-        , rejected_frames_cnt_(0)
-    { }
+        , iface_quota_(unsigned((iface_quota == 0) ? allocator_quota : iface_quota))
+        , num_entries_(0)
+        , next_transfer_tag_(1)
+    {
+        roots_[Volatile] = NULL;
+        roots_[Persistent] = NULL;
+        fill(rejected_frames_cnt_, rejected_frames_cnt_ + MaxCanIfaces, uint32_t(0));
+        fill(purged_frames_cnt_, purged_frames_cnt_ + MaxCanIfaces, uint32_t(0));
+        fill(saved_bus_bits_, saved_bus_bits_ + MaxCanIfaces, uint64_t(0));
+        fill(num_pending_, num_pending_ + MaxCanIfaces, 0U);
+    }
 
     ~CanTxQueue();
 
-    void push(const CanFrame& frame, MonotonicTime tx_deadline, Qos qos, CanIOFlags flags);
+    /**
+     * Complexity: O(log N); if the allocator quota is exhausted, O(log N) per every expired, replaced or purged
+     * entry.
+     */
+    void push(const CanFrame& frame, MonotonicTime tx_deadline, Qos qos, CanIOFlags flags, uint8_t iface_mask = 1);
+
+    /**
+     * Enqueues the frames of one transfer, all or none.
+     * Memory for all of them is obtained first, removing expired entries and lower QoS entries if necessary;
+     * if that's not possible, nothing is enqueued and all the frames are counted as rejected. Lower QoS entries
+     * are removed only if it's known in advance that the whole transfer will fit afterwards.
+     * If an interface would exceed its quota, lower QoS frames are dropped from that interface only; if that's not
+     * possible, the transfer is rejected on that interface and enqueued for the others.
+     * Complexity: O(M log N), where M is the number of frames to enqueue, plus O(log N) per every expired, replaced
+     * or purged entry. Purging a transfer whose frames don't share the CAN ID takes O(N).
+     * @param first_index   Index of the first frame to enqueue, per interface; frames before it are considered
+     *                      transmitted on that interface already.
+     * @param iface_mask    Interfaces to enqueue the frames for.
+     */
+    void push(const ICanTxFrameSource& source, const unsigned (&first_index)[MaxCanIfaces], uint8_t iface_mask,
+              MonotonicTime tx_deadline, Qos qos, CanIOFlags flags);
+
+    void push(const ICanTxFrameSource& source, unsigned first_index, MonotonicTime tx_deadline, Qos qos,
+              CanIOFlags flags, uint8_t iface_mask = 1);
+
+    /**
+     * Returns the highest priority entry pending on the given interface, removing expired entries from the top
+     * of the queue on the way.
+     * Complexity: O(log N), plus O(log N) per every expired or purged entry.
+     */
+    Entry* peek(uint8_t iface_index = 0);               // Modifier
+
+    /**
+     * Marks the entry transmitted on the given interface. The entry is freed once it's transmitted on all
+     * interfaces it was enqueued for; the pointer must not be used afterwards in any case.
+     * Complexity: O(log N)
+     */
+    void remove(Entry*& entry, uint8_t iface_index = 0);
+
+    bool topPriorityHigherOrEqual(const CanFrame& rhs_frame, uint8_t iface_index = 0) const;
+
+    /**
+     * Checks whether there is an entry containing exactly the same frame.
+     * Complexity: O(N), intended for diagnostics and testing.
+     */
+    bool contains(const CanFrame& frame) const;
+
+    /**
+     * Number of frames that were dropped because they expired, didn't fit into the queue, or were evicted.
+     * Purged frames are not included; each dropped frame is counted by exactly one of these two counters.
+     */
+    uint32_t getRejectedFrameCount(uint8_t iface_index = 0) const { return rejected_frames_cnt_[iface_index]; }
+
+    /**
+     * Number of frames that were removed because another frame of the same transfer was dropped.
+     */
+    uint32_t getPurgedFrameCount(uint8_t iface_index = 0) const { return purged_frames_cnt_[iface_index]; }
 
-    Entry* peek();               // Modifier
-    void remove(Entry*& entry);
+    /**
+     * Estimated length of the purged frames that would have been transmitted otherwise, in bits.
+     * Divide by the bit rate to get the bus time saved.
+     */
+    uint64_t getSavedBusBitCount(uint8_t iface_index = 0) const { return saved_bus_bits_[iface_index]; }
 
-    bool topPriorityHigherOrEqual(const CanFrame& rhs_frame) const;
+    /**
+     * Number of frames pending on the given interface.
+     * Complexity: O(1)
+     */
+    unsigned getNumPendingFrames(uint8_t iface_index = 0) const { return num_pending_[iface_index]; }
 
-    uint32_t getRejectedFrameCount() const { return rejected_frames_cnt_; }
+    /**
+     * Mask of the interfaces that have at least one pending frame.
+     * Complexity: O(1)
+     */
+    uint8_t getPendingIfaceMask() const;
 
-    bool isEmpty() const { return queue_.isEmpty(); }
+    /**
+     * Number of entries, regardless of how many interfaces they are pending on.
+     */
+    unsigned getLength() const { return num_entries_; }
+
+    bool isEmpty() const { return num_entries_ == 0; }
 };
 
 
@@ -122,11 +342,15 @@ struct UAVCAN_EXPORT CanIfacePerfCounters
     uint64_t frames_tx;
     uint64_t frames_rx;
     uint64_t errors;
+    uint64_t frames_purged;     ///< Frames of broken multi frame transfers that were not transmitted
+    uint64_t bus_bits_saved;    ///< Refer to CanTxQueue::getSavedBusBitCount()
 
     CanIfacePerfCounters()
         : frames_tx(0)
         , frames_rx(0)
         , errors(0)
+        , frames_purged(0)
+        , bus_bits_saved(0)
     { }
 };
 
@@ -147,7 +371,7 @@ class UAVCAN_EXPORT CanIOManager : Noncopyable
     ICanDriver& driver_;
     ISystemClock& sysclock_;
 
-    LazyConstructor<CanTxQueue> tx_queues_[MaxCanIfaces];
+    LazyConstructor<CanTxQueue> tx_queue_;
     IfaceFrameCounters counters_[MaxCanIfaces];
 
     const uint8_t num_ifaces_;
@@ -158,6 +382,13 @@ class UAVCAN_EXPORT CanIOManager : Noncopyable
     int callSelect(CanSelectMasks& inout_masks, MonotonicTime blocking_deadline);
 
 public:
+    /**
+     * @param mem_blocks_per_iface  TX queue capacity of every interface. The queue is shared between the
+     *                              interfaces and every frame takes one block regardless of the number of
+     *                              interfaces it is sent to, so the queue takes at most this many blocks
+     *                              times the number of interfaces. Zero means (number of pool blocks) /
+     *                              (number of interfaces + 1) + 1.
+     */
     CanIOManager(ICanDriver& driver, IPoolAllocator& allocator, ISystemClock& sysclock,
                  std::size_t mem_blocks_per_iface = 0);
 
@@ -176,7 +407,26 @@ public:
      */
     int send(const CanFrame& frame, MonotonicTime tx_deadline, MonotonicTime blocking_deadline,
              uint8_t iface_mask, CanTxQueue::Qos qos, CanIOFlags flags);
+
+    /**
+     * Sends all frames of one transfer. Frames that could not be transmitted until the blocking deadline
+     * are enqueued at once; refer to CanTxQueue::push() for details.
+     * The deadline is checked after every select() call, so select() is never called once it has passed;
+     * every writeable interface is given as many frames as it accepts without blocking per select() call.
+     * Return value is the same as for the single frame version.
+     */
+    int send(const ICanTxFrameSource& source, MonotonicTime tx_deadline, MonotonicTime blocking_deadline,
+             uint8_t iface_mask, CanTxQueue::Qos qos, CanIOFlags flags);
     int receive(CanRxFrame& out_frame, MonotonicTime blocking_deadline, CanIOFlags& out_flags);
+
+    /**
+     * Fetches up to max_frames frames from all readable ifaces per one select() call.
+     * Returns:
+     *  0 - timed out
+     *  1+ - number of frames written to out_frames
+     *  negative - failure
+     */
+    int receive(CanRxFrame* out_frames, unsigned max_frames, MonotonicTime blocking_deadline);
 };
 
 }
@@ -29,6 +29,9 @@ class UAVCAN_EXPORT TransferCRC
 {
 #if !UAVCAN_TINY
     static const uint16_t Table[256];
+# if UAVCAN_CRC_SLICE_BY > 1
+    static const uint16_t SliceTable[UAVCAN_CRC_SLICE_BY - 1][256];  ///< Table[] advanced by 1..N-1 zero bytes
+# endif
 #endif
 
     uint16_t value_;
@@ -63,6 +66,7 @@ public:
     }
 #endif
 
+#if UAVCAN_TINY
     void add(const uint8_t* bytes, unsigned len)
     {
         UAVCAN_ASSERT(bytes);
@@ -71,6 +75,12 @@ public:
             add(*bytes++);
         }
     }
+#else
+    /**
+     * Processes several bytes per iteration, refer to UAVCAN_CRC_SLICE_BY.
+     */
+    void add(const uint8_t* bytes, unsigned len);
+#endif
 
     uint16_t get() const { return value_; }
 };
@@ -13,6 +13,7 @@
 #include <uavcan/transport/transfer_listener.hpp>
 #include <uavcan/transport/outgoing_transfer_registry.hpp>
 #include <uavcan/transport/can_io.hpp>
+#include <uavcan/transport/can_acceptance_filter_builder.hpp>
 #include <uavcan/util/linked_list.hpp>
 
 namespace uavcan
@@ -68,9 +69,23 @@ class UAVCAN_EXPORT Dispatcher : Noncopyable
     IOutgoingTransferRegistry& outgoing_transfer_reg_;
     TransferPerfCounter perf_;
 
+    /**
+     * Listeners are kept in a list sorted by data type ID, so that listeners of the same data type form a
+     * contiguous chain. A bitmap over the data type ID space allows to reject frames of unknown data types
+     * with one bit test, and a table of chain heads indexed by data type ID allows to locate the listeners
+     * in constant time. The head table is optional, see UAVCAN_DISPATCHER_HEAD_TABLE; linear search is used
+     * if it is disabled.
+     */
     class ListenerRegistry
     {
+        enum { NumDataTypeIDs = DataTypeID::Max + 1 };
+        enum { BitmapWordBits = 32 };
+
         LinkedListRoot<TransferListenerBase> list_;
+        uint32_t bitmap_[NumDataTypeIDs / BitmapWordBits];
+#if UAVCAN_DISPATCHER_HEAD_TABLE && !UAVCAN_TINY
+        TransferListenerBase* heads_[NumDataTypeIDs];
+#endif
 
         class DataTypeIDInsertionComparator
         {
@@ -84,15 +99,31 @@ class UAVCAN_EXPORT Dispatcher : Noncopyable
             }
         };
 
+        void setBit(DataTypeID dtid, bool value);
+        TransferListenerBase* findFirst(DataTypeID dtid) const;
+
     public:
         enum Mode { UniqueListener, ManyListeners };
 
+        ListenerRegistry();
+
         bool add(TransferListenerBase* listener, Mode mode);
         void remove(TransferListenerBase* listener);
-        bool exists(DataTypeID dtid) const;
+        bool exists(DataTypeID dtid) const
+        {
+            return (dtid.get() < NumDataTypeIDs) &&
+                   (bitmap_[dtid.get() / BitmapWordBits] & (uint32_t(1) << (dtid.get() % BitmapWordBits)));
+        }
         void cleanup(MonotonicTime ts);
+        void cleanup(MonotonicTime ts, DataTypeID dtid);
         void handleFrame(const RxFrame& frame);
 
+        /**
+         * Returns the highest data type ID that has listeners and is not greater than the argument,
+         * or a negative value if there are none.
+         */
+        int findNextDataTypeID(int from) const;
+
         unsigned getNumEntries() const { return list_.getLength(); }
 
         const LinkedListRoot<TransferListenerBase>& getList() const { return list_; }
@@ -106,16 +137,32 @@ class UAVCAN_EXPORT Dispatcher : Noncopyable
 
     NodeID self_node_id_;
     bool self_node_id_is_set_;
+    bool hw_filtering_enabled_;
+
+    uint8_t cleanup_stage_;
+    int16_t cleanup_next_dtid_;
+
+    enum { MaxHardwareFilterConfigs = 32 };
 
     void handleFrame(const CanRxFrame& can_frame);
     void handleLoopbackFrame(const CanRxFrame& can_frame);
 
+    void fillAcceptanceFilters(CanAcceptanceFilterBuilder& builder) const;
+    void updateHardwareFilters();
+
 public:
-    Dispatcher(ICanDriver& driver, IPoolAllocator& allocator, ISystemClock& sysclock, IOutgoingTransferRegistry& otr)
-        : canio_(driver, allocator, sysclock)
+    /**
+     * @param tx_queue_blocks_per_iface     Refer to CanIOManager::CanIOManager(), mem_blocks_per_iface.
+     */
+    Dispatcher(ICanDriver& driver, IPoolAllocator& allocator, ISystemClock& sysclock, IOutgoingTransferRegistry& otr,
+               std::size_t tx_queue_blocks_per_iface = 0)
+        : canio_(driver, allocator, sysclock, tx_queue_blocks_per_iface)
         , sysclock_(sysclock)
         , outgoing_transfer_reg_(otr)
         , self_node_id_is_set_(false)
+        , hw_filtering_enabled_(false)
+        , cleanup_stage_(0)
+        , cleanup_next_dtid_(DataTypeID::Max)
     { }
 
     int spin(MonotonicTime deadline);
@@ -126,8 +173,27 @@ public:
     int send(const Frame& frame, MonotonicTime tx_deadline, MonotonicTime blocking_deadline, CanTxQueue::Qos qos,
              CanIOFlags flags, uint8_t iface_mask);
 
+    /**
+     * Sends all frames of one transfer at once; refer to CanIOManager::send() for the parameter description
+     */
+    int send(const TransferFrameBuilder& frames, MonotonicTime tx_deadline, MonotonicTime blocking_deadline,
+             CanTxQueue::Qos qos, CanIOFlags flags, uint8_t iface_mask);
+
     void cleanup(MonotonicTime ts);
 
+    /**
+     * Performs the same work as cleanup(), split into steps: the outgoing transfer registry is one step,
+     * and the listeners of one data type are another. Steps are executed until the system clock reaches the
+     * deadline; at least one step is executed per call, so a past deadline means one step per call.
+     * The deadline is checked between the steps only, so it is exceeded by up to the duration of one step, which
+     * is linear in the number of outgoing transfers or in the number of receivers of one data type.
+     * The position is preserved between calls, and it remains valid if listeners are added or removed meanwhile.
+     * @param ts        Timestamp used to detect expired items, same as for cleanup().
+     * @param deadline  Monotonic time when the method must stop executing further steps.
+     * @return          True if the full pass has been completed, false if it needs more calls.
+     */
+    bool cleanupIncrementally(MonotonicTime ts, MonotonicTime deadline);
+
     bool registerMessageListener(TransferListenerBase* listener);
     bool registerServiceRequestListener(TransferListenerBase* listener);
     bool registerServiceResponseListener(TransferListenerBase* listener);
@@ -136,6 +202,29 @@ public:
     void unregisterServiceRequestListener(TransferListenerBase* listener);
     void unregisterServiceResponseListener(TransferListenerBase* listener);
 
+    /**
+     * Hardware acceptance filters of every iface are configured automatically from the registered listeners and
+     * the local node ID. The filters are reapplied whenever a message or service request data type gets its first
+     * listener or loses its last one, and when the node ID is set.
+     * Once the node ID is set, all frames emitted by the local node are accepted in order to keep loopback working
+     * on any driver, and all service response frames are accepted by one permanent config, so that short-lived
+     * response listeners of service clients never cause reconfiguration. The destination node ID is transferred
+     * in the payload, so it can't be used for filtering.
+     * If an iface fails to accept the configuration, it is reset to accept all frames until the next update.
+     * Automatic configuration is disabled by default, because it overwrites the filters that the application
+     * may have configured on its own.
+     */
+    void setHardwareFilteringEnabled(bool enabled);
+    bool isHardwareFilteringEnabled() const { return hw_filtering_enabled_; }
+
+    /**
+     * Configures the hardware acceptance filters now.
+     * Ifaces that don't support hardware filtering are skipped; if there's nothing to listen to, the current
+     * configuration is retained.
+     * @return Number of configured ifaces, or negative error code if the driver failed to configure any.
+     */
+    int configureHardwareFilters();
+
     bool hasSubscriber(DataTypeID dtid) const;
     bool hasPublisher(DataTypeID dtid) const;
     bool hasServer(DataTypeID dtid) const;
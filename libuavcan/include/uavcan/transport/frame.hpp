@@ -8,6 +8,7 @@
 #include <cassert>
 #include <uavcan/transport/transfer.hpp>
 #include <uavcan/transport/can_io.hpp>
+#include <uavcan/transport/crc.hpp>
 #include <uavcan/build_config.hpp>
 #include <uavcan/data_type.hpp>
 
@@ -128,6 +129,93 @@ public:
 #endif
 };
 
+/**
+ * Read-only view of a received CAN frame. The CAN ID fields are decoded on access, nothing is copied.
+ * This allows to drop irrelevant frames before they are parsed into RxFrame.
+ * The CAN frame must outlive the view.
+ */
+class UAVCAN_EXPORT CanRxFrameView
+{
+    const CanRxFrame& can_frame_;
+
+public:
+    explicit CanRxFrameView(const CanRxFrame& can_frame)
+        : can_frame_(can_frame)
+    { }
+
+    /**
+     * Checks the CAN frame format only; the UAVCAN frame itself can be checked by RxFrame::parse().
+     */
+    bool isUavcanFrame() const
+    {
+        return can_frame_.isExtended() && !can_frame_.isRemoteTransmissionRequest() && !can_frame_.isErrorFrame() &&
+               (can_frame_.dlc <= sizeof(can_frame_.data));
+    }
+
+    TransferType getTransferType() const { return TransferType(CanIDTransferType::unpack(can_frame_.id)); }
+    DataTypeID getDataTypeID()     const { return DataTypeID(uint16_t(CanIDDataTypeID::unpack(can_frame_.id))); }
+    NodeID getSrcNodeID()          const { return NodeID(uint8_t(CanIDSrcNodeID::unpack(can_frame_.id))); }
+    TransferID getTransferID()     const { return TransferID(uint8_t(CanIDTransferID::unpack(can_frame_.id))); }
+    uint_fast8_t getIndex()        const { return uint_fast8_t(CanIDFrameIndex::unpack(can_frame_.id)); }
+    bool isLast()                  const { return CanIDLastFrame::unpack(can_frame_.id) != 0; }
+    bool isFirst()                 const { return getIndex() == 0; }
+
+    bool hasDstNodeID() const { return getTransferType() != TransferTypeMessageBroadcast; }
+
+    /**
+     * Broadcast for broadcast transfers.
+     * Invalid node ID if the frame doesn't contain a well formed destination node ID.
+     */
+    NodeID getDstNodeID() const
+    {
+        if (!hasDstNodeID())
+        {
+            return NodeID::Broadcast;
+        }
+        if ((can_frame_.dlc < 1) || ((can_frame_.data[0] & 0x80U) != 0))
+        {
+            return NodeID();
+        }
+        return NodeID(uint8_t(can_frame_.data[0] & 0x7FU));
+    }
+};
+
+
+/**
+ * Builds the CAN frames of one outgoing transfer straight from its payload.
+ * The CAN ID is computed once; every frame differs only in the frame index and the last frame flag.
+ * Multi frame transfers carry the transfer CRC in the first two bytes of the first frame, after the
+ * destination node ID if applicable. The payload must outlive the object.
+ */
+class UAVCAN_EXPORT TransferFrameBuilder : public ICanTxFrameSource
+{
+    const uint8_t* const payload_;
+    const unsigned payload_len_;
+    uint32_t can_id_template_;
+    uint16_t crc_;
+    uint8_t num_frames_;
+    uint8_t dst_node_id_;           ///< Zero if the frame doesn't contain the destination node ID
+    uint8_t frame_payload_capacity_;
+
+public:
+    TransferFrameBuilder(DataTypeID data_type_id, TransferType transfer_type, NodeID src_node_id,
+                         NodeID dst_node_id, TransferID transfer_id, const uint8_t* payload, unsigned payload_len,
+                         const TransferCRC& crc_base);
+
+    /**
+     * False if the payload doesn't fit the max number of frames per transfer, or the parameters are invalid.
+     */
+    bool isValid() const { return num_frames_ > 0; }
+
+    bool isMultiFrame() const { return num_frames_ > 1; }
+
+    NodeID getSrcNodeID() const { return NodeID(uint8_t(CanIDSrcNodeID::unpack(can_id_template_))); }
+
+    virtual unsigned getNumFrames() const { return num_frames_; }
+
+    virtual void buildFrame(unsigned index, CanFrame& out_frame) const;
+};
+
 }
 
 #endif // UAVCAN_TRANSPORT_FRAME_HPP_INCLUDED
@@ -9,6 +9,8 @@
 #include <uavcan/std.hpp>
 #include <uavcan/build_config.hpp>
 #include <uavcan/util/map.hpp>
+#include <uavcan/util/templates.hpp>
+#include <uavcan/dynamic_memory.hpp>
 #include <uavcan/debug.hpp>
 #include <uavcan/transport/transfer.hpp>
 #include <uavcan/time.hpp>
@@ -43,6 +45,7 @@ public:
 
     DataTypeID getDataTypeID() const { return data_type_id_; }
     TransferType getTransferType() const { return TransferType(transfer_type_); }
+    NodeID getDestinationNodeID() const { return destination_node_id_; }
 
     bool operator==(const OutgoingTransferRegistryKey& rhs) const
     {
@@ -52,6 +55,14 @@ public:
             (destination_node_id_ == rhs.destination_node_id_);
     }
 
+    /**
+     * For @ref HashMap.
+     */
+    uint32_t hash() const
+    {
+        return (uint32_t(data_type_id_.get()) << 16) | (uint32_t(transfer_type_) << 8) | destination_node_id_.get();
+    }
+
 #if UAVCAN_TOSTRING
     std::string toString() const;
 #endif
@@ -127,6 +138,11 @@ class UAVCAN_EXPORT OutgoingTransferRegistry : public IOutgoingTransferRegistry,
     Map<OutgoingTransferRegistryKey, Value, NumStaticEntries> map_;
 
 public:
+    /**
+     * Number of entries that share one memory pool block once the static entries are exhausted.
+     */
+    enum { NumEntriesPerPoolBlock = MapBase<OutgoingTransferRegistryKey, Value>::NumKVPerPoolBlock };
+
     explicit OutgoingTransferRegistry(IPoolAllocator& allocator)
         : map_(allocator)
     { }
@@ -151,6 +167,7 @@ TransferID* OutgoingTransferRegistry<NumStaticEntries>::accessOrCreate(const Out
     Value* p = map_.access(key);
     if (p == NULL)
     {
+        const PoolAllocationTagScope tag_scope(PoolAllocationTagOutgoingTransfers);
         p = map_.insert(key, Value());
         if (p == NULL)
         {
@@ -174,6 +191,186 @@ void OutgoingTransferRegistry<NumStaticEntries>::cleanup(MonotonicTime ts)
     map_.removeWhere(DeadlineExpiredPredicate(ts));
 }
 
+/**
+ * Outgoing transfer registry with constant lookup time, for nodes that keep track of many transfers at once
+ * (e.g. a gateway that calls services of many nodes).
+ *
+ * Entries are referenced from an open addressing hash table with linear probing; removal uses backward shift,
+ * so the table never accumulates tombstones. Entries are taken from the static buffer first, then from the pool,
+ * one block per entry. A secondary open addressing table counts the entries of every data type and transfer type,
+ * so that exists() doesn't need to look through the entries.
+ *
+ * The number of entries in the index is limited to 3/4 of the table size in order to keep the probe sequences short.
+ * Entries beyond that limit are kept in an overflow list in the pool, which is searched linearly, so the index
+ * should be sized for the expected number of transfers; refer to getNumOverflowEntries(). Overflow entries are
+ * moved into the index by cleanup() once there is room.
+ */
+class UAVCAN_EXPORT HashedOutgoingTransferRegistryBase : public IOutgoingTransferRegistry, Noncopyable
+{
+protected:
+    struct Entry
+    {
+        OutgoingTransferRegistryKey key;
+        MonotonicTime deadline;         ///< Zero means the entry is free
+        TransferID tid;
+
+        bool isFree() const { return deadline.isZero(); }
+    };
+
+    struct TypeSlot
+    {
+        uint16_t data_type_id;
+        uint8_t transfer_type;
+        uint8_t num_entries;            ///< Zero means the slot is free
+
+        TypeSlot()
+            : data_type_id(0)
+            , transfer_type(0)
+            , num_entries(0)
+        { }
+    };
+
+private:
+    UAVCAN_PACKED_BEGIN
+    struct OverflowValue
+    {
+        MonotonicTime deadline;
+        TransferID tid;
+    };
+    UAVCAN_PACKED_END
+
+    class OverflowExpiredPredicate
+    {
+        const MonotonicTime ts_;
+
+    public:
+        explicit OverflowExpiredPredicate(MonotonicTime ts)
+            : ts_(ts)
+        { }
+
+        bool operator()(const OutgoingTransferRegistryKey&, const OverflowValue& value) const
+        {
+            return value.deadline <= ts_;
+        }
+    };
+
+    class OverflowTypePredicate
+    {
+        const DataTypeID dtid_;
+        const TransferType tt_;
+
+    public:
+        OverflowTypePredicate(DataTypeID dtid, TransferType tt)
+            : dtid_(dtid)
+            , tt_(tt)
+        { }
+
+        bool operator()(const OutgoingTransferRegistryKey& key, const OverflowValue&) const
+        {
+            return dtid_ == key.getDataTypeID() && tt_ == key.getTransferType();
+        }
+    };
+
+    Entry** const index_;
+    TypeSlot* const type_index_;
+    Entry* const static_;
+    const unsigned num_static_;
+    const unsigned index_mask_;
+    IPoolAllocator& allocator_;
+    Map<OutgoingTransferRegistryKey, OverflowValue, 0> overflow_;
+    unsigned num_entries_;
+
+    static unsigned computeHash(const OutgoingTransferRegistryKey& key);
+    static unsigned computeHash(DataTypeID dtid, TransferType tt);
+
+    Entry* allocateEntry();
+    void destroyEntry(Entry* entry);
+
+    TypeSlot* findTypeSlot(DataTypeID dtid, TransferType tt, bool create);
+    void removeTypeSlot(unsigned pos);
+    void removeAt(unsigned pos);
+
+    Entry* insertIntoIndex(unsigned pos, const OutgoingTransferRegistryKey& key, MonotonicTime deadline);
+    void moveOverflowIntoIndex();
+
+protected:
+    HashedOutgoingTransferRegistryBase(Entry** index, TypeSlot* type_index, unsigned index_size,
+                                       Entry* static_buf, unsigned num_static_entries, IPoolAllocator& allocator);
+
+    void removeAll();
+
+public:
+    /**
+     * Entries in the index take one pool block each; overflow entries are grouped this many per block.
+     */
+    enum { NumOverflowEntriesPerPoolBlock = MapBase<OutgoingTransferRegistryKey, OverflowValue>::NumKVPerPoolBlock };
+
+    virtual TransferID* accessOrCreate(const OutgoingTransferRegistryKey& key, MonotonicTime new_deadline);
+
+    virtual bool exists(DataTypeID dtid, TransferType tt) const;
+
+    virtual void cleanup(MonotonicTime ts);
+
+    unsigned getNumEntries() const { return num_entries_ + getNumOverflowEntries(); }
+    unsigned getMaxEntries() const { return (index_mask_ + 1U) * 3U / 4U; }
+
+    /**
+     * Number of entries that didn't fit the index; their lookup time is linear.
+     * If this is not zero most of the time, the index should be made larger.
+     */
+    unsigned getNumOverflowEntries() const { return overflow_.getSize(); }
+};
+
+/**
+ * @tparam NumStaticEntries     Number of entries that don't need the pool.
+ * @tparam IndexSize            Size of the hash tables; must be a power of two.
+ *                              Up to MaxEntries = IndexSize * 3/4 transfers (48 by default) are tracked in constant
+ *                              time; more transfers are tracked in the overflow list as long as the pool allows.
+ *                              The index takes 8 bytes per slot on 32-bit targets.
+ */
+template <unsigned NumStaticEntries, unsigned IndexSize = 64>
+class UAVCAN_EXPORT HashedOutgoingTransferRegistry : public HashedOutgoingTransferRegistryBase
+{
+    Entry* index_[IndexSize];
+    TypeSlot type_index_[IndexSize];
+    Entry static_[NumStaticEntries];
+
+public:
+    enum { MaxEntries = IndexSize * 3U / 4U };
+
+#if !UAVCAN_TINY
+
+    // This instantiation will not be valid in UAVCAN_TINY mode
+    explicit HashedOutgoingTransferRegistry(IPoolAllocator& allocator)
+        : HashedOutgoingTransferRegistryBase(index_, type_index_, IndexSize, static_, NumStaticEntries, allocator)
+    {
+        StaticAssert<(IndexSize >= 4) && ((IndexSize & (IndexSize - 1)) == 0)>::check();
+        StaticAssert<(NumStaticEntries <= MaxEntries)>::check();   // Extra static entries would never be used
+    }
+
+    ~HashedOutgoingTransferRegistry() { removeAll(); }
+
+#endif // !UAVCAN_TINY
+};
+
+template <unsigned IndexSize>
+class UAVCAN_EXPORT HashedOutgoingTransferRegistry<0, IndexSize> : public HashedOutgoingTransferRegistryBase
+{
+    Entry* index_[IndexSize];
+    TypeSlot type_index_[IndexSize];
+
+public:
+    enum { MaxEntries = IndexSize * 3U / 4U };
+
+    explicit HashedOutgoingTransferRegistry(IPoolAllocator& allocator)
+        : HashedOutgoingTransferRegistryBase(index_, type_index_, IndexSize, NULL, 0, allocator)
+    {
+        StaticAssert<(IndexSize >= 4) && ((IndexSize & (IndexSize - 1)) == 0)>::check();
+    }
+
+    ~HashedOutgoingTransferRegistry() { removeAll(); }
+};
+
 }
 
 #endif // UAVCAN_TRANSPORT_OUTGOING_TRANSFER_REGISTRY_HPP_INCLUDED
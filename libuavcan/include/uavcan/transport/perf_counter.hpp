@@ -7,6 +7,7 @@
 
 #include <uavcan/std.hpp>
 #include <uavcan/build_config.hpp>
+#include <uavcan/driver/can.hpp>
 
 namespace uavcan
 {
@@ -20,9 +21,11 @@ public:
     void addRxTransfer() { }
     void addError() { }
     void addErrors(unsigned) { }
+    void addLostFrames(uint8_t, unsigned) { }
     uint64_t getTxTransferCount() const { return 0; }
     uint64_t getRxTransferCount() const { return 0; }
     uint64_t getErrorCount() const { return 0; }
+    uint64_t getLostFrameCount(uint8_t) const { return 0; }
 };
 
 #else
@@ -32,13 +35,16 @@ class UAVCAN_EXPORT TransferPerfCounter
     uint64_t transfers_tx_;
     uint64_t transfers_rx_;
     uint64_t errors_;
+    uint64_t lost_frames_[MaxCanIfaces];
 
 public:
     TransferPerfCounter()
         : transfers_tx_(0)
         , transfers_rx_(0)
         , errors_(0)
-    { }
+    {
+        fill(lost_frames_, lost_frames_ + MaxCanIfaces, uint64_t(0));
+    }
 
     void addTxTransfer() { transfers_tx_++; }
     void addRxTransfer() { transfers_rx_++; }
@@ -50,9 +56,25 @@ public:
         errors_ += errors;
     }
 
+    /**
+     * Frames that were lost on one interface, but received from another one. Refer to
+     * TransferReceiver::ReassemblyCrossIface.
+     */
+    void addLostFrames(uint8_t iface_index, unsigned num)
+    {
+        if (iface_index < MaxCanIfaces)
+        {
+            lost_frames_[iface_index] += num;
+        }
+    }
+
     uint64_t getTxTransferCount() const { return transfers_tx_; }
     uint64_t getRxTransferCount() const { return transfers_rx_; }
     uint64_t getErrorCount() const { return errors_; }
+    uint64_t getLostFrameCount(uint8_t iface_index) const
+    {
+        return (iface_index < MaxCanIfaces) ? lost_frames_[iface_index] : 0;
+    }
 };
 
 #endif
@@ -100,6 +100,29 @@ public:
     bool operator>=(NodeID rhs) const { return value_ >= rhs.value_; }
 };
 
+
+/**
+ * A field of the 29-bit CAN ID of a UAVCAN frame.
+ * The typedefs below are the only definition of the CAN ID layout; everything that encodes or decodes CAN IDs
+ * must use them.
+ */
+template <unsigned Offset, unsigned Width>
+struct UAVCAN_EXPORT CanIDField
+{
+    static uint32_t mask() { return uint32_t(((1UL << Width) - 1U) << Offset); }
+
+    static uint32_t pack(uint32_t value) { return uint32_t(value << Offset) & mask(); }
+
+    static uint32_t unpack(uint32_t can_id) { return (can_id & mask()) >> Offset; }
+};
+
+typedef CanIDField<0, 3>   CanIDTransferID;
+typedef CanIDField<3, 1>   CanIDLastFrame;
+typedef CanIDField<4, 6>   CanIDFrameIndex;
+typedef CanIDField<10, 7>  CanIDSrcNodeID;
+typedef CanIDField<17, 2>  CanIDTransferType;
+typedef CanIDField<19, 10> CanIDDataTypeID;
+
 }
 
 #endif // UAVCAN_TRANSPORT_TRANSFER_HPP_INCLUDED
@@ -46,6 +46,11 @@ public:
 
     bool isEmpty() const { return !node_id_.isValid(); }
 
+    /**
+     * For @ref HashMap.
+     */
+    uint32_t hash() const { return (uint32_t(node_id_.get()) << 8) | transfer_type_; }
+
     NodeID getNodeID() const { return node_id_; }
     TransferType getTransferType() const { return TransferType(transfer_type_); }
 
@@ -115,6 +120,11 @@ class UAVCAN_EXPORT DynamicTransferBufferManagerEntry
     virtual void resetImpl();
 
 public:
+    /**
+     * Number of payload bytes stored in one memory pool block; the entry itself takes one more block.
+     */
+    enum { PayloadBytesPerPoolBlock = Block::Size };
+
     DynamicTransferBufferManagerEntry(IPoolAllocator& allocator, uint16_t max_size)
         : allocator_(allocator)
         , max_write_pos_(0)
@@ -9,9 +9,10 @@
 #include <uavcan/error.hpp>
 #include <uavcan/std.hpp>
 #include <uavcan/transport/transfer_receiver.hpp>
+#include <uavcan/transport/transfer_receiver_store.hpp>
 #include <uavcan/transport/perf_counter.hpp>
 #include <uavcan/util/linked_list.hpp>
-#include <uavcan/util/map.hpp>
+#include <uavcan/util/hash_map.hpp>
 #include <uavcan/debug.hpp>
 #include <uavcan/transport/crc.hpp>
 #include <uavcan/data_type.hpp>
@@ -50,6 +51,13 @@ public:
      */
     virtual void release() { }
 
+    /**
+     * Single frame transfers keep the payload in one contiguous block, which allows to decode it in place
+     * without calling read(). Returns NULL for multi frame transfers.
+     */
+    virtual const uint8_t* getSingleFramePayloadPtr() const { return NULL; }
+    virtual unsigned getSingleFramePayloadLen() const { return 0; }
+
     MonotonicTime getMonotonicTimestamp() const { return ts_mono_; }
     UtcTime getUtcTimestamp()             const { return ts_utc_; }
     TransferType getTransferType()        const { return transfer_type_; }
@@ -68,6 +76,8 @@ class UAVCAN_EXPORT SingleFrameIncomingTransfer : public IncomingTransfer
 public:
     explicit SingleFrameIncomingTransfer(const RxFrame& frm);
     virtual int read(unsigned offset, uint8_t* data, unsigned len) const;
+    virtual const uint8_t* getSingleFramePayloadPtr() const { return payload_; }
+    virtual unsigned getSingleFramePayloadLen() const { return payload_len_; }
 };
 
 /**
@@ -90,38 +100,41 @@ class UAVCAN_EXPORT TransferListenerBase : public LinkedListNode<TransferListene
 {
     const DataTypeDescriptor& data_type_;
     const TransferCRC crc_base_;                      ///< Pre-initialized with data type hash, thus constant
-    MapBase<TransferBufferManagerKey, TransferReceiver>& receivers_;
+    ITransferReceiverStore& receivers_;
     ITransferBufferManager& bufmgr_;
     TransferPerfCounter& perf_;
+    IPoolAllocator& allocator_;
+    TransferReceiver::ReassemblyMode reassembly_mode_;
 
-    class TimedOutReceiverPredicate
-    {
-        const MonotonicTime ts_;
-        ITransferBufferManager& parent_bufmgr_;
-
-    public:
-        TimedOutReceiverPredicate(MonotonicTime arg_ts, ITransferBufferManager& arg_bufmgr)
-            : ts_(arg_ts)
-            , parent_bufmgr_(arg_bufmgr)
-        { }
-
-        bool operator()(const TransferBufferManagerKey& key, const TransferReceiver& value) const;
-    };
+    /*
+     * Cross iface mode only. The table is allocated in the memory pool on the first source that is received from
+     * more than one interface, and released once it is empty again, so that the other listeners don't pay for it.
+     * Its directory must fit the object into one pool block.
+     */
+    typedef HashMapBase<TransferBufferManagerKey, TransferReceiverIfaceTracker> IfaceTrackerMapBase;
+    typedef HashMap<TransferBufferManagerKey, TransferReceiverIfaceTracker, 0,
+                    IfaceTrackerMapBase::NumSegmentsPerDirectoryBlock> IfaceTrackerMap;
+    IfaceTrackerMap* iface_trackers_;
 
-    bool checkPayloadCrc(const uint16_t compare_with, const ITransferBuffer& tbb) const;
+    TransferReceiverIfaceTracker* accessIfaceTracker(const TransferBufferManagerKey& key,
+                                                     const TransferReceiver& receiver, const RxFrame& frame);
+    void destroyIfaceTrackers();
 
 protected:
     TransferListenerBase(TransferPerfCounter& perf, const DataTypeDescriptor& data_type,
-                         MapBase<TransferBufferManagerKey, TransferReceiver>& receivers,
-                         ITransferBufferManager& bufmgr)
+                         ITransferReceiverStore& receivers, ITransferBufferManager& bufmgr,
+                         IPoolAllocator& allocator)
         : data_type_(data_type)
         , crc_base_(data_type.getSignature().toTransferCRC())
         , receivers_(receivers)
         , bufmgr_(bufmgr)
         , perf_(perf)
+        , allocator_(allocator)
+        , reassembly_mode_(TransferReceiver::ReassemblySingleIface)
+        , iface_trackers_(NULL)
     { }
 
-    virtual ~TransferListenerBase() { }
+    virtual ~TransferListenerBase() { destroyIfaceTrackers(); }
 
     void handleReception(TransferReceiver& receiver, const RxFrame& frame, TransferBufferAccessor& tba);
 
@@ -130,6 +143,17 @@ protected:
 public:
     const DataTypeDescriptor& getDataTypeDescriptor() const { return data_type_; }
 
+    /**
+     * Cross iface reassembly is recommended for redundant interfaces. Refer to TransferReceiver::ReassemblyMode.
+     * Should be set before the first transfer is received. In this mode, per-interface progress of every source
+     * that is received from more than one interface is kept in a hash table in the memory pool, in order to count
+     * lost frames. Frames lost before the source was first received from another interface are not counted.
+     * The table holds up to 3/4 of NumSegmentsPerDirectoryBlock * NumKVPerPoolBlock sources; lost frames of the
+     * sources that don't fit are not counted either.
+     */
+    TransferReceiver::ReassemblyMode getReassemblyMode() const { return reassembly_mode_; }
+    void setReassemblyMode(TransferReceiver::ReassemblyMode mode) { reassembly_mode_ = mode; }
+
     void cleanup(MonotonicTime ts);
 
     virtual void handleFrame(const RxFrame& frame);
@@ -137,16 +161,25 @@ public:
 
 /**
  * This class should be derived by transfer receivers (subscribers, servers).
+ * @tparam ReceiverStore    Container of transfer receivers, either @ref TransferReceiverMap (default, compact),
+ *                          @ref TransferReceiverHashMap or @ref TransferReceiverTable (constant time lookup,
+ *                          for listeners with many sources).
+ * @tparam BufferManager    Manager of the buffers for multi-frame transfers, instantiated as
+ *                          BufferManager<MaxBufSize, NumStaticBufs> and constructed from the pool allocator.
+ *                          Either @ref TransferBufferManager (default, pool blocks) or ArenaBuffers<>::Manager
+ *                          (one contiguous arena, see arena_transfer_buffer.hpp).
  */
-template <unsigned MaxBufSize, unsigned NumStaticBufs, unsigned NumStaticReceivers>
+template <unsigned MaxBufSize, unsigned NumStaticBufs, unsigned NumStaticReceivers,
+          template <unsigned> class ReceiverStore = TransferReceiverMap,
+          template <uint16_t, uint8_t> class BufferManager = TransferBufferManager>
 class UAVCAN_EXPORT TransferListener : public TransferListenerBase
 {
-    TransferBufferManager<MaxBufSize, NumStaticBufs> bufmgr_;
-    Map<TransferBufferManagerKey, TransferReceiver, NumStaticReceivers> receivers_;
+    BufferManager<MaxBufSize, NumStaticBufs> bufmgr_;
+    ReceiverStore<NumStaticReceivers> receivers_;
 
 public:
     TransferListener(TransferPerfCounter& perf, const DataTypeDescriptor& data_type, IPoolAllocator& allocator)
-        : TransferListenerBase(perf, data_type, receivers_, bufmgr_)
+        : TransferListenerBase(perf, data_type, receivers_, bufmgr_, allocator)
         , bufmgr_(allocator)
         , receivers_(allocator)
     {
@@ -159,7 +192,7 @@ public:
 
     virtual ~TransferListener()
     {
-        // Map must be cleared before bufmgr is destructed
+        // Receivers must be removed before bufmgr is destructed
         receivers_.removeAll();
     }
 };
@@ -167,12 +200,14 @@ public:
 /**
  * This class should be derived by callers.
  */
-template <unsigned MaxBufSize, unsigned NumStaticBufs, unsigned NumStaticReceivers>
+template <unsigned MaxBufSize, unsigned NumStaticBufs, unsigned NumStaticReceivers,
+          template <unsigned> class ReceiverStore = TransferReceiverMap,
+          template <uint16_t, uint8_t> class BufferManager = TransferBufferManager>
 class UAVCAN_EXPORT ServiceResponseTransferListener
-    : public TransferListener<MaxBufSize, NumStaticBufs, NumStaticReceivers>
+    : public TransferListener<MaxBufSize, NumStaticBufs, NumStaticReceivers, ReceiverStore, BufferManager>
 {
 public:
-    typedef TransferListener<MaxBufSize, NumStaticBufs, NumStaticReceivers> BaseType;
+    typedef TransferListener<MaxBufSize, NumStaticBufs, NumStaticReceivers, ReceiverStore, BufferManager> BaseType;
 
     struct ExpectedResponseParams
     {
@@ -221,8 +256,10 @@ public:
 /*
  * ServiceResponseTransferListener<>
  */
-template <unsigned MaxBufSize, unsigned NumStaticBufs, unsigned NumStaticReceivers>
-void ServiceResponseTransferListener<MaxBufSize, NumStaticBufs, NumStaticReceivers>::handleFrame(const RxFrame& frame)
+template <unsigned MaxBufSize, unsigned NumStaticBufs, unsigned NumStaticReceivers,
+          template <unsigned> class ReceiverStore, template <uint16_t, uint8_t> class BufferManager>
+void ServiceResponseTransferListener<MaxBufSize, NumStaticBufs, NumStaticReceivers, ReceiverStore, BufferManager>::
+handleFrame(const RxFrame& frame)
 {
     if (response_params_.match(frame))
     {
@@ -230,15 +267,18 @@ void ServiceResponseTransferListener<MaxBufSize, NumStaticBufs, NumStaticReceive
     }
 }
 
-template <unsigned MaxBufSize, unsigned NumStaticBufs, unsigned NumStaticReceivers>
-void ServiceResponseTransferListener<MaxBufSize, NumStaticBufs, NumStaticReceivers>::setExpectedResponseParams(
-    const ExpectedResponseParams& erp)
+template <unsigned MaxBufSize, unsigned NumStaticBufs, unsigned NumStaticReceivers,
+          template <unsigned> class ReceiverStore, template <uint16_t, uint8_t> class BufferManager>
+void ServiceResponseTransferListener<MaxBufSize, NumStaticBufs, NumStaticReceivers, ReceiverStore, BufferManager>::
+setExpectedResponseParams(const ExpectedResponseParams& erp)
 {
     response_params_ = erp;
 }
 
-template <unsigned MaxBufSize, unsigned NumStaticBufs, unsigned NumStaticReceivers>
-void ServiceResponseTransferListener<MaxBufSize, NumStaticBufs, NumStaticReceivers>::stopAcceptingAnything()
+template <unsigned MaxBufSize, unsigned NumStaticBufs, unsigned NumStaticReceivers,
+          template <unsigned> class ReceiverStore, template <uint16_t, uint8_t> class BufferManager>
+void ServiceResponseTransferListener<MaxBufSize, NumStaticBufs, NumStaticReceivers, ReceiverStore, BufferManager>::
+stopAcceptingAnything()
 {
     response_params_ = ExpectedResponseParams();
 }
@@ -9,16 +9,74 @@
 #include <uavcan/build_config.hpp>
 #include <uavcan/transport/frame.hpp>
 #include <uavcan/transport/transfer_buffer.hpp>
+#include <uavcan/transport/crc.hpp>
 
 namespace uavcan
 {
 
+/**
+ * Per source state of the cross iface reassembly mode: progress of every interface, used to count the frames
+ * lost by it. It's kept apart from @ref TransferReceiver, so that receivers in single iface mode don't pay for it.
+ */
+UAVCAN_PACKED_BEGIN
+class UAVCAN_EXPORT TransferReceiverIfaceTracker
+{
+    // TID and the next frame index of the last frame received from an interface
+    static const uint16_t ProgressValid = 0x8000;
+    static const unsigned ProgressTidShift = 8;
+    static const unsigned ProgressIndexMask = 0x7F;
+
+    uint16_t progress_[MaxCanIfaces];
+    TransferID last_tid_;               ///< Last completed transfer
+    uint8_t last_num_frames_;           ///< Zero if unknown
+    uint8_t lost_frame_cnt_;
+
+    void registerLostFrames(unsigned num);
+
+public:
+    TransferReceiverIfaceTracker()
+        : last_num_frames_(0)
+        , lost_frame_cnt_(0)
+    {
+        reset();
+    }
+
+    void reset();
+
+    /**
+     * Sets the progress of an interface as if it has delivered the frames of the transfer up to the given index.
+     */
+    void setProgress(uint8_t iface_index, TransferID tid, unsigned next_frame_index);
+
+    void track(const RxFrame& frame);
+
+    void registerCompletedTransfer(TransferID tid, uint8_t num_frames);
+
+    /**
+     * Number of frames lost by the interface of the last tracked frame.
+     * Losses are detected when the interface delivers a frame after a gap, so this is a lower bound.
+     */
+    uint8_t yieldLostFrameCount();
+};
+UAVCAN_PACKED_END
+
 UAVCAN_PACKED_BEGIN
 class UAVCAN_EXPORT TransferReceiver
 {
 public:
     enum ResultCode { ResultNotComplete, ResultComplete, ResultSingleFrame };
 
+    /**
+     * Single iface mode: the transfer is received from one interface; another interface is switched to only
+     * if the current one stops delivering transfers.
+     * Cross iface mode, for redundant interfaces: the next expected frame is accepted from any interface, so that
+     * a frame lost on one bus is substituted with its twin from another bus. Twin frames are discarded. A transfer
+     * in progress is not abandoned for a newer one until the interface timeout expires, because any interface
+     * may still complete it. Frames lost by every interface are counted if @ref TransferReceiverIfaceTracker
+     * is provided.
+     */
+    enum ReassemblyMode { ReassemblySingleIface, ReassemblyCrossIface };
+
     static const uint32_t MinTransferIntervalUSec     = 1   * 1000UL;
     static const uint32_t MaxTransferIntervalUSec     = 10  * 1000 * 1000UL;
     static const uint32_t DefaultTransferIntervalUSec = 1   * 1000 * 1000UL;
@@ -39,6 +97,7 @@ private:
     UtcTime first_frame_ts_;
     uint32_t transfer_interval_usec_;
     uint16_t this_transfer_crc_;
+    TransferCRC computed_crc_;          ///< Updated as the payload is written to the buffer
     uint16_t buffer_write_pos_;
     TransferID tid_;
     uint8_t iface_index_;
@@ -49,14 +108,16 @@ private:
 
     void registerError() const;
 
+    bool isDuplicate(const RxFrame& frame) const;
+
     TidRelation getTidRelation(const RxFrame& frame) const;
 
     void updateTransferTimings();
     void prepareForNextTransfer();
 
-    bool validate(const RxFrame& frame) const;
+    bool validate(const RxFrame& frame, ReassemblyMode mode) const;
     bool writePayload(const RxFrame& frame, ITransferBuffer& buf);
-    ResultCode receive(const RxFrame& frame, TransferBufferAccessor& tba);
+    ResultCode receive(const RxFrame& frame, TransferBufferAccessor& tba, const TransferCRC& crc_base);
 
 public:
     TransferReceiver()
@@ -70,7 +131,28 @@ public:
 
     bool isTimedOut(MonotonicTime current_ts) const;
 
-    ResultCode addFrame(const RxFrame& frame, TransferBufferAccessor& tba);
+    /**
+     * @param crc_base      Initial value of the payload CRC for multi-frame transfers, i.e. the data type
+     *                      signature CRC.
+     * @param iface_tracker Optional, cross iface mode only. Must belong to this receiver.
+     */
+    ResultCode addFrame(const RxFrame& frame, TransferBufferAccessor& tba, const TransferCRC& crc_base = TransferCRC(),
+                        ReassemblyMode mode = ReassemblySingleIface,
+                        TransferReceiverIfaceTracker* iface_tracker = NULL);
+
+    /**
+     * Whether the frame came from another interface than the current transfer was started on.
+     */
+    bool isFromAnotherIface(const RxFrame& frame) const
+    {
+        return isInitialized() && (frame.getIfaceIndex() != iface_index_);
+    }
+
+    /**
+     * Seeds a newly created tracker with the progress of the transfer in progress, if any, which must have been
+     * received from one interface only.
+     */
+    void initIfaceTracker(TransferReceiverIfaceTracker& tracker) const;
 
     uint8_t yieldErrorCount();
 
@@ -79,6 +161,12 @@ public:
 
     uint16_t getLastTransferCrc() const { return this_transfer_crc_; }
 
+    /**
+     * CRC of the payload of the last multi-frame transfer, computed during reception.
+     * The transfer is valid if this value matches @ref getLastTransferCrc().
+     */
+    uint16_t getLastTransferComputedCrc() const { return computed_crc_.get(); }
+
     MonotonicDuration getInterval() const { return MonotonicDuration::fromUSec(transfer_interval_usec_); }
 };
 UAVCAN_PACKED_END
@@ -0,0 +1,208 @@
+/*
+ * Copyright (C) 2014 Pavel Kirienko <pavel.kirienko@gmail.com>
+ */
+
+#ifndef UAVCAN_TRANSPORT_TRANSFER_RECEIVER_STORE_HPP_INCLUDED
+#define UAVCAN_TRANSPORT_TRANSFER_RECEIVER_STORE_HPP_INCLUDED
+
+#include <uavcan/build_config.hpp>
+#include <uavcan/dynamic_memory.hpp>
+#include <uavcan/transport/transfer_receiver.hpp>
+#include <uavcan/transport/transfer_buffer.hpp>
+#include <uavcan/util/map.hpp>
+#include <uavcan/util/hash_map.hpp>
+#include <uavcan/util/templates.hpp>
+
+namespace uavcan
+{
+/**
+ * Storage of transfer receivers of one transfer listener, keyed by source node ID and transfer type.
+ * Refer to @ref TransferReceiverMap, @ref TransferReceiverHashMap and @ref TransferReceiverTable.
+ */
+class UAVCAN_EXPORT ITransferReceiverStore
+{
+public:
+    virtual ~ITransferReceiverStore() { }
+
+    virtual TransferReceiver* access(const TransferBufferManagerKey& key) = 0;
+
+    /**
+     * Creates a new receiver in the default state.
+     * @return Null pointer if there's no memory left.
+     */
+    virtual TransferReceiver* create(const TransferBufferManagerKey& key) = 0;
+
+    /**
+     * Removes the timed out receivers together with their transfer buffers.
+     */
+    virtual void removeTimedOut(MonotonicTime ts, ITransferBufferManager& bufmgr) = 0;
+
+    virtual void removeAll() = 0;
+
+    virtual bool isEmpty() const = 0;
+};
+
+/**
+ * Internal for TransferReceiverMap.
+ */
+class UAVCAN_EXPORT TimedOutTransferReceiverPredicate
+{
+    const MonotonicTime ts_;
+    ITransferBufferManager& parent_bufmgr_;
+
+public:
+    TimedOutTransferReceiverPredicate(MonotonicTime arg_ts, ITransferBufferManager& arg_bufmgr)
+        : ts_(arg_ts)
+        , parent_bufmgr_(arg_bufmgr)
+    { }
+
+    bool operator()(const TransferBufferManagerKey& key, const TransferReceiver& value) const;
+};
+
+/**
+ * Receiver store based on @ref Map<>. This is the default one.
+ * It is memory efficient, but the complexity of lookup is O(N) where N is the number of source nodes.
+ */
+template <unsigned NumStaticReceivers>
+class UAVCAN_EXPORT TransferReceiverMap : public ITransferReceiverStore, Noncopyable
+{
+    Map<TransferBufferManagerKey, TransferReceiver, NumStaticReceivers> map_;
+
+public:
+    explicit TransferReceiverMap(IPoolAllocator& allocator)
+        : map_(allocator)
+    { }
+
+    virtual TransferReceiver* access(const TransferBufferManagerKey& key) { return map_.access(key); }
+
+    virtual TransferReceiver* create(const TransferBufferManagerKey& key)
+    {
+        const PoolAllocationTagScope tag_scope(PoolAllocationTagReceivers);
+        return map_.insert(key, TransferReceiver());
+    }
+
+    virtual void removeTimedOut(MonotonicTime ts, ITransferBufferManager& bufmgr)
+    {
+        map_.removeWhere(TimedOutTransferReceiverPredicate(ts, bufmgr));
+    }
+
+    virtual void removeAll() { map_.removeAll(); }
+
+    virtual bool isEmpty() const { return map_.isEmpty(); }
+};
+
+/**
+ * Receiver store based on @ref HashMap<>.
+ * Lookup takes constant time, but the static buffer is 4/3 of the number of static receivers.
+ */
+template <unsigned NumStaticReceivers>
+class UAVCAN_EXPORT TransferReceiverHashMap : public ITransferReceiverStore, Noncopyable
+{
+    HashMap<TransferBufferManagerKey, TransferReceiver, NumStaticReceivers> map_;
+
+public:
+    explicit TransferReceiverHashMap(IPoolAllocator& allocator)
+        : map_(allocator)
+    { }
+
+    virtual TransferReceiver* access(const TransferBufferManagerKey& key) { return map_.access(key); }
+
+    virtual TransferReceiver* create(const TransferBufferManagerKey& key)
+    {
+        const PoolAllocationTagScope tag_scope(PoolAllocationTagReceivers);
+        return map_.insert(key, TransferReceiver());
+    }
+
+    virtual void removeTimedOut(MonotonicTime ts, ITransferBufferManager& bufmgr)
+    {
+        map_.removeWhere(TimedOutTransferReceiverPredicate(ts, bufmgr));
+    }
+
+    virtual void removeAll() { map_.removeAll(); }
+
+    virtual bool isEmpty() const { return map_.isEmpty(); }
+};
+
+/**
+ * Receiver store with constant time lookup.
+ * Receivers are indexed by source node ID; receivers of different transfer types from the same node form a chain.
+ * Receivers are allocated in the static buffer first, then in the memory pool, and are freed when timed out.
+ * The index costs one pointer per node ID, so this store pays off for listeners that receive data from many nodes,
+ * e.g. node status monitors.
+ */
+class UAVCAN_EXPORT TransferReceiverTableBase : public ITransferReceiverStore, Noncopyable
+{
+protected:
+    struct Entry
+    {
+        Entry* next;
+        TransferReceiver receiver;
+        uint8_t transfer_type;
+
+        Entry()
+            : next(NULL)
+            , transfer_type(NumTransferTypes)       // That means the entry is free
+        { }
+
+        bool isFree() const { return transfer_type == NumTransferTypes; }
+    };
+
+private:
+    enum { IndexSize = NodeID::Max + 1 };
+
+    Entry* index_[IndexSize];
+    Entry* const static_;
+    const unsigned num_static_;
+    IPoolAllocator& allocator_;
+    unsigned num_entries_;
+
+    Entry* allocateEntry();
+    void destroyEntry(Entry* entry);
+
+protected:
+    TransferReceiverTableBase(Entry* static_buf, unsigned num_static_entries, IPoolAllocator& allocator);
+
+public:
+    virtual TransferReceiver* access(const TransferBufferManagerKey& key);
+    virtual TransferReceiver* create(const TransferBufferManagerKey& key);
+    virtual void removeTimedOut(MonotonicTime ts, ITransferBufferManager& bufmgr);
+    virtual void removeAll();
+    virtual bool isEmpty() const { return num_entries_ == 0; }
+
+    unsigned getNumEntries() const { return num_entries_; }
+};
+
+
+template <unsigned NumStaticReceivers>
+class UAVCAN_EXPORT TransferReceiverTable : public TransferReceiverTableBase
+{
+    Entry static_[NumStaticReceivers];
+
+public:
+#if !UAVCAN_TINY
+
+    // This instantiation will not be valid in UAVCAN_TINY mode
+    explicit TransferReceiverTable(IPoolAllocator& allocator)
+        : TransferReceiverTableBase(static_, NumStaticReceivers, allocator)
+    { }
+
+    ~TransferReceiverTable() { removeAll(); }
+
+#endif // !UAVCAN_TINY
+};
+
+
+template <>
+class UAVCAN_EXPORT TransferReceiverTable<0> : public TransferReceiverTableBase
+{
+public:
+    explicit TransferReceiverTable(IPoolAllocator& allocator)
+        : TransferReceiverTableBase(NULL, 0, allocator)
+    { }
+
+    ~TransferReceiverTable() { removeAll(); }
+};
+
+}
+
+#endif // UAVCAN_TRANSPORT_TRANSFER_RECEIVER_STORE_HPP_INCLUDED
@@ -18,6 +18,7 @@
 #include <uavcan/node/service_server.hpp>
 #include <uavcan/node/service_client.hpp>
 #include <uavcan/node/global_data_type_registry.hpp>
+#include <uavcan/node/memory_budget.hpp>
 
 // Util
 #include <uavcan/util/templates.hpp>
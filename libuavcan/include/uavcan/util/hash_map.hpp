@@ -0,0 +1,779 @@
+/*
+ * Copyright (C) 2014 Pavel Kirienko <pavel.kirienko@gmail.com>
+ */
+
+#ifndef UAVCAN_UTIL_HASH_MAP_HPP_INCLUDED
+#define UAVCAN_UTIL_HASH_MAP_HPP_INCLUDED
+
+#include <cassert>
+#include <cstdlib>
+#include <uavcan/std.hpp>
+#include <uavcan/build_config.hpp>
+#include <uavcan/dynamic_memory.hpp>
+#include <uavcan/util/templates.hpp>
+#include <uavcan/util/placement_new.hpp>
+
+namespace uavcan
+{
+/**
+ * Hash function for @ref HashMap keys.
+ * By default it calls the method Key::hash(), which must return uint32_t; equal keys must produce equal hashes.
+ * The hash doesn't have to be well distributed, the map mixes it anyway.
+ * Specializations for integer keys are provided below.
+ */
+template <typename Key>
+struct UAVCAN_EXPORT HashMapKeyHash
+{
+    static uint32_t compute(const Key& key) { return key.hash(); }
+};
+
+template <typename T>
+struct UAVCAN_EXPORT IntegerHashMapKeyHash
+{
+    static uint32_t compute(T key)
+    {
+        const uint64_t x = uint64_t(key);
+        return uint32_t(x) ^ uint32_t(x >> 32);
+    }
+};
+
+template <> struct UAVCAN_EXPORT HashMapKeyHash<uint8_t>  : public IntegerHashMapKeyHash<uint8_t>  { };
+template <> struct UAVCAN_EXPORT HashMapKeyHash<int8_t>   : public IntegerHashMapKeyHash<int8_t>   { };
+template <> struct UAVCAN_EXPORT HashMapKeyHash<uint16_t> : public IntegerHashMapKeyHash<uint16_t> { };
+template <> struct UAVCAN_EXPORT HashMapKeyHash<int16_t>  : public IntegerHashMapKeyHash<int16_t>  { };
+template <> struct UAVCAN_EXPORT HashMapKeyHash<uint32_t> : public IntegerHashMapKeyHash<uint32_t> { };
+template <> struct UAVCAN_EXPORT HashMapKeyHash<int32_t>  : public IntegerHashMapKeyHash<int32_t>  { };
+template <> struct UAVCAN_EXPORT HashMapKeyHash<uint64_t> : public IntegerHashMapKeyHash<uint64_t> { };
+template <> struct UAVCAN_EXPORT HashMapKeyHash<int64_t>  : public IntegerHashMapKeyHash<int64_t>  { };
+
+/**
+ * Hash table with the same interface and memory policy as @ref Map, but with constant time lookups.
+ *
+ * This is an open addressing table with linear probing. Removal shifts the following entries of the probe
+ * sequence backwards, so there are no tombstones and lookups never get slower over time.
+ *
+ * KV pairs are stored in the static buffer first. When it gets 3/4 full, the table grows into segments allocated
+ * in the memory pool (one segment per block), and all entries are rehashed in place. When the number of entries
+ * drops, the table shrinks back and releases the segments, down to the static buffer only.
+ * The table never gets completely full, so lookups for a missing key always terminate.
+ *
+ * KV pairs and control bytes are kept in separate arrays, so that no padding is wasted after the control bytes.
+ * Type requirements are the same as for Map<>, plus the key must be hashable, see @ref HashMapKeyHash.
+ * Size of KV pair + 1 byte must not exceed MemPoolBlockSize.
+ */
+template <typename Key, typename Value>
+class UAVCAN_EXPORT HashMapBase : Noncopyable
+{
+    UAVCAN_PACKED_BEGIN
+public:
+    struct KVPair
+    {
+        Key key;
+        Value value;
+
+        KVPair()
+            : key()
+            , value()
+        { }
+
+        KVPair(const Key& arg_key, const Value& arg_value)
+            : key(arg_key)
+            , value(arg_value)
+        { }
+        bool match(const Key& rhs) const { return rhs == key; }
+    };
+    UAVCAN_PACKED_END
+
+private:
+    enum
+    {
+        CtrlEmpty = 0,
+        CtrlPending = 1,        ///< Occupied, to be relocated by the ongoing rehash
+        CtrlFull = 0x80         ///< Occupied; the lower 7 bits hold a part of the hash to skip most key comparisons
+    };
+
+    struct Segment
+    {
+        enum { NumKV = MemPoolBlockSize / (sizeof(KVPair) + 1U) };
+
+        KVPair kvs[NumKV];
+        uint8_t ctrl[NumKV];
+
+        Segment()
+        {
+            StaticAssert<(static_cast<unsigned>(NumKV) > 0)>::check();
+            IsDynamicallyAllocatable<Segment>::check();
+            fill(ctrl, ctrl + NumKV, uint8_t(CtrlEmpty));
+        }
+    };
+
+protected:
+    struct DirectoryBlock
+    {
+        enum { NumSegments = MemPoolBlockSize / sizeof(void*) };
+
+        Segment* segments[NumSegments];
+
+        DirectoryBlock()
+        {
+            IsDynamicallyAllocatable<DirectoryBlock>::check();
+            fill(segments, segments + NumSegments, static_cast<Segment*>(NULL));
+        }
+    };
+
+private:
+    /**
+     * Pointers to the parts of one slot.
+     */
+    struct Slot
+    {
+        KVPair* kv;
+        uint8_t* ctrl;
+
+        void moveFrom(const Slot& rhs) const
+        {
+            *kv = *rhs.kv;
+            *ctrl = *rhs.ctrl;
+        }
+
+        void clear() const
+        {
+            *kv = KVPair();
+            *ctrl = uint8_t(CtrlEmpty);
+        }
+    };
+
+    IPoolAllocator& allocator_;
+    KVPair* const static_kvs_;
+    uint8_t* const static_ctrl_;
+    DirectoryBlock** const directory_;
+    const unsigned num_static_slots_;
+    const unsigned max_segments_;
+    unsigned num_segments_;
+    unsigned size_;
+
+    struct YesPredicate
+    {
+        bool operator()(const Key& k, const Value& v) const { (void)k; (void)v; return true; }
+    };
+
+    static uint32_t computeHash(const Key& key)
+    {
+        uint32_t h = HashMapKeyHash<Key>::compute(key);     // MurmurHash3 finalizer
+        h ^= h >> 16;
+        h *= 0x85EBCA6BU;
+        h ^= h >> 13;
+        h *= 0xC2B2AE35U;
+        h ^= h >> 16;
+        return h;
+    }
+
+    static uint8_t makeCtrl(uint32_t hash) { return uint8_t(CtrlFull | (hash & 0x7FU)); }
+
+    /// Maps the hash onto [0, capacity) using its upper bits, which avoids division
+    static unsigned getHomeSlot(uint32_t hash, unsigned capacity)
+    {
+        return unsigned((uint64_t(hash) * capacity) >> 32);
+    }
+
+    static unsigned nextSlot(unsigned slot, unsigned capacity) { return ((slot + 1U) < capacity) ? (slot + 1U) : 0U; }
+
+    unsigned getCapacityWithSegments(unsigned num_segments) const
+    {
+        return num_static_slots_ + num_segments * unsigned(Segment::NumKV);
+    }
+
+    unsigned getNumDirectoryBlocks() const
+    {
+        return (max_segments_ + unsigned(DirectoryBlock::NumSegments) - 1U) / unsigned(DirectoryBlock::NumSegments);
+    }
+
+    Segment*& getSegment(unsigned index) const
+    {
+        return directory_[index / unsigned(DirectoryBlock::NumSegments)]->
+               segments[index % unsigned(DirectoryBlock::NumSegments)];
+    }
+
+    Slot locate(unsigned index) const
+    {
+        Slot slot;
+        if (index < num_static_slots_)
+        {
+            slot.kv = static_kvs_ + index;
+            slot.ctrl = static_ctrl_ + index;
+        }
+        else
+        {
+            index -= num_static_slots_;
+            Segment* const seg = getSegment(index / unsigned(Segment::NumKV));
+            index %= unsigned(Segment::NumKV);
+            slot.kv = seg->kvs + index;
+            slot.ctrl = seg->ctrl + index;
+        }
+        return slot;
+    }
+
+    int findSlot(const Key& key, uint32_t hash) const;
+    unsigned findFreeSlot(uint32_t hash) const;
+    void removeAt(unsigned slot);
+
+    bool allocateSegments(unsigned new_num_segments);
+    void releaseSegments(unsigned new_num_segments);
+    bool resize(unsigned new_num_segments);
+    bool grow();
+    void shrinkIfPossible();
+
+protected:
+    HashMapBase(KVPair* static_kvs, uint8_t* static_ctrl, unsigned num_static_slots, DirectoryBlock** directory,
+                unsigned max_segments, IPoolAllocator& allocator)
+        : allocator_(allocator)
+        , static_kvs_(static_kvs)
+        , static_ctrl_(static_ctrl)
+        , directory_(directory)
+        , num_static_slots_(num_static_slots)
+        , max_segments_(max_segments)
+        , num_segments_(0)
+        , size_(0)
+    {
+        UAVCAN_ASSERT(Key() == Key());
+        fill(static_ctrl_, static_ctrl_ + num_static_slots_, uint8_t(CtrlEmpty));
+        fill(directory_, directory_ + getNumDirectoryBlocks(), static_cast<DirectoryBlock*>(NULL));
+    }
+
+    /// Derived class destructor must call removeAll();
+    ~HashMapBase() { }
+
+public:
+    /**
+     * Number of KV pairs in one memory pool block once the static buffer is exhausted.
+     */
+    enum { NumKVPerPoolBlock = Segment::NumKV };
+
+    /**
+     * Number of segments that share one directory block.
+     */
+    enum { NumSegmentsPerDirectoryBlock = DirectoryBlock::NumSegments };
+
+    /**
+     * Returns null pointer if there's no such entry.
+     */
+    Value* access(const Key& key);
+
+    /**
+     * If entry with the same key already exists, it will be replaced.
+     * Returns null pointer if the table could not grow.
+     */
+    Value* insert(const Key& key, const Value& value);
+
+    /**
+     * Does nothing if there's no such entry.
+     */
+    void remove(const Key& key);
+
+    /**
+     * Removes entries where the predicate returns true.
+     * Predicate prototype:
+     *  bool (const Key& key, const Value& value)
+     */
+    template <typename Predicate>
+    void removeWhere(Predicate predicate);
+
+    /**
+     * Returns first entry where the predicate returns true.
+     * Predicate prototype:
+     *  bool (const Key& key, const Value& value)
+     */
+    template <typename Predicate>
+    const Key* findFirstKey(Predicate predicate) const;
+
+    void removeAll();
+
+    /**
+     * Returns a key-value pair located at the specified position from the beginning.
+     * The order of pairs is defined by their hashes, and any insertion or deletion may change it.
+     * If index is greater than or equal the number of pairs, null pointer will be returned.
+     */
+    KVPair* getByIndex(unsigned index);
+    const KVPair* getByIndex(unsigned index) const;
+
+    bool isEmpty() const { return size_ == 0; }
+
+    unsigned getSize() const { return size_; }
+
+    /**
+     * Total number of slots, including the free ones.
+     */
+    unsigned getCapacity() const { return getCapacityWithSegments(num_segments_); }
+
+    /**
+     * For testing, do not use directly.
+     */
+    unsigned getNumStaticPairs() const;
+    unsigned getNumDynamicPairs() const { return size_ - getNumStaticPairs(); }
+    unsigned getNumSegments() const { return num_segments_; }
+};
+
+/**
+ * @tparam NumStaticEntries     Number of entries that fit the static buffer without using the memory pool.
+ *                              The static buffer is 4/3 of that, because the table is never filled up completely.
+ * @tparam MaxSegments          Max number of memory pool blocks that hold the KV pairs. The segment directory
+ *                              takes one extra pool block per @ref NumSegmentsPerDirectoryBlock segments in use,
+ *                              and one pointer per that number of segments in the object itself.
+ */
+template <typename Key, typename Value, unsigned NumStaticEntries = 0, unsigned MaxSegments = 128>
+class UAVCAN_EXPORT HashMap : public HashMapBase<Key, Value>
+{
+    typedef HashMapBase<Key, Value> Base;
+
+public:
+    enum { NumStaticSlots = (NumStaticEntries * 4U + 2U) / 3U };
+
+private:
+    enum
+    {
+        NumDirectoryBlocks = (MaxSegments + unsigned(Base::NumSegmentsPerDirectoryBlock) - 1U) /
+                             unsigned(Base::NumSegmentsPerDirectoryBlock)
+    };
+
+    typename Base::KVPair static_kvs_[NumStaticSlots];
+    uint8_t static_ctrl_[NumStaticSlots];
+    typename Base::DirectoryBlock* directory_[NumDirectoryBlocks];
+
+public:
+    explicit HashMap(IPoolAllocator& allocator)
+        : Base(static_kvs_, static_ctrl_, NumStaticSlots, directory_, MaxSegments, allocator)
+    { }
+
+    ~HashMap() { this->removeAll(); }
+};
+
+
+template <typename Key, typename Value, unsigned MaxSegments>
+class UAVCAN_EXPORT HashMap<Key, Value, 0, MaxSegments> : public HashMapBase<Key, Value>
+{
+    typedef HashMapBase<Key, Value> Base;
+
+    enum
+    {
+        NumDirectoryBlocks = (MaxSegments + unsigned(Base::NumSegmentsPerDirectoryBlock) - 1U) /
+                             unsigned(Base::NumSegmentsPerDirectoryBlock)
+    };
+
+    typename Base::DirectoryBlock* directory_[NumDirectoryBlocks];
+
+public:
+    enum { NumStaticSlots = 0 };
+
+    explicit HashMap(IPoolAllocator& allocator)
+        : Base(NULL, NULL, 0, directory_, MaxSegments, allocator)
+    { }
+
+    ~HashMap() { this->removeAll(); }
+};
+
+// ----------------------------------------------------------------------------
+
+/*
+ * HashMapBase<>
+ */
+template <typename Key, typename Value>
+int HashMapBase<Key, Value>::findSlot(const Key& key, uint32_t hash) const
+{
+    const unsigned capacity = getCapacity();
+    if (capacity == 0)
+    {
+        return -1;
+    }
+    const uint8_t ctrl_full = makeCtrl(hash);
+    unsigned slot = getHomeSlot(hash, capacity);
+    while (true)                                        // There's always at least one empty slot
+    {
+        const Slot s = locate(slot);
+        if (*s.ctrl == CtrlEmpty)
+        {
+            return -1;
+        }
+        if ((*s.ctrl == ctrl_full) && s.kv->match(key))
+        {
+            return int(slot);
+        }
+        slot = nextSlot(slot, capacity);
+    }
+}
+
+template <typename Key, typename Value>
+unsigned HashMapBase<Key, Value>::findFreeSlot(uint32_t hash) const
+{
+    const unsigned capacity = getCapacity();
+    UAVCAN_ASSERT(size_ < capacity);
+    unsigned slot = getHomeSlot(hash, capacity);
+    while (true)
+    {
+        if (*locate(slot).ctrl == CtrlEmpty)
+        {
+            return slot;
+        }
+        slot = nextSlot(slot, capacity);
+    }
+}
+
+template <typename Key, typename Value>
+void HashMapBase<Key, Value>::removeAt(unsigned slot)
+{
+    const unsigned capacity = getCapacity();
+    Slot hole_slot = locate(slot);
+    UAVCAN_ASSERT(*hole_slot.ctrl & CtrlFull);
+
+    /*
+     * Backward shift: every following entry of the cluster that can be found from the hole moves into it
+     */
+    unsigned hole = slot;
+    unsigned next = slot;
+    while (true)
+    {
+        next = nextSlot(next, capacity);
+        const Slot next_slot = locate(next);
+        if (*next_slot.ctrl == CtrlEmpty)
+        {
+            break;
+        }
+        // The entry stays where it is if its home slot is cyclically within (hole, next]
+        const unsigned home = getHomeSlot(computeHash(next_slot.kv->key), capacity);
+        const bool stays = (hole <= next) ? ((hole < home) && (home <= next)) : ((hole < home) || (home <= next));
+        if (!stays)
+        {
+            hole_slot.moveFrom(next_slot);
+            hole = next;
+            hole_slot = next_slot;
+        }
+    }
+
+    hole_slot.clear();
+    UAVCAN_ASSERT(size_ > 0);
+    size_--;
+}
+
+template <typename Key, typename Value>
+bool HashMapBase<Key, Value>::allocateSegments(unsigned new_num_segments)
+{
+    UAVCAN_ASSERT(new_num_segments <= max_segments_);
+    const PoolAllocationTagScope tag_scope(PoolAllocationTagMap, false);  // Owner's tag takes precedence
+
+    for (unsigned i = num_segments_; i < new_num_segments; i++)
+    {
+        DirectoryBlock*& dir = directory_[i / unsigned(DirectoryBlock::NumSegments)];
+        if (dir == NULL)
+        {
+            void* const praw = allocator_.allocate(sizeof(DirectoryBlock));
+            if (praw == NULL)
+            {
+                releaseSegments(num_segments_);
+                return false;
+            }
+            dir = new (praw) DirectoryBlock();
+        }
+        void* const praw = allocator_.allocate(sizeof(Segment));
+        if (praw == NULL)
+        {
+            releaseSegments(num_segments_);
+            return false;
+        }
+        getSegment(i) = new (praw) Segment();
+    }
+    return true;
+}
+
+template <typename Key, typename Value>
+void HashMapBase<Key, Value>::releaseSegments(unsigned new_num_segments)
+{
+    for (unsigned d = new_num_segments / unsigned(DirectoryBlock::NumSegments); d < getNumDirectoryBlocks(); d++)
+    {
+        DirectoryBlock* dir = directory_[d];
+        if (dir == NULL)
+        {
+            break;
+        }
+        const unsigned first_seg = d * unsigned(DirectoryBlock::NumSegments);
+        for (unsigned i = 0; i < unsigned(DirectoryBlock::NumSegments); i++)
+        {
+            if (((first_seg + i) >= new_num_segments) && (dir->segments[i] != NULL))
+            {
+                dir->segments[i]->~Segment();
+                allocator_.deallocate(dir->segments[i]);
+                dir->segments[i] = NULL;
+            }
+        }
+        if (first_seg >= new_num_segments)
+        {
+            dir->~DirectoryBlock();
+            allocator_.deallocate(dir);
+            directory_[d] = NULL;
+        }
+    }
+}
+
+template <typename Key, typename Value>
+bool HashMapBase<Key, Value>::resize(unsigned new_num_segments)
+{
+    const unsigned old_num_segments = num_segments_;
+    if (new_num_segments > old_num_segments)
+    {
+        if (!allocateSegments(new_num_segments))
+        {
+            return false;
+        }
+        num_segments_ = new_num_segments;   // New slots are empty, the old ones are all reachable
+    }
+    const unsigned old_capacity = getCapacityWithSegments(old_num_segments);
+    const unsigned new_capacity = getCapacityWithSegments(new_num_segments);
+    UAVCAN_ASSERT(size_ < new_capacity || (size_ == 0));
+
+    /*
+     * In-place rehash. All entries get marked pending first; then every pending entry goes to the first
+     * empty or pending slot of its new probe sequence, swapping with the pending entry if there's one.
+     * Entries that have been placed are never moved again, so their probe sequences never break.
+     */
+    for (unsigned i = 0; i < old_capacity; i++)
+    {
+        uint8_t* const ctrl = locate(i).ctrl;
+        if (*ctrl & CtrlFull)
+        {
+            *ctrl = CtrlPending;
+        }
+    }
+    for (unsigned i = 0; i < old_capacity; i++)
+    {
+        const Slot slot = locate(i);
+        while (*slot.ctrl == CtrlPending)
+        {
+            const uint32_t hash = computeHash(slot.kv->key);
+            unsigned target = getHomeSlot(hash, new_capacity);
+            Slot target_slot;
+            while (true)
+            {
+                target_slot = locate(target);
+                if (!(*target_slot.ctrl & CtrlFull))
+                {
+                    break;
+                }
+                target = nextSlot(target, new_capacity);
+            }
+
+            if (target == i)
+            {
+                *slot.ctrl = makeCtrl(hash);
+            }
+            else if (*target_slot.ctrl == CtrlEmpty)
+            {
+                target_slot.moveFrom(slot);
+                *target_slot.ctrl = makeCtrl(hash);
+                slot.clear();
+            }
+            else
+            {
+                const KVPair tmp = *target_slot.kv;     // The pending entry comes here and gets processed next
+                target_slot.moveFrom(slot);
+                *target_slot.ctrl = makeCtrl(hash);
+                *slot.kv = tmp;
+            }
+        }
+    }
+
+    if (new_num_segments < old_num_segments)
+    {
+        releaseSegments(new_num_segments);
+    }
+    num_segments_ = new_num_segments;
+    return true;
+}
+
+template <typename Key, typename Value>
+bool HashMapBase<Key, Value>::grow()
+{
+    const unsigned capacity = getCapacity();
+    const unsigned wanted_capacity = max(capacity * 2U, ((size_ + 1U) * 4U + 2U) / 3U + 1U);
+    const unsigned wanted_segments = (wanted_capacity - min(wanted_capacity, num_static_slots_) +
+                                      unsigned(Segment::NumKV) - 1U) / unsigned(Segment::NumKV);
+    const unsigned new_num_segments = min(max(wanted_segments, num_segments_ + 1U), max_segments_);
+    if (new_num_segments <= num_segments_)
+    {
+        return false;
+    }
+    return resize(new_num_segments);
+}
+
+template <typename Key, typename Value>
+void HashMapBase<Key, Value>::shrinkIfPossible()
+{
+    if (num_segments_ == 0)
+    {
+        return;
+    }
+    const unsigned capacity = getCapacity();
+    if ((size_ * 2U) <= num_static_slots_)
+    {
+        (void)resize(0);                                // Everything fits the static buffer
+    }
+    else if ((size_ * 4U) <= capacity)
+    {
+        const unsigned wanted_capacity = capacity / 2U;
+        const unsigned new_num_segments = (wanted_capacity - min(wanted_capacity, num_static_slots_) +
+                                           unsigned(Segment::NumKV) - 1U) / unsigned(Segment::NumKV);
+        if (new_num_segments < num_segments_)
+        {
+            (void)resize(new_num_segments);
+        }
+    }
+}
+
+template <typename Key, typename Value>
+Value* HashMapBase<Key, Value>::access(const Key& key)
+{
+    UAVCAN_ASSERT(!(key == Key()));
+    const int slot = findSlot(key, computeHash(key));
+    if (slot < 0)
+    {
+        return NULL;
+    }
+    return &locate(unsigned(slot)).kv->value;
+}
+
+template <typename Key, typename Value>
+Value* HashMapBase<Key, Value>::insert(const Key& key, const Value& value)
+{
+    UAVCAN_ASSERT(!(key == Key()));
+    const uint32_t hash = computeHash(key);
+
+    const int existing = findSlot(key, hash);
+    if (existing >= 0)
+    {
+        Value* const existing_value = &locate(unsigned(existing)).kv->value;
+        *existing_value = value;
+        return existing_value;
+    }
+
+    if (((size_ + 1U) * 4U) > (getCapacity() * 3U))
+    {
+        // If the table can't grow, it can still be filled up, except for the last free slot
+        (void)grow();
+        if ((size_ + 1U) >= getCapacity())
+        {
+            return NULL;
+        }
+    }
+
+    const Slot slot = locate(findFreeSlot(hash));
+    *slot.kv = KVPair(key, value);
+    *slot.ctrl = makeCtrl(hash);
+    size_++;
+    return &slot.kv->value;
+}
+
+template <typename Key, typename Value>
+void HashMapBase<Key, Value>::remove(const Key& key)
+{
+    UAVCAN_ASSERT(!(key == Key()));
+    const int slot = findSlot(key, computeHash(key));
+    if (slot >= 0)
+    {
+        removeAt(unsigned(slot));
+        shrinkIfPossible();
+    }
+}
+
+template <typename Key, typename Value>
+template <typename Predicate>
+void HashMapBase<Key, Value>::removeWhere(Predicate predicate)
+{
+    unsigned num_removed = 0;
+    unsigned slot = 0;
+    while (slot < getCapacity())
+    {
+        const Slot s = locate(slot);
+        if ((*s.ctrl & CtrlFull) && predicate(s.kv->key, s.kv->value))
+        {
+            removeAt(slot);             // Another entry may move into this slot, so it is checked again
+            num_removed++;
+        }
+        else
+        {
+            slot++;
+        }
+    }
+
+    if (num_removed > 0)
+    {
+        shrinkIfPossible();
+    }
+}
+
+template <typename Key, typename Value>
+template <typename Predicate>
+const Key* HashMapBase<Key, Value>::findFirstKey(Predicate predicate) const
+{
+    const unsigned capacity = getCapacity();
+    for (unsigned i = 0; i < capacity; i++)
+    {
+        const Slot s = locate(i);
+        if ((*s.ctrl & CtrlFull) && predicate(s.kv->key, s.kv->value))
+        {
+            return &s.kv->key;
+        }
+    }
+    return NULL;
+}
+
+template <typename Key, typename Value>
+void HashMapBase<Key, Value>::removeAll()
+{
+    for (unsigned i = 0; i < num_static_slots_; i++)
+    {
+        locate(i).clear();
+    }
+    releaseSegments(0);
+    num_segments_ = 0;
+    size_ = 0;
+}
+
+template <typename Key, typename Value>
+typename HashMapBase<Key, Value>::KVPair* HashMapBase<Key, Value>::getByIndex(unsigned index)
+{
+    const unsigned capacity = getCapacity();
+    for (unsigned i = 0; i < capacity; i++)
+    {
+        const Slot s = locate(i);
+        if (*s.ctrl & CtrlFull)
+        {
+            if (index == 0)
+            {
+                return s.kv;
+            }
+            index--;
+        }
+    }
+    return NULL;
+}
+
+template <typename Key, typename Value>
+const typename HashMapBase<Key, Value>::KVPair* HashMapBase<Key, Value>::getByIndex(unsigned index) const
+{
+    return const_cast<HashMapBase<Key, Value>*>(this)->getByIndex(index);
+}
+
+template <typename Key, typename Value>
+unsigned HashMapBase<Key, Value>::getNumStaticPairs() const
+{
+    unsigned num = 0;
+    for (unsigned i = 0; i < num_static_slots_; i++)
+    {
+        if (static_ctrl_[i] & CtrlFull)
+        {
+            num++;
+        }
+    }
+    return num;
+}
+
+}
+
+#endif // UAVCAN_UTIL_HASH_MAP_HPP_INCLUDED
@@ -68,6 +68,7 @@ private:
 
         static KVGroup* instantiate(IPoolAllocator& allocator)
         {
+            const PoolAllocationTagScope tag_scope(PoolAllocationTagMap, false);  // Owner's tag takes precedence
             void* const praw = allocator.allocate(sizeof(KVGroup));
             if (praw == NULL)
             {
@@ -140,6 +141,11 @@ protected:
     ~MapBase() { }
 
 public:
+    /**
+     * Number of KV pairs that share one memory pool block once the static buffer is exhausted.
+     */
+    enum { NumKVPerPoolBlock = KVGroup::NumKV };
+
     /**
      * Returns null pointer if there's no such entry.
      */
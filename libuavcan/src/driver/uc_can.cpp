@@ -115,4 +115,32 @@ std::string CanFrame::toString(StringRepresentation mode) const
 }
 #endif
 
+/*
+ * CanRxFrame
+ */
+#if UAVCAN_TOSTRING
+std::string CanRxFrame::toString(StringRepresentation mode) const
+{
+    std::string out = CanFrame::toString(mode);
+    out.reserve(128);
+    out += " ts_m="   + ts_mono.toString();
+    out += " ts_utc=" + ts_utc.toString();
+    out += " iface=";
+    out += char('0' + iface_index);
+    return out;
+}
+#endif
+
+/*
+ * ICanIface
+ */
+int16_t ICanIface::receiveBurst(CanRxFrame* out_frames, uint16_t max_frames)
+{
+    if ((out_frames == NULL) || (max_frames == 0))
+    {
+        return 0;
+    }
+    return receive(*out_frames, out_frames->ts_mono, out_frames->ts_utc, out_frames->flags);
+}
+
 }
@@ -14,8 +14,6 @@ namespace uavcan
 static const unsigned char reverse_mask[]     = { 0x00U, 0x80U, 0xC0U, 0xE0U, 0xF0U, 0xF8U, 0xFCU, 0xFEU, 0xFFU };
 static const unsigned char reverse_mask_xor[] = { 0xFFU, 0x7FU, 0x3FU, 0x1FU, 0x0FU, 0x07U, 0x03U, 0x01U, 0x00U };
 
-#if UAVCAN_TINY
-
 #define PREPARE_FIRST_COPY()                                       \
     do {                                                           \
     if (src_len >= (CHAR_BIT - dst_offset_modulo)) {               \
@@ -120,148 +118,186 @@ void bitarrayCopy(const unsigned char* src_org, unsigned src_offset, unsigned sr
     }
 }
 
-#else
+#if !UAVCAN_TINY
 
 /*
- * Functions below were manually optimized in the most horrible way.
+ * Word-at-a-time kernels for the special cases where either source or destination is aligned.
+ * Bit arrays are big endian (the most significant bit of the first byte goes first), so the words are assembled
+ * from bytes explicitly, which makes the kernels independent of the host byte order.
+ * Unlike the generic algorithm above, these kernels never read past the last source byte that contains the data.
  */
-
-void bitarrayCopyAlignedToUnaligned(const unsigned char* src_org, unsigned src_len,
-                                    unsigned char* dst_org, unsigned dst_offset)
+template <typename Word>
+static inline Word loadBigEndianWord(const unsigned char* p)
 {
-    if (src_len > 0U)
+    Word w = 0;
+    for (unsigned i = 0; i < sizeof(Word); i++)
     {
-        unsigned char* dst = dst_org + (dst_offset / CHAR_BIT);
-        const unsigned dst_offset_modulo = dst_offset % CHAR_BIT;
+        w = Word((w << CHAR_BIT) | p[i]);
+    }
+    return w;
+}
 
-        if (0U == dst_offset_modulo)
-        {
-            const unsigned byte_len = src_len / CHAR_BIT;
-            const unsigned src_len_modulo = src_len % CHAR_BIT;
+template <typename Word>
+static inline void storeBigEndianWord(Word w, unsigned char* p)
+{
+    for (unsigned i = 0; i < sizeof(Word); i++)
+    {
+        p[i] = static_cast<unsigned char>(w >> ((sizeof(Word) - 1U - i) * CHAR_BIT));
+    }
+}
 
-            if (byte_len > 0U)
-            {
-                (void)std::memcpy(dst, src_org, byte_len);
-                src_org += byte_len;
-                dst += byte_len;
-            }
-            if (src_len_modulo > 0U)
-            {
-                *dst &= reverse_mask_xor[src_len_modulo];
-                *dst |= reverse_mask[src_len_modulo] & *src_org;
-            }
-        }
-        else
-        {
-            const unsigned bit_diff_ls = CHAR_BIT - dst_offset_modulo;
-            unsigned char c =
-                static_cast<unsigned char>(*src_org >> dst_offset_modulo & reverse_mask_xor[dst_offset_modulo]);
+/**
+ * Replaces the bits of *dst that are set in the mask.
+ */
+static inline void mergeMasked(unsigned char* dst, unsigned char value, unsigned char mask)
+{
+    *dst = static_cast<unsigned char>((*dst & ~mask) | (value & mask));
+}
 
-            if (src_len >= (CHAR_BIT - dst_offset_modulo))
-            {
-                *dst &= reverse_mask[dst_offset_modulo];
-                src_len -= CHAR_BIT - dst_offset_modulo;
-            }
-            else
-            {
-                *dst &= reverse_mask[dst_offset_modulo] | reverse_mask_xor[dst_offset_modulo + src_len + 1];
-                c &= reverse_mask[dst_offset_modulo + src_len];
-                src_len = 0;
-            }
+template <typename Word>
+void bitarrayCopyAlignedToUnalignedImpl(const unsigned char* src_org, unsigned src_len,
+                                        unsigned char* dst_org, unsigned dst_offset)
+{
+    if (src_len == 0U)
+    {
+        return;
+    }
+    unsigned char* const dst = dst_org + (dst_offset / CHAR_BIT);
+    const unsigned dst_offset_modulo = dst_offset % CHAR_BIT;
 
-            *dst++ |= c;
+    if (dst_offset_modulo == 0U)
+    {
+        const unsigned byte_len = src_len / CHAR_BIT;
+        (void)std::memcpy(dst, src_org, byte_len);
+        if ((src_len % CHAR_BIT) > 0U)
+        {
+            mergeMasked(dst + byte_len, src_org[byte_len], reverse_mask[src_len % CHAR_BIT]);
+        }
+        return;
+    }
 
-            int byte_len = int(src_len / CHAR_BIT);
+    const unsigned rs = dst_offset_modulo;
+    const unsigned ls = CHAR_BIT - dst_offset_modulo;
+    const unsigned end_bit = dst_offset_modulo + src_len;       // Relative to dst
+    const unsigned num_full_bytes = end_bit / CHAR_BIT;         // Including the first one, which is never full
 
-            while (--byte_len >= 0)
-            {
-                c = static_cast<unsigned char>(*src_org++ << bit_diff_ls);
-                c = static_cast<unsigned char>(c | (*src_org >> dst_offset_modulo));
-                *dst++ = c;
-            }
+    /*
+     * Head: the first byte keeps its leading bits, and its trailing bits if the data ends within it.
+     */
+    {
+        unsigned char mask = reverse_mask_xor[dst_offset_modulo];
+        if (end_bit < CHAR_BIT)
+        {
+            mask = static_cast<unsigned char>(mask & reverse_mask[end_bit]);
+        }
+        mergeMasked(dst, static_cast<unsigned char>(src_org[0] >> rs), mask);
+    }
 
-            const unsigned src_len_modulo = src_len % CHAR_BIT;
-            if (src_len_modulo > 0U)
-            {
-                c = static_cast<unsigned char>(*src_org++ << bit_diff_ls);
-                c = static_cast<unsigned char>(c | (*src_org >> dst_offset_modulo));
-                c &= reverse_mask[src_len_modulo];
+    /*
+     * Middle: destination byte i takes the low bits of source byte (i - 1) and the high bits of source byte i.
+     */
+    unsigned i = 1;
+    for (; (i + sizeof(Word)) <= num_full_bytes; i += sizeof(Word))
+    {
+        const Word hi = loadBigEndianWord<Word>(src_org + i - 1);
+        const Word lo = Word(src_org[i - 1 + sizeof(Word)] >> rs);
+        storeBigEndianWord<Word>(Word(Word(hi << ls) | lo), dst + i);
+    }
+    for (; i < num_full_bytes; i++)
+    {
+        dst[i] = static_cast<unsigned char>((src_org[i - 1] << ls) | (src_org[i] >> rs));
+    }
 
-                *dst &= reverse_mask_xor[src_len_modulo];
-                *dst |= c;
-            }
+    /*
+     * Tail: the last byte keeps its trailing bits. The next source byte exists only if it holds some data.
+     */
+    const unsigned end_bit_modulo = end_bit % CHAR_BIT;
+    if ((end_bit_modulo > 0U) && (num_full_bytes > 0U))
+    {
+        unsigned char c = static_cast<unsigned char>(src_org[i - 1] << ls);
+        if (end_bit_modulo > rs)
+        {
+            c = static_cast<unsigned char>(c | (src_org[i] >> rs));
         }
+        mergeMasked(dst + i, c, reverse_mask[end_bit_modulo]);
     }
 }
 
-void bitarrayCopyUnalignedToAligned(const unsigned char* src_org, unsigned src_offset, unsigned src_len,
-                                    unsigned char* dst_org)
+template <typename Word>
+void bitarrayCopyUnalignedToAlignedImpl(const unsigned char* src_org, unsigned src_offset, unsigned src_len,
+                                        unsigned char* dst_org)
 {
-    if (src_len > 0U)
+    if (src_len == 0U)
     {
-        const unsigned char* src = src_org + (src_offset / CHAR_BIT);
-
-        const unsigned src_offset_modulo = src_offset % CHAR_BIT;
+        return;
+    }
+    const unsigned char* const src = src_org + (src_offset / CHAR_BIT);
+    const unsigned src_offset_modulo = src_offset % CHAR_BIT;
+    const unsigned num_full_bytes = src_len / CHAR_BIT;
+    const unsigned src_len_modulo = src_len % CHAR_BIT;
 
-        if (src_offset_modulo == 0U)
+    if (src_offset_modulo == 0U)
+    {
+        (void)std::memcpy(dst_org, src, num_full_bytes);
+        if (src_len_modulo > 0U)
         {
-            const unsigned byte_len = src_len / CHAR_BIT;
-            const unsigned src_len_modulo = src_len % CHAR_BIT;
-
-            if (byte_len > 0U)
-            {
-                (void)std::memcpy(dst_org, src, byte_len);
-                src += byte_len;
-                dst_org += byte_len;
-            }
-            if (src_len_modulo > 0U)
-            {
-                *dst_org &= reverse_mask_xor[src_len_modulo];
-                *dst_org |= reverse_mask[src_len_modulo] & *src;
-            }
+            mergeMasked(dst_org + num_full_bytes, src[num_full_bytes], reverse_mask[src_len_modulo]);
         }
-        else
-        {
-            const unsigned bit_diff_rs = CHAR_BIT - src_offset_modulo;
+        return;
+    }
 
-            unsigned char c = static_cast<unsigned char>(*src++ << src_offset_modulo);
-            c = static_cast<unsigned char>(c | (*src >> bit_diff_rs));
+    const unsigned ls = src_offset_modulo;
+    const unsigned rs = CHAR_BIT - src_offset_modulo;
 
-            if (src_len >= CHAR_BIT)
-            {
-                *dst_org &= 0x55U;
-                src_len -= CHAR_BIT;
-            }
-            else
-            {
-                *dst_org &= 0x55U | reverse_mask_xor[src_len + 1];
-                c &= reverse_mask[src_len];
-                src_len = 0;
-            }
+    /*
+     * Destination byte i takes the low bits of source byte i and the high bits of source byte (i + 1).
+     */
+    unsigned i = 0;
+    for (; (i + sizeof(Word)) <= num_full_bytes; i += sizeof(Word))
+    {
+        const Word hi = loadBigEndianWord<Word>(src + i);
+        const Word lo = Word(src[i + sizeof(Word)] >> rs);
+        storeBigEndianWord<Word>(Word(Word(hi << ls) | lo), dst_org + i);
+    }
+    for (; i < num_full_bytes; i++)
+    {
+        dst_org[i] = static_cast<unsigned char>((src[i] << ls) | (src[i + 1] >> rs));
+    }
 
-            *dst_org++ |= c;
+    /*
+     * Tail: the last byte keeps its trailing bits. The next source byte exists only if it holds some data.
+     */
+    if (src_len_modulo > 0U)
+    {
+        unsigned char c = static_cast<unsigned char>(src[i] << ls);
+        if (src_len_modulo > rs)
+        {
+            c = static_cast<unsigned char>(c | (src[i + 1] >> rs));
+        }
+        mergeMasked(dst_org + i, c, reverse_mask[src_len_modulo]);
+    }
+}
 
-            int byte_len = int(src_len / CHAR_BIT);
+template void bitarrayCopyAlignedToUnalignedImpl<uint32_t>(const unsigned char*, unsigned, unsigned char*, unsigned);
+template void bitarrayCopyAlignedToUnalignedImpl<uint64_t>(const unsigned char*, unsigned, unsigned char*, unsigned);
+template void bitarrayCopyUnalignedToAlignedImpl<uint32_t>(const unsigned char*, unsigned, unsigned, unsigned char*);
+template void bitarrayCopyUnalignedToAlignedImpl<uint64_t>(const unsigned char*, unsigned, unsigned, unsigned char*);
 
-            while (--byte_len >= 0)
-            {
-                c = static_cast<unsigned char>(*src++ << src_offset_modulo);
-                c = static_cast<unsigned char>(c | (*src >> bit_diff_rs));
-                *dst_org++ = c;
-            }
+/**
+ * 64-bit words are used on 64-bit platforms only; 32-bit targets would have to emulate them.
+ */
+typedef Select<(sizeof(void*) >= 8), uint64_t, uint32_t>::Result NativeBitArrayCopyWord;
 
-            const unsigned src_len_modulo = src_len % CHAR_BIT;
-            if (src_len_modulo > 0U)
-            {
-                c = static_cast<unsigned char>(*src++ << src_offset_modulo);
-                c = static_cast<unsigned char>(c | (*src >> bit_diff_rs));
-                c &= reverse_mask[src_len_modulo];
+void bitarrayCopyAlignedToUnaligned(const unsigned char* src_org, unsigned src_len,
+                                    unsigned char* dst_org, unsigned dst_offset)
+{
+    bitarrayCopyAlignedToUnalignedImpl<NativeBitArrayCopyWord>(src_org, src_len, dst_org, dst_offset);
+}
 
-                *dst_org &= reverse_mask_xor[src_len_modulo];
-                *dst_org |= c;
-            }
-        }
-    }
+void bitarrayCopyUnalignedToAligned(const unsigned char* src_org, unsigned src_offset, unsigned src_len,
+                                    unsigned char* dst_org)
+{
+    bitarrayCopyUnalignedToAlignedImpl<NativeBitArrayCopyWord>(src_org, src_offset, src_len, dst_org);
 }
 
 #endif
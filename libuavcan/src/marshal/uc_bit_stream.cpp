@@ -14,6 +14,13 @@ const unsigned BitStream::MaxBitsPerRW;
 
 int BitStream::write(const uint8_t* bytes, const unsigned bitlen)
 {
+    // Byte aligned writes don't need to be merged with the cached bits, so they go straight to the buffer
+    if (((bit_offset_ % 8) == 0) && ((bitlen % 8) == 0))
+    {
+        UAVCAN_ASSERT(byte_cache_ == 0);
+        return writeBytes(bytes, bitlen / 8);
+    }
+
     // Temporary buffer is needed to merge new bits with cached unaligned bits from the last write() (see byte_cache_)
     uint8_t tmp[MaxBytesPerRW + 1];
 
@@ -54,6 +61,11 @@ int BitStream::write(const uint8_t* bytes, const unsigned bitlen)
 
 int BitStream::read(uint8_t* bytes, const unsigned bitlen)
 {
+    if (((bit_offset_ % 8) == 0) && ((bitlen % 8) == 0))
+    {
+        return readBytes(bytes, bitlen / 8);
+    }
+
     uint8_t tmp[MaxBytesPerRW + 1];
 
     const unsigned bytelen = bitlenToBytelen(bitlen + (bit_offset_ % 8));
@@ -75,6 +87,76 @@ int BitStream::read(uint8_t* bytes, const unsigned bitlen)
     return ResultOk;
 }
 
+int BitStream::writeBytes(const uint8_t* bytes, const unsigned len)
+{
+    if ((bit_offset_ % 8) == 0)
+    {
+        const int write_res = buf_.write(bit_offset_ / 8, bytes, len);
+        if (write_res < 0)
+        {
+            return write_res;
+        }
+        if (static_cast<unsigned>(write_res) < len)
+        {
+            return ResultOutOfBuffer;
+        }
+        bit_offset_ += len * 8;
+        return ResultOk;
+    }
+
+    // One byte of the temporary buffer is taken by the bits that remain from the last write()
+    for (unsigned offset = 0; offset < len; offset += MaxBytesPerRW - 1)
+    {
+        const unsigned chunk_len = min(len - offset, MaxBytesPerRW - 1);
+        const int res = write(bytes + offset, chunk_len * 8);
+        if (res <= 0)
+        {
+            return res;
+        }
+    }
+    return ResultOk;
+}
+
+int BitStream::readBytes(uint8_t* bytes, const unsigned len)
+{
+    if ((bit_offset_ % 8) == 0)
+    {
+        const int read_res = buf_.read(bit_offset_ / 8, bytes, len);
+        if (read_res < 0)
+        {
+            return read_res;
+        }
+        if (static_cast<unsigned>(read_res) < len)
+        {
+            return ResultOutOfBuffer;
+        }
+        bit_offset_ += len * 8;
+        return ResultOk;
+    }
+
+    for (unsigned offset = 0; offset < len; offset += MaxBytesPerRW - 1)
+    {
+        const unsigned chunk_len = min(len - offset, MaxBytesPerRW - 1);
+        const int res = read(bytes + offset, chunk_len * 8);
+        if (res <= 0)
+        {
+            return res;
+        }
+    }
+    return ResultOk;
+}
+
+int BitStream::readRemainingBytes(uint8_t* bytes, const unsigned max_len)
+{
+    UAVCAN_ASSERT(isByteAligned());
+    const int read_res = buf_.read(bit_offset_ / 8, bytes, max_len);
+    if (read_res > 0)
+    {
+        bit_offset_ += unsigned(read_res) * 8;
+    }
+    return read_res;
+}
+
 #if UAVCAN_TOSTRING
 std::string BitStream::toString() const
 {
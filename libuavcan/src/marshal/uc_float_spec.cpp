@@ -14,6 +14,10 @@
 # include <limits>
 #endif
 
+#if UAVCAN_FLOAT16_F16C && !UAVCAN_TINY
+# include <immintrin.h>
+#endif
+
 namespace uavcan
 {
 /*
@@ -89,4 +93,225 @@ float IEEE754Converter::halfToNativeNonIeee(uint16_t value)
     return (value & 0x8000U) ? -out : out;
 }
 
+#if UAVCAN_FLOAT16_TABLES && !UAVCAN_TINY
+/*
+ * The table-driven kernels implement exactly the same rounding as the portable algorithm above, which is
+ * round to nearest with ties away from zero, flushing float32 denormals to zero.
+ *
+ * The float32 -> float16 table is indexed by the float32 exponent; every entry contains the float16 exponent,
+ * less one (because the mantissa is taken with the implicit leading bit), in the upper six bits, and the right
+ * shift of the 24-bit mantissa in the lower five bits. Shift 25 discards the mantissa, along with the rounding bit.
+ * Regenerate with:
+ *   def entry(F):
+ *       e = F - 127
+ *       if F == 0 or e < -25: return 25
+ *       if e >= 16: return 0x7C00 | 25
+ *       if e >= -14: return ((e + 14) << 10) | 13
+ *       return -e - 1
+ */
+const uint16_t IEEE754Converter::SingleToHalfTable[256] =
+{
+    0x0019U, 0x0019U, 0x0019U, 0x0019U, 0x0019U, 0x0019U, 0x0019U, 0x0019U,
+    0x0019U, 0x0019U, 0x0019U, 0x0019U, 0x0019U, 0x0019U, 0x0019U, 0x0019U,
+    0x0019U, 0x0019U, 0x0019U, 0x0019U, 0x0019U, 0x0019U, 0x0019U, 0x0019U,
+    0x0019U, 0x0019U, 0x0019U, 0x0019U, 0x0019U, 0x0019U, 0x0019U, 0x0019U,
+    0x0019U, 0x0019U, 0x0019U, 0x0019U, 0x0019U, 0x0019U, 0x0019U, 0x0019U,
+    0x0019U, 0x0019U, 0x0019U, 0x0019U, 0x0019U, 0x0019U, 0x0019U, 0x0019U,
+    0x0019U, 0x0019U, 0x0019U, 0x0019U, 0x0019U, 0x0019U, 0x0019U, 0x0019U,
+    0x0019U, 0x0019U, 0x0019U, 0x0019U, 0x0019U, 0x0019U, 0x0019U, 0x0019U,
+    0x0019U, 0x0019U, 0x0019U, 0x0019U, 0x0019U, 0x0019U, 0x0019U, 0x0019U,
+    0x0019U, 0x0019U, 0x0019U, 0x0019U, 0x0019U, 0x0019U, 0x0019U, 0x0019U,
+    0x0019U, 0x0019U, 0x0019U, 0x0019U, 0x0019U, 0x0019U, 0x0019U, 0x0019U,
+    0x0019U, 0x0019U, 0x0019U, 0x0019U, 0x0019U, 0x0019U, 0x0019U, 0x0019U,
+    0x0019U, 0x0019U, 0x0019U, 0x0019U, 0x0019U, 0x0019U, 0x0018U, 0x0017U,
+    0x0016U, 0x0015U, 0x0014U, 0x0013U, 0x0012U, 0x0011U, 0x0010U, 0x000FU,
+    0x000EU, 0x000DU, 0x040DU, 0x080DU, 0x0C0DU, 0x100DU, 0x140DU, 0x180DU,
+    0x1C0DU, 0x200DU, 0x240DU, 0x280DU, 0x2C0DU, 0x300DU, 0x340DU, 0x380DU,
+    0x3C0DU, 0x400DU, 0x440DU, 0x480DU, 0x4C0DU, 0x500DU, 0x540DU, 0x580DU,
+    0x5C0DU, 0x600DU, 0x640DU, 0x680DU, 0x6C0DU, 0x700DU, 0x740DU, 0x7C19U,
+    0x7C19U, 0x7C19U, 0x7C19U, 0x7C19U, 0x7C19U, 0x7C19U, 0x7C19U, 0x7C19U,
+    0x7C19U, 0x7C19U, 0x7C19U, 0x7C19U, 0x7C19U, 0x7C19U, 0x7C19U, 0x7C19U,
+    0x7C19U, 0x7C19U, 0x7C19U, 0x7C19U, 0x7C19U, 0x7C19U, 0x7C19U, 0x7C19U,
+    0x7C19U, 0x7C19U, 0x7C19U, 0x7C19U, 0x7C19U, 0x7C19U, 0x7C19U, 0x7C19U,
+    0x7C19U, 0x7C19U, 0x7C19U, 0x7C19U, 0x7C19U, 0x7C19U, 0x7C19U, 0x7C19U,
+    0x7C19U, 0x7C19U, 0x7C19U, 0x7C19U, 0x7C19U, 0x7C19U, 0x7C19U, 0x7C19U,
+    0x7C19U, 0x7C19U, 0x7C19U, 0x7C19U, 0x7C19U, 0x7C19U, 0x7C19U, 0x7C19U,
+    0x7C19U, 0x7C19U, 0x7C19U, 0x7C19U, 0x7C19U, 0x7C19U, 0x7C19U, 0x7C19U,
+    0x7C19U, 0x7C19U, 0x7C19U, 0x7C19U, 0x7C19U, 0x7C19U, 0x7C19U, 0x7C19U,
+    0x7C19U, 0x7C19U, 0x7C19U, 0x7C19U, 0x7C19U, 0x7C19U, 0x7C19U, 0x7C19U,
+    0x7C19U, 0x7C19U, 0x7C19U, 0x7C19U, 0x7C19U, 0x7C19U, 0x7C19U, 0x7C19U,
+    0x7C19U, 0x7C19U, 0x7C19U, 0x7C19U, 0x7C19U, 0x7C19U, 0x7C19U, 0x7C19U,
+    0x7C19U, 0x7C19U, 0x7C19U, 0x7C19U, 0x7C19U, 0x7C19U, 0x7C19U, 0x7C19U,
+    0x7C19U, 0x7C19U, 0x7C19U, 0x7C19U, 0x7C19U, 0x7C19U, 0x7C19U, 0x7C19U
+};
+
+/*
+ * The float16 -> float32 table is indexed by the float16 sign and exponent; zero and all-ones exponents are
+ * handled separately.
+ *   def entry(i): return ((i >> 5) << 31) | (((i & 31) + 112) << 23 if 1 <= (i & 31) <= 30 else 0)
+ */
+const uint32_t IEEE754Converter::HalfToSingleTable[64] =
+{
+    0x00000000U, 0x38800000U, 0x39000000U, 0x39800000U,
+    0x3A000000U, 0x3A800000U, 0x3B000000U, 0x3B800000U,
+    0x3C000000U, 0x3C800000U, 0x3D000000U, 0x3D800000U,
+    0x3E000000U, 0x3E800000U, 0x3F000000U, 0x3F800000U,
+    0x40000000U, 0x40800000U, 0x41000000U, 0x41800000U,
+    0x42000000U, 0x42800000U, 0x43000000U, 0x43800000U,
+    0x44000000U, 0x44800000U, 0x45000000U, 0x45800000U,
+    0x46000000U, 0x46800000U, 0x47000000U, 0x00000000U,
+    0x80000000U, 0xB8800000U, 0xB9000000U, 0xB9800000U,
+    0xBA000000U, 0xBA800000U, 0xBB000000U, 0xBB800000U,
+    0xBC000000U, 0xBC800000U, 0xBD000000U, 0xBD800000U,
+    0xBE000000U, 0xBE800000U, 0xBF000000U, 0xBF800000U,
+    0xC0000000U, 0xC0800000U, 0xC1000000U, 0xC1800000U,
+    0xC2000000U, 0xC2800000U, 0xC3000000U, 0xC3800000U,
+    0xC4000000U, 0xC4800000U, 0xC5000000U, 0xC5800000U,
+    0xC6000000U, 0xC6800000U, 0xC7000000U, 0x80000000U
+};
+
+uint16_t IEEE754Converter::nativeToHalf(float value)
+{
+#if UAVCAN_CPP_VERSION >= UAVCAN_CPP11
+    StaticAssert<std::numeric_limits<float>::is_iec559>::check();
+#endif
+    const uint32_t bits = toIeee<32>(value);
+    const unsigned exponent = (bits >> 23) & 0xFFU;
+    if (exponent == 0xFFU)
+    {
+        return nativeNonIeeeToHalf(value);      // NaN or infinity
+    }
+    const unsigned entry = SingleToHalfTable[exponent];
+    const unsigned shift = entry & 0x1FU;
+    const uint32_t mantissa = (bits & 0x7FFFFFU) | 0x800000U;
+    const uint32_t magnitude = (entry & 0xFC00U) + (mantissa >> shift) + ((mantissa >> (shift - 1U)) & 1U);
+    return uint16_t(((bits >> 16) & 0x8000U) | magnitude);
+}
+
+float IEEE754Converter::halfToNative(uint16_t value)
+{
+    const unsigned exponent = value & 0x7C00U;
+    if (exponent == 0)
+    {
+        const float out = static_cast<float>(value & 0x3FFU) * 5.9604644775390625e-8F;   // 2^-24, exact
+        return (value & 0x8000U) ? -out : out;
+    }
+    if (exponent == 0x7C00U)
+    {
+        return halfToNativeNonIeee(value);      // NaN or infinity
+    }
+    return toNative<32>(HalfToSingleTable[value >> 10] | (uint32_t(value & 0x3FFU) << 13));
+}
+
+#else
+
+uint16_t IEEE754Converter::nativeToHalf(float value)
+{
+    return nativeNonIeeeToHalf(value);
+}
+
+float IEEE754Converter::halfToNative(uint16_t value)
+{
+    return halfToNativeNonIeee(value);
+}
+
+#endif
+
+#if UAVCAN_FLOAT16_F16C && !UAVCAN_TINY
+/*
+ * VCVTPS2PH can't round ties away from zero, so the rounding is done in advance: adding 0x1000 to the float32
+ * representation adds half of the float16 ULP to the magnitude, provided that the result is normal; then
+ * the conversion truncates. Lanes where the result may be subnormal, infinite or NaN are recomputed with
+ * the scalar kernel, as well as NaN lanes of VCVTPH2PS, whose payload would differ from the portable algorithm.
+ */
+void IEEE754Converter::nativeToHalf(const float* src, uint16_t* dst, unsigned count)
+{
+    const __m128i abs_mask = _mm_set1_epi32(0x7FFFFFFF);
+    const __m128i round_bit = _mm_set1_epi32(0x1000);
+    const __m128i min_subnormal_exp = _mm_set1_epi32(101);     // Up to that the result is zero
+    const __m128i min_normal_exp = _mm_set1_epi32(113);
+    const __m128i max_normal_exp = _mm_set1_epi32(142);
+    while (count >= 4)
+    {
+        const __m128i bits = _mm_castps_si128(_mm_loadu_ps(src));
+        const __m128i rounded = _mm_add_epi32(bits, round_bit);
+        const __m128i exponent = _mm_srli_epi32(_mm_and_si128(bits, abs_mask), 23);
+        const __m128i rounded_exp = _mm_srli_epi32(_mm_and_si128(rounded, abs_mask), 23);
+        // The original exponent is checked too, because rounding of NaN may overflow into the sign bit
+        const __m128i special = _mm_or_si128(_mm_and_si128(_mm_cmpgt_epi32(rounded_exp, min_subnormal_exp),
+                                                           _mm_cmplt_epi32(exponent, min_normal_exp)),
+                                             _mm_or_si128(_mm_cmpgt_epi32(rounded_exp, max_normal_exp),
+                                                          _mm_cmpgt_epi32(exponent, max_normal_exp)));
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(dst),
+                         _mm_cvtps_ph(_mm_castsi128_ps(rounded), _MM_FROUND_TO_ZERO));
+        const int special_lanes = _mm_movemask_ps(_mm_castsi128_ps(special));
+        if (special_lanes != 0)
+        {
+            for (unsigned i = 0; i < 4; i++)
+            {
+                if (special_lanes & (1 << i))
+                {
+                    dst[i] = nativeToHalf(src[i]);
+                }
+            }
+        }
+        src += 4;
+        dst += 4;
+        count -= 4;
+    }
+    while (count-- > 0)
+    {
+        *dst++ = nativeToHalf(*src++);
+    }
+}
+
+void IEEE754Converter::halfToNative(const uint16_t* src, float* dst, unsigned count)
+{
+    const __m128i abs_mask = _mm_set1_epi16(0x7FFF);
+    const __m128i inf = _mm_set1_epi16(0x7C00);
+    while (count >= 4)
+    {
+        const __m128i halves = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(src));
+        _mm_storeu_ps(dst, _mm_cvtph_ps(halves));
+        const int nan_lanes = _mm_movemask_epi8(_mm_cmpgt_epi16(_mm_and_si128(halves, abs_mask), inf)) & 0xFF;
+        if (nan_lanes != 0)
+        {
+            for (unsigned i = 0; i < 4; i++)
+            {
+                if (nan_lanes & (3 << (i * 2)))
+                {
+                    dst[i] = halfToNativeNonIeee(src[i]);
+                }
+            }
+        }
+        src += 4;
+        dst += 4;
+        count -= 4;
+    }
+    while (count-- > 0)
+    {
+        *dst++ = halfToNative(*src++);
+    }
+}
+
+#else
+
+void IEEE754Converter::nativeToHalf(const float* src, uint16_t* dst, unsigned count)
+{
+    while (count-- > 0)
+    {
+        *dst++ = nativeToHalf(*src++);
+    }
+}
+
+void IEEE754Converter::halfToNative(const uint16_t* src, float* dst, unsigned count)
+{
+    while (count-- > 0)
+    {
+        *dst++ = halfToNative(*src++);
+    }
+}
+
+#endif
+
 }
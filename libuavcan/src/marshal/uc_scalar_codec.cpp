@@ -43,4 +43,32 @@ int ScalarCodec::decodeBytesImpl(uint8_t* const bytes, const unsigned bitlen)
     return read_res;
 }
 
+int ScalarCodec::encodeBits(const uint8_t* const bytes, const unsigned bitlen)
+{
+    UAVCAN_ASSERT(bytes);
+    if (bitlen >= 8)
+    {
+        const int res = stream_.writeBytes(bytes, bitlen / 8);
+        if (res <= 0)
+        {
+            return res;
+        }
+    }
+    return ((bitlen % 8) == 0) ? int(BitStream::ResultOk) : stream_.write(bytes + bitlen / 8, bitlen % 8);
+}
+
+int ScalarCodec::decodeBits(uint8_t* const bytes, const unsigned bitlen)
+{
+    UAVCAN_ASSERT(bytes);
+    if (bitlen >= 8)
+    {
+        const int res = stream_.readBytes(bytes, bitlen / 8);
+        if (res <= 0)
+        {
+            return res;
+        }
+    }
+    return ((bitlen % 8) == 0) ? int(BitStream::ResultOk) : stream_.read(bytes + bitlen / 8, bitlen % 8);
+}
+
 }
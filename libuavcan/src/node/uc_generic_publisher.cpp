@@ -44,16 +44,23 @@ IMarshalBuffer* GenericPublisherBase::getBuffer(unsigned byte_len)
 
 int GenericPublisherBase::genericPublish(const IMarshalBuffer& buffer, TransferType transfer_type, NodeID dst_node_id,
                                          TransferID* tid, MonotonicTime blocking_deadline)
+{
+    return genericPublish(buffer.getDataPtr(), buffer.getDataLength(), transfer_type, dst_node_id, tid,
+                          blocking_deadline);
+}
+
+int GenericPublisherBase::genericPublish(const uint8_t* payload, unsigned payload_len, TransferType transfer_type,
+                                         NodeID dst_node_id, TransferID* tid, MonotonicTime blocking_deadline)
 {
     if (tid)
     {
-        return sender_->send(buffer.getDataPtr(), buffer.getDataLength(), getTxDeadline(),
-                             blocking_deadline, transfer_type, dst_node_id, *tid);
+        return sender_->send(payload, payload_len, getTxDeadline(), blocking_deadline, transfer_type,
+                             dst_node_id, *tid);
     }
     else
     {
-        return sender_->send(buffer.getDataPtr(), buffer.getDataLength(), getTxDeadline(),
-                             blocking_deadline, transfer_type, dst_node_id);
+        return sender_->send(payload, payload_len, getTxDeadline(), blocking_deadline, transfer_type,
+                             dst_node_id);
     }
 }
 
@@ -142,14 +142,20 @@ MonotonicTime Scheduler::computeDispatcherSpinDeadline(MonotonicTime spin_deadli
 
 void Scheduler::pollCleanup(MonotonicTime mono_ts, uint32_t num_frames_processed_with_last_spin)
 {
-    // cleanup will be performed less frequently if the stack handles more frames per second
-    const MonotonicTime deadline = prev_cleanup_ts_ + cleanup_period_ * (num_frames_processed_with_last_spin + 1);
-    if (mono_ts > deadline)
+    if (!cleanup_in_progress_)
     {
+        // cleanup will be performed less frequently if the stack handles more frames per second
+        const MonotonicTime deadline = prev_cleanup_ts_ + cleanup_period_ * (num_frames_processed_with_last_spin + 1);
+        if (mono_ts <= deadline)
+        {
+            return;
+        }
         //UAVCAN_TRACE("Scheduler", "Cleanup with %u processed frames", num_frames_processed_with_last_spin);
         prev_cleanup_ts_ = mono_ts;
-        dispatcher_.cleanup(mono_ts);
+        cleanup_in_progress_ = true;
     }
+    // A pass that doesn't fit into the time slice will be continued on the next spin iterations
+    cleanup_in_progress_ = !dispatcher_.cleanupIncrementally(mono_ts, mono_ts + cleanup_time_slice_);
 }
 
 int Scheduler::spin(MonotonicTime deadline)
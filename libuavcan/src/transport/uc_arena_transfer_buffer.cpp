@@ -0,0 +1,311 @@
+/*
+ * Copyright (C) 2014 Pavel Kirienko <pavel.kirienko@gmail.com>
+ */
+
+#include <uavcan/transport/arena_transfer_buffer.hpp>
+#include <uavcan/debug.hpp>
+#include <cassert>
+#include <cstring>
+
+namespace uavcan
+{
+/*
+ * ArenaTransferBufferManagerEntry
+ */
+void ArenaTransferBufferManagerEntry::resetImpl()
+{
+    if (owner_ != NULL)
+    {
+        owner_->release(*this);
+    }
+    max_write_pos_ = 0;
+}
+
+int ArenaTransferBufferManagerEntry::read(unsigned offset, uint8_t* data, unsigned len) const
+{
+    if (!data)
+    {
+        UAVCAN_ASSERT(0);
+        return -ErrInvalidParam;
+    }
+    if (offset >= max_write_pos_)
+    {
+        return 0;
+    }
+    if ((offset + len) > max_write_pos_)
+    {
+        len = max_write_pos_ - offset;
+    }
+    UAVCAN_ASSERT((offset + len) <= max_write_pos_);
+    UAVCAN_ASSERT(owner_ != NULL);
+    (void)std::memcpy(data, owner_->getChunkPtr(first_chunk_) + offset, len);
+    return int(len);
+}
+
+int ArenaTransferBufferManagerEntry::write(unsigned offset, const uint8_t* data, unsigned len)
+{
+    if (!data || (owner_ == NULL))
+    {
+        UAVCAN_ASSERT(0);
+        return -ErrInvalidParam;
+    }
+    if (offset >= owner_->max_buf_size_)
+    {
+        return 0;
+    }
+    if ((offset + len) > owner_->max_buf_size_)
+    {
+        len = owner_->max_buf_size_ - offset;
+    }
+
+    unsigned capacity = unsigned(num_chunks_) * unsigned(ArenaTransferBufferManagerImpl::ChunkSize);
+    if ((offset + len) > capacity)
+    {
+        (void)owner_->reserve(*this, offset + len);
+        capacity = unsigned(num_chunks_) * unsigned(ArenaTransferBufferManagerImpl::ChunkSize);
+        if (offset >= capacity)
+        {
+            return 0;
+        }
+        if ((offset + len) > capacity)
+        {
+            len = capacity - offset;                  // Out of arena space, writing what we can
+        }
+    }
+    UAVCAN_ASSERT((offset + len) <= capacity);
+
+    (void)std::memcpy(owner_->getChunkPtr(first_chunk_) + offset, data, len);
+    max_write_pos_ = max(uint16_t(offset + len), uint16_t(max_write_pos_));
+    return int(len);
+}
+
+/*
+ * ArenaTransferBufferManagerImpl
+ */
+ArenaTransferBufferManagerImpl::ArenaTransferBufferManagerImpl(uint16_t max_buf_size, uint8_t* arena,
+                                                               uint16_t num_chunks, uint32_t* chunk_bitmap,
+                                                               ArenaTransferBufferManagerEntry* entries,
+                                                               uint8_t num_entries)
+    : arena_(arena)
+    , chunk_bitmap_(chunk_bitmap)
+    , entries_(entries)
+    , num_chunks_(num_chunks)
+    , max_buf_size_(max_buf_size)
+    , num_entries_(num_entries)
+{
+    UAVCAN_ASSERT((arena_ != NULL) && (chunk_bitmap_ != NULL) && (entries_ != NULL));
+    fill(chunk_bitmap_, chunk_bitmap_ + (num_chunks_ + 31U) / 32U, uint32_t(0));
+}
+
+ArenaTransferBufferManagerEntry* ArenaTransferBufferManagerImpl::find(const TransferBufferManagerKey& key) const
+{
+    for (unsigned i = 0; i < num_entries_; i++)
+    {
+        if (entries_[i].getKey() == key)
+        {
+            return entries_ + i;
+        }
+    }
+    return NULL;
+}
+
+void ArenaTransferBufferManagerImpl::markChunks(unsigned first, unsigned num, bool used)
+{
+    UAVCAN_ASSERT((first + num) <= num_chunks_);
+    for (unsigned i = first; i < (first + num); i++)
+    {
+        UAVCAN_ASSERT(isChunkUsed(i) != used);
+        if (used)
+        {
+            chunk_bitmap_[i / 32U] |= uint32_t(1UL << (i % 32U));
+        }
+        else
+        {
+            chunk_bitmap_[i / 32U] &= ~uint32_t(1UL << (i % 32U));
+        }
+    }
+}
+
+bool ArenaTransferBufferManagerImpl::areChunksFree(unsigned first, unsigned num) const
+{
+    if ((first + num) > num_chunks_)
+    {
+        return false;
+    }
+    for (unsigned i = first; i < (first + num); i++)
+    {
+        if (isChunkUsed(i))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+int ArenaTransferBufferManagerImpl::findFreeChunks(unsigned num) const
+{
+    unsigned run = 0;
+    for (unsigned i = 0; i < num_chunks_; i++)
+    {
+        if (((i % 32U) == 0) && (chunk_bitmap_[i / 32U] == 0xFFFFFFFFUL))
+        {
+            run = 0;                                    // Skipping the fully occupied word
+            i += 31;
+            continue;
+        }
+        run = isChunkUsed(i) ? 0 : (run + 1);
+        if (run == num)
+        {
+            return int(i + 1 - num);
+        }
+    }
+    return -1;
+}
+
+bool ArenaTransferBufferManagerImpl::reserve(ArenaTransferBufferManagerEntry& entry, unsigned size)
+{
+    const unsigned max_chunks = (unsigned(max_buf_size_) + ChunkSize - 1U) / ChunkSize;
+    const unsigned needed_chunks = min((size + ChunkSize - 1U) / ChunkSize, max_chunks);
+    if (needed_chunks <= entry.num_chunks_)
+    {
+        return true;
+    }
+
+    // Next size class, but no less than required
+    unsigned new_chunks = (entry.num_chunks_ > 0) ? entry.num_chunks_ : 1U;
+    while (new_chunks < needed_chunks)
+    {
+        new_chunks *= 2U;
+    }
+    new_chunks = min(new_chunks, max_chunks);
+
+    // Growing in place if the adjacent chunks are free, either in the full size class or just as required
+    if (entry.num_chunks_ > 0)
+    {
+        const unsigned next = unsigned(entry.first_chunk_) + entry.num_chunks_;
+        const unsigned options[] = { new_chunks, needed_chunks };
+        for (unsigned i = 0; i < (sizeof(options) / sizeof(options[0])); i++)
+        {
+            if (areChunksFree(next, options[i] - entry.num_chunks_))
+            {
+                markChunks(next, options[i] - entry.num_chunks_, true);
+                entry.num_chunks_ = uint16_t(options[i]);
+                return true;
+            }
+        }
+    }
+
+    // Moving into a new run
+    int first = findFreeChunks(new_chunks);
+    if (first < 0)
+    {
+        new_chunks = needed_chunks;
+        first = findFreeChunks(new_chunks);
+    }
+    if (first < 0)
+    {
+        UAVCAN_TRACE("ArenaTransferBufferManager", "Out of arena space, %s", entry.getKey().toString().c_str());
+        return false;
+    }
+
+    markChunks(unsigned(first), new_chunks, true);
+    if (entry.num_chunks_ > 0)
+    {
+        (void)std::memcpy(getChunkPtr(unsigned(first)), getChunkPtr(entry.first_chunk_), entry.max_write_pos_);
+        markChunks(entry.first_chunk_, entry.num_chunks_, false);
+    }
+    entry.first_chunk_ = uint16_t(first);
+    entry.num_chunks_ = uint16_t(new_chunks);
+    return true;
+}
+
+void ArenaTransferBufferManagerImpl::release(ArenaTransferBufferManagerEntry& entry)
+{
+    if (entry.num_chunks_ > 0)
+    {
+        markChunks(entry.first_chunk_, entry.num_chunks_, false);
+    }
+    entry.first_chunk_ = 0;
+    entry.num_chunks_ = 0;
+}
+
+ITransferBuffer* ArenaTransferBufferManagerImpl::access(const TransferBufferManagerKey& key)
+{
+    if (key.isEmpty())
+    {
+        UAVCAN_ASSERT(0);
+        return NULL;
+    }
+    return find(key);
+}
+
+ITransferBuffer* ArenaTransferBufferManagerImpl::create(const TransferBufferManagerKey& key)
+{
+    if (key.isEmpty())
+    {
+        UAVCAN_ASSERT(0);
+        return NULL;
+    }
+    remove(key);
+
+    ArenaTransferBufferManagerEntry* const entry = find(TransferBufferManagerKey());
+    if (entry == NULL)
+    {
+        UAVCAN_TRACE("ArenaTransferBufferManager", "No free entries, %s", key.toString().c_str());
+        return NULL;
+    }
+    entry->owner_ = this;
+    entry->reset(key);
+    if (!reserve(*entry, 1))
+    {
+        entry->reset();
+        return NULL;
+    }
+    UAVCAN_TRACE("ArenaTransferBufferManager", "Buffer created [num=%u], %s",
+                 getNumBuffers(), key.toString().c_str());
+    return entry;
+}
+
+void ArenaTransferBufferManagerImpl::remove(const TransferBufferManagerKey& key)
+{
+    UAVCAN_ASSERT(!key.isEmpty());
+    ArenaTransferBufferManagerEntry* const entry = find(key);
+    if (entry != NULL)
+    {
+        UAVCAN_TRACE("ArenaTransferBufferManager", "Buffer deleted, %s", key.toString().c_str());
+        entry->reset();
+    }
+}
+
+bool ArenaTransferBufferManagerImpl::isEmpty() const
+{
+    return getNumBuffers() == 0;
+}
+
+unsigned ArenaTransferBufferManagerImpl::getNumBuffers() const
+{
+    unsigned res = 0;
+    for (unsigned i = 0; i < num_entries_; i++)
+    {
+        if (!entries_[i].isEmpty())
+        {
+            res++;
+        }
+    }
+    return res;
+}
+
+unsigned ArenaTransferBufferManagerImpl::getNumUsedChunks() const
+{
+    unsigned res = 0;
+    for (unsigned i = 0; i < num_chunks_; i++)
+    {
+        if (isChunkUsed(i))
+        {
+            res++;
+        }
+    }
+    return res;
+}
+
+}
@@ -0,0 +1,125 @@
+/*
+ * Copyright (C) 2014 Pavel Kirienko <pavel.kirienko@gmail.com>
+ */
+
+#include <uavcan/transport/can_acceptance_filter_builder.hpp>
+#include <cassert>
+
+namespace uavcan
+{
+unsigned CanAcceptanceFilterBuilder::getNumMaskBits(uint32_t mask)
+{
+    unsigned cnt = 0;
+    while (mask != 0)
+    {
+        mask &= mask - 1;
+        cnt++;
+    }
+    return cnt;
+}
+
+CanFilterConfig CanAcceptanceFilterBuilder::merge(const CanFilterConfig& a, const CanFilterConfig& b)
+{
+    CanFilterConfig out;
+    out.mask = a.mask & b.mask & ~(a.id ^ b.id);
+    out.id = a.id & out.mask;
+    return out;
+}
+
+bool CanAcceptanceFilterBuilder::covers(const CanFilterConfig& wide, const CanFilterConfig& narrow)
+{
+    return ((wide.mask & ~narrow.mask) == 0) && (((wide.id ^ narrow.id) & wide.mask) == 0);
+}
+
+void CanAcceptanceFilterBuilder::add(const CanFilterConfig& config)
+{
+    if (capacity_ == 0)
+    {
+        return;
+    }
+
+    CanFilterConfig cfg = config;
+    cfg.id &= cfg.mask;
+
+    for (unsigned i = 0; i < num_configs_; i++)
+    {
+        if (covers(configs_[i], cfg))
+        {
+            return;
+        }
+    }
+
+    if (num_configs_ < capacity_)
+    {
+        configs_[num_configs_++] = cfg;
+        return;
+    }
+
+    /*
+     * No space left - find the cheapest merge, either between two existing configs or with the new one.
+     */
+    unsigned best_i = 0;
+    unsigned best_j = num_configs_;           // Index num_configs_ stands for the new config
+    int best_score = -1;
+    for (unsigned i = 0; i < num_configs_; i++)
+    {
+        for (unsigned j = i + 1; j <= num_configs_; j++)
+        {
+            const CanFilterConfig& other = (j < num_configs_) ? configs_[j] : cfg;
+            const int score = int(getNumMaskBits(merge(configs_[i], other).mask));
+            if (score > best_score)
+            {
+                best_score = score;
+                best_i = i;
+                best_j = j;
+            }
+        }
+    }
+
+    if (best_j < num_configs_)
+    {
+        configs_[best_i] = merge(configs_[best_i], configs_[best_j]);
+        configs_[best_j] = cfg;
+    }
+    else
+    {
+        configs_[best_i] = merge(configs_[best_i], cfg);
+    }
+}
+
+void CanAcceptanceFilterBuilder::addTransferFilter(DataTypeID dtid, TransferType transfer_type)
+{
+    CanFilterConfig cfg;
+    cfg.id = CanFrame::FlagEFF | CanIDDataTypeID::pack(dtid.get()) | CanIDTransferType::pack(transfer_type);
+    cfg.mask = CanFrame::FlagEFF | CanFrame::FlagRTR | CanIDDataTypeID::mask() | CanIDTransferType::mask();
+    add(cfg);
+}
+
+void CanAcceptanceFilterBuilder::addMessageFilter(DataTypeID dtid)
+{
+    // Broadcast and unicast message transfer types differ in the least significant bit only
+    StaticAssert<(TransferTypeMessageBroadcast | 1) == TransferTypeMessageUnicast>::check();
+
+    CanFilterConfig cfg;
+    cfg.id = CanFrame::FlagEFF | CanIDDataTypeID::pack(dtid.get()) | CanIDTransferType::pack(TransferTypeMessageBroadcast);
+    cfg.mask = CanFrame::FlagEFF | CanFrame::FlagRTR | CanIDDataTypeID::mask() | CanIDTransferType::pack(2U);
+    add(cfg);
+}
+
+void CanAcceptanceFilterBuilder::addTransferTypeFilter(TransferType transfer_type)
+{
+    CanFilterConfig cfg;
+    cfg.id = CanFrame::FlagEFF | CanIDTransferType::pack(transfer_type);
+    cfg.mask = CanFrame::FlagEFF | CanFrame::FlagRTR | CanIDTransferType::mask();
+    add(cfg);
+}
+
+void CanAcceptanceFilterBuilder::addSourceNodeFilter(NodeID node_id)
+{
+    CanFilterConfig cfg;
+    cfg.id = CanFrame::FlagEFF | CanIDSrcNodeID::pack(node_id.get());
+    cfg.mask = CanFrame::FlagEFF | CanFrame::FlagRTR | CanIDSrcNodeID::mask();
+    add(cfg);
+}
+
+}
@@ -9,22 +9,6 @@
 
 namespace uavcan
 {
-/*
- * CanRxFrame
- */
-#if UAVCAN_TOSTRING
-std::string CanRxFrame::toString(StringRepresentation mode) const
-{
-    std::string out = CanFrame::toString(mode);
-    out.reserve(128);
-    out += " ts_m="   + ts_mono.toString();
-    out += " ts_utc=" + ts_utc.toString();
-    out += " iface=";
-    out += char('0' + iface_index);
-    return out;
-}
-#endif
-
 /*
  * CanTxQueue::Entry
  */
@@ -88,131 +72,821 @@ std::string CanTxQueue::Entry::toString() const
  */
 CanTxQueue::~CanTxQueue()
 {
-    Entry* p = queue_.get();
-    while (p)
+    for (int i = 0; i < NumQosLevels; i++)
+    {
+        while (roots_[i] != NULL)
+        {
+            Entry* p = roots_[i];
+            destroy(p);
+        }
+    }
+}
+
+unsigned CanTxQueue::estimateFrameBitLength(const CanFrame& frame)
+{
+    // Frame overhead including the interframe space; bit stuffing is not accounted for
+    return (frame.isExtended() ? 67U : 47U) + 8U * frame.dlc;
+}
+
+void CanTxQueue::registerRejectedFrames(uint8_t iface_mask, unsigned num)
+{
+    for (uint8_t i = 0; i < MaxCanIfaces; i++)
+    {
+        if (iface_mask & (1 << i))
+        {
+            uint32_t& cnt = rejected_frames_cnt_[i];
+            cnt = (num < (NumericTraits<uint32_t>::max() - cnt)) ? (cnt + num) : NumericTraits<uint32_t>::max();
+        }
+    }
+}
+
+void CanTxQueue::registerPendingFrames(uint8_t iface_mask, bool added)
+{
+    for (uint8_t i = 0; i < MaxCanIfaces; i++)
+    {
+        if (iface_mask & (1 << i))
+        {
+            UAVCAN_ASSERT(added || (num_pending_[i] > 0));
+            num_pending_[i] = added ? (num_pending_[i] + 1U) : (num_pending_[i] - 1U);
+        }
+    }
+}
+
+void CanTxQueue::updateNode(Entry* node)
+{
+    UAVCAN_ASSERT(node);
+    node->height_ = uint8_t(max(getHeight(node->left_), getHeight(node->right_)) + 1);
+    node->subtree_min_deadline_ = node->deadline;
+    node->subtree_pending_mask_ = node->pending_mask_;
+    if (node->left_ != NULL)
+    {
+        node->subtree_min_deadline_ = min(node->subtree_min_deadline_, node->left_->subtree_min_deadline_);
+        node->subtree_pending_mask_ |= node->left_->subtree_pending_mask_;
+    }
+    if (node->right_ != NULL)
+    {
+        node->subtree_min_deadline_ = min(node->subtree_min_deadline_, node->right_->subtree_min_deadline_);
+        node->subtree_pending_mask_ |= node->right_->subtree_pending_mask_;
+    }
+}
+
+void CanTxQueue::updatePathToRoot(Entry* node)
+{
+    // The tree shape doesn't change, so no rebalancing is needed
+    while (node != NULL)
+    {
+        updateNode(node);
+        node = node->parent_;
+    }
+}
+
+void CanTxQueue::replaceChild(Entry* parent, const Entry* old_child, Entry* new_child, Entry*& root)
+{
+    if (parent == NULL)
+    {
+        UAVCAN_ASSERT(root == old_child);
+        root = new_child;
+    }
+    else if (parent->left_ == old_child)
+    {
+        parent->left_ = new_child;
+    }
+    else
+    {
+        UAVCAN_ASSERT(parent->right_ == old_child);
+        parent->right_ = new_child;
+    }
+    if (new_child != NULL)
+    {
+        new_child->parent_ = parent;
+    }
+}
+
+CanTxQueue::Entry* CanTxQueue::rotateLeft(Entry* node, Entry*& root)
+{
+    Entry* const pivot = node->right_;
+    UAVCAN_ASSERT(pivot);
+    node->right_ = pivot->left_;
+    if (pivot->left_ != NULL)
+    {
+        pivot->left_->parent_ = node;
+    }
+    replaceChild(node->parent_, node, pivot, root);
+    pivot->left_ = node;
+    node->parent_ = pivot;
+    updateNode(node);
+    updateNode(pivot);
+    return pivot;
+}
+
+CanTxQueue::Entry* CanTxQueue::rotateRight(Entry* node, Entry*& root)
+{
+    Entry* const pivot = node->left_;
+    UAVCAN_ASSERT(pivot);
+    node->left_ = pivot->right_;
+    if (pivot->right_ != NULL)
+    {
+        pivot->right_->parent_ = node;
+    }
+    replaceChild(node->parent_, node, pivot, root);
+    pivot->right_ = node;
+    node->parent_ = pivot;
+    updateNode(node);
+    updateNode(pivot);
+    return pivot;
+}
+
+CanTxQueue::Entry* CanTxQueue::rebalance(Entry* node, Entry*& root)
+{
+    const int balance = int(getHeight(node->left_)) - int(getHeight(node->right_));
+    if (balance > 1)
+    {
+        if (getHeight(node->left_->left_) < getHeight(node->left_->right_))
+        {
+            (void)rotateLeft(node->left_, root);
+        }
+        return rotateRight(node, root);
+    }
+    if (balance < -1)
+    {
+        if (getHeight(node->right_->right_) < getHeight(node->right_->left_))
+        {
+            (void)rotateRight(node->right_, root);
+        }
+        return rotateLeft(node, root);
+    }
+    return node;
+}
+
+void CanTxQueue::retrace(Entry* node, Entry*& root)
+{
+    // Deadline and pending mask indices must be updated up to the root, so there's no early termination
+    while (node != NULL)
+    {
+        updateNode(node);
+        node = rebalance(node, root)->parent_;
+    }
+}
+
+CanTxQueue::Entry* CanTxQueue::findLeftmost(Entry* node)
+{
+    while ((node != NULL) && (node->left_ != NULL))
+    {
+        node = node->left_;
+    }
+    return node;
+}
+
+CanTxQueue::Entry* CanTxQueue::findRightmost(Entry* node)
+{
+    while ((node != NULL) && (node->right_ != NULL))
+    {
+        node = node->right_;
+    }
+    return node;
+}
+
+CanTxQueue::Entry* CanTxQueue::findPredecessor(Entry* node)
+{
+    if (node->left_ != NULL)
+    {
+        return findRightmost(node->left_);
+    }
+    while ((node->parent_ != NULL) && (node->parent_->left_ == node))
+    {
+        node = node->parent_;
+    }
+    return node->parent_;
+}
+
+CanTxQueue::Entry* CanTxQueue::findSuccessor(Entry* node)
+{
+    if (node->right_ != NULL)
+    {
+        return findLeftmost(node->right_);
+    }
+    while ((node->parent_ != NULL) && (node->parent_->right_ == node))
+    {
+        node = node->parent_;
+    }
+    return node->parent_;
+}
+
+CanTxQueue::Entry* CanTxQueue::findFirstNotHigherThan(Entry* node, const CanFrame& frame)
+{
+    Entry* result = NULL;
+    while (node != NULL)
+    {
+        if (node->frame.priorityHigherThan(frame))
+        {
+            node = node->right_;
+        }
+        else
+        {
+            result = node;
+            node = node->left_;
+        }
+    }
+    return result;
+}
+
+CanTxQueue::Entry* CanTxQueue::findFirstPendingNotHigherThan(Entry* node, const CanFrame& frame, uint8_t iface_mask)
+{
+    // Subtrees without pending entries are skipped; complexity is O(log^2 N)
+    Entry* result = NULL;
+    while ((node != NULL) && (node->subtree_pending_mask_ & iface_mask))
+    {
+        if (node->frame.priorityHigherThan(frame))
+        {
+            node = node->right_;
+        }
+        else
+        {
+            if (node->pending_mask_ & iface_mask)
+            {
+                result = node;
+            }
+            else if (node->right_ != NULL)
+            {
+                Entry* const right = findLeftmostPending(node->right_, iface_mask);
+                result = (right != NULL) ? right : result;
+            }
+            node = node->left_;
+        }
+    }
+    return result;
+}
+
+CanTxQueue::Entry* CanTxQueue::findLeftmostPending(Entry* node, uint8_t iface_mask)
+{
+    while ((node != NULL) && (node->subtree_pending_mask_ & iface_mask))
+    {
+        if ((node->left_ != NULL) && (node->left_->subtree_pending_mask_ & iface_mask))
+        {
+            node = node->left_;
+        }
+        else if (node->pending_mask_ & iface_mask)
+        {
+            return node;
+        }
+        else
+        {
+            node = node->right_;
+        }
+    }
+    return NULL;
+}
+
+CanTxQueue::Entry* CanTxQueue::findRightmostPending(Entry* node, uint8_t iface_mask)
+{
+    while ((node != NULL) && (node->subtree_pending_mask_ & iface_mask))
+    {
+        if ((node->right_ != NULL) && (node->right_->subtree_pending_mask_ & iface_mask))
+        {
+            node = node->right_;
+        }
+        else if (node->pending_mask_ & iface_mask)
+        {
+            return node;
+        }
+        else
+        {
+            node = node->left_;
+        }
+    }
+    return NULL;
+}
+
+CanTxQueue::Entry* CanTxQueue::findExpired(Entry* node, MonotonicTime timestamp)
+{
+    while ((node != NULL) && (timestamp > node->subtree_min_deadline_))
+    {
+        if ((node->left_ != NULL) && (timestamp > node->left_->subtree_min_deadline_))
+        {
+            node = node->left_;
+        }
+        else if (node->isExpired(timestamp))
+        {
+            return node;
+        }
+        else
+        {
+            node = node->right_;
+        }
+    }
+    return NULL;
+}
+
+bool CanTxQueue::containsInSubtree(const Entry* node, const CanFrame& frame)
+{
+    if (node == NULL)
+    {
+        return false;
+    }
+    return (node->frame == frame) || containsInSubtree(node->left_, frame) || containsInSubtree(node->right_, frame);
+}
+
+void CanTxQueue::insert(Entry* entry)
+{
+    UAVCAN_ASSERT(entry && (entry->parent_ == NULL) && (entry->left_ == NULL) && (entry->right_ == NULL));
+    Entry*& root = roots_[entry->qos];
+    if (root == NULL)
+    {
+        root = entry;
+    }
+    else
+    {
+        Entry* p = root;
+        while (true)
+        {
+            // Equal priority goes to the right, so that frames of the same priority will be sent in FIFO order
+            Entry*& child = entry->frame.priorityHigherThan(p->frame) ? p->left_ : p->right_;
+            if (child == NULL)
+            {
+                child = entry;
+                entry->parent_ = p;
+                break;
+            }
+            p = child;
+        }
+        retrace(entry->parent_, root);
+    }
+    registerPendingFrames(entry->pending_mask_, true);
+    num_entries_++;
+}
+
+void CanTxQueue::unlink(Entry* entry)
+{
+    UAVCAN_ASSERT(entry && (num_entries_ > 0));
+    Entry*& root = roots_[entry->qos];
+    Entry* retrace_from = NULL;
+
+    if ((entry->left_ != NULL) && (entry->right_ != NULL))
+    {
+        // Nodes are relinked rather than swapped by value, because the entries are referenced by the caller
+        Entry* const successor = findLeftmost(entry->right_);
+        if (successor->parent_ == entry)
+        {
+            retrace_from = successor;
+        }
+        else
+        {
+            retrace_from = successor->parent_;
+            retrace_from->left_ = successor->right_;
+            if (successor->right_ != NULL)
+            {
+                successor->right_->parent_ = retrace_from;
+            }
+            successor->right_ = entry->right_;
+            successor->right_->parent_ = successor;
+        }
+        successor->left_ = entry->left_;
+        successor->left_->parent_ = successor;
+        replaceChild(entry->parent_, entry, successor, root);
+    }
+    else
+    {
+        retrace_from = entry->parent_;
+        replaceChild(entry->parent_, entry, (entry->left_ != NULL) ? entry->left_ : entry->right_, root);
+    }
+    retrace(retrace_from, root);
+
+    entry->left_ = entry->right_ = entry->parent_ = NULL;
+    registerPendingFrames(entry->pending_mask_, false);
+    num_entries_--;
+}
+
+void CanTxQueue::removeExpired(MonotonicTime timestamp)
+{
+    for (int i = 0; i < NumQosLevels; i++)
+    {
+        while (true)
+        {
+            Entry* p = findExpired(roots_[i], timestamp);
+            if (p == NULL)
+            {
+                break;
+            }
+            UAVCAN_TRACE("CanTxQueue", "Push: Expired %s", p->toString().c_str());
+            drop(p, timestamp);
+        }
+    }
+}
+
+void CanTxQueue::destroy(Entry*& entry)
+{
+    unlink(entry);
+    Entry::destroy(entry, allocator_);
+}
+
+void CanTxQueue::release(Entry*& entry, uint8_t iface_mask)
+{
+    registerPendingFrames(iface_mask, false);
+    entry->pending_mask_ = uint8_t(entry->pending_mask_ & ~iface_mask);
+    if (entry->pending_mask_ == 0)
+    {
+        destroy(entry);
+    }
+    else
+    {
+        updatePathToRoot(entry);        // The frame is still pending on other interfaces
+        entry = NULL;
+    }
+}
+
+void CanTxQueue::drop(Entry* entry, uint8_t iface_mask, MonotonicTime timestamp)
+{
+    iface_mask = uint8_t(iface_mask & entry->pending_mask_);
+    UAVCAN_ASSERT(iface_mask != 0);
+    registerRejectedFrames(iface_mask, 1);
+    if (entry->transfer_tag_ != 0)
+    {
+        purgeTransfer(entry, iface_mask, timestamp);
+    }
+    release(entry, iface_mask);
+}
+
+void CanTxQueue::purge(Entry* entry, uint8_t iface_mask, MonotonicTime timestamp)
+{
+    // The transfer is purged only from the interfaces where the dropped frame was pending
+    const uint8_t purged_mask = uint8_t(entry->pending_mask_ & iface_mask);
+    if (purged_mask == 0)
+    {
+        return;
+    }
+    UAVCAN_TRACE("CanTxQueue", "Purged %s", entry->toString().c_str());
+    const bool expired = entry->isExpired(timestamp);
+    for (uint8_t i = 0; i < MaxCanIfaces; i++)
+    {
+        if (purged_mask & (1 << i))
+        {
+            if (!expired)
+            {
+                saved_bus_bits_[i] += estimateFrameBitLength(entry->frame);
+            }
+            if (purged_frames_cnt_[i] < NumericTraits<uint32_t>::max())
+            {
+                purged_frames_cnt_[i]++;
+            }
+        }
+    }
+    release(entry, purged_mask);
+}
+
+void CanTxQueue::purgeTransfer(Entry* dropped, uint8_t iface_mask, MonotonicTime timestamp)
+{
+    // Neighbours stay valid, because removal relinks the nodes rather than moving their contents.
+    // The dropped entry itself is left to the caller.
+    const uint16_t transfer_tag = dropped->transfer_tag_;
+    if (transfer_tag & TransferTagScattered)
     {
-        Entry* const next = p->getNextListNode();
-        remove(p);
+        Entry* p = findLeftmost(roots_[dropped->qos]);
+        while (p != NULL)
+        {
+            Entry* const next = findSuccessor(p);
+            if ((p != dropped) && (p->transfer_tag_ == transfer_tag))
+            {
+                purge(p, iface_mask, timestamp);
+            }
+            p = next;
+        }
+        return;
+    }
+
+    // Frames of equal priority are kept in FIFO order and a transfer is inserted at once, so the rest of the
+    // transfer is adjacent to the dropped frame
+    Entry* p = findPredecessor(dropped);
+    while ((p != NULL) && (p->transfer_tag_ == transfer_tag))
+    {
+        Entry* const prev = findPredecessor(p);
+        purge(p, iface_mask, timestamp);
+        p = prev;
+    }
+    p = findSuccessor(dropped);
+    while ((p != NULL) && (p->transfer_tag_ == transfer_tag))
+    {
+        Entry* const next = findSuccessor(p);
+        purge(p, iface_mask, timestamp);
         p = next;
     }
 }
 
-void CanTxQueue::registerRejectedFrame()
+CanTxQueue::Entry* CanTxQueue::findTop(uint8_t iface_index) const
+{
+    const uint8_t iface_mask = uint8_t(1U << iface_index);
+    Entry* const volat = findLeftmostPending(roots_[Volatile], iface_mask);
+    Entry* const perst = findLeftmostPending(roots_[Persistent], iface_mask);
+    if ((volat == NULL) || (perst == NULL))
+    {
+        return (volat == NULL) ? perst : volat;
+    }
+    return volat->frame.priorityHigherThan(perst->frame) ? volat : perst;
+}
+
+CanTxQueue::Entry* CanTxQueue::findLowestQos() const
+{
+    // Of the entries with equal priority, the oldest one is replaced first
+    Entry* const root = (roots_[Volatile] == NULL) ? roots_[Persistent] : roots_[Volatile];
+    const Entry* const lowest = findRightmost(root);
+    return (lowest == NULL) ? NULL : findFirstNotHigherThan(root, lowest->frame);
+}
+
+CanTxQueue::Entry* CanTxQueue::findLowestQos(uint8_t iface_index) const
+{
+    const uint8_t iface_mask = uint8_t(1U << iface_index);
+    for (int level = 0; level < NumQosLevels; level++)
+    {
+        const Entry* const lowest = findRightmostPending(roots_[level], iface_mask);
+        if (lowest != NULL)
+        {
+            return findFirstPendingNotHigherThan(roots_[level], lowest->frame, iface_mask);
+        }
+    }
+    return NULL;
+}
+
+unsigned CanTxQueue::countEvictable(const CanFrame& frame, Qos qos, unsigned limit, uint8_t iface_mask) const
+{
+    // All entries of lower QoS levels can be replaced; of the same level, only those not of higher priority.
+    // If the interface mask is given, only the entries pending on these interfaces are counted.
+    unsigned count = 0;
+    for (int level = 0; (level <= int(qos)) && (count < limit); level++)
+    {
+        Entry* p = (level == int(qos)) ? findFirstNotHigherThan(roots_[level], frame) : findLeftmost(roots_[level]);
+        while ((p != NULL) && (count < limit))
+        {
+            if ((iface_mask == 0) || (p->pending_mask_ & iface_mask))
+            {
+                count++;
+            }
+            p = findSuccessor(p);
+        }
+    }
+    return count;
+}
+
+void CanTxQueue::findLowestPriorityFrame(const ICanTxFrameSource& source, unsigned first_index, CanFrame& out_frame)
 {
-    if (rejected_frames_cnt_ < NumericTraits<uint32_t>::max())
+    source.buildFrame(first_index, out_frame);
+    for (unsigned i = first_index + 1; i < source.getNumFrames(); i++)
+    {
+        CanFrame frame;
+        source.buildFrame(i, frame);
+        if (frame.priorityLowerThan(out_frame))
+        {
+            out_frame = frame;
+        }
+    }
+}
+
+bool CanTxQueue::admitToIface(uint8_t iface_index, const ICanTxFrameSource& source, unsigned first_index, Qos qos,
+                              MonotonicTime timestamp)
+{
+    const unsigned num_frames = source.getNumFrames() - first_index;
+    if (num_frames > iface_quota_)
+    {
+        return false;
+    }
+    const uint8_t iface_mask = uint8_t(1U << iface_index);
+    if ((num_pending_[iface_index] + num_frames) > iface_quota_)
+    {
+        removeExpired(timestamp);
+    }
+    if ((num_pending_[iface_index] + num_frames) <= iface_quota_)
+    {
+        return true;
+    }
+    // The check is made against the lowest priority frame, so that it holds for the others too
+    const unsigned excess = num_pending_[iface_index] + num_frames - iface_quota_;
+    CanFrame lowest_frame;
+    findLowestPriorityFrame(source, first_index, lowest_frame);
+    if (countEvictable(lowest_frame, qos, excess, iface_mask) < excess)
+    {
+        UAVCAN_TRACE("CanTxQueue", "Push rejected: iface %i quota exhausted", int(iface_index));
+        return false;
+    }
+    while ((num_pending_[iface_index] + num_frames) > iface_quota_)
     {
-        rejected_frames_cnt_++;
+        // Dropping a frame may purge the rest of its transfer, so more than one frame may be freed at once
+        Entry* const lowestqos = findLowestQos(iface_index);
+        UAVCAN_ASSERT(lowestqos != NULL);
+        UAVCAN_TRACE("CanTxQueue", "Push: Replacing on iface %i %s", int(iface_index), lowestqos->toString().c_str());
+        drop(lowestqos, iface_mask, timestamp);
     }
+    return true;
 }
 
-void CanTxQueue::push(const CanFrame& frame, MonotonicTime tx_deadline, Qos qos, CanIOFlags flags)
+void CanTxQueue::rejectTransfer(unsigned num_frames, const unsigned (&first_index)[MaxCanIfaces], uint8_t iface_mask)
 {
+    for (uint8_t i = 0; i < MaxCanIfaces; i++)
+    {
+        if (iface_mask & (1 << i))
+        {
+            registerRejectedFrames(uint8_t(1 << i), num_frames - first_index[i]);
+        }
+    }
+}
+
+void CanTxQueue::push(const CanFrame& frame, MonotonicTime tx_deadline, Qos qos, CanIOFlags flags,
+                      uint8_t iface_mask)
+{
+    push(SingleCanTxFrameSource(frame), 0, tx_deadline, qos, flags, iface_mask);
+}
+
+void CanTxQueue::push(const ICanTxFrameSource& source, unsigned first_index, MonotonicTime tx_deadline, Qos qos,
+                      CanIOFlags flags, uint8_t iface_mask)
+{
+    unsigned first_indices[MaxCanIfaces];
+    fill(first_indices, first_indices + MaxCanIfaces, first_index);
+    push(source, first_indices, iface_mask, tx_deadline, qos, flags);
+}
+
+void CanTxQueue::push(const ICanTxFrameSource& source, const unsigned (&first_index)[MaxCanIfaces],
+                      uint8_t iface_mask, MonotonicTime tx_deadline, Qos qos, CanIOFlags flags)
+{
+    iface_mask &= uint8_t((1U << MaxCanIfaces) - 1U);
+    const unsigned num_frames = source.getNumFrames();
+    unsigned index = num_frames;
+    for (uint8_t i = 0; i < MaxCanIfaces; i++)
+    {
+        if (iface_mask & (1 << i))
+        {
+            UAVCAN_ASSERT(first_index[i] < num_frames);
+            index = min(index, first_index[i]);
+        }
+    }
+    if (index >= num_frames)
+    {
+        UAVCAN_ASSERT(0);
+        return;
+    }
     const MonotonicTime timestamp = sysclock_.getMonotonic();
 
     if (timestamp >= tx_deadline)
     {
         UAVCAN_TRACE("CanTxQueue", "Push rejected: already expired");
-        registerRejectedFrame();
+        rejectTransfer(num_frames, first_index, iface_mask);
         return;
     }
 
-    void* praw = allocator_.allocate(sizeof(Entry));
-    if (praw == NULL)
+    // Every interface must stay within its own quota
+    for (uint8_t i = 0; i < MaxCanIfaces; i++)
     {
-        UAVCAN_TRACE("CanTxQueue", "Push OOM #1, cleanup");
-        // No memory left in the pool, so we try to remove expired frames
-        Entry* p = queue_.get();
-        while (p)
+        if ((iface_mask & (1 << i)) && !admitToIface(i, source, first_index[i], qos, timestamp))
         {
-            Entry* const next = p->getNextListNode();
-            if (p->isExpired(timestamp))
-            {
-                UAVCAN_TRACE("CanTxQueue", "Push: Expired %s", p->toString().c_str());
-                registerRejectedFrame();
-                remove(p);
-            }
-            p = next;
+            registerRejectedFrames(uint8_t(1 << i), num_frames - first_index[i]);
+            iface_mask = uint8_t(iface_mask & ~(1 << i));
+        }
+    }
+    if (iface_mask == 0)
+    {
+        return;
+    }
+    index = num_frames;
+    for (uint8_t i = 0; i < MaxCanIfaces; i++)
+    {
+        if (iface_mask & (1 << i))
+        {
+            index = min(index, first_index[i]);
         }
-        praw = allocator_.allocate(sizeof(Entry));         // Try again
     }
 
-    if (praw == NULL)
+    // New entries are chained through right_ in order until memory for the whole transfer is obtained
+    Entry* pending = NULL;
+    Entry** pending_tail = &pending;
+    bool expired_removed = false;
+    bool admission_checked = false;
+    const PoolAllocationTagScope tag_scope(PoolAllocationTagTxQueue);
+    while (index < num_frames)
     {
-        UAVCAN_TRACE("CanTxQueue", "Push OOM #2, QoS arbitration");
-        registerRejectedFrame();
+        void* const praw = allocator_.allocate(sizeof(Entry));
+        if (praw != NULL)
+        {
+            uint8_t entry_iface_mask = 0;       // Ifaces that haven't transmitted this frame yet
+            for (uint8_t i = 0; i < MaxCanIfaces; i++)
+            {
+                if ((iface_mask & (1 << i)) && (first_index[i] <= index))
+                {
+                    entry_iface_mask |= uint8_t(1 << i);
+                }
+            }
+            Entry* const entry = new (praw) Entry(tx_deadline, qos, flags, entry_iface_mask);
+            source.buildFrame(index, entry->frame);
+            *pending_tail = entry;
+            pending_tail = &entry->right_;
+            index++;
+            continue;
+        }
 
-        // Find a frame with lowest QoS
-        Entry* p = queue_.get();
-        if (p == NULL)
+        if (!expired_removed)
         {
-            UAVCAN_TRACE("CanTxQueue", "Push rejected: Nothing to replace");
-            return;
+            UAVCAN_TRACE("CanTxQueue", "Push OOM #1, cleanup");
+            // No memory left in the pool, so we try to remove expired frames
+            removeExpired(timestamp);
+            expired_removed = true;
+            continue;
         }
-        Entry* lowestqos = p;
-        while (p)
+
+        UAVCAN_TRACE("CanTxQueue", "Push OOM #2, QoS arbitration");
+        if (!admission_checked)
         {
-            if (lowestqos->qosHigherThan(*p))
+            // Nothing is replaced unless the rest of the transfer fits. Every replaced entry frees at least one
+            // block; the check is made against the lowest priority frame, so that it holds for the others too.
+            CanFrame lowest_frame;
+            findLowestPriorityFrame(source, index, lowest_frame);
+            if (countEvictable(lowest_frame, qos, num_frames - index) < (num_frames - index))
             {
-                lowestqos = p;
+                UAVCAN_TRACE("CanTxQueue", "Push rejected: not enough entries to replace");
+                break;
             }
-            p = p->getNextListNode();
+            admission_checked = true;
+        }
+        CanFrame frame;
+        source.buildFrame(index, frame);
+
+        // Find a frame with lowest QoS
+        Entry* lowestqos = findLowestQos();
+        if (lowestqos == NULL)
+        {
+            UAVCAN_TRACE("CanTxQueue", "Push rejected: Nothing to replace");
+            break;
         }
         // Note that frame with *equal* QoS will be replaced too.
         if (lowestqos->qosHigherThan(frame, qos))           // Frame that we want to transmit has lowest QoS
         {
             UAVCAN_TRACE("CanTxQueue", "Push rejected: low QoS");
-            return;                                         // What a loser.
+            break;                                          // What a loser.
         }
         UAVCAN_TRACE("CanTxQueue", "Push: Replacing %s", lowestqos->toString().c_str());
-        remove(lowestqos);
-        praw = allocator_.allocate(sizeof(Entry));        // Try again
+        drop(lowestqos, timestamp);
     }
 
-    if (praw == NULL)
+    const bool complete = index == num_frames;
+    if (!complete)
     {
-        return;                                            // Seems that there is no memory at all.
+        rejectTransfer(num_frames, first_index, iface_mask);
+    }
+    uint16_t transfer_tag = 0;
+    if (complete && (num_frames > 1))
+    {
+        transfer_tag = next_transfer_tag_;
+        next_transfer_tag_ = uint16_t((next_transfer_tag_ >= MaxTransferTag) ? 1U : (next_transfer_tag_ + 1U));
+        for (const Entry* p = pending; p != NULL; p = p->right_)
+        {
+            if (p->frame.id != pending->frame.id)
+            {
+                transfer_tag = uint16_t(transfer_tag | TransferTagScattered);
+                break;
+            }
+        }
+    }
+    while (pending != NULL)
+    {
+        Entry* next = pending->right_;
+        pending->right_ = NULL;
+        if (complete)
+        {
+            pending->transfer_tag_ = transfer_tag;
+            insert(pending);
+        }
+        else
+        {
+            Entry::destroy(pending, allocator_);            // Rolling back
+        }
+        pending = next;
     }
-    Entry* entry = new (praw) Entry(frame, tx_deadline, qos, flags);
-    UAVCAN_ASSERT(entry);
-    queue_.insertBefore(entry, PriorityInsertionComparator(frame));
 }
 
-CanTxQueue::Entry* CanTxQueue::peek()
+CanTxQueue::Entry* CanTxQueue::peek(uint8_t iface_index)
 {
+    UAVCAN_ASSERT(iface_index < MaxCanIfaces);
     const MonotonicTime timestamp = sysclock_.getMonotonic();
-    Entry* p = queue_.get();
-    while (p)
+    while (true)
     {
-        if (p->isExpired(timestamp))
-        {
-            UAVCAN_TRACE("CanTxQueue", "Peek: Expired %s", p->toString().c_str());
-            Entry* const next = p->getNextListNode();
-            registerRejectedFrame();
-            remove(p);
-            p = next;
-        }
-        else
+        Entry* p = findTop(iface_index);
+        if ((p == NULL) || !p->isExpired(timestamp))
         {
             return p;
         }
+        UAVCAN_TRACE("CanTxQueue", "Peek: Expired %s", p->toString().c_str());
+        drop(p, timestamp);
     }
-    return NULL;
 }
 
-void CanTxQueue::remove(Entry*& entry)
+void CanTxQueue::remove(Entry*& entry, uint8_t iface_index)
 {
-    if (entry == NULL)
+    if ((entry == NULL) || (iface_index >= MaxCanIfaces))
     {
         UAVCAN_ASSERT(0);
         return;
     }
-    queue_.remove(entry);
-    Entry::destroy(entry, allocator_);
+    UAVCAN_ASSERT(entry->pending_mask_ & (1 << iface_index));
+    release(entry, uint8_t(1 << iface_index));
 }
 
-bool CanTxQueue::topPriorityHigherOrEqual(const CanFrame& rhs_frame) const
+bool CanTxQueue::topPriorityHigherOrEqual(const CanFrame& rhs_frame, uint8_t iface_index) const
 {
-    const Entry* entry = queue_.get();
+    const Entry* entry = findTop(iface_index);
     if (entry == NULL)
     {
         return false;
@@ -220,6 +894,24 @@ bool CanTxQueue::topPriorityHigherOrEqual(const CanFrame& rhs_frame) const
     return !rhs_frame.priorityHigherThan(entry->frame);
 }
 
+uint8_t CanTxQueue::getPendingIfaceMask() const
+{
+    uint8_t mask = 0;
+    for (int i = 0; i < NumQosLevels; i++)
+    {
+        if (roots_[i] != NULL)
+        {
+            mask |= roots_[i]->subtree_pending_mask_;
+        }
+    }
+    return mask;
+}
+
+bool CanTxQueue::contains(const CanFrame& frame) const
+{
+    return containsInSubtree(roots_[Volatile], frame) || containsInSubtree(roots_[Persistent], frame);
+}
+
 /*
  * CanIOManager
  */
@@ -248,7 +940,7 @@ int CanIOManager::sendToIface(uint8_t iface_index, const CanFrame& frame, Monoto
 int CanIOManager::sendFromTxQueue(uint8_t iface_index)
 {
     UAVCAN_ASSERT(iface_index < MaxCanIfaces);
-    CanTxQueue::Entry* entry = tx_queues_[iface_index]->peek();
+    CanTxQueue::Entry* entry = tx_queue_->peek(iface_index);
     if (entry == NULL)
     {
         return 0;
@@ -256,22 +948,14 @@ int CanIOManager::sendFromTxQueue(uint8_t iface_index)
     const int res = sendToIface(iface_index, entry->frame, entry->deadline, entry->flags);
     if (res > 0)
     {
-        tx_queues_[iface_index]->remove(entry);
+        tx_queue_->remove(entry, iface_index);
     }
     return res;
 }
 
 uint8_t CanIOManager::makePendingTxMask() const
 {
-    uint8_t write_mask = 0;
-    for (uint8_t i = 0; i < getNumIfaces(); i++)
-    {
-        if (!tx_queues_[i]->isEmpty())
-        {
-            write_mask |= uint8_t(1 << i);
-        }
-    }
-    return write_mask;
+    return tx_queue_->getPendingIfaceMask();
 }
 
 int CanIOManager::callSelect(CanSelectMasks& inout_masks, MonotonicTime blocking_deadline)
@@ -305,11 +989,8 @@ CanIOManager::CanIOManager(ICanDriver& driver, IPoolAllocator& allocator, ISyste
     UAVCAN_TRACE("CanIOManager", "Memory blocks per iface: %u, total: %u",
                  unsigned(mem_blocks_per_iface), unsigned(allocator.getNumBlocks()));
 
-    for (int i = 0; i < num_ifaces_; i++)
-    {
-        tx_queues_[i].construct<IPoolAllocator&, ISystemClock&, std::size_t>
-        (allocator, sysclock, mem_blocks_per_iface);
-    }
+    tx_queue_.construct<IPoolAllocator&, ISystemClock&, std::size_t, std::size_t>
+    (allocator, sysclock, mem_blocks_per_iface * num_ifaces_, mem_blocks_per_iface);
 }
 
 CanIfacePerfCounters CanIOManager::getIfacePerfCounters(uint8_t iface_index) const
@@ -321,24 +1002,44 @@ CanIfacePerfCounters CanIOManager::getIfacePerfCounters(uint8_t iface_index) con
         return CanIfacePerfCounters();
     }
     CanIfacePerfCounters cnt;
-    cnt.errors = iface->getErrorCount() + tx_queues_[iface_index]->getRejectedFrameCount();
+    cnt.errors = iface->getErrorCount() + tx_queue_->getRejectedFrameCount(iface_index);
     cnt.frames_rx = counters_[iface_index].frames_rx;
     cnt.frames_tx = counters_[iface_index].frames_tx;
+    cnt.frames_purged = tx_queue_->getPurgedFrameCount(iface_index);
+    cnt.bus_bits_saved = tx_queue_->getSavedBusBitCount(iface_index);
     return cnt;
 }
 
 int CanIOManager::send(const CanFrame& frame, MonotonicTime tx_deadline, MonotonicTime blocking_deadline,
                        uint8_t iface_mask, CanTxQueue::Qos qos, CanIOFlags flags)
+{
+    return send(SingleCanTxFrameSource(frame), tx_deadline, blocking_deadline, iface_mask, qos, flags);
+}
+
+int CanIOManager::send(const ICanTxFrameSource& source, MonotonicTime tx_deadline, MonotonicTime blocking_deadline,
+                       uint8_t iface_mask, CanTxQueue::Qos qos, CanIOFlags flags)
 {
     const uint8_t num_ifaces = getNumIfaces();
     const uint8_t all_ifaces_mask = uint8_t((1U << num_ifaces) - 1);
     iface_mask &= all_ifaces_mask;
 
+    const unsigned num_frames = source.getNumFrames();
+    if (num_frames == 0)
+    {
+        UAVCAN_ASSERT(0);
+        return -ErrInvalidParam;
+    }
+
     if (blocking_deadline > tx_deadline)
     {
         blocking_deadline = tx_deadline;
     }
 
+    // Ifaces may advance at different pace; the frame is rebuilt only when the required index changes
+    unsigned next_index[MaxCanIfaces] = { 0 };
+    CanFrame frame;
+    unsigned frame_index = num_frames;
+
     int retval = 0;
 
     while (true)
@@ -358,39 +1059,46 @@ int CanIOManager::send(const CanFrame& frame, MonotonicTime tx_deadline, Monoton
             UAVCAN_ASSERT(masks.read == 0);
         }
 
-        // Transmission
+        // Transmission. Every writeable iface takes as many frames as it can without blocking.
         for (uint8_t i = 0; i < num_ifaces; i++)
         {
-            if (masks.write & (1 << i))
+            if (!(masks.write & (1 << i)))
             {
-                int res = 0;
-                if (iface_mask & (1 << i))
+                continue;
+            }
+            if (!(iface_mask & (1 << i)))
+            {
+                if (sendFromTxQueue(i) > 0)
                 {
-                    if (tx_queues_[i]->topPriorityHigherOrEqual(frame))
-                    {
-                        res = sendFromTxQueue(i);                 // May return 0 if nothing to transmit (e.g. expired)
-                    }
-                    if (res <= 0)
-                    {
-                        res = sendToIface(i, frame, tx_deadline, flags);
-                        if (res > 0)
-                        {
-                            iface_mask &= uint8_t(~(1 << i));     // Mark transmitted
-                        }
-                    }
+                    retval++;
                 }
-                else
+                continue;
+            }
+            while (iface_mask & (1 << i))
+            {
+                if (frame_index != next_index[i])
                 {
-                    res = sendFromTxQueue(i);
+                    frame_index = next_index[i];
+                    source.buildFrame(frame_index, frame);
                 }
-                if (res > 0)
+                if (tx_queue_->topPriorityHigherOrEqual(frame, i) && (sendFromTxQueue(i) > 0))
                 {
                     retval++;
+                    continue;
+                }
+                if (sendToIface(i, frame, tx_deadline, flags) <= 0)
+                {
+                    break;                                  // The iface can't take more frames right now
+                }
+                retval++;
+                if (++next_index[i] >= num_frames)
+                {
+                    iface_mask &= uint8_t(~(1 << i));       // Mark transmitted
                 }
             }
         }
 
-        // Timeout. Enqueue the frame if wasn't transmitted and leave.
+        // Timeout. Enqueue the frames that weren't transmitted and leave.
         const bool timed_out = sysclock_.getMonotonic() >= blocking_deadline;
         if (masks.write == 0 || timed_out)
         {
@@ -399,12 +1107,9 @@ int CanIOManager::send(const CanFrame& frame, MonotonicTime tx_deadline, Monoton
                 UAVCAN_TRACE("CanIOManager", "Send: Premature timeout in select(), will try again");
                 continue;
             }
-            for (uint8_t i = 0; i < num_ifaces; i++)
+            if (iface_mask != 0)
             {
-                if (iface_mask & (1 << i))
-                {
-                    tx_queues_[i]->push(frame, tx_deadline, qos, flags);
-                }
+                tx_queue_->push(source, next_index, iface_mask, tx_deadline, qos, flags);
             }
             break;
         }
@@ -414,6 +1119,19 @@ int CanIOManager::send(const CanFrame& frame, MonotonicTime tx_deadline, Monoton
 
 int CanIOManager::receive(CanRxFrame& out_frame, MonotonicTime blocking_deadline, CanIOFlags& out_flags)
 {
+    const int res = receive(&out_frame, 1, blocking_deadline);
+    out_flags = out_frame.flags;
+    return res;
+}
+
+int CanIOManager::receive(CanRxFrame* out_frames, unsigned max_frames, MonotonicTime blocking_deadline)
+{
+    if ((out_frames == NULL) || (max_frames == 0))
+    {
+        UAVCAN_ASSERT(0);
+        return -ErrInvalidParam;
+    }
+
     const uint8_t num_ifaces = getNumIfaces();
 
     while (true)
@@ -438,8 +1156,10 @@ int CanIOManager::receive(CanRxFrame& out_frame, MonotonicTime blocking_deadline
             }
         }
 
-        // Read
-        for (uint8_t i = 0; i < num_ifaces; i++)
+        // Read - every readable iface is drained until the output array is full
+        unsigned num_received = 0;
+        bool driver_failure = false;
+        for (uint8_t i = 0; (i < num_ifaces) && (num_received < max_frames); i++)
         {
             if (masks.read & (1 << i))
             {
@@ -449,20 +1169,39 @@ int CanIOManager::receive(CanRxFrame& out_frame, MonotonicTime blocking_deadline
                     UAVCAN_ASSERT(0);   // Nonexistent interface
                     continue;
                 }
-                const int res = iface->receive(out_frame, out_frame.ts_mono, out_frame.ts_utc, out_flags);
+                CanRxFrame* const burst = out_frames + num_received;
+                const unsigned burst_capacity = min(max_frames - num_received, unsigned(0xFFFFU));
+                const int res = iface->receiveBurst(burst, uint16_t(burst_capacity));
+                if (res < 0)
+                {
+                    driver_failure = true;
+                    continue;
+                }
                 if (res == 0)
                 {
                     UAVCAN_ASSERT(0);   // select() reported that iface has pending RX frames, but receive() returned none
                     continue;
                 }
-                out_frame.iface_index = i;
-                if ((res > 0) && !(out_flags & CanIOFlagLoopback))
+                UAVCAN_ASSERT(unsigned(res) <= burst_capacity);
+                for (int k = 0; k < res; k++)
                 {
-                    counters_[i].frames_rx += 1;
+                    burst[k].iface_index = i;
+                    if (!(burst[k].flags & CanIOFlagLoopback))
+                    {
+                        counters_[i].frames_rx += 1;
+                    }
                 }
-                return (res < 0) ? -ErrDriver : res;
+                num_received += unsigned(res);
             }
         }
+        if (num_received > 0)
+        {
+            return int(num_received);     // Frames that were received before a driver failure are still delivered
+        }
+        if (driver_failure)
+        {
+            return -ErrDriver;
+        }
 
         // Timeout checked in the last order - this way we can operate with expired deadline:
         if (sysclock_.getMonotonic() >= blocking_deadline)
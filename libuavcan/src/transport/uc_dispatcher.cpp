@@ -70,42 +70,98 @@ void LoopbackFrameListenerRegistry::invokeListeners(RxFrame& frame)
 /*
  * Dispatcher::ListenerRegister
  */
-bool Dispatcher::ListenerRegistry::add(TransferListenerBase* listener, Mode mode)
+Dispatcher::ListenerRegistry::ListenerRegistry()
 {
-    if (mode == UniqueListener)
-    {
-        TransferListenerBase* p = list_.get();
-        while (p)
-        {
-            if (p->getDataTypeDescriptor().getID() == listener->getDataTypeDescriptor().getID())
-            {
-                return false;
-            }
-            p = p->getNextListNode();
-        }
-    }
-    // Objective is to arrange entries by Data Type ID in ascending order from root.
-    list_.insertBefore(listener, DataTypeIDInsertionComparator(listener->getDataTypeDescriptor().getID()));
-    return true;
+    fill(bitmap_, bitmap_ + (NumDataTypeIDs / BitmapWordBits), uint32_t(0));
+#if UAVCAN_DISPATCHER_HEAD_TABLE && !UAVCAN_TINY
+    fill(heads_, heads_ + NumDataTypeIDs, static_cast<TransferListenerBase*>(NULL));
+#endif
 }
 
-void Dispatcher::ListenerRegistry::remove(TransferListenerBase* listener)
+void Dispatcher::ListenerRegistry::setBit(DataTypeID dtid, bool value)
 {
-    list_.remove(listener);
+    const uint32_t mask = uint32_t(1) << (dtid.get() % BitmapWordBits);
+    if (value)
+    {
+        bitmap_[dtid.get() / BitmapWordBits] |= mask;
+    }
+    else
+    {
+        bitmap_[dtid.get() / BitmapWordBits] &= ~mask;
+    }
 }
 
-bool Dispatcher::ListenerRegistry::exists(DataTypeID dtid) const
+TransferListenerBase* Dispatcher::ListenerRegistry::findFirst(DataTypeID dtid) const
 {
+    if (!exists(dtid))
+    {
+        return NULL;
+    }
+#if !UAVCAN_DISPATCHER_HEAD_TABLE || UAVCAN_TINY
     TransferListenerBase* p = list_.get();
     while (p)
     {
         if (p->getDataTypeDescriptor().getID() == dtid)
         {
-            return true;
+            return p;
+        }
+        if (p->getDataTypeDescriptor().getID() < dtid)  // Listeners are ordered by data type id!
+        {
+            break;
         }
         p = p->getNextListNode();
     }
-    return false;
+    UAVCAN_ASSERT(0);   // Bitmap is out of sync with the list
+    return NULL;
+#else
+    return heads_[dtid.get()];
+#endif
+}
+
+bool Dispatcher::ListenerRegistry::add(TransferListenerBase* listener, Mode mode)
+{
+    const DataTypeID dtid = listener->getDataTypeDescriptor().getID();
+    if (!dtid.isValid())
+    {
+        UAVCAN_ASSERT(0);
+        return false;
+    }
+    if (mode == UniqueListener && exists(dtid))
+    {
+        return false;
+    }
+    // Objective is to arrange entries by Data Type ID in descending order from root.
+    // Listeners of the same data type are appended to the end of their chain, so the chain head stays the same.
+    list_.insertBefore(listener, DataTypeIDInsertionComparator(dtid));
+#if UAVCAN_DISPATCHER_HEAD_TABLE && !UAVCAN_TINY
+    if (heads_[dtid.get()] == NULL)
+    {
+        heads_[dtid.get()] = listener;
+    }
+#endif
+    setBit(dtid, true);
+    return true;
+}
+
+void Dispatcher::ListenerRegistry::remove(TransferListenerBase* listener)
+{
+    const DataTypeID dtid = listener->getDataTypeDescriptor().getID();
+    if (!exists(dtid))
+    {
+        return;
+    }
+    TransferListenerBase* const first = findFirst(dtid);
+    TransferListenerBase* const next = listener->getNextListNode();
+    list_.remove(listener);
+
+    const bool chain_continues = (next != NULL) && (next->getDataTypeDescriptor().getID() == dtid);
+    if (first == listener)
+    {
+#if UAVCAN_DISPATCHER_HEAD_TABLE && !UAVCAN_TINY
+        heads_[dtid.get()] = chain_continues ? next : NULL;
+#endif
+        setBit(dtid, chain_continues);
+    }
 }
 
 void Dispatcher::ListenerRegistry::cleanup(MonotonicTime ts)
@@ -119,24 +175,52 @@ void Dispatcher::ListenerRegistry::cleanup(MonotonicTime ts)
     }
 }
 
-void Dispatcher::ListenerRegistry::handleFrame(const RxFrame& frame)
+void Dispatcher::ListenerRegistry::cleanup(MonotonicTime ts, DataTypeID dtid)
 {
-    TransferListenerBase* p = list_.get();
-    while (p)
+    TransferListenerBase* p = findFirst(dtid);
+    while ((p != NULL) && (p->getDataTypeDescriptor().getID() == dtid))
     {
         TransferListenerBase* const next = p->getNextListNode();
-        if (p->getDataTypeDescriptor().getID() == frame.getDataTypeID())
-        {
-            p->handleFrame(frame); // p may be modified
-        }
-        else if (p->getDataTypeDescriptor().getID() < frame.getDataTypeID())  // Listeners are ordered by data type id!
+        p->cleanup(ts);
+        p = next;
+    }
+}
+
+int Dispatcher::ListenerRegistry::findNextDataTypeID(int from) const
+{
+    if (from >= int(NumDataTypeIDs))
+    {
+        from = int(NumDataTypeIDs) - 1;
+    }
+    while (from >= 0)
+    {
+        const uint32_t word = bitmap_[unsigned(from) / BitmapWordBits];
+        const unsigned bit = unsigned(from) % BitmapWordBits;
+        // Bits above the current position are masked out; the whole word is skipped if nothing is left
+        const uint32_t masked = word & (uint32_t(0xFFFFFFFFUL) >> (BitmapWordBits - 1U - bit));
+        if (masked == 0)
         {
-            break;
+            from -= int(bit) + 1;
+            continue;
         }
-        else
+        unsigned highest = bit;
+        while ((masked & (uint32_t(1) << highest)) == 0)
         {
-            ;  // Nothing to do with this one
+            highest--;
         }
+        return from - int(bit - highest);
+    }
+    return -1;
+}
+
+void Dispatcher::ListenerRegistry::handleFrame(const RxFrame& frame)
+{
+    const DataTypeID dtid = frame.getDataTypeID();
+    TransferListenerBase* p = findFirst(dtid);
+    while ((p != NULL) && (p->getDataTypeDescriptor().getID() == dtid))
+    {
+        TransferListenerBase* const next = p->getNextListNode();
+        p->handleFrame(frame); // p may be modified
         p = next;
     }
 }
@@ -146,44 +230,61 @@ void Dispatcher::ListenerRegistry::handleFrame(const RxFrame& frame)
  */
 void Dispatcher::handleFrame(const CanRxFrame& can_frame)
 {
-    RxFrame frame;
-    if (!frame.parse(can_frame))
+    /*
+     * Frames that nobody is interested in are dropped before parsing
+     */
+    const CanRxFrameView view(can_frame);
+    if (!view.isUavcanFrame())
     {
         // This is not counted as a transport error
         UAVCAN_TRACE("Dispatcher", "Invalid CAN frame received: %s", can_frame.toString().c_str());
         return;
     }
 
-    if ((frame.getDstNodeID() != NodeID::Broadcast) &&
-        (frame.getDstNodeID() != getNodeID()))
+    const NodeID dst_node_id = view.getDstNodeID();
+    if (!dst_node_id.isBroadcast() && (dst_node_id != getNodeID()))
     {
         return;
     }
 
-    switch (frame.getTransferType())
+    ListenerRegistry* registry = NULL;
+    switch (view.getTransferType())
     {
     case TransferTypeMessageBroadcast:
     case TransferTypeMessageUnicast:
     {
-        lmsg_.handleFrame(frame);
+        registry = &lmsg_;
         break;
     }
     case TransferTypeServiceRequest:
     {
-        lsrv_req_.handleFrame(frame);
+        registry = &lsrv_req_;
         break;
     }
     case TransferTypeServiceResponse:
     {
-        lsrv_resp_.handleFrame(frame);
+        registry = &lsrv_resp_;
         break;
     }
     default:
     {
         UAVCAN_ASSERT(0);
-        break;
+        return;
+    }
+    }
+
+    if (!registry->exists(view.getDataTypeID()))
+    {
+        return;
     }
+
+    RxFrame frame;
+    if (!frame.parse(can_frame))
+    {
+        UAVCAN_TRACE("Dispatcher", "Invalid CAN frame received: %s", can_frame.toString().c_str());
+        return;
     }
+    registry->handleFrame(frame);
 }
 
 void Dispatcher::handleLoopbackFrame(const CanRxFrame& can_frame)
@@ -204,23 +305,22 @@ int Dispatcher::spin(MonotonicTime deadline)
     int num_frames_processed = 0;
     do
     {
-        CanIOFlags flags = 0;
-        CanRxFrame frame;
-        const int res = canio_.receive(frame, deadline, flags);
+        CanRxFrame frames[RxBurstLen];
+        const int res = canio_.receive(frames, RxBurstLen, deadline);
         if (res < 0)
         {
             return res;
         }
-        if (res > 0)
+        for (int i = 0; i < res; i++)
         {
-            if (flags & CanIOFlagLoopback)
+            if (frames[i].flags & CanIOFlagLoopback)
             {
-                handleLoopbackFrame(frame);
+                handleLoopbackFrame(frames[i]);
             }
             else
             {
                 num_frames_processed++;
-                handleFrame(frame);
+                handleFrame(frames[i]);
             }
         }
     }
@@ -248,6 +348,17 @@ int Dispatcher::send(const Frame& frame, MonotonicTime tx_deadline, MonotonicTim
     return canio_.send(can_frame, tx_deadline, blocking_deadline, iface_mask, qos, flags);
 }
 
+int Dispatcher::send(const TransferFrameBuilder& frames, MonotonicTime tx_deadline, MonotonicTime blocking_deadline,
+                     CanTxQueue::Qos qos, CanIOFlags flags, uint8_t iface_mask)
+{
+    if ((frames.getSrcNodeID() != getNodeID()) || !frames.isValid())
+    {
+        UAVCAN_ASSERT(0);
+        return -ErrLogic;
+    }
+    return canio_.send(frames, tx_deadline, blocking_deadline, iface_mask, qos, flags);
+}
+
 void Dispatcher::cleanup(MonotonicTime ts)
 {
     outgoing_transfer_reg_.cleanup(ts);
@@ -256,6 +367,43 @@ void Dispatcher::cleanup(MonotonicTime ts)
     lsrv_resp_.cleanup(ts);
 }
 
+bool Dispatcher::cleanupIncrementally(MonotonicTime ts, MonotonicTime deadline)
+{
+    ListenerRegistry* const registries[] = { &lmsg_, &lsrv_req_, &lsrv_resp_ };
+    enum { NumRegistries = sizeof(registries) / sizeof(registries[0]) };
+
+    do
+    {
+        if (cleanup_stage_ == 0)
+        {
+            outgoing_transfer_reg_.cleanup(ts);
+            cleanup_stage_++;
+        }
+        else
+        {
+            ListenerRegistry& reg = *registries[cleanup_stage_ - 1];
+            const int dtid = reg.findNextDataTypeID(cleanup_next_dtid_);
+            if (dtid >= 0)
+            {
+                reg.cleanup(ts, DataTypeID(uint16_t(dtid)));
+                cleanup_next_dtid_ = int16_t(dtid - 1);
+            }
+            if (dtid <= 0)                                  // This registry is done, proceeding to the next one
+            {
+                cleanup_next_dtid_ = DataTypeID::Max;
+                if (++cleanup_stage_ > NumRegistries)
+                {
+                    cleanup_stage_ = 0;
+                    return true;
+                }
+            }
+        }
+    }
+    while (sysclock_.getMonotonic() < deadline);
+
+    return false;
+}
+
 bool Dispatcher::registerMessageListener(TransferListenerBase* listener)
 {
     if (listener->getDataTypeDescriptor().getKind() != DataTypeKindMessage)
@@ -263,7 +411,13 @@ bool Dispatcher::registerMessageListener(TransferListenerBase* listener)
         UAVCAN_ASSERT(0);
         return false;
     }
-    return lmsg_.add(listener, ListenerRegistry::ManyListeners);       // Multiple subscribers are OK
+    const bool was_listened = lmsg_.exists(listener->getDataTypeDescriptor().getID());
+    const bool res = lmsg_.add(listener, ListenerRegistry::ManyListeners);       // Multiple subscribers are OK
+    if (res && !was_listened)
+    {
+        updateHardwareFilters();
+    }
+    return res;
 }
 
 bool Dispatcher::registerServiceRequestListener(TransferListenerBase* listener)
@@ -273,7 +427,12 @@ bool Dispatcher::registerServiceRequestListener(TransferListenerBase* listener)
         UAVCAN_ASSERT(0);
         return false;
     }
-    return lsrv_req_.add(listener, ListenerRegistry::UniqueListener);  // Only one server per data type
+    const bool res = lsrv_req_.add(listener, ListenerRegistry::UniqueListener);  // Only one server per data type
+    if (res)
+    {
+        updateHardwareFilters();
+    }
+    return res;
 }
 
 bool Dispatcher::registerServiceResponseListener(TransferListenerBase* listener)
@@ -283,17 +442,30 @@ bool Dispatcher::registerServiceResponseListener(TransferListenerBase* listener)
         UAVCAN_ASSERT(0);
         return false;
     }
-    return lsrv_resp_.add(listener, ListenerRegistry::ManyListeners);  // Multiple callers may call same srv
+    // Responses are accepted by a permanent filter, so there's no need to reconfigure anything
+    return lsrv_resp_.add(listener, ListenerRegistry::ManyListeners);    // Multiple callers may call same srv
 }
 
 void Dispatcher::unregisterMessageListener(TransferListenerBase* listener)
 {
+    const DataTypeID dtid = listener->getDataTypeDescriptor().getID();
+    const bool was_listened = lmsg_.exists(dtid);
     lmsg_.remove(listener);
+    if (was_listened && !lmsg_.exists(dtid))
+    {
+        updateHardwareFilters();
+    }
 }
 
 void Dispatcher::unregisterServiceRequestListener(TransferListenerBase* listener)
 {
+    const DataTypeID dtid = listener->getDataTypeDescriptor().getID();
+    const bool was_listened = lsrv_req_.exists(dtid);
     lsrv_req_.remove(listener);
+    if (was_listened && !lsrv_req_.exists(dtid))
+    {
+        updateHardwareFilters();
+    }
 }
 
 void Dispatcher::unregisterServiceResponseListener(TransferListenerBase* listener)
@@ -301,6 +473,89 @@ void Dispatcher::unregisterServiceResponseListener(TransferListenerBase* listene
     lsrv_resp_.remove(listener);
 }
 
+void Dispatcher::fillAcceptanceFilters(CanAcceptanceFilterBuilder& builder) const
+{
+    if (getNodeID().isUnicast())
+    {
+        builder.addSourceNodeFilter(getNodeID());
+        /*
+         * Service response listeners come and go with every call, and reprogramming the hardware that often is
+         * expensive. Hence all responses are accepted by one permanent filter; the destination node ID is
+         * carried in the payload, so the rest is up to the software.
+         */
+        builder.addTransferTypeFilter(TransferTypeServiceResponse);
+    }
+    for (int dtid = lmsg_.findNextDataTypeID(DataTypeID::Max); dtid >= 0; dtid = lmsg_.findNextDataTypeID(dtid - 1))
+    {
+        builder.addMessageFilter(DataTypeID(uint16_t(dtid)));
+    }
+    for (int dtid = lsrv_req_.findNextDataTypeID(DataTypeID::Max); dtid >= 0;
+         dtid = lsrv_req_.findNextDataTypeID(dtid - 1))
+    {
+        builder.addTransferFilter(DataTypeID(uint16_t(dtid)), TransferTypeServiceRequest);
+    }
+}
+
+void Dispatcher::updateHardwareFilters()
+{
+    if (hw_filtering_enabled_)
+    {
+        (void)configureHardwareFilters();
+    }
+}
+
+void Dispatcher::setHardwareFilteringEnabled(bool enabled)
+{
+    hw_filtering_enabled_ = enabled;
+    updateHardwareFilters();
+}
+
+int Dispatcher::configureHardwareFilters()
+{
+    ICanDriver& driver = canio_.getCanDriver();
+    int num_configured = 0;
+    bool failed = false;
+
+    for (uint8_t i = 0; i < canio_.getNumIfaces(); i++)
+    {
+        ICanIface* const iface = driver.getIface(i);
+        if (iface == NULL)
+        {
+            UAVCAN_ASSERT(0);
+            continue;
+        }
+        const unsigned capacity = min(unsigned(iface->getNumFilters()), unsigned(MaxHardwareFilterConfigs));
+        if (capacity == 0)
+        {
+            continue;
+        }
+
+        CanFilterConfig configs[MaxHardwareFilterConfigs];
+        CanAcceptanceFilterBuilder builder(configs, capacity);
+        fillAcceptanceFilters(builder);
+        if (builder.getNumConfigs() == 0)
+        {
+            continue;
+        }
+
+        const int res = iface->configureFilters(configs, uint16_t(builder.getNumConfigs()));
+        if (res < 0)
+        {
+            /*
+             * The previous configuration may be narrower than the current set of listeners, so it can't be left
+             * in place. The next update will try again.
+             */
+            UAVCAN_TRACE("Dispatcher", "Failed to configure filters of iface %i: %i", int(i), res);
+            const CanFilterConfig accept_all = { 0, 0 };
+            (void)iface->configureFilters(&accept_all, 1);
+            failed = true;
+            continue;
+        }
+        num_configured++;
+    }
+    return (failed && (num_configured == 0)) ? -ErrDriver : num_configured;
+}
+
 bool Dispatcher::hasSubscriber(DataTypeID dtid) const
 {
     return lmsg_.exists(dtid);
@@ -323,6 +578,7 @@ bool Dispatcher::setNodeID(NodeID nid)
     {
         self_node_id_ = nid;
         self_node_id_is_set_ = true;
+        updateHardwareFilters();
         return true;
     }
     return false;
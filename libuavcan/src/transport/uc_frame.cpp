@@ -4,6 +4,7 @@
 
 #include <uavcan/transport/frame.hpp>
 #include <uavcan/transport/can_io.hpp>
+#include <uavcan/debug.hpp>
 #include <cassert>
 
 namespace uavcan
@@ -46,12 +47,6 @@ int Frame::setPayload(const uint8_t* data, unsigned len)
     return int(len);
 }
 
-template <int OFFSET, int WIDTH>
-inline static uint32_t bitunpack(uint32_t val)
-{
-    return (val >> OFFSET) & ((1UL << WIDTH) - 1);
-}
-
 bool Frame::parse(const CanFrame& can_frame)
 {
     if (can_frame.isErrorFrame() || can_frame.isRemoteTransmissionRequest() || !can_frame.isExtended())
@@ -69,12 +64,12 @@ bool Frame::parse(const CanFrame& can_frame)
      * CAN ID parsing
      */
     const uint32_t id = can_frame.id & CanFrame::MaskExtID;
-    transfer_id_   = uint8_t(bitunpack<0, 3>(id));
-    last_frame_    = bitunpack<3, 1>(id) != 0;
-    frame_index_   = uint8_t(bitunpack<4, 6>(id));
-    src_node_id_   = uint8_t(bitunpack<10, 7>(id));
-    transfer_type_ = TransferType(bitunpack<17, 2>(id));
-    data_type_id_  = uint16_t(bitunpack<19, 10>(id));
+    transfer_id_   = uint8_t(CanIDTransferID::unpack(id));
+    last_frame_    = CanIDLastFrame::unpack(id) != 0;
+    frame_index_   = uint8_t(CanIDFrameIndex::unpack(id));
+    src_node_id_   = uint8_t(CanIDSrcNodeID::unpack(id));
+    transfer_type_ = TransferType(CanIDTransferType::unpack(id));
+    data_type_id_  = uint16_t(CanIDDataTypeID::unpack(id));
 
     /*
      * CAN payload parsing
@@ -114,12 +109,6 @@ bool Frame::parse(const CanFrame& can_frame)
     return isValid();
 }
 
-template <int OFFSET, int WIDTH>
-inline static uint32_t bitpack(uint32_t field)
-{
-    return uint32_t((field & ((1UL << WIDTH) - 1)) << OFFSET);
-}
-
 bool Frame::compile(CanFrame& out_can_frame) const
 {
     if (!isValid())
@@ -130,12 +119,12 @@ bool Frame::compile(CanFrame& out_can_frame) const
 
     out_can_frame.id =
         CanFrame::FlagEFF |
-        bitpack<0, 3>(transfer_id_.get()) |
-        bitpack<3, 1>(last_frame_) |
-        bitpack<4, 6>(frame_index_) |
-        bitpack<10, 7>(src_node_id_.get()) |
-        bitpack<17, 2>(transfer_type_) |
-        bitpack<19, 10>(data_type_id_.get());
+        CanIDTransferID::pack(transfer_id_.get()) |
+        CanIDLastFrame::pack(last_frame_) |
+        CanIDFrameIndex::pack(frame_index_) |
+        CanIDSrcNodeID::pack(src_node_id_.get()) |
+        CanIDTransferType::pack(transfer_type_) |
+        CanIDDataTypeID::pack(data_type_id_.get());
 
     switch (transfer_type_)
     {
@@ -226,6 +215,96 @@ std::string Frame::toString() const
 }
 #endif
 
+/**
+ * TransferFrameBuilder
+ */
+TransferFrameBuilder::TransferFrameBuilder(DataTypeID data_type_id, TransferType transfer_type, NodeID src_node_id,
+                                           NodeID dst_node_id, TransferID transfer_id, const uint8_t* payload,
+                                           unsigned payload_len, const TransferCRC& crc_base)
+    : payload_(payload)
+    , payload_len_(payload_len)
+    , can_id_template_(0)
+    , crc_(0)
+    , num_frames_(0)
+    , dst_node_id_(0)
+    , frame_payload_capacity_(sizeof(static_cast<CanFrame*>(0)->data))
+{
+    const bool valid =
+        data_type_id.isValid() && src_node_id.isUnicast() && (transfer_type < NumTransferTypes) &&
+        dst_node_id.isValid() && ((transfer_type == TransferTypeMessageBroadcast) == dst_node_id.isBroadcast()) &&
+        (dst_node_id != src_node_id) && ((payload != NULL) || (payload_len == 0));
+    if (!valid)
+    {
+        // Reported via isValid(); the parameters may come from the application, e.g. a unicast destination
+        UAVCAN_TRACE("TransferFrameBuilder", "Invalid parameters: dtid=%i tt=%i snid=%i dnid=%i",
+                     int(data_type_id.get()), int(transfer_type), int(src_node_id.get()), int(dst_node_id.get()));
+        return;
+    }
+
+    can_id_template_ =
+        CanFrame::FlagEFF |
+        CanIDTransferID::pack(transfer_id.get()) |
+        CanIDSrcNodeID::pack(src_node_id.get()) |
+        CanIDTransferType::pack(transfer_type) |
+        CanIDDataTypeID::pack(data_type_id.get());
+
+    if (transfer_type != TransferTypeMessageBroadcast)
+    {
+        dst_node_id_ = dst_node_id.get();
+        frame_payload_capacity_--;
+    }
+
+    unsigned num_frames = 1;
+    if (payload_len > frame_payload_capacity_)
+    {
+        // The first frame loses two bytes to the transfer CRC: 1 + ceil((len - (cap - 2)) / cap)
+        num_frames = 1U + (payload_len + 1U) / frame_payload_capacity_;
+        TransferCRC crc = crc_base;
+        crc.add(payload, payload_len);
+        crc_ = crc.get();
+    }
+    if (num_frames > (unsigned(Frame::MaxIndex) + 1U))
+    {
+        UAVCAN_TRACE("TransferFrameBuilder", "Payload is too long: %u", payload_len);
+        return;
+    }
+    num_frames_ = uint8_t(num_frames);
+}
+
+void TransferFrameBuilder::buildFrame(unsigned index, CanFrame& out_frame) const
+{
+    UAVCAN_ASSERT(index < num_frames_);
+    const bool last = (index + 1U) == num_frames_;
+    out_frame.id = can_id_template_ | CanIDLastFrame::pack(last) | CanIDFrameIndex::pack(index);
+
+    uint8_t* out = out_frame.data;
+    if (dst_node_id_ != 0)
+    {
+        *out++ = dst_node_id_;
+    }
+
+    unsigned offset = 0;
+    unsigned len = frame_payload_capacity_;
+    if (num_frames_ == 1)
+    {
+        len = payload_len_;
+    }
+    else if (index == 0)
+    {
+        *out++ = uint8_t(crc_ & 0xFFU);                  // Transfer CRC, little endian
+        *out++ = uint8_t((crc_ >> 8) & 0xFFU);
+        len -= 2U;
+    }
+    else
+    {
+        offset = unsigned(frame_payload_capacity_) - 2U + (index - 1U) * frame_payload_capacity_;
+        len = min(len, payload_len_ - offset);
+    }
+
+    out = copy(payload_ + offset, payload_ + offset + len, out);
+    out_frame.dlc = uint8_t(out - out_frame.data);
+}
+
 /**
  * RxFrame
  */
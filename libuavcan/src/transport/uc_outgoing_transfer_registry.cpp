@@ -19,4 +19,301 @@ std::string OutgoingTransferRegistryKey::toString() const
 }
 #endif
 
+/*
+ * HashedOutgoingTransferRegistryBase
+ */
+HashedOutgoingTransferRegistryBase::HashedOutgoingTransferRegistryBase(Entry** index, TypeSlot* type_index,
+                                                                       unsigned index_size, Entry* static_buf,
+                                                                       unsigned num_static_entries,
+                                                                       IPoolAllocator& allocator)
+    : index_(index)
+    , type_index_(type_index)
+    , static_(static_buf)
+    , num_static_(num_static_entries)
+    , index_mask_(index_size - 1U)
+    , allocator_(allocator)
+    , overflow_(allocator)
+    , num_entries_(0)
+{
+    UAVCAN_ASSERT((index_size & index_mask_) == 0);
+    fill(index_, index_ + index_size, static_cast<Entry*>(NULL));
+    fill(type_index_, type_index_ + index_size, TypeSlot());
+}
+
+unsigned HashedOutgoingTransferRegistryBase::computeHash(const OutgoingTransferRegistryKey& key)
+{
+    // Fibonacci hashing; the most significant bits are the best mixed ones, so they are moved down
+    const uint32_t x = uint32_t(key.getDataTypeID().get()) |
+                       (uint32_t(key.getTransferType()) << 10) |
+                       (uint32_t(key.getDestinationNodeID().get()) << 12);
+    const uint32_t h = uint32_t(x * 2654435769UL);
+    return unsigned(h ^ (h >> 16));
+}
+
+unsigned HashedOutgoingTransferRegistryBase::computeHash(DataTypeID dtid, TransferType tt)
+{
+    const uint32_t x = uint32_t(dtid.get()) | (uint32_t(tt) << 10);
+    const uint32_t h = uint32_t(x * 2654435769UL);
+    return unsigned(h ^ (h >> 16));
+}
+
+HashedOutgoingTransferRegistryBase::Entry* HashedOutgoingTransferRegistryBase::allocateEntry()
+{
+    for (unsigned i = 0; i < num_static_; i++)
+    {
+        if (static_[i].isFree())
+        {
+            return static_ + i;
+        }
+    }
+    IsDynamicallyAllocatable<Entry>::check();
+    const PoolAllocationTagScope tag_scope(PoolAllocationTagOutgoingTransfers);
+    void* const praw = allocator_.allocate(sizeof(Entry));
+    if (praw == NULL)
+    {
+        return NULL;
+    }
+    return new (praw) Entry();
+}
+
+void HashedOutgoingTransferRegistryBase::destroyEntry(Entry* entry)
+{
+    UAVCAN_ASSERT(entry != NULL);
+    UAVCAN_ASSERT(num_entries_ > 0);
+    num_entries_--;
+    if ((entry >= static_) && (entry < static_ + num_static_))
+    {
+        *entry = Entry();
+    }
+    else
+    {
+        entry->~Entry();
+        allocator_.deallocate(entry);
+    }
+}
+
+HashedOutgoingTransferRegistryBase::TypeSlot*
+HashedOutgoingTransferRegistryBase::findTypeSlot(DataTypeID dtid, TransferType tt, bool create)
+{
+    for (unsigned pos = computeHash(dtid, tt) & index_mask_; true; pos = (pos + 1U) & index_mask_)
+    {
+        TypeSlot& slot = type_index_[pos];
+        if (slot.num_entries == 0)
+        {
+            if (create)
+            {
+                slot.data_type_id = dtid.get();
+                slot.transfer_type = uint8_t(tt);
+                return &slot;
+            }
+            return NULL;
+        }
+        if ((slot.data_type_id == dtid.get()) && (slot.transfer_type == uint8_t(tt)))
+        {
+            return &slot;
+        }
+    }
+}
+
+void HashedOutgoingTransferRegistryBase::removeTypeSlot(unsigned pos)
+{
+    // Backward shift: the following slots of the cluster are moved in place unless that puts them before their home
+    unsigned next = pos;
+    while (true)
+    {
+        next = (next + 1U) & index_mask_;
+        const TypeSlot& slot = type_index_[next];
+        if (slot.num_entries == 0)
+        {
+            break;
+        }
+        const unsigned home = computeHash(DataTypeID(slot.data_type_id), TransferType(slot.transfer_type)) &
+                              index_mask_;
+        if (((next - home) & index_mask_) >= ((next - pos) & index_mask_))
+        {
+            type_index_[pos] = slot;
+            pos = next;
+        }
+    }
+    type_index_[pos] = TypeSlot();
+}
+
+void HashedOutgoingTransferRegistryBase::removeAt(unsigned pos)
+{
+    Entry* const entry = index_[pos];
+    UAVCAN_ASSERT(entry != NULL);
+
+    TypeSlot* const type_slot = findTypeSlot(entry->key.getDataTypeID(), entry->key.getTransferType(), false);
+    UAVCAN_ASSERT((type_slot != NULL) && (type_slot->num_entries > 0));
+    if ((type_slot != NULL) && (--type_slot->num_entries == 0))
+    {
+        removeTypeSlot(unsigned(type_slot - type_index_));
+    }
+
+    // Same backward shift as for the type index
+    unsigned next = pos;
+    while (true)
+    {
+        next = (next + 1U) & index_mask_;
+        Entry* const p = index_[next];
+        if (p == NULL)
+        {
+            break;
+        }
+        const unsigned home = computeHash(p->key) & index_mask_;
+        if (((next - home) & index_mask_) >= ((next - pos) & index_mask_))
+        {
+            index_[pos] = p;
+            pos = next;
+        }
+    }
+    index_[pos] = NULL;
+
+    destroyEntry(entry);
+}
+
+void HashedOutgoingTransferRegistryBase::removeAll()
+{
+    for (unsigned pos = 0; pos <= index_mask_; pos++)
+    {
+        if (index_[pos] != NULL)
+        {
+            destroyEntry(index_[pos]);
+            index_[pos] = NULL;
+        }
+        type_index_[pos] = TypeSlot();
+    }
+    UAVCAN_ASSERT(num_entries_ == 0);
+    overflow_.removeAll();
+}
+
+HashedOutgoingTransferRegistryBase::Entry*
+HashedOutgoingTransferRegistryBase::insertIntoIndex(unsigned pos, const OutgoingTransferRegistryKey& key,
+                                                    MonotonicTime deadline)
+{
+    UAVCAN_ASSERT(index_[pos] == NULL);
+    UAVCAN_ASSERT(num_entries_ < getMaxEntries());
+    Entry* const entry = allocateEntry();
+    if (entry == NULL)
+    {
+        return NULL;
+    }
+    entry->key = key;
+    entry->deadline = deadline;
+    entry->tid = TransferID();
+    index_[pos] = entry;
+    num_entries_++;
+
+    // There are never more types than entries, so the type index can't be full
+    TypeSlot* const type_slot = findTypeSlot(key.getDataTypeID(), key.getTransferType(), true);
+    UAVCAN_ASSERT(type_slot != NULL);
+    type_slot->num_entries++;
+    return entry;
+}
+
+void HashedOutgoingTransferRegistryBase::moveOverflowIntoIndex()
+{
+    while ((num_entries_ < getMaxEntries()) && !overflow_.isEmpty())
+    {
+        const Map<OutgoingTransferRegistryKey, OverflowValue, 0>::KVPair kv = *overflow_.getByIndex(0);
+        unsigned pos = computeHash(kv.key) & index_mask_;
+        while (index_[pos] != NULL)
+        {
+            pos = (pos + 1U) & index_mask_;
+        }
+        Entry* const entry = insertIntoIndex(pos, kv.key, kv.value.deadline);
+        if (entry == NULL)
+        {
+            break;
+        }
+        entry->tid = kv.value.tid;
+        overflow_.remove(kv.key);
+    }
+}
+
+TransferID* HashedOutgoingTransferRegistryBase::accessOrCreate(const OutgoingTransferRegistryKey& key,
+                                                               MonotonicTime new_deadline)
+{
+    UAVCAN_ASSERT(!new_deadline.isZero());
+    unsigned pos = computeHash(key) & index_mask_;
+    while (index_[pos] != NULL)
+    {
+        if (index_[pos]->key == key)
+        {
+            index_[pos]->deadline = new_deadline;
+            return &index_[pos]->tid;
+        }
+        pos = (pos + 1U) & index_mask_;
+    }
+
+    if (!overflow_.isEmpty())
+    {
+        OverflowValue* const value = overflow_.access(key);
+        if (value != NULL)
+        {
+            value->deadline = new_deadline;
+            return &value->tid;
+        }
+    }
+
+    if (num_entries_ >= getMaxEntries())
+    {
+        UAVCAN_TRACE("OutgoingTransferRegistry", "Index is full, overflow %s", key.toString().c_str());
+        const PoolAllocationTagScope tag_scope(PoolAllocationTagOutgoingTransfers);
+        OverflowValue value;
+        value.deadline = new_deadline;
+        OverflowValue* const p = overflow_.insert(key, value);
+        return (p == NULL) ? NULL : &p->tid;
+    }
+
+    Entry* const entry = insertIntoIndex(pos, key, new_deadline);
+    if (entry == NULL)
+    {
+        return NULL;
+    }
+    UAVCAN_TRACE("OutgoingTransferRegistry", "Created %s", key.toString().c_str());
+    return &entry->tid;
+}
+
+bool HashedOutgoingTransferRegistryBase::exists(DataTypeID dtid, TransferType tt) const
+{
+    for (unsigned pos = computeHash(dtid, tt) & index_mask_; true; pos = (pos + 1U) & index_mask_)
+    {
+        const TypeSlot& slot = type_index_[pos];
+        if (slot.num_entries == 0)
+        {
+            break;
+        }
+        if ((slot.data_type_id == dtid.get()) && (slot.transfer_type == uint8_t(tt)))
+        {
+            return true;
+        }
+    }
+    return !overflow_.isEmpty() && (overflow_.findFirstKey(OverflowTypePredicate(dtid, tt)) != NULL);
+}
+
+void HashedOutgoingTransferRegistryBase::cleanup(MonotonicTime ts)
+{
+    unsigned pos = 0;
+    while ((pos <= index_mask_) && (num_entries_ > 0))
+    {
+        const Entry* const entry = index_[pos];
+        if ((entry != NULL) && (entry->deadline <= ts))
+        {
+            UAVCAN_TRACE("OutgoingTransferRegistry", "Expired %s tid=%i",
+                         entry->key.toString().c_str(), int(entry->tid.get()));
+            removeAt(pos);          // The next entry may have been shifted here, so the position stays the same
+        }
+        else
+        {
+            pos++;
+        }
+    }
+    if (!overflow_.isEmpty())
+    {
+        overflow_.removeWhere(OverflowExpiredPredicate(ts));
+        moveOverflowIntoIndex();
+    }
+}
+
 }
@@ -26,6 +26,7 @@ std::string TransferBufferManagerKey::toString() const
 DynamicTransferBufferManagerEntry::Block*
 DynamicTransferBufferManagerEntry::Block::instantiate(IPoolAllocator& allocator)
 {
+    const PoolAllocationTagScope tag_scope(PoolAllocationTagBuffers);
     void* const praw = allocator.allocate(sizeof(Block));
     if (praw == NULL)
     {
@@ -78,6 +79,7 @@ void DynamicTransferBufferManagerEntry::Block::write(const uint8_t*& inptr, unsi
 DynamicTransferBufferManagerEntry* DynamicTransferBufferManagerEntry::instantiate(IPoolAllocator& allocator,
                                                                                   uint16_t max_size)
 {
+    const PoolAllocationTagScope tag_scope(PoolAllocationTagBuffers);
     void* const praw = allocator.allocate(sizeof(DynamicTransferBufferManagerEntry));
     if (praw == NULL)
     {
@@ -75,62 +75,78 @@ int MultiFrameIncomingTransfer::read(unsigned offset, uint8_t* data, unsigned le
 }
 
 /*
- * TransferListenerBase::TimedOutReceiverPredicate
+ * TransferListenerBase
  */
-bool TransferListenerBase::TimedOutReceiverPredicate::operator()(const TransferBufferManagerKey& key,
-                                                                 const TransferReceiver& value) const
+class UnusedIfaceTrackerPredicate
 {
-    if (value.isTimedOut(ts_))
+    ITransferReceiverStore& receivers_;
+
+public:
+    explicit UnusedIfaceTrackerPredicate(ITransferReceiverStore& receivers)
+        : receivers_(receivers)
+    { }
+
+    bool operator()(const TransferBufferManagerKey& key, const TransferReceiverIfaceTracker&) const
     {
-        UAVCAN_TRACE("TransferListener", "Timed out receiver: %s", key.toString().c_str());
-        /*
-         * TransferReceivers do not own their buffers - this helps the Map<> container to copy them
-         * around quickly and safely (using default assignment operator). Downside is that we need to
-         * destroy the buffers manually.
-         * Maybe it is not good that the predicate has side effects, but I ran out of better ideas.
-         */
-        parent_bufmgr_.remove(key);
-        return true;
+        return receivers_.access(key) == NULL;
     }
-    return false;
-}
+};
 
-/*
- * TransferListenerBase
- */
-bool TransferListenerBase::checkPayloadCrc(const uint16_t compare_with, const ITransferBuffer& tbb) const
+TransferReceiverIfaceTracker* TransferListenerBase::accessIfaceTracker(const TransferBufferManagerKey& key,
+                                                                      const TransferReceiver& receiver,
+                                                                      const RxFrame& frame)
 {
-    TransferCRC crc = crc_base_;
-    unsigned offset = 0;
-    while (true)
+    if (reassembly_mode_ != TransferReceiver::ReassemblyCrossIface)
+    {
+        return NULL;
+    }
+    TransferReceiverIfaceTracker* tracker = (iface_trackers_ == NULL) ? NULL : iface_trackers_->access(key);
+    // Sources that are received from one interface only don't need a tracker, since no frames can be recovered
+    if ((tracker == NULL) && receiver.isFromAnotherIface(frame))
     {
-        uint8_t buf[16];
-        const int res = tbb.read(offset, buf, sizeof(buf));
-        if (res < 0)
+        const PoolAllocationTagScope tag_scope(PoolAllocationTagReceivers);
+        if (iface_trackers_ == NULL)
         {
-            UAVCAN_TRACE("TransferListenerBase", "Failed to check CRC: Buffer read failure %i", res);
-            return false;
+            IsDynamicallyAllocatable<IfaceTrackerMap>::check();
+            void* const praw = allocator_.allocate(sizeof(IfaceTrackerMap));
+            if (praw == NULL)
+            {
+                return NULL;
+            }
+            iface_trackers_ = new (praw) IfaceTrackerMap(allocator_);
         }
-        if (res == 0)
+        tracker = iface_trackers_->insert(key, TransferReceiverIfaceTracker());
+        if (tracker != NULL)
         {
-            break;
+            receiver.initIfaceTracker(*tracker);
         }
-        offset += unsigned(res);
-        crc.add(buf, unsigned(res));
     }
-    if (crc.get() != compare_with)
+    return tracker;     // Lost frames are not counted if there's no memory for the tracker
+}
+
+void TransferListenerBase::destroyIfaceTrackers()
+{
+    if (iface_trackers_ != NULL)
     {
-        UAVCAN_TRACE("TransferListenerBase", "CRC mismatch, expected=0x%04x, got=0x%04x",
-                     int(compare_with), int(crc.get()));
-        return false;
+        iface_trackers_->~IfaceTrackerMap();
+        allocator_.deallocate(iface_trackers_);
+        iface_trackers_ = NULL;
     }
-    return true;
 }
 
 void TransferListenerBase::handleReception(TransferReceiver& receiver, const RxFrame& frame,
                                            TransferBufferAccessor& tba)
 {
-    switch (receiver.addFrame(frame, tba))
+    TransferReceiverIfaceTracker* const iface_tracker =
+        accessIfaceTracker(TransferBufferManagerKey(frame.getSrcNodeID(), frame.getTransferType()), receiver, frame);
+    const TransferReceiver::ResultCode result =
+        receiver.addFrame(frame, tba, crc_base_, reassembly_mode_, iface_tracker);
+    if (iface_tracker != NULL)
+    {
+        perf_.addLostFrames(frame.getIfaceIndex(), iface_tracker->yieldLostFrameCount());
+    }
+
+    switch (result)
     {
     case TransferReceiver::ResultNotComplete:
     {
@@ -147,15 +163,21 @@ void TransferListenerBase::handleReception(TransferReceiver& receiver, const RxF
     case TransferReceiver::ResultComplete:
     {
         perf_.addRxTransfer();
-        const ITransferBuffer* tbb = tba.access();
-        if (tbb == NULL)
+        /*
+         * The payload CRC is computed by the receiver as the frames arrive, so there's no need to read the buffer.
+         * Buffers of rejected transfers are released immediately.
+         */
+        if (receiver.getLastTransferComputedCrc() != receiver.getLastTransferCrc())
         {
-            UAVCAN_TRACE("TransferListenerBase", "Buffer access failure, last frame: %s", frame.toString().c_str());
+            UAVCAN_TRACE("TransferListenerBase", "CRC mismatch, expected=0x%04x, got=0x%04x, last frame: %s",
+                         int(receiver.getLastTransferCrc()), int(receiver.getLastTransferComputedCrc()),
+                         frame.toString().c_str());
+            tba.remove();
             break;
         }
-        if (!checkPayloadCrc(receiver.getLastTransferCrc(), *tbb))
+        if (tba.access() == NULL)
         {
-            UAVCAN_TRACE("TransferListenerBase", "CRC error, last frame: %s", frame.toString().c_str());
+            UAVCAN_TRACE("TransferListenerBase", "Buffer access failure, last frame: %s", frame.toString().c_str());
             break;
         }
         MultiFrameIncomingTransfer it(receiver.getLastTransferTimestampMonotonic(),
@@ -174,8 +196,16 @@ void TransferListenerBase::handleReception(TransferReceiver& receiver, const RxF
 
 void TransferListenerBase::cleanup(MonotonicTime ts)
 {
-    receivers_.removeWhere(TimedOutReceiverPredicate(ts, bufmgr_));
+    receivers_.removeTimedOut(ts, bufmgr_);
     UAVCAN_ASSERT(receivers_.isEmpty() ? bufmgr_.isEmpty() : 1);
+    if (iface_trackers_ != NULL)
+    {
+        iface_trackers_->removeWhere(UnusedIfaceTrackerPredicate(receivers_));
+        if (iface_trackers_->isEmpty())
+        {
+            destroyIfaceTrackers();
+        }
+    }
 }
 
 void TransferListenerBase::handleFrame(const RxFrame& frame)
@@ -190,8 +220,7 @@ void TransferListenerBase::handleFrame(const RxFrame& frame)
             return;
         }
 
-        TransferReceiver new_recv;
-        recv = receivers_.insert(key, new_recv);
+        recv = receivers_.create(key);
         if (recv == NULL)
         {
             UAVCAN_TRACE("TransferListener", "Receiver registration failed; frame %s", frame.toString().c_str());
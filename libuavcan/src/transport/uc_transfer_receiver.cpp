@@ -15,7 +15,86 @@ const uint32_t TransferReceiver::MinTransferIntervalUSec;
 const uint32_t TransferReceiver::MaxTransferIntervalUSec;
 const uint32_t TransferReceiver::DefaultTransferIntervalUSec;
 const uint8_t TransferReceiver::IfaceIndexNotSet;
+const uint16_t TransferReceiverIfaceTracker::ProgressValid;
+const unsigned TransferReceiverIfaceTracker::ProgressTidShift;
+const unsigned TransferReceiverIfaceTracker::ProgressIndexMask;
 
+/*
+ * TransferReceiverIfaceTracker
+ */
+void TransferReceiverIfaceTracker::registerLostFrames(unsigned num)
+{
+    lost_frame_cnt_ = uint8_t(min(unsigned(lost_frame_cnt_) + num, 0xFFU));
+}
+
+void TransferReceiverIfaceTracker::reset()
+{
+    fill(progress_, progress_ + MaxCanIfaces, uint16_t(0));
+    last_num_frames_ = 0;
+}
+
+void TransferReceiverIfaceTracker::setProgress(uint8_t iface_index, TransferID tid, unsigned next_frame_index)
+{
+    if (iface_index >= MaxCanIfaces)
+    {
+        UAVCAN_ASSERT(0);
+        return;
+    }
+    progress_[iface_index] = uint16_t(ProgressValid |
+                                      (unsigned(tid.get()) << ProgressTidShift) |
+                                      (next_frame_index & ProgressIndexMask));
+}
+
+void TransferReceiverIfaceTracker::track(const RxFrame& frame)
+{
+    const uint8_t iface = frame.getIfaceIndex();
+    if (iface >= MaxCanIfaces)
+    {
+        UAVCAN_ASSERT(0);
+        return;
+    }
+    const uint16_t progress = progress_[iface];
+    if (progress & ProgressValid)
+    {
+        const TransferID tid(uint8_t((progress >> ProgressTidShift) & TransferID::Max));
+        const unsigned next_index = progress & ProgressIndexMask;
+        if (tid == frame.getTransferID())
+        {
+            if (frame.getIndex() > next_index)
+            {
+                registerLostFrames(frame.getIndex() - next_index);
+            }
+        }
+        else
+        {
+            // The tail of the previous transfer is known only if that transfer was completed.
+            // Transfers that were missed completely are not accounted for.
+            if ((tid == last_tid_) && (next_index < last_num_frames_))
+            {
+                registerLostFrames(last_num_frames_ - next_index);
+            }
+            registerLostFrames(frame.getIndex());
+        }
+    }
+    setProgress(iface, frame.getTransferID(), frame.getIndex() + 1U);
+}
+
+void TransferReceiverIfaceTracker::registerCompletedTransfer(TransferID tid, uint8_t num_frames)
+{
+    last_tid_ = tid;
+    last_num_frames_ = num_frames;
+}
+
+uint8_t TransferReceiverIfaceTracker::yieldLostFrameCount()
+{
+    const uint8_t ret = lost_frame_cnt_;
+    lost_frame_cnt_ = 0;
+    return ret;
+}
+
+/*
+ * TransferReceiver
+ */
 void TransferReceiver::registerError() const
 {
     if (error_cnt_ < 0xFF)
@@ -28,6 +107,12 @@ void TransferReceiver::registerError() const
     }
 }
 
+bool TransferReceiver::isDuplicate(const RxFrame& frame) const
+{
+    const TidRelation tid_rel = getTidRelation(frame);
+    return (tid_rel == TidRepeat) || ((tid_rel == TidSame) && (frame.getIndex() < next_frame_index_));
+}
+
 TransferReceiver::TidRelation TransferReceiver::getTidRelation(const RxFrame& frame) const
 {
     const int distance = tid_.computeForwardDistance(frame.getTransferID());
@@ -65,9 +150,24 @@ void TransferReceiver::prepareForNextTransfer()
     buffer_write_pos_ = 0;
 }
 
-bool TransferReceiver::validate(const RxFrame& frame) const
+bool TransferReceiver::validate(const RxFrame& frame, ReassemblyMode mode) const
 {
-    if (iface_index_ != frame.getIfaceIndex())
+    if (mode == ReassemblyCrossIface)
+    {
+        if (isDuplicate(frame))
+        {
+            return false;
+        }
+        if ((frame.getIndex() > next_frame_index_) && (getTidRelation(frame) == TidSame))
+        {
+            return false;           // Lost frame on this iface, its twin may still arrive from another iface
+        }
+        if ((next_frame_index_ > 0) && (getTidRelation(frame) == TidFuture))
+        {
+            return false;           // This iface is ahead, another one may still complete the current transfer
+        }
+    }
+    else if (iface_index_ != frame.getIfaceIndex())
     {
         return false;
     }
@@ -119,6 +219,7 @@ bool TransferReceiver::writePayload(const RxFrame& frame, ITransferBuffer& buf)
         if (success)
         {
             buffer_write_pos_ = static_cast<uint16_t>(buffer_write_pos_ + effective_payload_len);
+            computed_crc_.add(payload + TransferCRC::NumBytes, effective_payload_len);
         }
         return success;
     }
@@ -129,18 +230,21 @@ bool TransferReceiver::writePayload(const RxFrame& frame, ITransferBuffer& buf)
         if (success)
         {
             buffer_write_pos_ = static_cast<uint16_t>(buffer_write_pos_ + payload_len);
+            computed_crc_.add(payload, payload_len);
         }
         return success;
     }
 }
 
-TransferReceiver::ResultCode TransferReceiver::receive(const RxFrame& frame, TransferBufferAccessor& tba)
+TransferReceiver::ResultCode TransferReceiver::receive(const RxFrame& frame, TransferBufferAccessor& tba,
+                                                      const TransferCRC& crc_base)
 {
     // Transfer timestamps are derived from the first frame
     if (frame.isFirst())
     {
         this_transfer_ts_ = frame.getMonotonicTimestamp();
         first_frame_ts_   = frame.getUtcTimestamp();
+        computed_crc_     = crc_base;
     }
 
     if (frame.isFirst() && frame.isLast())
@@ -194,7 +298,9 @@ bool TransferReceiver::isTimedOut(MonotonicTime current_ts) const
     return (current_ts - this_transfer_ts_).toUSec() > (int64_t(transfer_interval_usec_) * INTERVAL_MULT);
 }
 
-TransferReceiver::ResultCode TransferReceiver::addFrame(const RxFrame& frame, TransferBufferAccessor& tba)
+TransferReceiver::ResultCode TransferReceiver::addFrame(const RxFrame& frame, TransferBufferAccessor& tba,
+                                                       const TransferCRC& crc_base, ReassemblyMode mode,
+                                                       TransferReceiverIfaceTracker* iface_tracker)
 {
     if ((frame.getMonotonicTimestamp().isZero()) ||
         (frame.getMonotonicTimestamp() < prev_transfer_ts_) ||
@@ -205,7 +311,9 @@ TransferReceiver::ResultCode TransferReceiver::addFrame(const RxFrame& frame, Tr
 
     const bool not_initialized = !isInitialized();
     const bool receiver_timed_out = isTimedOut(frame.getMonotonicTimestamp());
-    const bool same_iface = frame.getIfaceIndex() == iface_index_;
+    // In cross iface mode, every iface is the same one unless there's a transfer in progress
+    const bool same_iface = (mode == ReassemblyCrossIface) ? (next_frame_index_ == 0) :
+                            (frame.getIfaceIndex() == iface_index_);
     const bool first_fame = frame.isFirst();
     const TidRelation tid_rel = getTidRelation(frame);
     const bool iface_timed_out =
@@ -235,18 +343,41 @@ TransferReceiver::ResultCode TransferReceiver::addFrame(const RxFrame& frame, Tr
         next_frame_index_ = 0;
         buffer_write_pos_ = 0;
         this_transfer_crc_ = 0;
+        if ((mode == ReassemblyCrossIface) && (iface_tracker != NULL))
+        {
+            iface_tracker->reset();
+            iface_tracker->track(frame);
+        }
         if (!first_fame)
         {
             tid_.increment();
             return ResultNotComplete;
         }
     }
+    else if ((mode == ReassemblyCrossIface) && (iface_tracker != NULL))
+    {
+        iface_tracker->track(frame);
+    }
 
-    if (!validate(frame))
+    if (!validate(frame, mode))
     {
         return ResultNotComplete;
     }
-    return receive(frame, tba);
+    const ResultCode result = receive(frame, tba, crc_base);
+    if ((result != ResultNotComplete) && (iface_tracker != NULL))
+    {
+        iface_tracker->registerCompletedTransfer(frame.getTransferID(), uint8_t(frame.getIndex() + 1U));
+    }
+    return result;
+}
+
+void TransferReceiver::initIfaceTracker(TransferReceiverIfaceTracker& tracker) const
+{
+    tracker.reset();
+    if (isInitialized() && (next_frame_index_ > 0))
+    {
+        tracker.setProgress(iface_index_, tid_, next_frame_index_);
+    }
 }
 
 uint8_t TransferReceiver::yieldErrorCount()
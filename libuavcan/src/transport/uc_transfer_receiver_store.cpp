@@ -0,0 +1,160 @@
+/*
+ * Copyright (C) 2014 Pavel Kirienko <pavel.kirienko@gmail.com>
+ */
+
+#include <uavcan/transport/transfer_receiver_store.hpp>
+#include <uavcan/debug.hpp>
+#include <cassert>
+
+namespace uavcan
+{
+/*
+ * TimedOutTransferReceiverPredicate
+ */
+bool TimedOutTransferReceiverPredicate::operator()(const TransferBufferManagerKey& key,
+                                                   const TransferReceiver& value) const
+{
+    if (value.isTimedOut(ts_))
+    {
+        UAVCAN_TRACE("TransferListener", "Timed out receiver: %s", key.toString().c_str());
+        /*
+         * TransferReceivers do not own their buffers - this helps the Map<> container to copy them
+         * around quickly and safely (using default assignment operator). Downside is that we need to
+         * destroy the buffers manually.
+         * Maybe it is not good that the predicate has side effects, but I ran out of better ideas.
+         */
+        parent_bufmgr_.remove(key);
+        return true;
+    }
+    return false;
+}
+
+/*
+ * TransferReceiverTableBase
+ */
+TransferReceiverTableBase::TransferReceiverTableBase(Entry* static_buf, unsigned num_static_entries,
+                                                     IPoolAllocator& allocator)
+    : static_(static_buf)
+    , num_static_(num_static_entries)
+    , allocator_(allocator)
+    , num_entries_(0)
+{
+    fill(index_, index_ + IndexSize, static_cast<Entry*>(NULL));
+}
+
+TransferReceiverTableBase::Entry* TransferReceiverTableBase::allocateEntry()
+{
+    for (unsigned i = 0; i < num_static_; i++)
+    {
+        if (static_[i].isFree())
+        {
+            return static_ + i;
+        }
+    }
+    IsDynamicallyAllocatable<Entry>::check();
+    const PoolAllocationTagScope tag_scope(PoolAllocationTagReceivers);
+    void* const praw = allocator_.allocate(sizeof(Entry));
+    if (praw == NULL)
+    {
+        return NULL;
+    }
+    return new (praw) Entry();
+}
+
+void TransferReceiverTableBase::destroyEntry(Entry* entry)
+{
+    UAVCAN_ASSERT(entry != NULL);
+    UAVCAN_ASSERT(num_entries_ > 0);
+    num_entries_--;
+    if ((entry >= static_) && (entry < static_ + num_static_))
+    {
+        *entry = Entry();
+    }
+    else
+    {
+        entry->~Entry();
+        allocator_.deallocate(entry);
+    }
+}
+
+TransferReceiver* TransferReceiverTableBase::access(const TransferBufferManagerKey& key)
+{
+    const uint8_t node_id = key.getNodeID().get();
+    if (node_id >= IndexSize)
+    {
+        UAVCAN_ASSERT(0);
+        return NULL;
+    }
+    for (Entry* p = index_[node_id]; p != NULL; p = p->next)
+    {
+        if (p->transfer_type == key.getTransferType())
+        {
+            return &p->receiver;
+        }
+    }
+    return NULL;
+}
+
+TransferReceiver* TransferReceiverTableBase::create(const TransferBufferManagerKey& key)
+{
+    const uint8_t node_id = key.getNodeID().get();
+    if (node_id >= IndexSize)
+    {
+        UAVCAN_ASSERT(0);
+        return NULL;
+    }
+    UAVCAN_ASSERT(access(key) == NULL);
+
+    Entry* const entry = allocateEntry();
+    if (entry == NULL)
+    {
+        return NULL;
+    }
+    entry->transfer_type = uint8_t(key.getTransferType());
+    entry->next = index_[node_id];
+    index_[node_id] = entry;
+    num_entries_++;
+    return &entry->receiver;
+}
+
+void TransferReceiverTableBase::removeTimedOut(MonotonicTime ts, ITransferBufferManager& bufmgr)
+{
+    for (unsigned node_id = 0; (node_id < IndexSize) && (num_entries_ > 0); node_id++)
+    {
+        Entry** pp = index_ + node_id;
+        while (*pp != NULL)
+        {
+            Entry* const p = *pp;
+            if (p->receiver.isTimedOut(ts))
+            {
+                const TransferBufferManagerKey key(NodeID(uint8_t(node_id)), TransferType(p->transfer_type));
+                UAVCAN_TRACE("TransferListener", "Timed out receiver: %s", key.toString().c_str());
+                bufmgr.remove(key);         // Receivers don't own their buffers
+                *pp = p->next;
+                destroyEntry(p);
+            }
+            else
+            {
+                pp = &p->next;
+            }
+        }
+    }
+}
+
+void TransferReceiverTableBase::removeAll()
+{
+    for (unsigned node_id = 0; (node_id < IndexSize) && (num_entries_ > 0); node_id++)
+    {
+        Entry* p = index_[node_id];
+        index_[node_id] = NULL;
+        while (p != NULL)
+        {
+            Entry* const next = p->next;
+            destroyEntry(p);
+            p = next;
+        }
+    }
+    UAVCAN_ASSERT(num_entries_ == 0);
+}
+
+}
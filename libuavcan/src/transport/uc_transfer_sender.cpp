@@ -26,84 +26,27 @@ int TransferSender::send(const uint8_t* payload, unsigned payload_len, Monotonic
 
     dispatcher_.getTransferPerfCounter().addTxTransfer();
 
-    Frame frame(data_type_.getID(), transfer_type, dispatcher_.getNodeID(), dst_node_id, 0, tid);
+    // Frames are built on demand straight from the payload, and the whole transfer is passed down at once
+    const TransferFrameBuilder frames(data_type_.getID(), transfer_type, dispatcher_.getNodeID(), dst_node_id, tid,
+                                      payload, payload_len, crc_base_);
+    if (!frames.isValid())
+    {
+        UAVCAN_TRACE("TransferSender", "Invalid transfer, payload len %u", payload_len);
+        registerError();
+        return -ErrLogic;
+    }
 
-    if (frame.getMaxPayloadLen() >= int(payload_len))           // Single Frame Transfer
+    const int send_res = dispatcher_.send(frames, tx_deadline, blocking_deadline, qos_, flags_, iface_mask_);
+    if (!frames.isMultiFrame())
     {
-        const int res = frame.setPayload(payload, payload_len);
-        if (res != int(payload_len))
-        {
-            UAVCAN_ASSERT(0);
-            UAVCAN_TRACE("TransferSender", "Frame payload write failure, %i", res);
-            registerError();
-            return (res < 0) ? res : -ErrLogic;
-        }
-        frame.makeLast();
-        UAVCAN_ASSERT(frame.isLast() && frame.isFirst());
-        return dispatcher_.send(frame, tx_deadline, blocking_deadline, qos_, flags_, iface_mask_);
+        return send_res;
     }
-    else                                                   // Multi Frame Transfer
+    if (send_res < 0)
     {
-        int offset = 0;
-        {
-            TransferCRC crc = crc_base_;
-            crc.add(payload, payload_len);
-
-            static const int BUFLEN = sizeof(static_cast<CanFrame*>(0)->data);
-            uint8_t buf[BUFLEN];
-
-            buf[0] = uint8_t(crc.get() & 0xFFU);       // Transfer CRC, little endian
-            buf[1] = uint8_t((crc.get() >> 8) & 0xFF);
-            (void)copy(payload, payload + BUFLEN - 2, buf + 2);
-
-            const int write_res = frame.setPayload(buf, BUFLEN);
-            if (write_res < 2)
-            {
-                UAVCAN_TRACE("TransferSender", "Frame payload write failure, %i", write_res);
-                registerError();
-                return write_res;
-            }
-            offset = write_res - 2;
-            UAVCAN_ASSERT(int(payload_len) > offset);
-        }
-
-        int next_frame_index = 1;
-
-        while (true)
-        {
-            const int send_res = dispatcher_.send(frame, tx_deadline, blocking_deadline, qos_, flags_, iface_mask_);
-            if (send_res < 0)
-            {
-                registerError();
-                return send_res;
-            }
-
-            if (frame.isLast())
-            {
-                return next_frame_index;  // Number of frames transmitted
-            }
-            frame.setIndex(next_frame_index++);
-
-            UAVCAN_ASSERT(offset >= 0);
-            const int write_res = frame.setPayload(payload + offset, payload_len - unsigned(offset));
-            if (write_res < 0)
-            {
-                UAVCAN_TRACE("TransferSender", "Frame payload write failure, %i", write_res);
-                registerError();
-                return write_res;
-            }
-
-            offset += write_res;
-            UAVCAN_ASSERT(offset <= int(payload_len));
-            if (offset >= int(payload_len))
-            {
-                frame.makeLast();
-            }
-        }
+        registerError();
+        return send_res;
     }
-
-    UAVCAN_ASSERT(0);
-    return -ErrLogic; // Return path analysis is apparently broken. There should be no warning, this 'return' is unreachable.
+    return int(frames.getNumFrames());  // Number of frames transmitted
 }
 
 int TransferSender::send(const uint8_t* payload, unsigned payload_len, MonotonicTime tx_deadline,
@@ -6,24 +6,51 @@
 
 namespace uavcan
 {
+#if UAVCAN_POOL_ALLOCATION_TAGS
+/*
+ * PoolAllocationTagScope
+ */
+UAVCAN_POOL_ALLOCATION_TAG_STORAGE PoolAllocationTag PoolAllocationTagScope::current_ = PoolAllocationTagUnattributed;
+
+const char* PoolAllocationTagScope::getTagName(PoolAllocationTag tag)
+{
+    static const char* const Names[NumPoolAllocationTags] =
+    {
+        "unattributed",
+        "tx_queue",
+        "receivers",
+        "buffers",
+        "outgoing_transfers",
+        "map"
+    };
+    return (tag < NumPoolAllocationTags) ? Names[tag] : "?";
+}
+#endif
+
 /*
  * LimitedPoolAllocator
  */
 void* LimitedPoolAllocator::allocate(std::size_t size)
 {
-    if (used_blocks_ < max_blocks_)
+    if (used_blocks_ >= max_blocks_)
     {
-        used_blocks_++;
-        return allocator_.allocate(size);
+        return NULL;
     }
-    else
+    void* const pmem = allocator_.allocate(size);
+    if (pmem != NULL)
     {
-        return NULL;
+        used_blocks_++;
+        peak_used_blocks_ = max(peak_used_blocks_, used_blocks_);
     }
+    return pmem;
 }
 
 void LimitedPoolAllocator::deallocate(const void* ptr)
 {
+    if (ptr == NULL)
+    {
+        return;
+    }
     allocator_.deallocate(ptr);
 
     UAVCAN_ASSERT(used_blocks_ > 0);
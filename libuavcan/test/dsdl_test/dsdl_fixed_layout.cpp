@@ -0,0 +1,155 @@
+/*
+ * Copyright (C) 2014 Pavel Kirienko <pavel.kirienko@gmail.com>
+ */
+
+#include <cstdlib>
+#include <limits>
+#include <gtest/gtest.h>
+#include <uavcan/transport/transfer_buffer.hpp>
+#include <root_ns_a/A.hpp>
+#include <root_ns_a/NestedMessage.hpp>
+#include <uavcan/protocol/NodeStatus.hpp>
+#include <uavcan/protocol/GlobalTimeSync.hpp>
+#include <uavcan/protocol/RestartNode.hpp>
+#include <uavcan/equipment/esc/Status.hpp>
+#include <uavcan/equipment/air_data/StaticPressure.hpp>
+#include <uavcan/equipment/camera_gimbal/AngularCommand.hpp>
+#include <uavcan/equipment/power/CircuitStatus.hpp>
+
+typedef uavcan::StaticTransferBuffer<uavcan::MaxTransferPayloadLen + 4> PayloadBuffer;
+
+static const uint8_t PrefixPattern[] = { 0xA5, 0x5A };
+
+/**
+ * Encodes the object after a few prefix bits, which allows to test unaligned (i.e. nested) placement.
+ */
+template <typename T>
+static std::string encode(const T& obj, unsigned prefix_bitlen, bool fixed_layout)
+{
+    PayloadBuffer buf;
+    uavcan::BitStream bs(buf);
+    uavcan::ScalarCodec sc(bs);
+    if (prefix_bitlen > 0)
+    {
+        EXPECT_EQ(1, bs.write(PrefixPattern, prefix_bitlen));
+    }
+    EXPECT_EQ(1, fixed_layout ? T::encode(obj, sc) : T::encodeFieldByField(obj, sc));
+    return bs.toString();
+}
+
+template <typename T>
+static T decode(const uint8_t* data, unsigned len, unsigned prefix_bitlen, bool fixed_layout)
+{
+    PayloadBuffer buf;
+    EXPECT_EQ(int(len), buf.write(0, data, len));
+    uavcan::BitStream bs(buf);
+    uavcan::ScalarCodec sc(bs);
+    if (prefix_bitlen > 0)
+    {
+        uint8_t prefix[sizeof(PrefixPattern)];
+        EXPECT_EQ(1, bs.read(prefix, prefix_bitlen));
+    }
+    T obj;
+    EXPECT_EQ(1, fixed_layout ? T::decode(obj, sc) : T::decodeFieldByField(obj, sc));
+    return obj;
+}
+
+/**
+ * Random payloads are decoded with both codecs, then both results are encoded with both codecs.
+ * All four outputs must be bit exact; comparison is done on the encoded form because of NaNs.
+ */
+template <typename T>
+static void crossCheck(const char* name)
+{
+    enum { PayloadLen = uavcan::BitLenToByteLen<T::MaxBitLen>::Result + sizeof(PrefixPattern) };
+    static const unsigned PrefixBitLens[] = { 0, 3, 8, 13 };
+
+    for (unsigned iteration = 0; iteration < 1000; iteration++)
+    {
+        uint8_t payload[PayloadLen];
+        for (unsigned i = 0; i < PayloadLen; i++)
+        {
+            payload[i] = uint8_t(std::rand());
+        }
+        const unsigned prefix_bitlen = PrefixBitLens[iteration % (sizeof(PrefixBitLens) / sizeof(PrefixBitLens[0]))];
+
+        const T generic = decode<T>(payload, PayloadLen, prefix_bitlen, false);
+        const T fixed = decode<T>(payload, PayloadLen, prefix_bitlen, true);
+
+        const std::string reference = encode(generic, prefix_bitlen, false);
+        ASSERT_EQ(reference, encode(generic, prefix_bitlen, true)) << name;
+        ASSERT_EQ(reference, encode(fixed, prefix_bitlen, false)) << name;
+        ASSERT_EQ(reference, encode(fixed, prefix_bitlen, true)) << name;
+    }
+}
+
+TEST(DsdlFixedLayout, CrossCheck)
+{
+    std::srand(42);
+    crossCheck<root_ns_a::A>("root_ns_a.A");
+    crossCheck<root_ns_a::NestedMessage>("root_ns_a.NestedMessage");
+    crossCheck<uavcan::protocol::NodeStatus>("uavcan.protocol.NodeStatus");
+    crossCheck<uavcan::protocol::GlobalTimeSync>("uavcan.protocol.GlobalTimeSync");
+    crossCheck<uavcan::protocol::RestartNode::Request>("uavcan.protocol.RestartNode.Request");
+    crossCheck<uavcan::protocol::RestartNode::Response>("uavcan.protocol.RestartNode.Response");
+    crossCheck<uavcan::equipment::esc::Status>("uavcan.equipment.esc.Status");
+    crossCheck<uavcan::equipment::air_data::StaticPressure>("uavcan.equipment.air_data.StaticPressure");
+    crossCheck<uavcan::equipment::camera_gimbal::AngularCommand>("uavcan.equipment.camera_gimbal.AngularCommand");
+    crossCheck<uavcan::equipment::power::CircuitStatus>("uavcan.equipment.power.CircuitStatus");
+}
+
+TEST(DsdlFixedLayout, CastModes)
+{
+    uavcan::protocol::NodeStatus ns;
+    ns.uptime_sec = 0xFFFFFFFF;             // uint28, saturated
+    ns.status_code = 0xFF;                  // uint4, saturated
+    ns.vendor_specific_status_code = 0x1234;
+    ASSERT_EQ(encode(ns, 0, false), encode(ns, 0, true));
+    ASSERT_EQ("11111111 11111111 11111111 11111111 00110100 00010010", encode(ns, 0, true));
+
+    uavcan::equipment::esc::Status esc;
+    esc.error_count = 0xDEADBEEF;
+    esc.voltage = 1e6F;                     // float16, saturated
+    esc.current = -1e6F;
+    esc.temperature = std::numeric_limits<float>::infinity();
+    esc.rpm = -300000;                      // int18, saturated
+    esc.power_rating_pct = 255;             // uint7, saturated
+    esc.esc_index = 31;
+    for (unsigned prefix = 0; prefix < 8; prefix++)
+    {
+        ASSERT_EQ(encode(esc, prefix, false), encode(esc, prefix, true));
+    }
+
+    uint8_t payload[uavcan::BitLenToByteLen<uavcan::equipment::esc::Status::MaxBitLen>::Result] = { };
+    {
+        PayloadBuffer buf;
+        uavcan::BitStream bs(buf);
+        uavcan::ScalarCodec sc(bs);
+        ASSERT_EQ(1, uavcan::equipment::esc::Status::encode(esc, sc));
+        ASSERT_EQ(int(sizeof(payload)), buf.read(0, payload, sizeof(payload)));
+    }
+    const uavcan::equipment::esc::Status decoded =
+        decode<uavcan::equipment::esc::Status>(payload, sizeof(payload), 0, true);
+    ASSERT_EQ(0xDEADBEEF, decoded.error_count);
+    ASSERT_FLOAT_EQ(65504.0F, decoded.voltage);
+    ASSERT_FLOAT_EQ(-65504.0F, decoded.current);
+    ASSERT_EQ(-131072, decoded.rpm);
+    ASSERT_EQ(127, decoded.power_rating_pct);
+    ASSERT_EQ(31, decoded.esc_index);
+}
+
+TEST(DsdlFixedLayout, OutOfBuffer)
+{
+    uavcan::protocol::NodeStatus ns;
+    ns.uptime_sec = 123;
+
+    uavcan::StaticTransferBuffer<5> buf;    // NodeStatus needs 6 bytes
+    uavcan::BitStream bs_wr(buf);
+    uavcan::ScalarCodec sc_wr(bs_wr);
+    ASSERT_EQ(0, uavcan::protocol::NodeStatus::encode(ns, sc_wr));
+
+    uavcan::BitStream bs_rd(buf);
+    uavcan::ScalarCodec sc_rd(bs_rd);
+    ASSERT_EQ(0, uavcan::protocol::NodeStatus::decode(ns, sc_rd));
+    ASSERT_EQ(123, ns.uptime_sec);          // Not modified
+}
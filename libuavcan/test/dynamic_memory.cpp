@@ -3,7 +3,10 @@
  */
 
 #include <gtest/gtest.h>
+#include <pthread.h>
 #include <uavcan/dynamic_memory.hpp>
+#include <uavcan/util/map.hpp>
+#include <uavcan/transport/transfer_buffer.hpp>
 
 TEST(DynamicMemory, Basic)
 {
@@ -120,3 +123,234 @@ TEST(DynamicMemory, LimitedPoolAllocator)
     EXPECT_TRUE(ptr5);
     EXPECT_FALSE(ptr6);
 }
+
+TEST(DynamicMemory, UsageCounters)
+{
+    uavcan::PoolAllocator<128, 32> pool32;
+    uavcan::LimitedPoolAllocator lim(pool32, 3);
+
+    EXPECT_EQ(0, pool32.getPeakNumUsedBlocks());
+
+    const void* ptr1 = lim.allocate(1);
+    const void* ptr2 = lim.allocate(1);
+    const void* ptr3 = pool32.allocate(1);      // Bypassing the limiter
+    EXPECT_TRUE(ptr1);
+    EXPECT_TRUE(ptr2);
+    EXPECT_TRUE(ptr3);
+    EXPECT_EQ(3, pool32.getNumUsedBlocks());
+    EXPECT_EQ(1, pool32.getNumFreeBlocks());
+    EXPECT_EQ(2, lim.getNumUsedBlocks());
+
+    const void* ptr4 = lim.allocate(1);
+    EXPECT_TRUE(ptr4);
+    EXPECT_FALSE(lim.allocate(1));              // The underlying pool is exhausted
+    EXPECT_EQ(3, lim.getNumUsedBlocks());       // Failed allocation must not be counted
+    EXPECT_EQ(3, lim.getPeakNumUsedBlocks());
+    EXPECT_EQ(4, pool32.getPeakNumUsedBlocks());
+
+    lim.deallocate(ptr1);
+    lim.deallocate(ptr2);
+    lim.deallocate(NULL);
+    pool32.deallocate(ptr3);
+    EXPECT_EQ(1, lim.getNumUsedBlocks());
+    EXPECT_EQ(3, lim.getPeakNumUsedBlocks());
+    EXPECT_EQ(1, pool32.getNumUsedBlocks());
+    EXPECT_EQ(3, pool32.getNumFreeBlocks());
+    EXPECT_EQ(4, pool32.getPeakNumUsedBlocks());
+
+    lim.resetPeakNumUsedBlocks();
+    pool32.resetPeakNumUsedBlocks();
+    EXPECT_EQ(1, lim.getPeakNumUsedBlocks());
+    EXPECT_EQ(1, pool32.getPeakNumUsedBlocks());
+
+    lim.deallocate(ptr4);
+    EXPECT_EQ(0, lim.getNumUsedBlocks());
+    EXPECT_EQ(0, pool32.getNumUsedBlocks());
+    EXPECT_EQ(1, pool32.getPeakNumUsedBlocks());
+}
+
+TEST(DynamicMemory, IndexedPoolManager)
+{
+    uavcan::PoolAllocator<64, 16> pool16;
+    uavcan::PoolAllocator<64, 32> pool32;
+    uavcan::PoolAllocator<128, 64> pool64;
+    uavcan::PoolAllocator<256, 128> pool128;
+    uavcan::LimitedPoolAllocator lim128(pool128, 2);       // Doesn't report its address range
+
+    uavcan::IndexedPoolManager<4> poolmgr;
+    EXPECT_FALSE(poolmgr.allocate(1));                      // No pools yet
+    EXPECT_TRUE(poolmgr.addPool(&pool64));                  // Order of insertion shall not matter
+    EXPECT_TRUE(poolmgr.addPool(&lim128));
+    EXPECT_TRUE(poolmgr.addPool(&pool16));
+    EXPECT_TRUE(poolmgr.addPool(&pool32));
+    EXPECT_FALSE(poolmgr.addPool(&pool128));                // No space left
+
+    EXPECT_EQ(4 + 2 + 2 + 2, poolmgr.getNumBlocks());
+    EXPECT_EQ(0, poolmgr.getBlockSize());
+
+    /*
+     * Size classes
+     */
+    const void* ptr16 = poolmgr.allocate(0);
+    const void* ptr17 = poolmgr.allocate(17);
+    const void* ptr33 = poolmgr.allocate(33);
+    const void* ptr65 = poolmgr.allocate(65);
+    EXPECT_TRUE(pool16.isInPool(ptr16));
+    EXPECT_TRUE(pool32.isInPool(ptr17));
+    EXPECT_TRUE(pool64.isInPool(ptr33));
+    EXPECT_TRUE(pool128.isInPool(ptr65));
+    EXPECT_FALSE(poolmgr.allocate(129));
+    EXPECT_TRUE(poolmgr.isInPool(ptr65));
+    EXPECT_FALSE(poolmgr.isInPool(&pool16));
+
+    /*
+     * Exhaustion falls back to larger classes
+     */
+    const void* ptrs[3] = { };
+    for (int i = 0; i < 3; i++)
+    {
+        ptrs[i] = poolmgr.allocate(20);
+        ASSERT_TRUE(ptrs[i]);
+    }
+    EXPECT_EQ(2, pool32.getNumUsedBlocks());
+    EXPECT_EQ(2, pool64.getNumUsedBlocks());
+    EXPECT_EQ(2, lim128.getNumUsedBlocks());
+    EXPECT_FALSE(poolmgr.allocate(20));                     // Limited by the LimitedPoolAllocator
+
+    /*
+     * Deallocation is routed to the owner, including the pool without the address range
+     */
+    poolmgr.deallocate(ptr65);
+    EXPECT_EQ(1, lim128.getNumUsedBlocks());
+    poolmgr.deallocate(ptr16);
+    poolmgr.deallocate(ptr17);
+    poolmgr.deallocate(ptr33);
+    poolmgr.deallocate(NULL);
+    for (int i = 0; i < 3; i++)
+    {
+        poolmgr.deallocate(ptrs[i]);
+    }
+    EXPECT_EQ(0, pool16.getNumUsedBlocks());
+    EXPECT_EQ(0, pool32.getNumUsedBlocks());
+    EXPECT_EQ(0, pool64.getNumUsedBlocks());
+    EXPECT_EQ(0, pool128.getNumUsedBlocks());
+    EXPECT_EQ(0, lim128.getNumUsedBlocks());
+}
+
+#if UAVCAN_POOL_ALLOCATION_TAGS
+
+TEST(DynamicMemory, AllocationTags)
+{
+    using uavcan::PoolAllocationTagScope;
+
+    uavcan::PoolAllocator<uavcan::MemPoolBlockSize * 8, uavcan::MemPoolBlockSize> pool;
+
+    const void* app = pool.allocate(1);
+    const void* txq = NULL;
+    const void* buf = NULL;
+    {
+        PoolAllocationTagScope outer(uavcan::PoolAllocationTagTxQueue);
+        txq = pool.allocate(1);
+        {
+            PoolAllocationTagScope inner(uavcan::PoolAllocationTagBuffers);             // Innermost wins
+            buf = pool.allocate(1);
+            PoolAllocationTagScope weak(uavcan::PoolAllocationTagMap, false);           // Owner takes precedence
+            EXPECT_EQ(uavcan::PoolAllocationTagBuffers, PoolAllocationTagScope::getCurrent());
+        }
+        EXPECT_EQ(uavcan::PoolAllocationTagTxQueue, PoolAllocationTagScope::getCurrent());
+    }
+    EXPECT_EQ(uavcan::PoolAllocationTagUnattributed, PoolAllocationTagScope::getCurrent());
+
+    EXPECT_EQ(1, pool.getNumUsedBlocks(uavcan::PoolAllocationTagUnattributed));
+    EXPECT_EQ(1, pool.getNumUsedBlocks(uavcan::PoolAllocationTagTxQueue));
+    EXPECT_EQ(1, pool.getNumUsedBlocks(uavcan::PoolAllocationTagBuffers));
+    EXPECT_EQ(0, pool.getNumUsedBlocks(uavcan::PoolAllocationTagMap));
+
+    // Deallocation is attributed to the owner regardless of the current scope
+    {
+        PoolAllocationTagScope scope(uavcan::PoolAllocationTagReceivers);
+        pool.deallocate(txq);
+    }
+    pool.deallocate(buf);
+    EXPECT_EQ(0, pool.getNumUsedBlocks(uavcan::PoolAllocationTagTxQueue));
+    EXPECT_EQ(1, pool.getPeakNumUsedBlocks(uavcan::PoolAllocationTagTxQueue));
+    EXPECT_EQ(0, pool.getNumUsedBlocks(uavcan::PoolAllocationTagBuffers));
+    EXPECT_EQ(0, pool.getNumUsedBlocks(uavcan::PoolAllocationTagReceivers));
+
+    /*
+     * Map<> groups are attributed to the map unless the owner claims them
+     */
+    {
+        uavcan::Map<int, int, 0> map(pool);
+        ASSERT_TRUE(map.insert(1, 1));
+        EXPECT_EQ(1, pool.getNumUsedBlocks(uavcan::PoolAllocationTagMap));
+        {
+            PoolAllocationTagScope scope(uavcan::PoolAllocationTagOutgoingTransfers);
+            uavcan::Map<int, int, 0> owned_map(pool);
+            ASSERT_TRUE(owned_map.insert(1, 1));
+            EXPECT_EQ(1, pool.getNumUsedBlocks(uavcan::PoolAllocationTagOutgoingTransfers));
+        }
+        EXPECT_EQ(0, pool.getNumUsedBlocks(uavcan::PoolAllocationTagOutgoingTransfers));
+    }
+
+    /*
+     * Transfer buffers are tagged by the library
+     */
+    {
+        uavcan::TransferBufferManager<256, 0> mgr(pool);
+        const uavcan::TransferBufferManagerKey key(1, uavcan::TransferTypeMessageBroadcast);
+        uavcan::ITransferBuffer* const tbb = mgr.create(key);
+        ASSERT_TRUE(tbb);
+        const uint8_t data[100] = { };
+        ASSERT_EQ(100, tbb->write(0, data, 100));
+        EXPECT_LT(1, pool.getNumUsedBlocks(uavcan::PoolAllocationTagBuffers));
+    }
+    EXPECT_EQ(0, pool.getNumUsedBlocks(uavcan::PoolAllocationTagBuffers));
+    EXPECT_EQ(1, pool.getNumUsedBlocks());
+
+    // Every block is attributed to exactly one tag
+    unsigned total_used = 0;
+    for (int i = 0; i < uavcan::NumPoolAllocationTags; i++)
+    {
+        const uavcan::PoolAllocationTag tag = uavcan::PoolAllocationTag(i);
+        EXPECT_TRUE(PoolAllocationTagScope::getTagName(tag));
+        EXPECT_LE(pool.getNumUsedBlocks(tag), pool.getPeakNumUsedBlocks(tag));
+        total_used += pool.getNumUsedBlocks(tag);
+    }
+    EXPECT_EQ(pool.getNumUsedBlocks(), total_used);
+    EXPECT_EQ(1, pool.getNumUsedBlocks(uavcan::PoolAllocationTagUnattributed));
+    EXPECT_EQ(1, pool.getPeakNumUsedBlocks(uavcan::PoolAllocationTagUnattributed));
+    EXPECT_EQ(1, pool.getPeakNumUsedBlocks(uavcan::PoolAllocationTagTxQueue));
+    EXPECT_EQ(0, pool.getPeakNumUsedBlocks(uavcan::PoolAllocationTagReceivers));
+    EXPECT_LT(1, pool.getPeakNumUsedBlocks(uavcan::PoolAllocationTagBuffers));
+    EXPECT_EQ(1, pool.getPeakNumUsedBlocks(uavcan::PoolAllocationTagOutgoingTransfers));
+    EXPECT_EQ(1, pool.getPeakNumUsedBlocks(uavcan::PoolAllocationTagMap));
+    EXPECT_STREQ("tx_queue", PoolAllocationTagScope::getTagName(uavcan::PoolAllocationTagTxQueue));
+
+    pool.deallocate(app);
+    EXPECT_EQ(0, pool.getNumUsedBlocks());
+}
+
+static void* getCurrentTagInThread(void*)
+{
+    static uavcan::PoolAllocationTag tag = uavcan::NumPoolAllocationTags;
+    tag = uavcan::PoolAllocationTagScope::getCurrent();
+    return &tag;
+}
+
+TEST(DynamicMemory, AllocationTagsPerThread)
+{
+    uavcan::PoolAllocationTagScope scope(uavcan::PoolAllocationTagTxQueue);
+
+    pthread_t thread;
+    ASSERT_EQ(0, pthread_create(&thread, NULL, &getCurrentTagInThread, NULL));
+    void* result = NULL;
+    ASSERT_EQ(0, pthread_join(thread, &result));
+    ASSERT_TRUE(result);
+
+    // The scope of this thread must not leak into the other one
+    EXPECT_EQ(uavcan::PoolAllocationTagUnattributed, *static_cast<uavcan::PoolAllocationTag*>(result));
+    EXPECT_EQ(uavcan::PoolAllocationTagTxQueue, uavcan::PoolAllocationTagScope::getCurrent());
+}
+
+#endif
@@ -589,6 +589,85 @@ TEST(Array, TailArrayOptimizationErrors)
 }
 
 
+template <unsigned PrefixBitLen>
+static void testByteArrayBulk(const uavcan::TailArrayOptimizationMode tao_mode)
+{
+    typedef Array<IntegerSpec<8, SignednessUnsigned, CastModeSaturate>, ArrayModeDynamic, 400> A;
+    typedef IntegerSpec<9, SignednessUnsigned, CastModeSaturate> LenType;
+    const bool tao = tao_mode == uavcan::TailArrayOptEnabled;
+
+    A a;
+    for (unsigned i = 0; i < 321; i++)
+    {
+        a.push_back(uint8_t(i * 7));
+    }
+
+    // Reference encoding, element by element
+    uavcan::StaticTransferBuffer<512> buf_ref;
+    {
+        uavcan::BitStream bs(buf_ref);
+        uavcan::ScalarCodec sc(bs);
+        ASSERT_EQ(1, sc.encode<PrefixBitLen>(uint8_t(1)));
+        if (!tao)
+        {
+            ASSERT_EQ(1, LenType::encode(uint16_t(a.size()), sc, uavcan::TailArrayOptDisabled));
+        }
+        for (A::SizeType i = 0; i < a.size(); i++)
+        {
+            ASSERT_EQ(1, sc.encode<8>(a[i]));
+        }
+    }
+
+    uavcan::StaticTransferBuffer<512> buf;
+    {
+        uavcan::BitStream bs(buf);
+        uavcan::ScalarCodec sc(bs);
+        ASSERT_EQ(1, sc.encode<PrefixBitLen>(uint8_t(1)));
+        ASSERT_EQ(1, A::encode(a, sc, tao_mode));
+        ASSERT_EQ(uavcan::BitStream(buf_ref).toString(), bs.toString());
+    }
+    {
+        uavcan::BitStream bs(buf);
+        uavcan::ScalarCodec sc(bs);
+        uint8_t prefix = 0;
+        ASSERT_EQ(1, sc.decode<PrefixBitLen>(prefix));
+        A a2;
+        a2.push_back(42);   // Garbage
+        ASSERT_EQ(1, A::decode(a2, sc, tao_mode));
+        ASSERT_TRUE(a == a2);
+    }
+}
+
+TEST(Array, ByteArrayBulk)
+{
+    testByteArrayBulk<8>(uavcan::TailArrayOptEnabled);
+    testByteArrayBulk<8>(uavcan::TailArrayOptDisabled);
+    testByteArrayBulk<7>(uavcan::TailArrayOptEnabled);      // Length is 9 bit, so 7 + 9 is byte aligned again
+    testByteArrayBulk<7>(uavcan::TailArrayOptDisabled);
+    testByteArrayBulk<3>(uavcan::TailArrayOptEnabled);
+    testByteArrayBulk<3>(uavcan::TailArrayOptDisabled);
+
+    // Static arrays
+    typedef Array<IntegerSpec<8, SignednessSigned, CastModeTruncate>, ArrayModeStatic, 20> S;
+    S s;
+    for (S::SizeType i = 0; i < s.size(); i++)
+    {
+        s[i] = int8_t(int(i) * 13 - 100);
+    }
+    uavcan::StaticTransferBuffer<S::MaxBitLen / 8> buf;
+    uavcan::BitStream bs_wr(buf);
+    uavcan::ScalarCodec sc_wr(bs_wr);
+    ASSERT_EQ(1, S::encode(s, sc_wr, uavcan::TailArrayOptEnabled));
+    ASSERT_EQ(0, S::encode(s, sc_wr, uavcan::TailArrayOptEnabled));    // Out of buffer
+
+    uavcan::BitStream bs_rd(buf);
+    uavcan::ScalarCodec sc_rd(bs_rd);
+    S s2;
+    ASSERT_EQ(1, S::decode(s2, sc_rd, uavcan::TailArrayOptEnabled));
+    ASSERT_TRUE(s == s2);
+    ASSERT_EQ(0, S::decode(s2, sc_rd, uavcan::TailArrayOptEnabled));
+}
+
 TEST(Array, DynamicEncodeDecodeErrors)
 {
     typedef CustomType2<Array<Array<IntegerSpec<8, SignednessUnsigned, CastModeSaturate>,
@@ -0,0 +1,122 @@
+/*
+ * Copyright (C) 2014 Pavel Kirienko <pavel.kirienko@gmail.com>
+ */
+
+#include <cstdlib>
+#include <algorithm>
+#include <gtest/gtest.h>
+#include <uavcan/marshal/bit_stream.hpp>
+
+#if !UAVCAN_TINY
+
+static const unsigned MaxBytes = 64;
+static const unsigned Padding = 4;
+
+/**
+ * Reference implementation, one bit at a time.
+ */
+static void copyBitByBit(const uint8_t* src, unsigned src_offset, unsigned len, uint8_t* dst, unsigned dst_offset)
+{
+    for (unsigned i = 0; i < len; i++)
+    {
+        const unsigned s = src_offset + i;
+        const unsigned d = dst_offset + i;
+        const bool bit = (src[s / 8] >> (7 - (s % 8))) & 1;
+        if (bit)
+        {
+            dst[d / 8] = uint8_t(dst[d / 8] | (1U << (7 - (d % 8))));
+        }
+        else
+        {
+            dst[d / 8] = uint8_t(dst[d / 8] & ~(1U << (7 - (d % 8))));
+        }
+    }
+}
+
+static void fillRandom(uint8_t* data, unsigned len)
+{
+    for (unsigned i = 0; i < len; i++)
+    {
+        data[i] = uint8_t(std::rand());
+    }
+}
+
+template <typename Word>
+static void testAlignedToUnaligned()
+{
+    for (unsigned iteration = 0; iteration < 20000; iteration++)
+    {
+        const unsigned dst_offset = unsigned(std::rand()) % 64U;
+        const unsigned len = unsigned(std::rand()) % (MaxBytes * 8U - 64U);
+
+        // Padding is needed by the byte algorithm, which may read one byte past the data
+        uint8_t src[MaxBytes + Padding];
+        fillRandom(src, sizeof(src));
+
+        uint8_t dst_word[MaxBytes + Padding];
+        fillRandom(dst_word, sizeof(dst_word));
+        uint8_t dst_byte[MaxBytes + Padding];
+        uint8_t dst_ref[MaxBytes + Padding];
+        std::copy(dst_word, dst_word + sizeof(dst_word), dst_byte);
+        std::copy(dst_word, dst_word + sizeof(dst_word), dst_ref);
+
+        uavcan::bitarrayCopyAlignedToUnalignedImpl<Word>(src, len, dst_word, dst_offset);
+        uavcan::bitarrayCopy(src, 0, len, dst_byte, dst_offset);
+        copyBitByBit(src, 0, len, dst_ref, dst_offset);
+
+        ASSERT_TRUE(std::equal(dst_ref, dst_ref + sizeof(dst_ref), dst_word)) << dst_offset << " " << len;
+        ASSERT_TRUE(std::equal(dst_ref, dst_ref + sizeof(dst_ref), dst_byte)) << dst_offset << " " << len;
+    }
+}
+
+template <typename Word>
+static void testUnalignedToAligned()
+{
+    for (unsigned iteration = 0; iteration < 20000; iteration++)
+    {
+        const unsigned src_offset = unsigned(std::rand()) % 64U;
+        const unsigned len = unsigned(std::rand()) % (MaxBytes * 8U - 64U);
+
+        uint8_t src[MaxBytes + Padding];
+        fillRandom(src, sizeof(src));
+
+        uint8_t dst_word[MaxBytes + Padding];
+        fillRandom(dst_word, sizeof(dst_word));
+        uint8_t dst_byte[MaxBytes + Padding];
+        uint8_t dst_ref[MaxBytes + Padding];
+        std::copy(dst_word, dst_word + sizeof(dst_word), dst_byte);
+        std::copy(dst_word, dst_word + sizeof(dst_word), dst_ref);
+
+        uavcan::bitarrayCopyUnalignedToAlignedImpl<Word>(src, src_offset, len, dst_word);
+        uavcan::bitarrayCopy(src, src_offset, len, dst_byte, 0);
+        copyBitByBit(src, src_offset, len, dst_ref, 0);
+
+        ASSERT_TRUE(std::equal(dst_ref, dst_ref + sizeof(dst_ref), dst_word)) << src_offset << " " << len;
+        ASSERT_TRUE(std::equal(dst_ref, dst_ref + sizeof(dst_ref), dst_byte)) << src_offset << " " << len;
+    }
+}
+
+TEST(BitArrayCopy, RandomizedAgainstByteAlgorithm)
+{
+    std::srand(1234);
+    testAlignedToUnaligned<uint32_t>();
+    testAlignedToUnaligned<uint64_t>();
+    testUnalignedToAligned<uint32_t>();
+    testUnalignedToAligned<uint64_t>();
+}
+
+TEST(BitArrayCopy, NativeWord)
+{
+    const uint8_t src[] = { 0xDE, 0xAD, 0xBE, 0xEF, 0x12, 0x34, 0x56, 0x78, 0x9A };
+    uint8_t dst[sizeof(src) + 1] = { };
+
+    uavcan::bitarrayCopyAlignedToUnaligned(src, 72, dst, 4);
+    const uint8_t expected[] = { 0x0D, 0xEA, 0xDB, 0xEE, 0xF1, 0x23, 0x45, 0x67, 0x89, 0xA0 };
+    ASSERT_TRUE(std::equal(expected, expected + sizeof(expected), dst));
+
+    uint8_t readback[sizeof(src)] = { };
+    uavcan::bitarrayCopyUnalignedToAligned(dst, 4, 72, readback);
+    ASSERT_TRUE(std::equal(src, src + sizeof(src), readback));
+}
+
+#endif
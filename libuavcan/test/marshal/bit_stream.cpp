@@ -2,6 +2,7 @@
  * Copyright (C) 2014 Pavel Kirienko <pavel.kirienko@gmail.com>
  */
 
+#include <algorithm>
 #include <gtest/gtest.h>
 #include <uavcan/marshal/bit_stream.hpp>
 #include <uavcan/transport/transfer_buffer.hpp>
@@ -192,3 +193,75 @@ TEST(BitStream, BitByBit)
     ASSERT_EQ(0, bs_wr.read(dummy_data_rd, 1));
     ASSERT_EQ(0xFF, dummy_data_rd[0]);
 }
+
+
+TEST(BitStream, BulkBytes)
+{
+    static const unsigned NumBytes = 100;
+    uint8_t data[NumBytes];
+    for (unsigned i = 0; i < NumBytes; i++)
+    {
+        data[i] = uint8_t(i * 37 + 11);
+    }
+
+    // Bulk access at every bit offset must produce the same bits as the bit-by-bit access
+    for (unsigned offset = 0; offset < 8; offset++)
+    {
+        uavcan::StaticTransferBuffer<NumBytes + 1> buf_bulk;
+        uavcan::StaticTransferBuffer<NumBytes + 1> buf_ref;
+        uavcan::BitStream bs_bulk(buf_bulk);
+        uavcan::BitStream bs_ref(buf_ref);
+
+        const uint8_t prefix[] = { 0xA5 };
+        if (offset > 0)
+        {
+            ASSERT_EQ(1, bs_bulk.write(prefix, offset));
+            ASSERT_EQ(1, bs_ref.write(prefix, offset));
+        }
+        ASSERT_EQ(offset == 0, bs_bulk.isByteAligned());
+
+        ASSERT_EQ(1, bs_bulk.writeBytes(data, NumBytes));
+        for (unsigned i = 0; i < NumBytes * 8; i++)
+        {
+            const uint8_t bit[] = { uint8_t((data[i / 8] << (i % 8)) & 0x80) };
+            ASSERT_EQ(1, bs_ref.write(bit, 1));
+        }
+        ASSERT_EQ(bs_ref.toString(), bs_bulk.toString());
+
+        uavcan::BitStream bs_rd(buf_bulk);
+        uint8_t readback[NumBytes] = { };
+        uint8_t prefix_readback[1] = { };
+        if (offset > 0)
+        {
+            ASSERT_EQ(1, bs_rd.read(prefix_readback, offset));
+        }
+        ASSERT_EQ(1, bs_rd.readBytes(readback, NumBytes));
+        ASSERT_TRUE(std::equal(data, data + NumBytes, readback));
+
+        // Nothing was written past the data
+        uint8_t extra[2] = { };
+        ASSERT_EQ(0, bs_rd.readBytes(extra, 2));
+    }
+}
+
+
+TEST(BitStream, AlignedOutOfBuffer)
+{
+    const uint8_t data[] = { 1, 2, 3, 4, 5 };
+    uavcan::StaticTransferBuffer<4> buf;
+    uavcan::BitStream bs_wr(buf);
+
+    ASSERT_EQ(1, bs_wr.write(data, 16));
+    ASSERT_EQ(0, bs_wr.writeBytes(data, 3));        // Only 2 bytes left
+    ASSERT_EQ(1, bs_wr.writeBytes(data + 2, 2));
+    ASSERT_EQ("00000001 00000010 00000011 00000100", bs_wr.toString());
+
+    uavcan::BitStream bs_rd(buf);
+    uint8_t readback[5] = { };
+    ASSERT_EQ(1, bs_rd.read(readback, 8));
+    ASSERT_EQ(0, bs_rd.readBytes(readback, 4));
+    ASSERT_EQ(3, bs_rd.readRemainingBytes(readback, 5));
+    ASSERT_EQ(2, readback[0]);
+    ASSERT_EQ(4, readback[2]);
+    ASSERT_EQ(0, bs_rd.readRemainingBytes(readback, 5));
+}
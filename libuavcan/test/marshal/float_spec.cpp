@@ -2,6 +2,9 @@
  * Copyright (C) 2014 Pavel Kirienko <pavel.kirienko@gmail.com>
  */
 
+#include <cstdlib>
+#include <iostream>
+#include <vector>
 #include <gtest/gtest.h>
 #include <limits>
 #include <uavcan/marshal/types.hpp>
@@ -182,3 +185,193 @@ TEST(FloatSpec, Float16Representation)
 
     ASSERT_EQ(Reference, bs_wr.toString());
 }
+
+
+static uint32_t floatBits(float value)
+{
+    return uavcan::IEEE754Converter::toIeee<32>(value);
+}
+
+static float floatFromBits(uint32_t bits)
+{
+    return uavcan::IEEE754Converter::toNative<32>(bits);
+}
+
+/**
+ * Float32 bit patterns around every rounding point of every exponent, plus random mantissas.
+ */
+static std::vector<float> makeFloat16TestValues()
+{
+    std::vector<float> out;
+    for (uint32_t sign_exp = 0; sign_exp < 512; sign_exp++)
+    {
+        const uint32_t base = sign_exp << 23;
+        for (unsigned shift = 13; shift <= 24; shift++)
+        {
+            const uint32_t half = 1U << (shift - 1);
+            const uint32_t upper = (uint32_t(std::rand()) << shift) & 0x7FFFFFU;
+            const uint32_t lows[] = { 0, 1, half - 1, half, half + 1, (half << 1) - 1 };
+            for (unsigned i = 0; i < sizeof(lows) / sizeof(lows[0]); i++)
+            {
+                out.push_back(floatFromBits(base | upper | (lows[i] & 0x7FFFFFU)));
+                out.push_back(floatFromBits(base | (0x7FFFFFU & ~((half << 1) - 1)) | (lows[i] & 0x7FFFFFU)));
+            }
+        }
+        for (unsigned i = 0; i < 64; i++)
+        {
+            out.push_back(floatFromBits(base | (uint32_t(std::rand()) & 0x7FFFFFU)));
+        }
+    }
+    return out;
+}
+
+TEST(FloatSpec, Float16KernelsBitExact)
+{
+    using uavcan::IEEE754Converter;
+    std::srand(16);
+
+    /*
+     * Float32 -> float16, scalar and bulk
+     */
+    const std::vector<float> floats = makeFloat16TestValues();
+    std::vector<uint16_t> bulk_halves(floats.size());
+    IEEE754Converter::nativeToHalf(&floats[0], &bulk_halves[0], unsigned(floats.size()));
+    for (unsigned i = 0; i < floats.size(); i++)
+    {
+        const uint16_t reference = IEEE754Converter::nativeNonIeeeToHalf(floats[i]);
+        ASSERT_EQ(reference, IEEE754Converter::nativeToHalf(floats[i])) << std::hex << floatBits(floats[i]);
+        ASSERT_EQ(reference, bulk_halves[i]) << std::hex << floatBits(floats[i]);
+    }
+
+    /*
+     * Float16 -> float32, exhaustive
+     */
+    std::vector<uint16_t> halves(0x10000);
+    for (unsigned i = 0; i < halves.size(); i++)
+    {
+        halves[i] = uint16_t(i);
+    }
+    std::vector<float> bulk_floats(halves.size());
+    IEEE754Converter::halfToNative(&halves[0], &bulk_floats[0], unsigned(halves.size()));
+    for (unsigned i = 0; i < halves.size(); i++)
+    {
+        const uint32_t reference = floatBits(IEEE754Converter::halfToNativeNonIeee(halves[i]));
+        ASSERT_EQ(reference, floatBits(IEEE754Converter::halfToNative(halves[i]))) << std::hex << i;
+        ASSERT_EQ(reference, floatBits(bulk_floats[i])) << std::hex << i;
+    }
+
+    /*
+     * Bulk conversion of short unaligned arrays
+     */
+    for (unsigned offset = 0; offset < 4; offset++)
+    {
+        for (unsigned len = 0; len < 12; len++)
+        {
+            uint16_t out_halves[16] = { };
+            IEEE754Converter::nativeToHalf(&floats[100 + offset], out_halves + offset, len);
+            float out_floats[16] = { };
+            IEEE754Converter::halfToNative(&halves[0x7BF0 + offset], out_floats + offset, len);
+            for (unsigned i = 0; i < 16; i++)
+            {
+                const bool inside = (i >= offset) && (i < offset + len);
+                ASSERT_EQ(inside ? IEEE754Converter::nativeNonIeeeToHalf(floats[100 + i]) : 0, out_halves[i]);
+                ASSERT_EQ(inside ? floatBits(IEEE754Converter::halfToNativeNonIeee(halves[0x7BF0 + i])) : 0,
+                          floatBits(out_floats[i]));
+            }
+        }
+    }
+}
+
+/**
+ * Bulk array codec against the element by element encoding, at every bit offset, followed by decoding.
+ */
+template <typename F16>
+static void checkFloat16ArrayCodec(const std::vector<float>& values)
+{
+    typedef uavcan::Array<F16, uavcan::ArrayModeStatic, 37> StaticArray;
+    typedef uavcan::Array<F16, uavcan::ArrayModeDynamic, 37> DynamicArray;
+    static const uint8_t Prefix = 0xA5;
+
+    for (unsigned prefix_bitlen = 0; prefix_bitlen < 8; prefix_bitlen++)
+    {
+        const unsigned first = unsigned(std::rand()) % unsigned(values.size() - StaticArray::MaxSize);
+
+        StaticArray static_array;
+        DynamicArray dynamic_array;
+        for (uint8_t i = 0; i < StaticArray::MaxSize; i++)
+        {
+            static_array[i] = values.at(first + i);
+            dynamic_array.push_back(values.at(first + StaticArray::MaxSize - 1 - i));
+        }
+
+        uavcan::StaticTransferBuffer<200> buf;
+        uavcan::BitStream bs(buf);
+        uavcan::ScalarCodec sc(bs);
+        ASSERT_EQ(1, sc.encodeBits(&Prefix, prefix_bitlen));
+        ASSERT_EQ(1, StaticArray::encode(static_array, sc, uavcan::TailArrayOptDisabled));
+        ASSERT_EQ(1, DynamicArray::encode(dynamic_array, sc, uavcan::TailArrayOptDisabled));
+
+        uavcan::StaticTransferBuffer<200> buf_ref;
+        uavcan::BitStream bs_ref(buf_ref);
+        uavcan::ScalarCodec sc_ref(bs_ref);
+        ASSERT_EQ(1, sc_ref.encodeBits(&Prefix, prefix_bitlen));
+        for (uint8_t i = 0; i < static_array.size(); i++)
+        {
+            ASSERT_EQ(1, F16::encode(static_array[i], sc_ref, uavcan::TailArrayOptDisabled));
+        }
+        ASSERT_EQ(1, sc_ref.encode<6>(uint8_t(dynamic_array.size())));
+        for (uint8_t i = 0; i < dynamic_array.size(); i++)
+        {
+            ASSERT_EQ(1, F16::encode(dynamic_array[i], sc_ref, uavcan::TailArrayOptDisabled));
+        }
+        ASSERT_EQ(bs_ref.toString(), bs.toString()) << prefix_bitlen;
+
+        uavcan::BitStream bs_rd(buf);
+        uavcan::ScalarCodec sc_rd(bs_rd);
+        uint8_t prefix = 0;
+        ASSERT_EQ(1, sc_rd.decodeBits(&prefix, prefix_bitlen));
+        StaticArray static_decoded;
+        DynamicArray dynamic_decoded;
+        ASSERT_EQ(1, StaticArray::decode(static_decoded, sc_rd, uavcan::TailArrayOptDisabled));
+        ASSERT_EQ(1, DynamicArray::decode(dynamic_decoded, sc_rd, uavcan::TailArrayOptDisabled));
+        ASSERT_EQ(dynamic_array.size(), dynamic_decoded.size());
+
+        uavcan::BitStream bs_ref_rd(buf);
+        uavcan::ScalarCodec sc_ref_rd(bs_ref_rd);
+        ASSERT_EQ(1, sc_ref_rd.decodeBits(&prefix, prefix_bitlen));
+        for (uint8_t i = 0; i < 2 * StaticArray::MaxSize + 1; i++)
+        {
+            if (i == StaticArray::MaxSize)
+            {
+                uint8_t size = 0;
+                ASSERT_EQ(1, sc_ref_rd.decode<6>(size));
+                continue;
+            }
+            float value = 0;
+            ASSERT_EQ(1, F16::decode(value, sc_ref_rd, uavcan::TailArrayOptDisabled));
+            const float decoded = (i < StaticArray::MaxSize) ? static_decoded[i]
+                                                             : dynamic_decoded[uint8_t(i - StaticArray::MaxSize - 1)];
+            ASSERT_EQ(floatBits(value), floatBits(decoded)) << i;
+        }
+    }
+
+    // Out of buffer space
+    DynamicArray dynamic_array;
+    dynamic_array.resize(20);
+    uavcan::StaticTransferBuffer<20> buf;
+    uavcan::BitStream bs(buf);
+    uavcan::ScalarCodec sc(bs);
+    ASSERT_EQ(0, DynamicArray::encode(dynamic_array, sc, uavcan::TailArrayOptDisabled));
+    uavcan::BitStream bs_rd(buf);
+    uavcan::ScalarCodec sc_rd(bs_rd);
+    ASSERT_EQ(0, DynamicArray::decode(dynamic_array, sc_rd, uavcan::TailArrayOptDisabled));
+}
+
+TEST(FloatSpec, Float16ArrayCodec)
+{
+    std::srand(17);
+    const std::vector<float> values = makeFloat16TestValues();
+    checkFloat16ArrayCodec<uavcan::FloatSpec<16, uavcan::CastModeSaturate> >(values);
+    checkFloat16ArrayCodec<uavcan::FloatSpec<16, uavcan::CastModeTruncate> >(values);
+}
+
@@ -0,0 +1,191 @@
+/*
+ * Copyright (C) 2014 Pavel Kirienko <pavel.kirienko@gmail.com>
+ */
+
+#include <gtest/gtest.h>
+#include <uavcan/node/memory_budget.hpp>
+#include <uavcan/node/scheduler.hpp>
+#include <uavcan/transport/arena_transfer_buffer.hpp>
+#include <uavcan/protocol/NodeStatus.hpp>
+#include <uavcan/protocol/GetNodeInfo.hpp>
+#include "../transport/transfer_test_helpers.hpp"
+#include "../transport/can/can.hpp"
+#include "../clock.hpp"
+
+
+struct MemoryBudgetTestMessage
+{
+    enum { MaxBitLen = 8 * 100 };
+};
+
+
+TEST(MemoryBudget, Arithmetic)
+{
+    // Single frame messages need no buffers
+    typedef uavcan::SubscriberMemoryBudget<uavcan::protocol::NodeStatus, 2> NodeStatusFromTwo;
+    ASSERT_EQ(0, NodeStatusFromTwo::NumBlocks);
+
+    typedef uavcan::SubscriberMemoryBudget<MemoryBudgetTestMessage, 1, 2, 1> FromOne;
+    ASSERT_EQ(0, FromOne::NumBlocks);
+    ASSERT_EQ(0, FromOne::NumOutgoingTransfers);
+
+    // One extra node takes one block of receivers and one buffer of 100 bytes
+    typedef uavcan::SubscriberMemoryBudget<MemoryBudgetTestMessage, 3, 2, 1> FromThree;
+    const unsigned buffer_blocks =
+        1U + (100U + uavcan::DynamicTransferBufferManagerEntry::PayloadBytesPerPoolBlock - 1U) /
+        uavcan::DynamicTransferBufferManagerEntry::PayloadBytesPerPoolBlock;
+    ASSERT_EQ(1, FromThree::ReceiverBlocks);
+    ASSERT_EQ(2 * buffer_blocks, FromThree::BufferBlocks);
+
+    // Clients take outgoing transfer registry entries, servers don't
+    typedef uavcan::ServiceClientMemoryBudget<uavcan::protocol::GetNodeInfo, 3> Client;
+    typedef uavcan::ServiceServerMemoryBudget<uavcan::protocol::GetNodeInfo, 3> Server;
+    ASSERT_EQ(3, Client::NumOutgoingTransfers);
+    ASSERT_EQ(0, Server::NumOutgoingTransfers);
+    ASSERT_LT(0, Client::NumBlocks);            // GetNodeInfo response is multi-frame
+    ASSERT_EQ(0, Server::BufferBlocks);         // GetNodeInfo request is empty
+    ASSERT_EQ(1, Server::ReceiverBlocks);
+
+    typedef uavcan::MemoryBudget<FromThree, Client, uavcan::PublisherMemoryBudget<MemoryBudgetTestMessage, 2>,
+                                 uavcan::TxQueueMemoryBudget<50> > Budget;
+    ASSERT_EQ(FromThree::NumBlocks + Client::NumBlocks + 50, Budget::NumBlocks);
+
+    // Every interface may fill its TX queue quota
+    ASSERT_EQ(150, (uavcan::TxQueueMemoryBudget<50, 3>::NumBlocks));
+
+    // Arena buffers don't use the pool, the table takes one block per receiver
+    typedef uavcan::SubscriberMemoryBudget<MemoryBudgetTestMessage, 5, 2, 1, uavcan::TransferReceiverTable,
+                                           uavcan::ArenaBuffers<512>::Manager> FromFiveArenaTable;
+    ASSERT_EQ(3, FromFiveArenaTable::ReceiverBlocks);
+    ASSERT_EQ(0, FromFiveArenaTable::BufferBlocks);
+    ASSERT_EQ(3 + 3, Budget::NumOutgoingTransfers);
+
+    // The node's own services are added on top, dynamic registry entries are needed only past the static ones
+    typedef uavcan::NodeMemoryBudget<Budget, 10> NodeBudget;
+    ASSERT_LE(Budget::NumBlocks, NodeBudget::NumBlocks);
+    ASSERT_EQ(NodeBudget::NumBlocks * uavcan::MemPoolBlockSize, NodeBudget::MemPoolSize);
+    NodeBudget::checkPoolSize<NodeBudget::MemPoolSize>();
+
+    typedef uavcan::NodeMemoryBudget<Budget, 10, 0> NodeBudgetNoStaticOtr;
+    ASSERT_EQ(0, NodeBudget::OutgoingTransferBlocks);
+    ASSERT_LT(0, NodeBudgetNoStaticOtr::OutgoingTransferBlocks);
+
+    // The hashed registry takes one block per entry in the index, and overflows past 3/4 of the index size
+    typedef uavcan::NodeMemoryBudget<Budget, 10, 0, uavcan::HashedOutgoingTransferRegistry<2, 8> > NodeBudgetHashedOtr;
+    typedef uavcan::OutgoingTransferRegistryMemoryBudget<uavcan::HashedOutgoingTransferRegistry<2, 8>,
+                                                         NodeBudgetHashedOtr::NumOutgoingTransfers> HashedOtrBudget;
+    ASSERT_EQ(4, HashedOtrBudget::IndexBlocks);
+    ASSERT_LT(0, HashedOtrBudget::OverflowBlocks);
+    ASSERT_EQ(HashedOtrBudget::NumBlocks, NodeBudgetHashedOtr::OutgoingTransferBlocks);
+}
+
+
+template <unsigned NumNodes, template <unsigned> class ReceiverStore, template <uint16_t, uint8_t> class BufferManager>
+static void checkListenerBudget()
+{
+    static const unsigned PayloadLen = 100;
+
+    typedef uavcan::TransferListenerMemoryBudget<MemoryBudgetTestMessage, NumNodes, 2, 1,
+                                                 ReceiverStore, BufferManager> Budget;
+
+    uavcan::PoolAllocator<uavcan::MemPoolBlockSize * 512, uavcan::MemPoolBlockSize> pool;
+    uavcan::PoolManager<1> poolmgr;
+    poolmgr.addPool(&pool);
+
+    const uavcan::DataTypeDescriptor type = makeDataType(uavcan::DataTypeKindMessage, 123);
+    uavcan::TransferPerfCounter perf;
+    TestListener<PayloadLen, 1, 2, ReceiverStore, BufferManager> listener(perf, type, poolmgr);
+
+    /*
+     * All nodes are transmitting at once; the last frames are withheld so that all buffers stay allocated
+     */
+    const std::string payload(PayloadLen, 'x');
+    for (uint8_t node_id = 1; node_id <= NumNodes; node_id++)
+    {
+        const Transfer tr(uavcan::MonotonicTime::fromUSec(1000), uavcan::UtcTime(),
+                          uavcan::TransferTypeMessageBroadcast, uavcan::TransferID(0), node_id,
+                          uavcan::NodeID::Broadcast, payload, type);
+        const std::vector<uavcan::RxFrame> frames = serializeTransfer(tr);
+        ASSERT_LT(1, frames.size());
+        for (unsigned i = 0; i < (frames.size() - 1); i++)
+        {
+            listener.handleFrame(frames[i]);
+        }
+    }
+    ASSERT_TRUE(listener.isEmpty());
+
+    ASSERT_EQ(Budget::NumBlocks, pool.getNumUsedBlocks());
+}
+
+
+TEST(MemoryBudget, MatchesActualUsage)
+{
+    checkListenerBudget<6, uavcan::TransferReceiverMap, uavcan::TransferBufferManager>();
+    checkListenerBudget<6, uavcan::TransferReceiverHashMap, uavcan::TransferBufferManager>();
+    checkListenerBudget<40, uavcan::TransferReceiverHashMap, uavcan::TransferBufferManager>();
+    checkListenerBudget<6, uavcan::TransferReceiverTable, uavcan::TransferBufferManager>();
+    checkListenerBudget<6, uavcan::TransferReceiverMap, uavcan::ArenaBuffers<512>::Manager>();
+}
+
+
+TEST(MemoryBudget, OutgoingTransferRegistryMatchesActualUsage)
+{
+    static const unsigned NumTransfers = 10;
+
+    typedef uavcan::HashedOutgoingTransferRegistry<2, 8> Registry;
+    typedef uavcan::OutgoingTransferRegistryMemoryBudget<Registry, NumTransfers> Budget;
+
+    uavcan::PoolAllocator<uavcan::MemPoolBlockSize * 64, uavcan::MemPoolBlockSize> pool;
+    uavcan::PoolManager<1> poolmgr;
+    poolmgr.addPool(&pool);
+
+    Registry otr(poolmgr);
+    for (unsigned i = 0; i < NumTransfers; i++)
+    {
+        const uavcan::OutgoingTransferRegistryKey key(uavcan::DataTypeID(uint16_t(100 + i)),
+                                                      uavcan::TransferTypeMessageBroadcast, uavcan::NodeID::Broadcast);
+        ASSERT_TRUE(otr.accessOrCreate(key, uavcan::MonotonicTime::fromUSec(1000000)));
+    }
+    ASSERT_EQ(NumTransfers, otr.getNumEntries());
+    ASSERT_LT(0, otr.getNumOverflowEntries());
+
+    ASSERT_EQ(Budget::NumBlocks, pool.getNumUsedBlocks());
+}
+
+
+TEST(MemoryBudget, TxQueueMatchesActualUsage)
+{
+    static const unsigned NumFramesPerIface = 5;
+
+    typedef uavcan::TxQueueMemoryBudget<NumFramesPerIface, 2> Budget;
+
+    uavcan::PoolAllocator<uavcan::MemPoolBlockSize * 64, uavcan::MemPoolBlockSize> pool;
+    uavcan::PoolManager<1> poolmgr;
+    poolmgr.addPool(&pool);
+
+    SystemClockMock clockmock(100);
+    CanDriverMock driver(2, clockmock);
+    driver.ifaces[0].writeable = false;
+    driver.ifaces[1].writeable = false;
+
+    uavcan::OutgoingTransferRegistry<8> otr(poolmgr);
+    uavcan::Scheduler scheduler(driver, poolmgr, clockmock, otr, NumFramesPerIface);
+    uavcan::Dispatcher& dispatcher = scheduler.getDispatcher();
+    dispatcher.setNodeID(1);
+
+    // Every iface has its own frames pending; the frames past the quota are rejected
+    for (uint8_t iface_index = 0; iface_index < 2; iface_index++)
+    {
+        for (uint8_t i = 0; i < (NumFramesPerIface * 2); i++)
+        {
+            const uavcan::Frame frame(uavcan::protocol::NodeStatus::DefaultDataTypeID,
+                                      uavcan::TransferTypeMessageBroadcast, 1, uavcan::NodeID::Broadcast, 0, 0, true);
+            dispatcher.send(frame, tsMono(1000000), tsMono(0), uavcan::CanTxQueue::Volatile, 0,
+                            uint8_t(1U << iface_index));
+        }
+    }
+    ASSERT_EQ(NumFramesPerIface, dispatcher.getCanIOManager().getIfacePerfCounters(0).errors);
+    ASSERT_EQ(NumFramesPerIface, dispatcher.getCanIOManager().getIfacePerfCounters(1).errors);
+
+    ASSERT_EQ(Budget::NumBlocks, pool.getNumUsedBlocks());
+}
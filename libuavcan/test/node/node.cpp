@@ -92,3 +92,30 @@ TEST(Node, Basic)
     ASSERT_TRUE(log_sub.collector.msg.get());
     std::cout << *log_sub.collector.msg << std::endl;
 }
+
+
+TEST(Node, HashedOutgoingTransferRegistry)
+{
+    registerTypes();
+    InterlinkedTestNodesWithSysClock nodes;
+
+    typedef uavcan::Node<0, 0, uavcan::MaxTransferPayloadLen, uavcan::HashedOutgoingTransferRegistry<4> > GatewayNode;
+    GatewayNode node1(nodes.can_a, nodes.clock_a);
+    node1.setName("com.example.gateway");
+    node1.setNodeID(1);
+
+    uavcan::Node<0> node2(nodes.can_b, nodes.clock_b);
+    node2.setName("foobar");
+    node2.setNodeID(2);
+
+    uavcan::NodeStatusMonitor node_status_monitor(node2);
+    ASSERT_LE(0, node_status_monitor.start());
+
+    ASSERT_LE(0, node2.start());
+    ASSERT_LE(0, node1.start());
+    ASSERT_TRUE(node1.getDispatcher().hasPublisher(uavcan::protocol::NodeStatus::DefaultDataTypeID));
+
+    ASSERT_LE(0, node1.spin(uavcan::MonotonicDuration::fromMSec(20)));
+    ASSERT_LE(0, node2.spin(uavcan::MonotonicDuration::fromMSec(20)));
+    ASSERT_EQ(1, node_status_monitor.findNodeWithWorstStatus().get());
+}
@@ -5,6 +5,8 @@
 #include <gtest/gtest.h>
 #include <uavcan/node/publisher.hpp>
 #include <uavcan/mavlink/Message.hpp>
+#include <uavcan/protocol/NodeStatus.hpp>
+#include <uavcan/protocol/GlobalTimeSync.hpp>
 #include "../clock.hpp"
 #include "../transport/can/can.hpp"
 #include "test_node.hpp"
@@ -121,3 +123,92 @@ TEST(Publisher, ImplicitInitialization)
     // Will be initialized ad-hoc
     ASSERT_TRUE(publisher.getTransferSender());
 }
+
+
+template <typename T>
+static unsigned encodeGeneric(const T& obj, uint8_t* out_payload)
+{
+    uavcan::StaticTransferBuffer<uavcan::MaxTransferPayloadLen> buf;
+    uavcan::BitStream bs(buf);
+    uavcan::ScalarCodec sc(bs);
+    EXPECT_EQ(1, T::encodeFieldByField(obj, sc));
+    const unsigned len = buf.getMaxWritePos();
+    EXPECT_EQ(int(len), buf.read(0, out_payload, len));
+    return len;
+}
+
+TEST(Publisher, SingleFrame)
+{
+    SystemClockMock clock_mock(100);
+    CanDriverMock can_driver(2, clock_mock);
+    TestNode node(can_driver, clock_mock, 1);
+
+    uavcan::GlobalDataTypeRegistry::instance().reset();
+    uavcan::DefaultDataTypeRegistrator<uavcan::protocol::NodeStatus> _reg1;
+    uavcan::DefaultDataTypeRegistrator<uavcan::protocol::GlobalTimeSync> _reg2;
+
+    /*
+     * NodeStatus always fits one frame, it is packed directly into the frame payload
+     */
+    {
+        uavcan::Publisher<uavcan::protocol::NodeStatus> publisher(node);
+        const uint64_t tx_timeout_usec = uint64_t(publisher.getDefaultTxTimeout().toUSec());
+
+        uavcan::protocol::NodeStatus msg;
+        msg.uptime_sec = 0x1234567;
+        msg.status_code = uavcan::protocol::NodeStatus::STATUS_WARNING;
+        msg.vendor_specific_status_code = 0xBEEF;
+
+        uint8_t expected_payload[8];
+        ASSERT_EQ(6, encodeGeneric(msg, expected_payload));
+
+        ASSERT_LT(0, publisher.broadcast(msg));
+        uavcan::Frame expected_frame(uavcan::protocol::NodeStatus::DefaultDataTypeID,
+                                     uavcan::TransferTypeMessageBroadcast,
+                                     node.getNodeID(), uavcan::NodeID::Broadcast, 0, 0, true);
+        expected_frame.setPayload(expected_payload, 6);
+        uavcan::CanFrame expected_can_frame;
+        ASSERT_TRUE(expected_frame.compile(expected_can_frame));
+        ASSERT_TRUE(can_driver.ifaces[0].matchAndPopTx(expected_can_frame, tx_timeout_usec + 100));
+        ASSERT_TRUE(can_driver.ifaces[1].matchAndPopTx(expected_can_frame, tx_timeout_usec + 100));
+
+        ASSERT_LT(0, publisher.unicast(msg, 0x44));
+        expected_frame = uavcan::Frame(uavcan::protocol::NodeStatus::DefaultDataTypeID,
+                                       uavcan::TransferTypeMessageUnicast,
+                                       node.getNodeID(), uavcan::NodeID(0x44), 0, 0, true);
+        expected_frame.setPayload(expected_payload, 6);
+        ASSERT_TRUE(expected_frame.compile(expected_can_frame));
+        ASSERT_TRUE(can_driver.ifaces[0].matchAndPopTx(expected_can_frame, tx_timeout_usec + 100));
+        ASSERT_TRUE(can_driver.ifaces[1].matchAndPopTx(expected_can_frame, tx_timeout_usec + 100));
+        ASSERT_TRUE(can_driver.ifaces[0].tx.empty());
+        ASSERT_TRUE(can_driver.ifaces[1].tx.empty());
+    }
+
+    /*
+     * GlobalTimeSync is 8 bytes long - fits one broadcast frame, but unicast requires a multi frame transfer
+     */
+    {
+        uavcan::Publisher<uavcan::protocol::GlobalTimeSync> publisher(node);
+        const uint64_t tx_timeout_usec = uint64_t(publisher.getDefaultTxTimeout().toUSec());
+
+        uavcan::protocol::GlobalTimeSync msg;
+        msg.previous_transmission_timestamp_usec = 0x0123456789ABCDEFULL;
+
+        uint8_t expected_payload[8];
+        ASSERT_EQ(8, encodeGeneric(msg, expected_payload));
+
+        ASSERT_LT(0, publisher.broadcast(msg));
+        uavcan::Frame expected_frame(uavcan::protocol::GlobalTimeSync::DefaultDataTypeID,
+                                     uavcan::TransferTypeMessageBroadcast,
+                                     node.getNodeID(), uavcan::NodeID::Broadcast, 0, 0, true);
+        expected_frame.setPayload(expected_payload, 8);
+        uavcan::CanFrame expected_can_frame;
+        ASSERT_TRUE(expected_frame.compile(expected_can_frame));
+        ASSERT_TRUE(can_driver.ifaces[0].matchAndPopTx(expected_can_frame, tx_timeout_usec + 100));
+        ASSERT_TRUE(can_driver.ifaces[1].matchAndPopTx(expected_can_frame, tx_timeout_usec + 100));
+
+        ASSERT_LT(0, publisher.unicast(msg, 0x44));
+        ASSERT_EQ(2, can_driver.ifaces[0].tx.size());
+        ASSERT_EQ(2, can_driver.ifaces[1].tx.size());
+    }
+}
@@ -4,11 +4,15 @@
 
 #include <gtest/gtest.h>
 #include <uavcan/node/subscriber.hpp>
+#include <uavcan/node/publisher.hpp>
+#include <uavcan/transport/arena_transfer_buffer.hpp>
 #include <uavcan/util/method_binder.hpp>
 #include <uavcan/mavlink/Message.hpp>
 #include <root_ns_a/EmptyMessage.hpp>
+#include <uavcan/protocol/NodeStatus.hpp>
 #include "../clock.hpp"
 #include "../transport/can/can.hpp"
+#include "../transport/transfer_test_helpers.hpp"
 #include "test_node.hpp"
 
 
@@ -230,6 +234,54 @@ TEST(Subscriber, FailureCount)
 }
 
 
+TEST(Subscriber, CrossIfaceReassembly)
+{
+    // Manual type registration - we can't rely on the GDTR state
+    uavcan::GlobalDataTypeRegistry::instance().reset();
+    uavcan::DefaultDataTypeRegistrator<uavcan::mavlink::Message> _registrator;
+
+    SystemClockDriver clock_driver;
+    CanDriverMock can_driver(2, clock_driver);
+    TestNode node(can_driver, clock_driver, 1);
+
+    typedef SubscriptionListener<uavcan::mavlink::Message> Listener;
+
+    Listener listener_single;
+    uavcan::Subscriber<uavcan::mavlink::Message, Listener::SimpleBinder> sub_single(node);
+    ASSERT_EQ(uavcan::TransferReceiver::ReassemblySingleIface, sub_single.getReassemblyMode());
+    ASSERT_LE(0, sub_single.start(listener_single.bindSimple()));
+
+    // The mode is kept until the listener is created
+    Listener listener_cross;
+    uavcan::Subscriber<uavcan::mavlink::Message, Listener::SimpleBinder> sub_cross(node);
+    sub_cross.setReassemblyMode(uavcan::TransferReceiver::ReassemblyCrossIface);
+    ASSERT_LE(0, sub_cross.start(listener_cross.bindSimple()));
+    ASSERT_EQ(uavcan::TransferReceiver::ReassemblyCrossIface, sub_cross.getReassemblyMode());
+
+    const uavcan::DataTypeDescriptor* const descr =
+        uavcan::GlobalDataTypeRegistry::instance().find(uavcan::DataTypeKindMessage,
+                                                         uavcan::mavlink::Message::getDataTypeFullName());
+    ASSERT_TRUE(descr);
+
+    // Every other frame of the transfer comes from the other iface
+    const Transfer tr(clock_driver.getMonotonic(), uavcan::UtcTime(), uavcan::TransferTypeMessageBroadcast, 0,
+                      uavcan::NodeID(100), uavcan::NodeID::Broadcast, "\x42\x72\x08\xa5" "Redundant", *descr);
+    const std::vector<uavcan::RxFrame> frames = serializeTransfer(tr);
+    ASSERT_LT(1, frames.size());
+    for (unsigned i = 0; i < frames.size(); i++)
+    {
+        can_driver.ifaces[i % 2].pushRx(frames[i]);
+    }
+
+    ASSERT_LE(0, node.spin(clock_driver.getMonotonic() + durMono(10000)));
+
+    ASSERT_TRUE(listener_single.simple.empty());
+    ASSERT_EQ(1, listener_cross.simple.size());
+    ASSERT_EQ(0x42, listener_cross.simple[0].seq);
+    ASSERT_EQ("Redundant", listener_cross.simple[0].payload);
+}
+
+
 TEST(Subscriber, SingleFrameTransfer)
 {
     // Manual type registration - we can't rely on the GDTR state
@@ -274,3 +326,102 @@ TEST(Subscriber, SingleFrameTransfer)
         ASSERT_TRUE(listener.simple.at(i) == root_ns_a::EmptyMessage());
     }
 }
+
+
+TEST(Subscriber, SingleFrameFixedLayout)
+{
+    // Manual type registration - we can't rely on the GDTR state
+    uavcan::GlobalDataTypeRegistry::instance().reset();
+    uavcan::DefaultDataTypeRegistrator<uavcan::protocol::NodeStatus> _registrator;
+
+    SystemClockDriver clock_driver;
+    CanDriverMock can_driver(1, clock_driver);
+    TestNode node(can_driver, clock_driver, 1);
+
+    typedef SubscriptionListener<uavcan::protocol::NodeStatus> Listener;
+
+    uavcan::Subscriber<uavcan::protocol::NodeStatus, Listener::SimpleBinder> sub(node);
+
+    Listener listener;
+
+    sub.start(listener.bindSimple());
+
+    /*
+     * uint28 uptime_sec = 0x1234567
+     * uint4 status_code = 3
+     * uint16 vendor_specific_status_code = 0xBEEF
+     */
+    const uint8_t payload[] = { 0x67, 0x45, 0x23, 0x13, 0xEF, 0xBE };
+
+    // Full payload - decoded in place; truncated payload - rejected by the generic decoder
+    for (uint8_t i = 0; i < 2; i++)
+    {
+        uavcan::Frame frame(uavcan::protocol::NodeStatus::DefaultDataTypeID, uavcan::TransferTypeMessageBroadcast,
+                            uavcan::NodeID(uint8_t(i + 100)), uavcan::NodeID::Broadcast, 0, i, true);
+        frame.setPayload(payload, (i == 0) ? sizeof(payload) : (sizeof(payload) - 1));
+        uavcan::RxFrame rx_frame(frame, clock_driver.getMonotonic(), clock_driver.getUtc(), 0);
+        can_driver.ifaces[0].pushRx(rx_frame);
+    }
+
+    ASSERT_LE(0, node.spin(clock_driver.getMonotonic() + durMono(10000)));
+
+    ASSERT_EQ(1, sub.getFailureCount());
+
+    ASSERT_EQ(1, listener.simple.size());
+    ASSERT_EQ(0x1234567, listener.simple.at(0).uptime_sec);
+    ASSERT_EQ(3, listener.simple.at(0).status_code);
+    ASSERT_EQ(0xBEEF, listener.simple.at(0).vendor_specific_status_code);
+}
+
+
+TEST(Subscriber, ArenaBuffers)
+{
+    // Manual type registration - we can't rely on the GDTR state
+    uavcan::GlobalDataTypeRegistry::instance().reset();
+    uavcan::DefaultDataTypeRegistrator<uavcan::mavlink::Message> _registrator;
+
+    InterlinkedTestNodesWithSysClock nodes;
+
+    typedef SubscriptionListener<uavcan::mavlink::Message> Listener;
+
+    uavcan::Subscriber<uavcan::mavlink::Message, Listener::SimpleBinder, 2, 2,
+                       uavcan::TransferReceiverMap, uavcan::ArenaBuffers<512>::Manager> sub(nodes.b);
+
+    Listener listener;
+    ASSERT_EQ(0, sub.start(listener.bindSimple()));
+
+    uavcan::Publisher<uavcan::mavlink::Message> pub(nodes.a);
+
+    uavcan::mavlink::Message msg;
+    msg.seq = 0x42;
+    for (unsigned i = 0; i < 200; i++)
+    {
+        msg.payload.push_back(uint8_t(i));
+    }
+
+    for (unsigned i = 0; i < 3; i++)
+    {
+        msg.msgid = uint8_t(i);
+        ASSERT_LT(0, pub.broadcast(msg));
+        ASSERT_LE(0, nodes.spinBoth(uavcan::MonotonicDuration::fromMSec(10)));
+    }
+
+    ASSERT_EQ(0, sub.getFailureCount());
+    ASSERT_EQ(3, listener.simple.size());
+    for (unsigned i = 0; i < 3; i++)
+    {
+        msg.msgid = uint8_t(i);
+        ASSERT_TRUE(msg == listener.simple.at(i));
+    }
+
+    ASSERT_EQ(0, nodes.b.pool.getPeakNumUsedBlocks(uavcan::PoolAllocationTagBuffers));
+
+    // Same with the default manager without static buffers - the pool is used
+    sub.stop();
+    uavcan::Subscriber<uavcan::mavlink::Message, Listener::SimpleBinder, 2, 0> pool_sub(nodes.b);
+    ASSERT_EQ(0, pool_sub.start(listener.bindSimple()));
+    ASSERT_LT(0, pub.broadcast(msg));
+    ASSERT_LE(0, nodes.spinBoth(uavcan::MonotonicDuration::fromMSec(10)));
+    ASSERT_EQ(4, listener.simple.size());
+    ASSERT_LT(0, nodes.b.pool.getPeakNumUsedBlocks(uavcan::PoolAllocationTagBuffers));
+}
@@ -0,0 +1,129 @@
+/*
+ * Copyright (C) 2014 Pavel Kirienko <pavel.kirienko@gmail.com>
+ */
+
+#include <gtest/gtest.h>
+#include <uavcan/transport/arena_transfer_buffer.hpp>
+
+static const std::string TEST_DATA =
+    "It was like this: I asked myself one day this question - what if Napoleon, for instance, had happened to be in my "
+    "place, and if he had not had Toulon nor Egypt nor the passage of Mont Blanc to begin his career with, but "
+    "instead of all those picturesque and monumental things, there had simply been some ridiculous old hag, a "
+    "pawnbroker, who had to be murdered too to get money from her trunk (for his career, you understand). "
+    "Well, would he have brought himself to that if there had been no other means?";
+
+static const uint8_t* testData(unsigned offset = 0)
+{
+    return reinterpret_cast<const uint8_t*>(TEST_DATA.c_str()) + offset;
+}
+
+static bool matchAgainstTestData(const uavcan::ITransferBuffer& tbb, unsigned len)
+{
+    uint8_t buf[1024];
+    const int res = tbb.read(0, buf, sizeof(buf));
+    if (res != int(len))
+    {
+        std::cout << "matchAgainstTestData(): res " << res << " expected " << len << std::endl;
+        return false;
+    }
+    return std::equal(buf, buf + len, testData());
+}
+
+
+TEST(ArenaTransferBufferManager, Basic)
+{
+    using uavcan::TransferBufferManagerKey;
+    using uavcan::ITransferBuffer;
+
+    // 12 chunks of 32 bytes, up to 3 buffers, every buffer is limited to 100 bytes (4 chunks)
+    uavcan::ArenaTransferBufferManager<100, 384, 3> mgr;
+    ASSERT_EQ(12, mgr.getNumChunks());
+    ASSERT_TRUE(mgr.isEmpty());
+
+    const TransferBufferManagerKey key_a(1, uavcan::TransferTypeMessageBroadcast);
+    const TransferBufferManagerKey key_b(2, uavcan::TransferTypeMessageBroadcast);
+    const TransferBufferManagerKey key_c(3, uavcan::TransferTypeServiceRequest);
+    const TransferBufferManagerKey key_d(4, uavcan::TransferTypeServiceResponse);
+
+    ITransferBuffer* const a = mgr.create(key_a);           // Chunk 0
+    ITransferBuffer* const b = mgr.create(key_b);           // Chunk 1
+    ASSERT_TRUE(a);
+    ASSERT_TRUE(b);
+    ASSERT_EQ(a, mgr.access(key_a));
+    ASSERT_EQ(b, mgr.access(key_b));
+    ASSERT_FALSE(mgr.access(key_c));
+    ASSERT_EQ(2, mgr.getNumBuffers());
+    ASSERT_EQ(2, mgr.getNumUsedChunks());
+
+    /*
+     * A grows: the adjacent chunk is taken by B, so it moves to the chunks 2..3, then grows in place up to 2..5
+     */
+    ASSERT_EQ(20, a->write(0, testData(), 20));
+    ASSERT_EQ(30, a->write(20, testData(20), 30));
+    ASSERT_TRUE(matchAgainstTestData(*a, 50));
+    ASSERT_EQ(3, mgr.getNumUsedChunks());
+
+    ASSERT_EQ(50, a->write(50, testData(50), 60));          // Limited by the max buffer size
+    ASSERT_TRUE(matchAgainstTestData(*a, 100));
+    ASSERT_EQ(5, mgr.getNumUsedChunks());
+    ASSERT_EQ(0, a->write(100, testData(), 1));
+
+    /*
+     * B grows to the next size class (4 chunks, 6..9) while being written in reverse order
+     */
+    ASSERT_EQ(40, b->write(40, testData(40), 40));
+    ASSERT_EQ(40, b->write(0, testData(), 40));
+    ASSERT_TRUE(matchAgainstTestData(*b, 80));
+    ASSERT_EQ(8, mgr.getNumUsedChunks());
+
+    /*
+     * C takes the chunk 0; there's no run of 4 chunks left for it to grow, so only the first chunk is written
+     */
+    ITransferBuffer* const c = mgr.create(key_c);
+    ASSERT_TRUE(c);
+    ASSERT_EQ(32, c->write(0, testData(), 100));
+    ASSERT_TRUE(matchAgainstTestData(*c, 32));
+    ASSERT_EQ(9, mgr.getNumUsedChunks());
+
+    mgr.remove(key_c);
+    ASSERT_FALSE(mgr.access(key_c));
+    ASSERT_TRUE(mgr.create(key_c));
+    ASSERT_FALSE(mgr.create(key_d));                        // No entries left
+
+    /*
+     * Recreation resets the buffer
+     */
+    ASSERT_EQ(a, mgr.create(key_a));
+    uint8_t dummy = 0;
+    ASSERT_EQ(0, a->read(0, &dummy, 1));
+    ASSERT_EQ(1 + 4 + 1, mgr.getNumUsedChunks());
+
+    mgr.remove(key_a);
+    mgr.remove(key_b);
+    mgr.remove(key_c);
+    ASSERT_TRUE(mgr.isEmpty());
+    ASSERT_EQ(0, mgr.getNumUsedChunks());
+}
+
+TEST(ArenaTransferBufferManager, Fragmentation)
+{
+    uavcan::ArenaTransferBufferManager<128, 256, 8> mgr;
+
+    // Filling the arena with single chunk buffers, then releasing every other one
+    for (uint8_t i = 1; i <= 8; i++)
+    {
+        ASSERT_TRUE(mgr.create(uavcan::TransferBufferManagerKey(i, uavcan::TransferTypeMessageBroadcast)));
+    }
+    ASSERT_FALSE(mgr.create(uavcan::TransferBufferManagerKey(9, uavcan::TransferTypeMessageBroadcast)));
+    for (uint8_t i = 1; i <= 8; i += 2)
+    {
+        mgr.remove(uavcan::TransferBufferManagerKey(i, uavcan::TransferTypeMessageBroadcast));
+    }
+    ASSERT_EQ(4, mgr.getNumUsedChunks());
+
+    // The last buffer can't grow in place, and there's no contiguous run of two chunks
+    uavcan::ITransferBuffer* const tbb =
+        mgr.access(uavcan::TransferBufferManagerKey(8, uavcan::TransferTypeMessageBroadcast));
+    ASSERT_TRUE(tbb);
+    ASSERT_EQ(32, tbb->write(0, testData(), 40));
+}
@@ -43,6 +43,13 @@ public:
     uint64_t num_errors;
     uavcan::ISystemClock& iclock;
     bool enable_utc_timestamping;
+    bool enable_burst_rx;               ///< Drain all pending frames per receiveBurst() call
+    unsigned num_burst_rx_calls;
+    uavcan::uint16_t num_filters;       ///< Zero means that filters are not supported
+    std::vector<uavcan::CanFilterConfig> filters;
+    unsigned num_filter_reconfigurations;
+    bool filter_failure;
+    bool narrow_filter_failure;         ///< Reject every config but a single accept-all one
 
     CanIfaceMock(uavcan::ISystemClock& iclock)
         : writeable(true)
@@ -51,8 +58,26 @@ public:
         , num_errors(0)
         , iclock(iclock)
         , enable_utc_timestamping(false)
+        , enable_burst_rx(false)
+        , num_burst_rx_calls(0)
+        , num_filters(0)
+        , num_filter_reconfigurations(0)
+        , filter_failure(false)
+        , narrow_filter_failure(false)
     { }
 
+    bool acceptedByFilters(const uavcan::CanFrame& frame) const
+    {
+        for (unsigned i = 0; i < filters.size(); i++)
+        {
+            if (((frame.id ^ filters[i].id) & filters[i].mask) == 0)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
     void pushRx(const uavcan::CanFrame& frame)
     {
         rx.push(FrameWithTime(frame, iclock.getMonotonic()));
@@ -148,11 +173,45 @@ public:
         return 1;
     }
 
+    virtual uavcan::int16_t receiveBurst(uavcan::CanRxFrame* out_frames, uavcan::uint16_t max_frames)
+    {
+        num_burst_rx_calls++;
+        if (!enable_burst_rx)
+        {
+            return uavcan::ICanIface::receiveBurst(out_frames, max_frames);
+        }
+        uavcan::int16_t num_frames = 0;
+        while ((num_frames < max_frames) && (rx.size() || loopback.size()))
+        {
+            uavcan::CanRxFrame& frame = out_frames[num_frames];
+            const uavcan::int16_t res = receive(frame, frame.ts_mono, frame.ts_utc, frame.flags);
+            if (res < 0)
+            {
+                return (num_frames > 0) ? num_frames : res;
+            }
+            num_frames++;
+        }
+        return num_frames;
+    }
+
     // cppcheck-suppress unusedFunction
-    // cppcheck-suppress functionConst
-    virtual uavcan::int16_t configureFilters(const uavcan::CanFilterConfig*, uavcan::uint16_t) { return -1; }
+    virtual uavcan::int16_t configureFilters(const uavcan::CanFilterConfig* filter_configs,
+                                             uavcan::uint16_t num_configs)
+    {
+        if (filter_failure || (num_configs > num_filters))
+        {
+            return -1;
+        }
+        if (narrow_filter_failure && ((num_configs != 1) || (filter_configs[0].mask != 0)))
+        {
+            return -1;
+        }
+        filters.assign(filter_configs, filter_configs + num_configs);
+        num_filter_reconfigurations++;
+        return 0;
+    }
     // cppcheck-suppress unusedFunction
-    virtual uavcan::uint16_t getNumFilters() const { return 0; }
+    virtual uavcan::uint16_t getNumFilters() const { return num_filters; }
     virtual uavcan::uint64_t getErrorCount() const { return num_errors; }
 };
 
@@ -162,17 +221,20 @@ public:
     std::vector<CanIfaceMock> ifaces;
     uavcan::ISystemClock& iclock;
     bool select_failure;
+    unsigned num_select_calls;
 
     CanDriverMock(unsigned num_ifaces, uavcan::ISystemClock& iclock)
         : ifaces(num_ifaces, CanIfaceMock(iclock))
         , iclock(iclock)
         , select_failure(false)
+        , num_select_calls(0)
     { }
 
     virtual uavcan::int16_t select(uavcan::CanSelectMasks& inout_masks, uavcan::MonotonicTime deadline)
     {
         assert(this);
         //std::cout << "Write/read masks: " << inout_write_iface_mask << "/" << inout_read_iface_mask << std::endl;
+        num_select_calls++;
 
         if (select_failure)
         {
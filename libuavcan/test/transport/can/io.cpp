@@ -174,7 +174,7 @@ TEST(CanIOManager, Transmission)
     // Sending to both, both blocked
     driver.ifaces.at(1).writeable = false;
     EXPECT_EQ(0, iomgr.send(frames[1], tsMono(777), tsMono(300), ALL_IFACES_MASK, CanTxQueue::Volatile, flags));
-    EXPECT_EQ(3, pool.getNumUsedBlocks());          // Total 3 frames in TX queue now
+    EXPECT_EQ(2, pool.getNumUsedBlocks());          // The frame for both ifaces takes one block
 
     // Sending to #0, both blocked
     EXPECT_EQ(0, iomgr.send(frames[2], tsMono(888), tsMono(400), 1, CanTxQueue::Persistent, flags));
@@ -182,9 +182,9 @@ TEST(CanIOManager, Transmission)
     EXPECT_EQ(400, clockmock.utc);
     EXPECT_TRUE(driver.ifaces.at(0).tx.empty());
     EXPECT_TRUE(driver.ifaces.at(1).tx.empty());
-    EXPECT_EQ(4, pool.getNumUsedBlocks());
+    EXPECT_EQ(3, pool.getNumUsedBlocks());
 
-    // At this time TX queues are containing the following data:
+    // At this time the TX queue is containing the following data:
     // iface 0: frames[0] (EXPIRED), frames[1], frames[2]
     // iface 1: frames[1]
 
@@ -218,14 +218,13 @@ TEST(CanIOManager, Transmission)
     driver.ifaces.at(0).writeable = false;
     driver.ifaces.at(1).writeable = false;
 
-    // Sending 5 frames, one will be rejected
+    // Sending 5 frames, they take only 3 blocks, so nothing is rejected
     EXPECT_EQ(0, iomgr.send(frames[2], tsMono(2222), tsMono(1000), ALL_IFACES_MASK, CanTxQueue::Persistent, flags));
     EXPECT_EQ(0, iomgr.send(frames[0], tsMono(3333), tsMono(1100), 2, CanTxQueue::Persistent, flags));
-    // One frame kicked here:
     EXPECT_EQ(0, iomgr.send(frames[1], tsMono(4444), tsMono(1200), ALL_IFACES_MASK, CanTxQueue::Volatile, flags));
 
     // State checks
-    EXPECT_EQ(4, pool.getNumUsedBlocks());          // TX queue is full
+    EXPECT_EQ(3, pool.getNumUsedBlocks());
     EXPECT_EQ(1200, clockmock.monotonic);
     EXPECT_EQ(1200, clockmock.utc);
     EXPECT_TRUE(driver.ifaces.at(0).tx.empty());
@@ -249,7 +248,12 @@ TEST(CanIOManager, Transmission)
     EXPECT_EQ(1, iomgr.receive(rx_frame, tsMono(0), flags));
     EXPECT_TRUE(rxFrameEquals(rx_frame, rx_frames[1], 1200, 1));
     EXPECT_TRUE(driver.ifaces.at(0).matchAndPopTx(frames[2], 2222));
-    EXPECT_TRUE(driver.ifaces.at(1).matchAndPopTx(frames[2], 2222));  // Iface #1, frame[1] was rejected (VOLATILE)
+    EXPECT_TRUE(driver.ifaces.at(1).matchAndPopTx(frames[1], 4444));
+    ASSERT_EQ(0, flags);
+    EXPECT_EQ(1, pool.getNumUsedBlocks());          // frames[2] is still pending on iface #1
+
+    EXPECT_EQ(0, iomgr.receive(rx_frame, tsMono(0), flags));
+    EXPECT_TRUE(driver.ifaces.at(1).matchAndPopTx(frames[2], 2222));
     ASSERT_EQ(0, flags);
 
     // State checks
@@ -259,7 +263,7 @@ TEST(CanIOManager, Transmission)
     EXPECT_TRUE(driver.ifaces.at(0).tx.empty());
     EXPECT_TRUE(driver.ifaces.at(1).tx.empty());
     EXPECT_EQ(1, iomgr.getIfacePerfCounters(0).errors);
-    EXPECT_EQ(1, iomgr.getIfacePerfCounters(1).errors); // This is because of rejected frame[1]
+    EXPECT_EQ(0, iomgr.getIfacePerfCounters(1).errors);
 
     /*
      * Error handling
@@ -282,7 +286,7 @@ TEST(CanIOManager, Transmission)
     // Non-blocking - return < 0
     EXPECT_GE(0, iomgr.send(frames[0], tsMono(2200), tsMono(0), ALL_IFACES_MASK, CanTxQueue::Persistent, flags));
 
-    ASSERT_EQ(2, pool.getNumUsedBlocks());               // Untransmitted frames will be buffered
+    ASSERT_EQ(1, pool.getNumUsedBlocks());               // Untransmitted frame will be buffered once for both ifaces
 
     // Failure removed - transmission shall proceed
     driver.ifaces.at(0).tx_failure = false;
@@ -300,7 +304,97 @@ TEST(CanIOManager, Transmission)
     EXPECT_EQ(1, iomgr.getIfacePerfCounters(1).frames_rx);
 
     EXPECT_EQ(6, iomgr.getIfacePerfCounters(0).frames_tx);
-    EXPECT_EQ(8, iomgr.getIfacePerfCounters(1).frames_tx);
+    EXPECT_EQ(9, iomgr.getIfacePerfCounters(1).frames_tx);
+}
+
+TEST(CanIOManager, StalledIfaceDoesNotBlockOthers)
+{
+    using uavcan::CanIOManager;
+    using uavcan::CanTxQueue;
+
+    uavcan::PoolAllocator<sizeof(CanTxQueue::Entry) * 8, sizeof(CanTxQueue::Entry)> pool;
+    uavcan::PoolManager<2> poolmgr;
+    poolmgr.addPool(&pool);
+
+    SystemClockMock clockmock;
+    CanDriverMock driver(2, clockmock);
+
+    CanIOManager iomgr(driver, poolmgr, clockmock, 3);       // Three frames per iface
+
+    const uavcan::CanIOFlags flags = uavcan::CanIOFlags();
+
+    // Iface #1 is bus off, iface #0 is temporarily busy
+    driver.ifaces.at(0).writeable = false;
+    driver.ifaces.at(1).writeable = false;
+
+    // Iface #1 is filled with high priority frames; the rest don't fit its quota and nothing can be replaced
+    for (uint32_t id = 1; id <= 5; id++)
+    {
+        EXPECT_EQ(0, iomgr.send(makeCanFrame(id, "stall", EXT), tsMono(10000), tsMono(0), 2,
+                                CanTxQueue::Persistent, flags));
+    }
+    EXPECT_EQ(3, pool.getNumUsedBlocks());
+    EXPECT_EQ(2, iomgr.getIfacePerfCounters(1).errors);
+
+    // A frame for both ifaces is rejected by the stalled one only
+    const uavcan::CanFrame shared_frame = makeCanFrame(100, "shared", EXT);
+    EXPECT_EQ(0, iomgr.send(shared_frame, tsMono(10000), tsMono(0), 3, CanTxQueue::Volatile, flags));
+    EXPECT_EQ(3, iomgr.getIfacePerfCounters(1).errors);
+
+    // Lower priority and lower QoS frames for the healthy iface are still accepted
+    const uavcan::CanFrame frames[] = { makeCanFrame(200, "a", EXT), makeCanFrame(201, "b", EXT) };
+    EXPECT_EQ(0, iomgr.send(frames[0], tsMono(10000), tsMono(0), 1, CanTxQueue::Volatile, flags));
+    EXPECT_EQ(0, iomgr.send(frames[1], tsMono(10000), tsMono(0), 1, CanTxQueue::Volatile, flags));
+    EXPECT_EQ(6, pool.getNumUsedBlocks());
+    EXPECT_EQ(0, iomgr.getIfacePerfCounters(0).errors);
+
+    // A higher priority frame replaces the lowest priority one on the stalled iface only
+    EXPECT_EQ(0, iomgr.send(makeCanFrame(0, "urgent", EXT), tsMono(10000), tsMono(0), 2,
+                            CanTxQueue::Persistent, flags));
+    EXPECT_EQ(6, pool.getNumUsedBlocks());
+    EXPECT_EQ(4, iomgr.getIfacePerfCounters(1).errors);
+    EXPECT_EQ(0, iomgr.getIfacePerfCounters(0).errors);
+
+    // The healthy iface gets all of its frames through while the other one is still stalled
+    driver.ifaces.at(0).writeable = true;
+    uavcan::CanRxFrame rx_frame;
+    uavcan::CanIOFlags rx_flags = uavcan::CanIOFlags();
+    for (int i = 0; i < 3; i++)
+    {
+        EXPECT_EQ(0, iomgr.receive(rx_frame, tsMono(0), rx_flags));
+    }
+    EXPECT_TRUE(driver.ifaces.at(0).matchAndPopTx(shared_frame, 10000));
+    EXPECT_TRUE(driver.ifaces.at(0).matchAndPopTx(frames[0], 10000));
+    EXPECT_TRUE(driver.ifaces.at(0).matchAndPopTx(frames[1], 10000));
+    EXPECT_TRUE(driver.ifaces.at(0).tx.empty());
+    EXPECT_EQ(3, pool.getNumUsedBlocks());                  // Only the frames of the stalled iface are left
+    EXPECT_EQ(0, iomgr.getIfacePerfCounters(0).errors);
+}
+
+TEST(CanIOManager, BlockingDeadline)
+{
+    using uavcan::CanIOManager;
+    using uavcan::CanTxQueue;
+
+    uavcan::PoolAllocator<sizeof(CanTxQueue::Entry) * 8, sizeof(CanTxQueue::Entry)> pool;
+    uavcan::PoolManager<2> poolmgr;
+    poolmgr.addPool(&pool);
+
+    SystemClockMock clockmock;
+    clockmock.monotonic = 1000;
+    CanDriverMock driver(2, clockmock);
+
+    CanIOManager iomgr(driver, poolmgr, clockmock);
+
+    const uavcan::CanFrame frame = makeCanFrame(123, "frame", EXT);
+
+    // Iface #0 accepts the frame, #1 is blocked; since the deadline has passed, there's only one select() call
+    driver.ifaces.at(1).writeable = false;
+    EXPECT_EQ(1, iomgr.send(frame, tsMono(5000), tsMono(1000), 3, CanTxQueue::Volatile, uavcan::CanIOFlags()));
+    EXPECT_EQ(1, driver.num_select_calls);
+    EXPECT_EQ(1000, clockmock.monotonic);
+    EXPECT_TRUE(driver.ifaces.at(0).matchAndPopTx(frame, 5000));
+    EXPECT_EQ(1, pool.getNumUsedBlocks());                  // Enqueued for iface #1
 }
 
 TEST(CanIOManager, Loopback)
@@ -359,6 +453,82 @@ TEST(CanIOManager, Loopback)
     EXPECT_EQ(0, iomgr.getIfacePerfCounters(1).frames_tx);
 }
 
+TEST(CanIOManager, BurstReception)
+{
+    using uavcan::CanRxFrame;
+
+    // Memory
+    uavcan::PoolAllocator<sizeof(uavcan::CanTxQueue::Entry) * 4, sizeof(uavcan::CanTxQueue::Entry)> pool;
+    uavcan::PoolManager<2> poolmgr;
+    poolmgr.addPool(&pool);
+
+    // Platform interface
+    SystemClockMock clockmock;
+    CanDriverMock driver(2, clockmock);
+    driver.ifaces.at(0).enable_burst_rx = true;       // Second iface relies on the default implementation
+
+    // IO Manager
+    uavcan::CanIOManager iomgr(driver, poolmgr, clockmock);
+
+    CanRxFrame frames[4];
+
+    /*
+     * Empty, will time out
+     */
+    EXPECT_EQ(0, iomgr.receive(frames, 4, tsMono(100)));
+    EXPECT_EQ(100, clockmock.monotonic);
+
+    /*
+     * Five frames from the first iface, two from the second, one loopback
+     */
+    for (int i = 0; i < 5; i++)
+    {
+        driver.ifaces.at(0).pushRx(makeCanFrame(uint32_t(100 + i), "a", EXT));
+    }
+    driver.ifaces.at(1).pushRx(makeCanFrame(200, "b0", EXT));
+    driver.ifaces.at(1).pushRx(makeCanFrame(201, "b1", EXT));
+    driver.ifaces.at(0).loopback.push(CanIfaceMock::FrameWithTime(makeCanFrame(300, "lb", EXT), 100));
+
+    // The first iface fills the whole burst, loopback goes first
+    ASSERT_EQ(4, iomgr.receive(frames, 4, tsMono(0)));
+    EXPECT_EQ(uavcan::CanIOFlagLoopback, frames[0].flags);
+    EXPECT_TRUE(rxFrameEquals(frames[0], makeCanFrame(300, "lb", EXT), 100, 0));
+    for (int i = 1; i < 4; i++)
+    {
+        EXPECT_EQ(0, frames[i].flags);
+        EXPECT_TRUE(rxFrameEquals(frames[i], makeCanFrame(uint32_t(100 + i - 1), "a", EXT), 100, 0));
+    }
+    EXPECT_EQ(1, driver.ifaces.at(0).num_burst_rx_calls);
+    EXPECT_EQ(0, driver.ifaces.at(1).num_burst_rx_calls);
+
+    // Remaining two frames from the first iface and one from the second
+    ASSERT_EQ(3, iomgr.receive(frames, 4, tsMono(0)));
+    EXPECT_TRUE(rxFrameEquals(frames[0], makeCanFrame(103, "a", EXT), 100, 0));
+    EXPECT_TRUE(rxFrameEquals(frames[1], makeCanFrame(104, "a", EXT), 100, 0));
+    EXPECT_TRUE(rxFrameEquals(frames[2], makeCanFrame(200, "b0", EXT), 100, 1));
+
+    ASSERT_EQ(1, iomgr.receive(frames, 4, tsMono(0)));
+    EXPECT_TRUE(rxFrameEquals(frames[0], makeCanFrame(201, "b1", EXT), 100, 1));
+
+    EXPECT_EQ(0, iomgr.receive(frames, 4, tsMono(0)));
+
+    /*
+     * Driver failure is reported only if no frames were received
+     */
+    driver.ifaces.at(0).pushRx(makeCanFrame(400, "a", EXT));
+    driver.ifaces.at(1).pushRx(makeCanFrame(401, "b", EXT));
+    driver.ifaces.at(1).rx_failure = true;
+    ASSERT_EQ(1, iomgr.receive(frames, 4, tsMono(0)));
+    EXPECT_TRUE(rxFrameEquals(frames[0], makeCanFrame(400, "a", EXT), 100, 0));
+    EXPECT_EQ(-uavcan::ErrDriver, iomgr.receive(frames, 4, tsMono(0)));
+
+    /*
+     * Perf counters - loopback frames are not registered as RX
+     */
+    EXPECT_EQ(6, iomgr.getIfacePerfCounters(0).frames_rx);
+    EXPECT_EQ(2, iomgr.getIfacePerfCounters(1).frames_rx);
+}
+
 TEST(CanIOManager, Size)
 {
     std::cout << sizeof(uavcan::CanIOManager) << std::endl;
@@ -2,6 +2,8 @@
  * Copyright (C) 2014 Pavel Kirienko <pavel.kirienko@gmail.com>
  */
 
+#include <cstdlib>
+#include <vector>
 #include <gtest/gtest.h>
 #include <uavcan/transport/can_io.hpp>
 #include "can.hpp"
@@ -9,28 +11,12 @@
 
 static int getQueueLength(uavcan::CanTxQueue& queue)
 {
-    const uavcan::CanTxQueue::Entry* p = queue.peek();
-    int length = 0;
-    while (p)
-    {
-        length++;
-        p = p->getNextListNode();
-    }
-    return length;
+    return int(queue.getLength());
 }
 
 static bool isInQueue(uavcan::CanTxQueue& queue, const uavcan::CanFrame& frame)
 {
-    const uavcan::CanTxQueue::Entry* p = queue.peek();
-    while (p)
-    {
-        if (frame == p->frame)
-        {
-            return true;
-        }
-        p = p->getNextListNode();
-    }
-    return false;
+    return queue.contains(frame);
 }
 
 TEST(CanTxQueue, Qos)
@@ -65,9 +51,10 @@ TEST(CanTxQueue, TxQueue)
     using uavcan::CanTxQueue;
     using uavcan::CanFrame;
 
-    ASSERT_GE(40, sizeof(CanTxQueue::Entry)); // should be true for any platforms, though not required
+    ASSERT_GE(uavcan::MemPoolBlockSize, sizeof(CanTxQueue::Entry));
+    ASSERT_GE(40 + 3 * sizeof(void*), sizeof(CanTxQueue::Entry)); // should be true for any platforms, though not required
 
-    uavcan::PoolAllocator<40 * 4, 40> pool;
+    uavcan::PoolAllocator<uavcan::MemPoolBlockSize * 4, uavcan::MemPoolBlockSize> pool;
     uavcan::PoolManager<2> poolmgr;
     poolmgr.addPool(&pool);
 
@@ -119,12 +106,7 @@ TEST(CanTxQueue, TxQueue)
     EXPECT_TRUE(isInQueue(queue, f3));
     EXPECT_TRUE(isInQueue(queue, f4));
 
-    const CanTxQueue::Entry* p = queue.peek();
-    while (p)
-    {
-        std::cout << p->toString() << std::endl;
-        p = p->getNextListNode();
-    }
+    std::cout << queue.peek()->toString() << std::endl;
 
     /*
      * QoS
@@ -216,3 +198,439 @@ TEST(CanTxQueue, TxQueue)
     EXPECT_FALSE(queue.peek());
     EXPECT_FALSE(queue.topPriorityHigherOrEqual(f0));
 }
+
+TEST(CanTxQueue, RandomizedOrderingAndExpiration)
+{
+    using uavcan::CanTxQueue;
+    using uavcan::CanFrame;
+
+    static const unsigned NumFrames = 300;
+
+    uavcan::PoolAllocator<uavcan::MemPoolBlockSize * NumFrames, uavcan::MemPoolBlockSize> pool;
+    uavcan::PoolManager<1> poolmgr;
+    poolmgr.addPool(&pool);
+
+    SystemClockMock clockmock(1000);
+    CanTxQueue queue(poolmgr, clockmock, NumFrames);
+
+    std::srand(42);
+
+    unsigned num_expired = 0;
+    std::vector<CanFrame> pushed;
+    for (unsigned i = 0; i < NumFrames; i++)
+    {
+        // Narrow ID range ensures there will be plenty of frames of equal priority
+        CanFrame frame = makeCanFrame(uint32_t(std::rand() % 64), "", EXT);
+        frame.dlc = 2;
+        frame.data[0] = uint8_t(i & 0xFF);
+        frame.data[1] = uint8_t(i >> 8);
+        const uint64_t deadline = 1001 + uint64_t(std::rand() % 1000);
+        if (deadline < 1500)
+        {
+            num_expired++;
+        }
+        const CanTxQueue::Qos qos = (std::rand() % 2) ? CanTxQueue::Volatile : CanTxQueue::Persistent;
+        queue.push(frame, tsMono(deadline), qos, 0);
+        pushed.push_back(frame);
+    }
+    ASSERT_EQ(NumFrames, queue.getLength());
+    ASSERT_EQ(NumFrames, pool.getNumUsedBlocks());
+    ASSERT_EQ(0, queue.getRejectedFrameCount());
+    for (unsigned i = 0; i < pushed.size(); i++)
+    {
+        ASSERT_TRUE(isInQueue(queue, pushed[i]));
+    }
+
+    clockmock.monotonic = 1500;
+
+    std::vector<CanFrame> popped;
+    std::vector<uint8_t> popped_qos;
+    while (CanTxQueue::Entry* entry = queue.peek())
+    {
+        ASSERT_FALSE(entry->isExpired(clockmock.getMonotonic()));
+        popped.push_back(entry->frame);
+        popped_qos.push_back(entry->qos);
+        queue.remove(entry);
+    }
+
+    EXPECT_EQ(NumFrames - num_expired, popped.size());
+    EXPECT_EQ(num_expired, queue.getRejectedFrameCount());
+    EXPECT_TRUE(queue.isEmpty());
+    EXPECT_EQ(0, pool.getNumUsedBlocks());
+
+    for (unsigned i = 1; i < popped.size(); i++)
+    {
+        // Priority must not increase; frames of equal priority and QoS must be sent in FIFO order
+        ASSERT_FALSE(popped[i].priorityHigherThan(popped[i - 1]));
+        for (unsigned k = 0; k < i; k++)
+        {
+            if ((popped[k].id == popped[i].id) && (popped_qos[k] == popped_qos[i]))
+            {
+                const unsigned seq_k = popped[k].data[0] | (unsigned(popped[k].data[1]) << 8);
+                const unsigned seq_i = popped[i].data[0] | (unsigned(popped[i].data[1]) << 8);
+                ASSERT_LT(seq_k, seq_i);
+            }
+        }
+    }
+}
+
+TEST(CanTxQueue, ExpirationUnderMemoryPressure)
+{
+    using uavcan::CanTxQueue;
+
+    uavcan::PoolAllocator<uavcan::MemPoolBlockSize * 64, uavcan::MemPoolBlockSize> pool;
+    uavcan::PoolManager<1> poolmgr;
+    poolmgr.addPool(&pool);
+
+    SystemClockMock clockmock(100);
+    CanTxQueue queue(poolmgr, clockmock, 32);
+
+    // Every other frame expires at 200
+    for (unsigned i = 0; i < 32; i++)
+    {
+        queue.push(makeCanFrame(1000 - i, "", EXT), tsMono((i % 2) ? 200 : 1000), CanTxQueue::Persistent, 0);
+    }
+    EXPECT_EQ(32, queue.getLength());
+
+    clockmock.monotonic = 300;
+    queue.push(makeCanFrame(5000, "", EXT), tsMono(1000), CanTxQueue::Volatile, 0);  // All expired will be purged
+    EXPECT_EQ(17, queue.getLength());
+    EXPECT_EQ(16, queue.getRejectedFrameCount());
+    EXPECT_EQ(17, pool.getNumUsedBlocks());
+    EXPECT_TRUE(isInQueue(queue, makeCanFrame(5000, "", EXT)));
+    EXPECT_FALSE(isInQueue(queue, makeCanFrame(999, "", EXT)));
+    EXPECT_TRUE(isInQueue(queue, makeCanFrame(1000, "", EXT)));
+}
+
+/**
+ * Frames of a transfer have consecutive CAN IDs, so that their priority decreases with the index.
+ */
+class TestTxFrameSource : public uavcan::ICanTxFrameSource
+{
+    const uint32_t first_id_;
+    const unsigned num_frames_;
+    const int id_step_;
+
+public:
+    TestTxFrameSource(uint32_t first_id, unsigned num_frames, int id_step = 1)
+        : first_id_(first_id)
+        , num_frames_(num_frames)
+        , id_step_(id_step)
+    { }
+
+    virtual unsigned getNumFrames() const { return num_frames_; }
+
+    virtual void buildFrame(unsigned index, uavcan::CanFrame& out_frame) const
+    {
+        out_frame = makeCanFrame(uint32_t(int(first_id_) + int(index) * id_step_), "12345678", EXT);
+    }
+};
+
+TEST(CanTxQueue, TransferAdmission)
+{
+    using uavcan::CanTxQueue;
+
+    uavcan::PoolAllocator<uavcan::MemPoolBlockSize * 64, uavcan::MemPoolBlockSize> pool;
+    uavcan::PoolManager<1> poolmgr;
+    poolmgr.addPool(&pool);
+
+    SystemClockMock clockmock(100);
+    CanTxQueue queue(poolmgr, clockmock, 8);
+
+    // Fits completely
+    queue.push(TestTxFrameSource(1000, 6), 0, tsMono(1000), CanTxQueue::Volatile, 0);
+    EXPECT_EQ(6, queue.getLength());
+    EXPECT_TRUE(isInQueue(queue, makeCanFrame(1005, "12345678", EXT)));
+
+    // Two frames fit, the rest replaces the lowest QoS entry; its whole transfer is purged along with it
+    queue.push(TestTxFrameSource(500, 4), 0, tsMono(1000), CanTxQueue::Persistent, 0);
+    EXPECT_EQ(4, queue.getLength());
+    EXPECT_EQ(1, queue.getRejectedFrameCount());    // The replaced frame; the purged ones are counted apart
+    EXPECT_EQ(5, queue.getPurgedFrameCount());
+    EXPECT_FALSE(isInQueue(queue, makeCanFrame(1000, "12345678", EXT)));
+    EXPECT_TRUE(isInQueue(queue, makeCanFrame(503, "12345678", EXT)));
+
+    queue.push(TestTxFrameSource(600, 4), 0, tsMono(1000), CanTxQueue::Persistent, 0);
+    EXPECT_EQ(8, queue.getLength());
+
+    // Nothing to replace, the transfer is rolled back completely; only the last two frames are enqueued
+    queue.push(TestTxFrameSource(2000, 5), 3, tsMono(1000), CanTxQueue::Volatile, 0);
+    EXPECT_EQ(8, queue.getLength());
+    EXPECT_EQ(3, queue.getRejectedFrameCount());
+    EXPECT_EQ(8, pool.getNumUsedBlocks());
+    EXPECT_FALSE(isInQueue(queue, makeCanFrame(2003, "12345678", EXT)));
+
+    // Already expired
+    queue.push(TestTxFrameSource(10, 3), 0, tsMono(100), CanTxQueue::Persistent, 0);
+    EXPECT_EQ(6, queue.getRejectedFrameCount());
+    EXPECT_EQ(5, queue.getPurgedFrameCount());
+
+    // Transmission order
+    uint32_t prev_id = 0;
+    while (CanTxQueue::Entry* entry = queue.peek())
+    {
+        EXPECT_LT(prev_id, entry->frame.id & uavcan::CanFrame::MaskExtID);
+        prev_id = entry->frame.id & uavcan::CanFrame::MaskExtID;
+        queue.remove(entry);
+    }
+    EXPECT_EQ(603, prev_id);
+    EXPECT_EQ(0, pool.getNumUsedBlocks());
+}
+
+TEST(CanTxQueue, TransferAdmissionNoEviction)
+{
+    using uavcan::CanTxQueue;
+
+    uavcan::PoolAllocator<uavcan::MemPoolBlockSize * 64, uavcan::MemPoolBlockSize> pool;
+    uavcan::PoolManager<1> poolmgr;
+    poolmgr.addPool(&pool);
+
+    SystemClockMock clockmock(100);
+    CanTxQueue queue(poolmgr, clockmock, 6);
+
+    queue.push(makeCanFrame(1000, "a", EXT), tsMono(1000), CanTxQueue::Volatile, 0);
+    queue.push(makeCanFrame(1000, "b", EXT), tsMono(1000), CanTxQueue::Volatile, 0);
+    queue.push(makeCanFrame(1001, "", EXT), tsMono(1000), CanTxQueue::Volatile, 0);
+    queue.push(makeCanFrame(1002, "", EXT), tsMono(1000), CanTxQueue::Volatile, 0);
+    queue.push(makeCanFrame(10, "", EXT), tsMono(1000), CanTxQueue::Persistent, 0);
+    queue.push(makeCanFrame(11, "", EXT), tsMono(1000), CanTxQueue::Persistent, 0);
+    EXPECT_EQ(6, queue.getLength());
+
+    // Only four entries can be replaced, which is not enough for five frames; nothing is replaced then
+    queue.push(TestTxFrameSource(500, 5), 0, tsMono(1000), CanTxQueue::Persistent, 0);
+    EXPECT_EQ(6, queue.getLength());
+    EXPECT_EQ(5, queue.getRejectedFrameCount());
+    EXPECT_EQ(0, queue.getPurgedFrameCount());
+    EXPECT_EQ(6, pool.getNumUsedBlocks());
+    EXPECT_TRUE(isInQueue(queue, makeCanFrame(1000, "a", EXT)));
+    EXPECT_TRUE(isInQueue(queue, makeCanFrame(1000, "b", EXT)));
+    EXPECT_TRUE(isInQueue(queue, makeCanFrame(1001, "", EXT)));
+    EXPECT_TRUE(isInQueue(queue, makeCanFrame(1002, "", EXT)));
+    EXPECT_FALSE(isInQueue(queue, makeCanFrame(500, "12345678", EXT)));
+
+    // Single frames replace the lowest priority entries, the oldest one first on equal priority
+    queue.push(makeCanFrame(100, "", EXT), tsMono(1000), CanTxQueue::Persistent, 0);
+    queue.push(makeCanFrame(101, "", EXT), tsMono(1000), CanTxQueue::Persistent, 0);
+    queue.push(makeCanFrame(102, "", EXT), tsMono(1000), CanTxQueue::Persistent, 0);
+    EXPECT_EQ(6, queue.getLength());
+    EXPECT_EQ(8, queue.getRejectedFrameCount());
+    EXPECT_FALSE(isInQueue(queue, makeCanFrame(1002, "", EXT)));
+    EXPECT_FALSE(isInQueue(queue, makeCanFrame(1001, "", EXT)));
+    EXPECT_FALSE(isInQueue(queue, makeCanFrame(1000, "a", EXT)));
+    EXPECT_TRUE(isInQueue(queue, makeCanFrame(1000, "b", EXT)));
+    EXPECT_TRUE(isInQueue(queue, makeCanFrame(102, "", EXT)));
+}
+
+TEST(CanTxQueue, TransferPurge)
+{
+    using uavcan::CanTxQueue;
+
+    uavcan::PoolAllocator<uavcan::MemPoolBlockSize * 64, uavcan::MemPoolBlockSize> pool;
+    uavcan::PoolManager<1> poolmgr;
+    poolmgr.addPool(&pool);
+
+    SystemClockMock clockmock(100);
+    CanTxQueue queue(poolmgr, clockmock, 6);
+
+    // Frames of one transfer interleaved with a single frame transfer
+    queue.push(TestTxFrameSource(1000, 5), 0, tsMono(1000), CanTxQueue::Volatile, 0);
+    queue.push(makeCanFrame(1002, "1234", EXT), tsMono(2000), CanTxQueue::Volatile, 0);
+    EXPECT_EQ(6, queue.getLength());
+
+    // The lowest priority frame of the transfer is replaced, the other four are not worth transmitting anymore
+    queue.push(makeCanFrame(100, "", EXT), tsMono(1000), CanTxQueue::Persistent, 0);
+    EXPECT_EQ(2, queue.getLength());
+    EXPECT_EQ(1, queue.getRejectedFrameCount());    // Each dropped frame is counted once
+    EXPECT_EQ(4, queue.getPurgedFrameCount());
+    EXPECT_EQ(4 * (67 + 8 * 8), queue.getSavedBusBitCount());
+    EXPECT_TRUE(isInQueue(queue, makeCanFrame(1002, "1234", EXT)));
+    EXPECT_TRUE(isInQueue(queue, makeCanFrame(100, "", EXT)));
+
+    // Expired transfers are purged as well, but that doesn't save anything
+    queue.push(TestTxFrameSource(300, 3), 0, tsMono(1000), CanTxQueue::Volatile, 0);
+    EXPECT_EQ(5, queue.getLength());
+    clockmock.advance(1000);
+    CanTxQueue::Entry* entry = queue.peek();
+    ASSERT_TRUE(entry);
+    EXPECT_TRUE(entry->frame == makeCanFrame(1002, "1234", EXT));
+    EXPECT_EQ(1, queue.getLength());
+    EXPECT_EQ(3, queue.getRejectedFrameCount());
+    EXPECT_EQ(6, queue.getPurgedFrameCount());
+    EXPECT_EQ(4 * (67 + 8 * 8), queue.getSavedBusBitCount());
+
+    // Successful transmission of a frame doesn't affect the rest of its transfer
+    queue.push(TestTxFrameSource(4000, 2), 0, tsMono(3000), CanTxQueue::Volatile, 0);
+    queue.remove(entry);
+    entry = queue.peek();
+    ASSERT_TRUE(entry);
+    queue.remove(entry);
+    EXPECT_EQ(1, queue.getLength());
+    EXPECT_EQ(6, queue.getPurgedFrameCount());
+
+    while ((entry = queue.peek()) != NULL)
+    {
+        queue.remove(entry);
+    }
+    EXPECT_EQ(0, pool.getNumUsedBlocks());
+}
+
+/**
+ * Frames of a real transfer share the CAN ID; the payload keeps the transfer name and the frame index.
+ */
+class SameIdTxFrameSource : public uavcan::ICanTxFrameSource
+{
+    const char name_;
+    const unsigned num_frames_;
+
+public:
+    SameIdTxFrameSource(char name, unsigned num_frames)
+        : name_(name)
+        , num_frames_(num_frames)
+    { }
+
+    virtual unsigned getNumFrames() const { return num_frames_; }
+
+    virtual void buildFrame(unsigned index, uavcan::CanFrame& out_frame) const
+    {
+        out_frame = makeFrame(index);
+    }
+
+    uavcan::CanFrame makeFrame(unsigned index) const
+    {
+        const char data[] = { name_, char('0' + index), '\0' };
+        return makeCanFrame(1000, data, EXT);
+    }
+};
+
+TEST(CanTxQueue, TransferPurgeSameId)
+{
+    using uavcan::CanTxQueue;
+
+    uavcan::PoolAllocator<uavcan::MemPoolBlockSize * 64, uavcan::MemPoolBlockSize> pool;
+    uavcan::PoolManager<1> poolmgr;
+    poolmgr.addPool(&pool);
+
+    SystemClockMock clockmock(100);
+    CanTxQueue queue(poolmgr, clockmock, 8);
+
+    const SameIdTxFrameSource a('a', 3);
+    const SameIdTxFrameSource b('b', 3);
+    const SameIdTxFrameSource c('c', 5);
+    queue.push(a, 0, tsMono(1000), CanTxQueue::Volatile, 0);
+    queue.push(b, 0, tsMono(2000), CanTxQueue::Volatile, 0);
+    EXPECT_EQ(6, queue.getLength());
+
+    // Frames are transmitted in order
+    CanTxQueue::Entry* entry = queue.peek();
+    ASSERT_TRUE(entry);
+    EXPECT_TRUE(entry->frame == a.makeFrame(0));
+    queue.remove(entry);
+    entry = queue.peek();
+    ASSERT_TRUE(entry);
+    EXPECT_TRUE(entry->frame == a.makeFrame(1));
+
+    // The expired transfer is purged, the adjacent one of the same CAN ID is not affected
+    clockmock.advance(1000);
+    entry = queue.peek();
+    ASSERT_TRUE(entry);
+    EXPECT_TRUE(entry->frame == b.makeFrame(0));
+    EXPECT_EQ(3, queue.getLength());
+    EXPECT_EQ(1, queue.getRejectedFrameCount());
+    EXPECT_EQ(1, queue.getPurgedFrameCount());
+
+    // The oldest transfer is replaced and purged as a whole
+    queue.push(c, 0, tsMono(3000), CanTxQueue::Volatile, 0);
+    EXPECT_EQ(8, queue.getLength());
+    queue.push(makeCanFrame(100, "", EXT), tsMono(3000), CanTxQueue::Persistent, 0);
+    EXPECT_EQ(6, queue.getLength());
+    EXPECT_EQ(2, queue.getRejectedFrameCount());
+    EXPECT_EQ(3, queue.getPurgedFrameCount());
+    EXPECT_EQ(2 * (67 + 8 * 2), queue.getSavedBusBitCount());
+
+    entry = queue.peek();
+    ASSERT_TRUE(entry);
+    EXPECT_TRUE(entry->frame == makeCanFrame(100, "", EXT));
+    queue.remove(entry);
+    for (unsigned i = 0; i < 5; i++)
+    {
+        entry = queue.peek();
+        ASSERT_TRUE(entry);
+        EXPECT_TRUE(entry->frame == c.makeFrame(i));
+        queue.remove(entry);
+    }
+    EXPECT_TRUE(queue.isEmpty());
+    EXPECT_EQ(0, pool.getNumUsedBlocks());
+}
+
+TEST(CanTxQueue, SharedEntries)
+{
+    using uavcan::CanTxQueue;
+
+    uavcan::PoolAllocator<uavcan::MemPoolBlockSize * 64, uavcan::MemPoolBlockSize> pool;
+    uavcan::PoolManager<1> poolmgr;
+    poolmgr.addPool(&pool);
+
+    SystemClockMock clockmock(100);
+    CanTxQueue queue(poolmgr, clockmock, 8);
+
+    // One block per frame regardless of the number of ifaces
+    queue.push(makeCanFrame(200, "a", EXT), tsMono(1000), CanTxQueue::Volatile, 0, 7);
+    queue.push(makeCanFrame(100, "b", EXT), tsMono(1000), CanTxQueue::Volatile, 0, 2);
+    EXPECT_EQ(2, queue.getLength());
+    EXPECT_EQ(2, pool.getNumUsedBlocks());
+    EXPECT_EQ(7, queue.getPendingIfaceMask());
+
+    // Every iface sees its own top
+    EXPECT_TRUE(queue.peek(0)->frame == makeCanFrame(200, "a", EXT));
+    EXPECT_TRUE(queue.peek(1)->frame == makeCanFrame(100, "b", EXT));
+    EXPECT_TRUE(queue.peek(2)->frame == makeCanFrame(200, "a", EXT));
+    EXPECT_FALSE(queue.topPriorityHigherOrEqual(makeCanFrame(150, "", EXT), 0));
+    EXPECT_TRUE(queue.topPriorityHigherOrEqual(makeCanFrame(150, "", EXT), 1));
+
+    // The entry is freed once transmitted on all ifaces
+    CanTxQueue::Entry* entry = queue.peek(0);
+    queue.remove(entry, 0);
+    EXPECT_FALSE(entry);
+    EXPECT_FALSE(queue.peek(0));
+    EXPECT_EQ(6, queue.getPendingIfaceMask());
+    entry = queue.peek(2);
+    queue.remove(entry, 2);
+    EXPECT_EQ(2, queue.getLength());
+    EXPECT_EQ(2, queue.getPendingIfaceMask());
+    entry = queue.peek(1);
+    queue.remove(entry, 1);
+    entry = queue.peek(1);
+    queue.remove(entry, 1);
+    EXPECT_TRUE(queue.isEmpty());
+    EXPECT_EQ(0, queue.getPendingIfaceMask());
+    EXPECT_EQ(0, pool.getNumUsedBlocks());
+
+    // Ifaces that have progressed further don't get the frames they have already transmitted
+    // Frame IDs are descending, so that the first frame is the lowest priority one
+    const unsigned first_index[uavcan::MaxCanIfaces] = { 0, 2, 0 };
+    queue.push(TestTxFrameSource(1003, 4, -1), first_index, 3, tsMono(1000), CanTxQueue::Volatile, 0);
+    EXPECT_EQ(4, queue.getLength());
+    EXPECT_EQ(1000, queue.peek(0)->frame.id & uavcan::CanFrame::MaskExtID);
+    EXPECT_EQ(1000, queue.peek(1)->frame.id & uavcan::CanFrame::MaskExtID);
+    EXPECT_FALSE(queue.peek(2));
+
+    // The first frame is replaced; the transfer is purged only from the iface where that frame was pending
+    queue.push(TestTxFrameSource(500, 5), 0, tsMono(1000), CanTxQueue::Persistent, 0, 1);
+    EXPECT_EQ(7, queue.getLength());
+    EXPECT_EQ(1, queue.getRejectedFrameCount(0));
+    EXPECT_EQ(0, queue.getRejectedFrameCount(1));
+    EXPECT_EQ(3, queue.getPurgedFrameCount(0));
+    EXPECT_EQ(0, queue.getPurgedFrameCount(1));
+    EXPECT_EQ(500, queue.peek(0)->frame.id & uavcan::CanFrame::MaskExtID);
+    EXPECT_EQ(1000, queue.peek(1)->frame.id & uavcan::CanFrame::MaskExtID);
+    EXPECT_EQ(0, queue.getRejectedFrameCount(2));
+
+    for (uint8_t i = 0; i < uavcan::MaxCanIfaces; i++)
+    {
+        while ((entry = queue.peek(i)) != NULL)
+        {
+            queue.remove(entry, i);
+        }
+    }
+    EXPECT_EQ(0, pool.getNumUsedBlocks());
+}
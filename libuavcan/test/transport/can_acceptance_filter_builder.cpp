@@ -0,0 +1,170 @@
+/*
+ * Copyright (C) 2014 Pavel Kirienko <pavel.kirienko@gmail.com>
+ */
+
+#include <cstdlib>
+#include <vector>
+#include <gtest/gtest.h>
+#include <uavcan/transport/can_acceptance_filter_builder.hpp>
+#include <uavcan/transport/frame.hpp>
+
+
+static uint32_t makeCanID(uavcan::DataTypeID dtid, uavcan::TransferType tt, uavcan::NodeID src)
+{
+    const uavcan::NodeID unicast_dst((src.get() == 1) ? 2 : 1);
+    const uavcan::NodeID dst = (tt == uavcan::TransferTypeMessageBroadcast) ? uavcan::NodeID::Broadcast : unicast_dst;
+    uavcan::Frame frame(dtid, tt, src, dst, 0, 0, true);
+    uavcan::CanFrame can_frame;
+    EXPECT_TRUE(frame.compile(can_frame));
+    return can_frame.id;
+}
+
+static bool isAccepted(const uavcan::CanAcceptanceFilterBuilder& builder, uint32_t can_id)
+{
+    for (unsigned i = 0; i < builder.getNumConfigs(); i++)
+    {
+        if (uavcan::CanAcceptanceFilterBuilder::accepts(builder.getConfigs()[i], can_id))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+
+TEST(CanAcceptanceFilterBuilder, Exact)
+{
+    using namespace uavcan;
+
+    CanFilterConfig configs[8];
+    CanAcceptanceFilterBuilder builder(configs, 8);
+
+    builder.addMessageFilter(341);
+    builder.addTransferFilter(12, TransferTypeServiceRequest);
+    builder.addTransferFilter(12, TransferTypeServiceResponse);
+    builder.addSourceNodeFilter(42);
+    ASSERT_EQ(4, builder.getNumConfigs());
+
+    // Repeated and covered rules are not added
+    builder.addMessageFilter(341);
+    builder.addSourceNodeFilter(42);
+    ASSERT_EQ(4, builder.getNumConfigs());
+
+    EXPECT_TRUE(isAccepted(builder, makeCanID(341, TransferTypeMessageBroadcast, 1)));
+    EXPECT_TRUE(isAccepted(builder, makeCanID(341, TransferTypeMessageUnicast, 127)));
+    EXPECT_FALSE(isAccepted(builder, makeCanID(341, TransferTypeServiceRequest, 1)));
+    EXPECT_FALSE(isAccepted(builder, makeCanID(340, TransferTypeMessageBroadcast, 1)));
+
+    EXPECT_TRUE(isAccepted(builder, makeCanID(12, TransferTypeServiceRequest, 1)));
+    EXPECT_TRUE(isAccepted(builder, makeCanID(12, TransferTypeServiceResponse, 1)));
+    EXPECT_FALSE(isAccepted(builder, makeCanID(12, TransferTypeMessageBroadcast, 1)));
+    EXPECT_FALSE(isAccepted(builder, makeCanID(13, TransferTypeServiceRequest, 1)));
+
+    EXPECT_TRUE(isAccepted(builder, makeCanID(1000, TransferTypeMessageBroadcast, 42)));
+    EXPECT_TRUE(isAccepted(builder, makeCanID(0, TransferTypeServiceResponse, 42)));
+
+    // Standard and RTR frames are rejected
+    EXPECT_FALSE(isAccepted(builder, makeCanID(341, TransferTypeMessageBroadcast, 1) & CanFrame::MaskStdID));
+    EXPECT_FALSE(isAccepted(builder, makeCanID(341, TransferTypeMessageBroadcast, 1) | CanFrame::FlagRTR));
+
+    // All data types of one transfer type
+    EXPECT_FALSE(isAccepted(builder, makeCanID(777, TransferTypeServiceResponse, 1)));
+    builder.addTransferTypeFilter(TransferTypeServiceResponse);
+    ASSERT_EQ(5, builder.getNumConfigs());
+    EXPECT_TRUE(isAccepted(builder, makeCanID(777, TransferTypeServiceResponse, 1)));
+    EXPECT_TRUE(isAccepted(builder, makeCanID(0, TransferTypeServiceResponse, 127)));
+    EXPECT_FALSE(isAccepted(builder, makeCanID(777, TransferTypeServiceRequest, 1)));
+    EXPECT_FALSE(isAccepted(builder, makeCanID(777, TransferTypeServiceResponse, 1) | CanFrame::FlagRTR));
+
+    builder.addTransferFilter(12, TransferTypeServiceResponse);     // Already covered
+    ASSERT_EQ(5, builder.getNumConfigs());
+}
+
+TEST(CanAcceptanceFilterBuilder, ZeroCapacity)
+{
+    uavcan::CanAcceptanceFilterBuilder builder(NULL, 0);
+    builder.addMessageFilter(1);
+    builder.addSourceNodeFilter(1);
+    ASSERT_EQ(0, builder.getNumConfigs());
+}
+
+TEST(CanAcceptanceFilterBuilder, Merging)
+{
+    using namespace uavcan;
+
+    CanFilterConfig configs[2];
+    CanAcceptanceFilterBuilder builder(configs, 2);
+
+    // Adjacent data type IDs are merged first
+    builder.addMessageFilter(100);
+    builder.addMessageFilter(900);
+    builder.addMessageFilter(101);
+    ASSERT_EQ(2, builder.getNumConfigs());
+
+    EXPECT_TRUE(isAccepted(builder, makeCanID(100, TransferTypeMessageBroadcast, 1)));
+    EXPECT_TRUE(isAccepted(builder, makeCanID(101, TransferTypeMessageBroadcast, 1)));
+    EXPECT_TRUE(isAccepted(builder, makeCanID(900, TransferTypeMessageBroadcast, 1)));
+    EXPECT_FALSE(isAccepted(builder, makeCanID(102, TransferTypeMessageBroadcast, 1)));
+    EXPECT_FALSE(isAccepted(builder, makeCanID(901, TransferTypeMessageBroadcast, 1)));
+
+    // The rule that is already accepted doesn't cause merging
+    builder.addMessageFilter(101);
+    EXPECT_FALSE(isAccepted(builder, makeCanID(102, TransferTypeMessageBroadcast, 1)));
+}
+
+TEST(CanAcceptanceFilterBuilder, Randomized)
+{
+    using namespace uavcan;
+
+    std::srand(42);
+
+    for (unsigned iteration = 0; iteration < 200; iteration++)
+    {
+        const unsigned capacity = 1 + unsigned(std::rand()) % 8;
+        std::vector<CanFilterConfig> configs(capacity);
+        CanAcceptanceFilterBuilder builder(&configs[0], capacity);
+
+        std::vector<uint32_t> wanted;
+        const unsigned num_rules = unsigned(std::rand()) % 20;
+        for (unsigned i = 0; i < num_rules; i++)
+        {
+            const DataTypeID dtid(uint16_t(std::rand() % (DataTypeID::Max + 1)));
+            const NodeID src(uint8_t(1 + std::rand() % NodeID::Max));
+            switch (std::rand() % 4)
+            {
+            case 0:
+            {
+                builder.addMessageFilter(dtid);
+                wanted.push_back(makeCanID(dtid, TransferTypeMessageBroadcast, src));
+                wanted.push_back(makeCanID(dtid, TransferTypeMessageUnicast, src));
+                break;
+            }
+            case 1:
+            {
+                builder.addTransferFilter(dtid, TransferTypeServiceRequest);
+                wanted.push_back(makeCanID(dtid, TransferTypeServiceRequest, src));
+                break;
+            }
+            case 2:
+            {
+                builder.addTransferFilter(dtid, TransferTypeServiceResponse);
+                wanted.push_back(makeCanID(dtid, TransferTypeServiceResponse, src));
+                break;
+            }
+            default:
+            {
+                builder.addSourceNodeFilter(src);
+                wanted.push_back(makeCanID(dtid, TransferTypeServiceResponse, src));
+                wanted.push_back(makeCanID(dtid, TransferTypeMessageBroadcast, src));
+                break;
+            }
+            }
+            ASSERT_GE(capacity, builder.getNumConfigs());
+        }
+
+        for (unsigned i = 0; i < wanted.size(); i++)
+        {
+            ASSERT_TRUE(isAccepted(builder, wanted[i]));
+        }
+    }
+}
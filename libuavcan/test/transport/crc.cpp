@@ -2,6 +2,7 @@
  * Copyright (C) 2014 Pavel Kirienko <pavel.kirienko@gmail.com>
  */
 
+#include <cstdlib>
 #include <gtest/gtest.h>
 #include <uavcan/transport/crc.hpp>
 
@@ -30,3 +31,32 @@ TEST(TransferCRC, Correctness)
     crc.add(reinterpret_cast<const uint8_t*>("456789"), 6);
     ASSERT_EQ(0x29B1, crc.get());
 }
+
+TEST(TransferCRC, MultiByteKernel)
+{
+    std::srand(0);
+
+    uint8_t data[512];
+    for (unsigned i = 0; i < sizeof(data); i++)
+    {
+        data[i] = uint8_t(std::rand());
+    }
+
+    // Every length and misalignment up to the kernel width, with non-default initial values
+    for (unsigned offset = 0; offset < 16; offset++)
+    {
+        for (unsigned len = 0; len < (sizeof(data) - offset); len += (len < 40) ? 1 : 37)
+        {
+            uavcan::TransferCRC bulk;
+            bulk.add(uint8_t(offset));
+            uavcan::TransferCRC bytewise = bulk;
+
+            bulk.add(data + offset, len);
+            for (unsigned i = 0; i < len; i++)
+            {
+                bytewise.add(data[offset + i]);
+            }
+            ASSERT_EQ(bytewise.get(), bulk.get()) << "offset " << offset << " len " << len;
+        }
+    }
+}
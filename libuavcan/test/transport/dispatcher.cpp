@@ -222,6 +222,351 @@ TEST(Dispatcher, Reception)
 }
 
 
+TEST(Dispatcher, ListenerChains)
+{
+    uavcan::PoolAllocator<uavcan::MemPoolBlockSize * 8, uavcan::MemPoolBlockSize> pool;
+    uavcan::PoolManager<1> poolmgr;
+    poolmgr.addPool(&pool);
+
+    SystemClockMock clockmock(100);
+    CanDriverMock driver(1, clockmock);
+    driver.ifaces.at(0).enable_burst_rx = true;
+
+    uavcan::OutgoingTransferRegistry<8> out_trans_reg(poolmgr);
+
+    uavcan::Dispatcher dispatcher(driver, poolmgr, clockmock, out_trans_reg);
+    ASSERT_TRUE(dispatcher.setNodeID(SELF_NODE_ID));
+
+    DispatcherTransferEmulator emulator(driver, SELF_NODE_ID);
+
+    const uavcan::DataTypeDescriptor type_a = makeDataType(uavcan::DataTypeKindMessage, 5);
+    const uavcan::DataTypeDescriptor type_b = makeDataType(uavcan::DataTypeKindMessage, 0);
+    const uavcan::DataTypeDescriptor type_c = makeDataType(uavcan::DataTypeKindMessage, 1023);
+
+    typedef TestListener<64, 1, 1> Subscriber;
+    Subscriber a1(dispatcher.getTransferPerfCounter(), type_a, poolmgr);
+    Subscriber a2(dispatcher.getTransferPerfCounter(), type_a, poolmgr);
+    Subscriber a3(dispatcher.getTransferPerfCounter(), type_a, poolmgr);
+    Subscriber b(dispatcher.getTransferPerfCounter(), type_b, poolmgr);
+    Subscriber c(dispatcher.getTransferPerfCounter(), type_c, poolmgr);
+
+    ASSERT_TRUE(dispatcher.registerMessageListener(&a1));
+    ASSERT_TRUE(dispatcher.registerMessageListener(&b));
+    ASSERT_TRUE(dispatcher.registerMessageListener(&a2));
+    ASSERT_TRUE(dispatcher.registerMessageListener(&c));
+    ASSERT_TRUE(dispatcher.registerMessageListener(&a3));
+
+    ASSERT_TRUE(dispatcher.hasSubscriber(0));
+    ASSERT_TRUE(dispatcher.hasSubscriber(5));
+    ASSERT_TRUE(dispatcher.hasSubscriber(1023));
+    ASSERT_FALSE(dispatcher.hasSubscriber(1));
+    ASSERT_FALSE(dispatcher.hasSubscriber(4));
+    ASSERT_FALSE(dispatcher.hasSubscriber(6));
+    ASSERT_FALSE(dispatcher.hasServer(5));
+
+    // Descending order by data type ID, registration order within the same data type
+    {
+        const uavcan::TransferListenerBase* const expected[] = { &c, &a1, &a2, &a3, &b };
+        const uavcan::TransferListenerBase* p = dispatcher.getListOfMessageListeners().get();
+        for (unsigned i = 0; i < sizeof(expected) / sizeof(expected[0]); i++)
+        {
+            ASSERT_EQ(expected[i], p);
+            p = p->getNextListNode();
+        }
+        ASSERT_FALSE(p);
+    }
+
+    /*
+     * Every listener of the chain receives the transfer
+     */
+    const Transfer tr_a = emulator.makeTransfer(uavcan::TransferTypeMessageBroadcast, 10, "abc", type_a);
+    const Transfer tr_b = emulator.makeTransfer(uavcan::TransferTypeMessageBroadcast, 11, "def", type_b);
+    const Transfer tr_unknown = emulator.makeTransfer(uavcan::TransferTypeMessageBroadcast, 12, "ghi",
+                                                      makeDataType(uavcan::DataTypeKindMessage, 6));
+    emulator.send(&tr_a, 1);
+    emulator.send(&tr_b, 1);
+    emulator.send(&tr_unknown, 1);
+    ASSERT_EQ(3, dispatcher.spin(tsMono(0)));
+
+    ASSERT_TRUE(a1.matchAndPop(tr_a));
+    ASSERT_TRUE(a2.matchAndPop(tr_a));
+    ASSERT_TRUE(a3.matchAndPop(tr_a));
+    ASSERT_TRUE(b.matchAndPop(tr_b));
+    ASSERT_TRUE(c.isEmpty());
+
+    /*
+     * Removal of the chain head, then the tail, then the last one
+     */
+    dispatcher.unregisterMessageListener(&a1);
+    ASSERT_TRUE(dispatcher.hasSubscriber(5));
+    dispatcher.unregisterMessageListener(&a1);            // Repeated removal has no effect
+    ASSERT_TRUE(dispatcher.hasSubscriber(5));
+
+    const Transfer tr_a2 = emulator.makeTransfer(uavcan::TransferTypeMessageBroadcast, 10, "jkl", type_a);
+    emulator.send(&tr_a2, 1);
+    ASSERT_EQ(1, dispatcher.spin(tsMono(0)));
+    ASSERT_TRUE(a1.isEmpty());
+    ASSERT_TRUE(a2.matchAndPop(tr_a2));
+    ASSERT_TRUE(a3.matchAndPop(tr_a2));
+
+    dispatcher.unregisterMessageListener(&a3);
+    ASSERT_TRUE(dispatcher.hasSubscriber(5));
+    dispatcher.unregisterMessageListener(&a2);
+    ASSERT_FALSE(dispatcher.hasSubscriber(5));
+    ASSERT_TRUE(dispatcher.hasSubscriber(0));
+    ASSERT_TRUE(dispatcher.hasSubscriber(1023));
+    ASSERT_EQ(2, dispatcher.getNumMessageListeners());
+
+    const Transfer tr_a3 = emulator.makeTransfer(uavcan::TransferTypeMessageBroadcast, 10, "mno", type_a);
+    emulator.send(&tr_a3, 1);
+    ASSERT_EQ(1, dispatcher.spin(tsMono(0)));
+    ASSERT_TRUE(a1.isEmpty());
+    ASSERT_TRUE(a2.isEmpty());
+    ASSERT_TRUE(a3.isEmpty());
+
+    // Re-registration starts a new chain
+    ASSERT_TRUE(dispatcher.registerMessageListener(&a3));
+    ASSERT_TRUE(dispatcher.hasSubscriber(5));
+
+    dispatcher.unregisterMessageListener(&a3);
+    dispatcher.unregisterMessageListener(&b);
+    dispatcher.unregisterMessageListener(&c);
+    ASSERT_FALSE(dispatcher.hasSubscriber(0));
+    ASSERT_FALSE(dispatcher.hasSubscriber(1023));
+    ASSERT_EQ(0, dispatcher.getNumMessageListeners());
+}
+
+
+TEST(Dispatcher, IncrementalCleanup)
+{
+    uavcan::PoolAllocator<uavcan::MemPoolBlockSize * 16, uavcan::MemPoolBlockSize> pool;
+    uavcan::PoolManager<1> poolmgr;
+    poolmgr.addPool(&pool);
+
+    SystemClockMock clockmock(100);
+    CanDriverMock driver(1, clockmock);
+    driver.ifaces.at(0).enable_burst_rx = true;
+
+    uavcan::OutgoingTransferRegistry<0> out_trans_reg(poolmgr);
+
+    uavcan::Dispatcher dispatcher(driver, poolmgr, clockmock, out_trans_reg);
+    ASSERT_TRUE(dispatcher.setNodeID(SELF_NODE_ID));
+
+    DispatcherTransferEmulator emulator(driver, SELF_NODE_ID);
+
+    const uavcan::DataTypeDescriptor type_a = makeDataType(uavcan::DataTypeKindMessage, 5);
+    const uavcan::DataTypeDescriptor type_b = makeDataType(uavcan::DataTypeKindMessage, 0);
+    const uavcan::DataTypeDescriptor type_c = makeDataType(uavcan::DataTypeKindMessage, 1023);
+    const uavcan::DataTypeDescriptor type_d = makeDataType(uavcan::DataTypeKindService, 7);
+
+    typedef TestListener<64, 0, 0> Listener;            // Every receiver takes one pool block
+    Listener a(dispatcher.getTransferPerfCounter(), type_a, poolmgr);
+    Listener b(dispatcher.getTransferPerfCounter(), type_b, poolmgr);
+    Listener c(dispatcher.getTransferPerfCounter(), type_c, poolmgr);
+    Listener d(dispatcher.getTransferPerfCounter(), type_d, poolmgr);
+
+    ASSERT_TRUE(dispatcher.registerMessageListener(&a));
+    ASSERT_TRUE(dispatcher.registerMessageListener(&b));
+    ASSERT_TRUE(dispatcher.registerMessageListener(&c));
+    ASSERT_TRUE(dispatcher.registerServiceRequestListener(&d));
+
+    const Transfer transfers[] =
+    {
+        emulator.makeTransfer(uavcan::TransferTypeMessageBroadcast, 1, "abc", type_a),
+        emulator.makeTransfer(uavcan::TransferTypeMessageBroadcast, 2, "def", type_b),
+        emulator.makeTransfer(uavcan::TransferTypeMessageBroadcast, 3, "ghi", type_c),
+        emulator.makeTransfer(uavcan::TransferTypeServiceRequest,   4, "jkl", type_d)
+    };
+    emulator.send(transfers);
+    ASSERT_EQ(4, dispatcher.spin(tsMono(0)));
+    ASSERT_TRUE(a.matchAndPop(transfers[0]));
+    ASSERT_TRUE(b.matchAndPop(transfers[1]));
+    ASSERT_TRUE(c.matchAndPop(transfers[2]));
+    ASSERT_TRUE(d.matchAndPop(transfers[3]));
+
+    ASSERT_TRUE(out_trans_reg.accessOrCreate(uavcan::OutgoingTransferRegistryKey(type_a.getID(),
+                                                                                 uavcan::TransferTypeMessageBroadcast,
+                                                                                 uavcan::NodeID::Broadcast),
+                                             tsMono(1000)));
+    ASSERT_EQ(5, pool.getNumUsedBlocks());
+
+    /*
+     * The deadline is in the past, so there's one step per call:
+     * registry, DTID 1023, DTID 5, DTID 0, service DTID 7, end of service requests, end of service responses
+     */
+    const uavcan::MonotonicTime expired = tsMono(100000000);
+    const unsigned expected_blocks[] = { 4, 3, 2, 1, 0, 0 };
+    for (unsigned i = 0; i < sizeof(expected_blocks) / sizeof(expected_blocks[0]); i++)
+    {
+        ASSERT_FALSE(dispatcher.cleanupIncrementally(expired, tsMono(0)));
+        ASSERT_EQ(expected_blocks[i], pool.getNumUsedBlocks());
+    }
+    ASSERT_TRUE(dispatcher.cleanupIncrementally(expired, tsMono(0)));
+
+    /*
+     * Listener removal in the middle of a pass doesn't break it
+     */
+    emulator.send(transfers);
+    ASSERT_EQ(4, dispatcher.spin(tsMono(0)));
+    ASSERT_EQ(4, pool.getNumUsedBlocks());
+
+    ASSERT_FALSE(dispatcher.cleanupIncrementally(expired, tsMono(0)));     // Registry
+    ASSERT_FALSE(dispatcher.cleanupIncrementally(expired, tsMono(0)));     // DTID 1023
+    dispatcher.unregisterMessageListener(&a);
+    ASSERT_FALSE(dispatcher.cleanupIncrementally(expired, tsMono(0)));     // DTID 0, DTID 5 is skipped
+    ASSERT_EQ(2, pool.getNumUsedBlocks());
+
+    /*
+     * Enough time to complete the pass in one call
+     */
+    ASSERT_TRUE(dispatcher.cleanupIncrementally(expired, tsMono(1000000)));
+    ASSERT_EQ(1, pool.getNumUsedBlocks());                                  // Removed listener's receiver
+
+    dispatcher.unregisterMessageListener(&b);
+    dispatcher.unregisterMessageListener(&c);
+    dispatcher.unregisterServiceRequestListener(&d);
+}
+
+TEST(Dispatcher, HardwareFilters)
+{
+    uavcan::PoolAllocator<uavcan::MemPoolBlockSize * 8, uavcan::MemPoolBlockSize> pool;
+    uavcan::PoolManager<1> poolmgr;
+    poolmgr.addPool(&pool);
+
+    SystemClockMock clockmock(100);
+    CanDriverMock driver(2, clockmock);
+    driver.ifaces.at(0).num_filters = 3;
+    driver.ifaces.at(1).num_filters = 0;        // Not supported
+
+    uavcan::OutgoingTransferRegistry<8> out_trans_reg(poolmgr);
+
+    uavcan::Dispatcher dispatcher(driver, poolmgr, clockmock, out_trans_reg);
+    ASSERT_FALSE(dispatcher.isHardwareFilteringEnabled());
+
+    CanIfaceMock& iface = driver.ifaces.at(0);
+
+    const uavcan::DataTypeDescriptor msg_type = makeDataType(uavcan::DataTypeKindMessage, 100);
+    const uavcan::DataTypeDescriptor srv_type = makeDataType(uavcan::DataTypeKindService, 10);
+
+    typedef TestListener<64, 1, 1> Listener;
+    Listener msg1(dispatcher.getTransferPerfCounter(), msg_type, poolmgr);
+    Listener msg2(dispatcher.getTransferPerfCounter(), msg_type, poolmgr);
+    Listener server(dispatcher.getTransferPerfCounter(), srv_type, poolmgr);
+    Listener caller(dispatcher.getTransferPerfCounter(), srv_type, poolmgr);
+
+    // Disabled by default - the filters configured by the application are left intact
+    ASSERT_TRUE(dispatcher.registerMessageListener(&msg1));
+    dispatcher.unregisterMessageListener(&msg1);
+    ASSERT_EQ(0, iface.num_filter_reconfigurations);
+
+    // Nothing to listen to - the filters are left intact
+    dispatcher.setHardwareFilteringEnabled(true);
+    ASSERT_TRUE(dispatcher.isHardwareFilteringEnabled());
+    ASSERT_EQ(0, dispatcher.configureHardwareFilters());
+    ASSERT_EQ(0, iface.num_filter_reconfigurations);
+
+    /*
+     * Reconfiguration happens only when a data type gets its first listener
+     */
+    ASSERT_TRUE(dispatcher.registerMessageListener(&msg1));
+    ASSERT_EQ(1, iface.num_filter_reconfigurations);
+    ASSERT_EQ(1, iface.filters.size());
+    ASSERT_TRUE(dispatcher.registerMessageListener(&msg2));
+    ASSERT_EQ(1, iface.num_filter_reconfigurations);
+
+    ASSERT_TRUE(dispatcher.setNodeID(SELF_NODE_ID));       // Loopback and all service responses
+    ASSERT_EQ(2, iface.num_filter_reconfigurations);
+    ASSERT_EQ(3, iface.filters.size());
+
+    ASSERT_TRUE(dispatcher.registerServiceRequestListener(&server));
+    ASSERT_EQ(3, iface.num_filter_reconfigurations);
+    ASSERT_EQ(3, iface.filters.size());             // Budget is exhausted, two rules were merged
+
+    ASSERT_TRUE(dispatcher.registerServiceResponseListener(&caller));   // Covered by the permanent filter
+    ASSERT_EQ(3, iface.num_filter_reconfigurations);
+
+    const uavcan::CanFrame msg_frame       = makeCanFrame(100U << 19 | 2U << 17 | 11U << 10, "", EXT);
+    const uavcan::CanFrame msg_frame_ucast = makeCanFrame(100U << 19 | 3U << 17 | 11U << 10, "\x40", EXT);
+    const uavcan::CanFrame request_frame   = makeCanFrame(10U << 19 | 1U << 17 | 11U << 10, "\x40", EXT);
+    const uavcan::CanFrame response_frame  = makeCanFrame(10U << 19 | 0U << 17 | 11U << 10, "\x40", EXT);
+    const uavcan::CanFrame other_response  = makeCanFrame(700U << 19 | 0U << 17 | 12U << 10, "\x40", EXT);
+    const uavcan::CanFrame loopback_frame  = makeCanFrame(500U << 19 | 2U << 17 | 64U << 10, "", EXT);
+    const uavcan::CanFrame foreign_frame   = makeCanFrame(600U << 19 | 2U << 17 | 11U << 10, "", EXT);
+    const uavcan::CanFrame std_frame       = makeCanFrame(123, "", STD);
+
+    ASSERT_TRUE(iface.acceptedByFilters(msg_frame));
+    ASSERT_TRUE(iface.acceptedByFilters(msg_frame_ucast));
+    ASSERT_TRUE(iface.acceptedByFilters(request_frame));
+    ASSERT_TRUE(iface.acceptedByFilters(response_frame));
+    ASSERT_TRUE(iface.acceptedByFilters(other_response));
+    ASSERT_TRUE(iface.acceptedByFilters(loopback_frame));
+    ASSERT_FALSE(iface.acceptedByFilters(foreign_frame));
+    ASSERT_FALSE(iface.acceptedByFilters(std_frame));
+
+    /*
+     * Removal
+     */
+    dispatcher.unregisterServiceResponseListener(&caller);   // Response listeners never trigger reconfiguration
+    ASSERT_EQ(3, iface.num_filter_reconfigurations);
+
+    dispatcher.unregisterMessageListener(&msg1);
+    ASSERT_EQ(3, iface.num_filter_reconfigurations);
+    dispatcher.unregisterMessageListener(&msg2);
+    ASSERT_EQ(4, iface.num_filter_reconfigurations);
+    ASSERT_EQ(3, iface.filters.size());
+
+    ASSERT_FALSE(iface.acceptedByFilters(msg_frame));
+    ASSERT_TRUE(iface.acceptedByFilters(response_frame));
+    ASSERT_TRUE(iface.acceptedByFilters(request_frame));
+    ASSERT_TRUE(iface.acceptedByFilters(loopback_frame));
+
+    /*
+     * Disabled automatic configuration
+     */
+    dispatcher.setHardwareFilteringEnabled(false);
+    ASSERT_FALSE(dispatcher.isHardwareFilteringEnabled());
+    dispatcher.unregisterServiceRequestListener(&server);
+    ASSERT_TRUE(dispatcher.registerMessageListener(&msg1));
+    ASSERT_EQ(4, iface.num_filter_reconfigurations);
+
+    ASSERT_EQ(1, dispatcher.configureHardwareFilters());      // Explicit call still works
+    ASSERT_EQ(5, iface.num_filter_reconfigurations);
+    ASSERT_TRUE(iface.acceptedByFilters(msg_frame));
+    ASSERT_FALSE(iface.acceptedByFilters(request_frame));
+
+    iface.num_filters = 1;
+    ASSERT_EQ(1, dispatcher.configureHardwareFilters());      // Merged into one config
+    ASSERT_EQ(1, iface.filters.size());
+
+    /*
+     * Driver failure - the failed iface accepts everything until the next update succeeds
+     */
+    iface.narrow_filter_failure = true;
+    dispatcher.setHardwareFilteringEnabled(true);
+    ASSERT_EQ(7, iface.num_filter_reconfigurations);
+    ASSERT_EQ(1, iface.filters.size());
+    ASSERT_TRUE(iface.acceptedByFilters(msg_frame));
+    ASSERT_TRUE(iface.acceptedByFilters(foreign_frame));      // Stale filters were not left in place
+    ASSERT_TRUE(iface.acceptedByFilters(std_frame));
+    iface.narrow_filter_failure = false;
+
+    ASSERT_TRUE(dispatcher.registerServiceRequestListener(&server));   // Retried automatically
+    ASSERT_EQ(8, iface.num_filter_reconfigurations);
+    ASSERT_TRUE(iface.acceptedByFilters(request_frame));
+    ASSERT_FALSE(iface.acceptedByFilters(std_frame));
+
+    ASSERT_EQ(1, dispatcher.configureHardwareFilters());
+    ASSERT_EQ(9, iface.num_filter_reconfigurations);
+    dispatcher.unregisterServiceRequestListener(&server);
+    ASSERT_EQ(10, iface.num_filter_reconfigurations);
+
+    iface.filter_failure = true;
+    ASSERT_EQ(-uavcan::ErrDriver, dispatcher.configureHardwareFilters());
+    iface.filters.clear();
+    dispatcher.unregisterMessageListener(&msg1);
+}
+
+
 TEST(Dispatcher, Transmission)
 {
     uavcan::PoolAllocator<uavcan::MemPoolBlockSize * 8, uavcan::MemPoolBlockSize> pool;
@@ -362,3 +707,51 @@ TEST(Dispatcher, Loopback)
     }
     ASSERT_EQ(0, dispatcher.getLoopbackFrameListenerRegistry().getNumListeners());
 }
+
+TEST(Dispatcher, BurstSpin)
+{
+    uavcan::PoolManager<1> poolmgr;
+
+    SystemClockMock clockmock(100);
+    CanDriverMock driver(1, clockmock);
+    driver.ifaces.at(0).enable_burst_rx = true;
+
+    uavcan::OutgoingTransferRegistry<8> out_trans_reg(poolmgr);
+
+    uavcan::Dispatcher dispatcher(driver, poolmgr, clockmock, out_trans_reg);
+    ASSERT_TRUE(dispatcher.setNodeID(SELF_NODE_ID));
+
+    DispatcherTestLoopbackFrameListener listener(dispatcher);
+    listener.startListening();
+
+    /*
+     * Loopback frames interleaved with regular frames within the same burst
+     */
+    const unsigned NumFrames = uavcan::RxBurstLen * 2 + 1;
+    for (unsigned i = 0; i < NumFrames; i++)
+    {
+        uavcan::Frame frame(123, uavcan::TransferTypeMessageBroadcast, 1, uavcan::NodeID::Broadcast, 0,
+                            uavcan::TransferID(uint8_t(i % 8)), true);
+        frame.setPayload(reinterpret_cast<const uint8_t*>("123"), 3);
+        uavcan::CanFrame can_frame;
+        ASSERT_TRUE(frame.compile(can_frame));
+        driver.ifaces.at(0).pushRx(can_frame);
+    }
+    for (unsigned i = 0; i < 3; i++)
+    {
+        uavcan::Frame frame(123, uavcan::TransferTypeMessageBroadcast, SELF_NODE_ID, uavcan::NodeID::Broadcast, 0,
+                            uavcan::TransferID(uint8_t(i % 8)), true);
+        ASSERT_LE(0, dispatcher.send(frame, tsMono(1000), tsMono(0), uavcan::CanTxQueue::Persistent,
+                                     uavcan::CanIOFlagLoopback, 0xFF));
+    }
+
+    // Loopback frames are not counted as processed
+    ASSERT_EQ(int(NumFrames), dispatcher.spin(tsMono(1000)));
+    ASSERT_EQ(3, listener.count);
+    ASSERT_TRUE(driver.ifaces.at(0).rx.empty());
+    ASSERT_TRUE(driver.ifaces.at(0).loopback.empty());
+
+    // Every call fetched a full burst except the last one
+    const unsigned TotalFrames = NumFrames + 3;
+    ASSERT_EQ((TotalFrames + uavcan::RxBurstLen - 1) / uavcan::RxBurstLen, driver.ifaces.at(0).num_burst_rx_calls);
+}
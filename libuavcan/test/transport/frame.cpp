@@ -2,7 +2,9 @@
  * Copyright (C) 2014 Pavel Kirienko <pavel.kirienko@gmail.com>
  */
 
+#include <cstdlib>
 #include <string>
+#include <vector>
 #include <gtest/gtest.h>
 #include <uavcan/transport/transfer.hpp>
 #include "../clock.hpp"
@@ -208,6 +210,199 @@ TEST(Frame, RxFrameParse)
 }
 
 
+TEST(Frame, CanIDLayout)
+{
+    // The fields cover the 29-bit CAN ID without overlapping
+    const uint32_t masks[] =
+    {
+        uavcan::CanIDTransferID::mask(),
+        uavcan::CanIDLastFrame::mask(),
+        uavcan::CanIDFrameIndex::mask(),
+        uavcan::CanIDSrcNodeID::mask(),
+        uavcan::CanIDTransferType::mask(),
+        uavcan::CanIDDataTypeID::mask()
+    };
+    uint32_t all = 0;
+    for (unsigned i = 0; i < sizeof(masks) / sizeof(masks[0]); i++)
+    {
+        ASSERT_EQ(0, all & masks[i]);
+        all |= masks[i];
+    }
+    ASSERT_EQ(uavcan::CanFrame::MaskExtID, all);
+
+    ASSERT_EQ(0x1FF80000U, uavcan::CanIDDataTypeID::pack(0xFFFFU));
+    ASSERT_EQ(1023U, uavcan::CanIDDataTypeID::unpack(0xFFFFFFFFU));
+    ASSERT_EQ(2U, uavcan::CanIDTransferType::unpack(uavcan::CanIDTransferType::pack(2)));
+}
+
+
+TEST(Frame, CanRxFrameView)
+{
+    using uavcan::CanFrame;
+    using uavcan::CanRxFrame;
+    using uavcan::RxFrame;
+
+    std::srand(1);
+
+    unsigned num_valid = 0;
+    for (unsigned i = 0; i < 10000; i++)
+    {
+        CanRxFrame can_frame;
+        can_frame.id = (uint32_t(std::rand()) & CanFrame::MaskExtID) | CanFrame::FlagEFF;
+        can_frame.dlc = uint8_t(std::rand() % 9);
+        for (unsigned k = 0; k < can_frame.dlc; k++)
+        {
+            can_frame.data[k] = uint8_t(std::rand());
+        }
+        can_frame.ts_mono = tsMono(1000 + i);
+
+        const uavcan::CanRxFrameView view(can_frame);
+        ASSERT_TRUE(view.isUavcanFrame());
+
+        RxFrame frame;
+        if (!frame.parse(can_frame))
+        {
+            continue;
+        }
+        num_valid++;
+
+        // Every field of a valid frame must match
+        ASSERT_EQ(frame.getTransferType(), view.getTransferType());
+        ASSERT_EQ(frame.getDataTypeID(), view.getDataTypeID());
+        ASSERT_EQ(frame.getSrcNodeID(), view.getSrcNodeID());
+        ASSERT_EQ(frame.getDstNodeID(), view.getDstNodeID());
+        ASSERT_EQ(frame.getTransferID(), view.getTransferID());
+        ASSERT_EQ(frame.getIndex(), view.getIndex());
+        ASSERT_EQ(frame.isLast(), view.isLast());
+        ASSERT_EQ(frame.isFirst(), view.isFirst());
+    }
+    ASSERT_LT(1000, num_valid);
+
+    CanRxFrame can_frame;
+    uavcan::Frame(123, uavcan::TransferTypeServiceRequest, 1, 2, 0, 0, true).compile(can_frame);
+    const uavcan::CanRxFrameView view(can_frame);
+    ASSERT_EQ(2, view.getDstNodeID().get());
+
+    // Malformed destination
+    can_frame.data[0] = 0x82;
+    ASSERT_FALSE(view.getDstNodeID().isValid());
+    can_frame.dlc = 0;
+    ASSERT_FALSE(view.getDstNodeID().isValid());
+
+    // Not a UAVCAN frame
+    can_frame.id &= CanFrame::MaskStdID;
+    ASSERT_FALSE(view.isUavcanFrame());
+}
+
+/**
+ * Reference: the frame by frame sequence that TransferSender used to produce.
+ */
+static std::vector<uavcan::CanFrame> makeTransferFrames(uavcan::DataTypeID dtid, uavcan::TransferType tt,
+                                                        uavcan::NodeID src, uavcan::NodeID dst, uavcan::TransferID tid,
+                                                        const std::vector<uint8_t>& payload, uint16_t crc)
+{
+    std::vector<uavcan::CanFrame> out;
+    uavcan::Frame frame(dtid, tt, src, dst, 0, tid);
+    uavcan::CanFrame can_frame;
+    if (frame.getMaxPayloadLen() >= int(payload.size()))
+    {
+        const uint8_t* const ptr = payload.empty() ? NULL : &payload[0];
+        EXPECT_EQ(int(payload.size()), frame.setPayload(ptr, unsigned(payload.size())));
+        frame.makeLast();
+        EXPECT_TRUE(frame.compile(can_frame));
+        out.push_back(can_frame);
+        return out;
+    }
+
+    std::vector<uint8_t> first(payload.begin(), payload.begin() + frame.getMaxPayloadLen() - 2);
+    first.insert(first.begin(), uint8_t(crc >> 8));
+    first.insert(first.begin(), uint8_t(crc & 0xFF));
+    unsigned offset = unsigned(frame.setPayload(&first[0], unsigned(first.size())) - 2);
+    int index = 1;
+    while (true)
+    {
+        if (offset >= payload.size())
+        {
+            frame.makeLast();
+        }
+        EXPECT_TRUE(frame.compile(can_frame));
+        out.push_back(can_frame);
+        if (frame.isLast())
+        {
+            break;
+        }
+        frame.setIndex(index++);
+        offset += unsigned(frame.setPayload(&payload[offset], unsigned(payload.size() - offset)));
+    }
+    return out;
+}
+
+TEST(Frame, TransferFrameBuilder)
+{
+    const uavcan::TransferCRC crc_base(uavcan::DataTypeSignature(0xDEADBEEF12345678ULL).toTransferCRC());
+
+    std::vector<uint8_t> payload;
+    for (unsigned len = 0; len <= 400; len++)
+    {
+        for (int broadcast = 0; broadcast < 2; broadcast++)
+        {
+            const uavcan::TransferType tt =
+                broadcast ? uavcan::TransferTypeMessageBroadcast : uavcan::TransferTypeServiceRequest;
+            const uavcan::NodeID dst = broadcast ? uavcan::NodeID::Broadcast : uavcan::NodeID(42);
+            const uavcan::TransferID tid(uint8_t(len % 8));
+
+            uavcan::TransferCRC crc = crc_base;
+            if (!payload.empty())
+            {
+                crc.add(&payload[0], unsigned(payload.size()));
+            }
+
+            const std::vector<uavcan::CanFrame> reference =
+                makeTransferFrames(1023, tt, 127, dst, tid, payload, crc.get());
+
+            const uavcan::TransferFrameBuilder builder(1023, tt, 127, dst, tid,
+                                                       payload.empty() ? NULL : &payload[0],
+                                                       unsigned(payload.size()), crc_base);
+            ASSERT_TRUE(builder.isValid());
+            ASSERT_EQ(reference.size() > 1, builder.isMultiFrame());
+            ASSERT_EQ(reference.size(), builder.getNumFrames());
+            ASSERT_TRUE(uavcan::NodeID(127) == builder.getSrcNodeID());
+
+            for (unsigned i = 0; i < reference.size(); i++)
+            {
+                uavcan::CanFrame can_frame;
+                builder.buildFrame(i, can_frame);
+                ASSERT_TRUE(reference[i] == can_frame) << "len " << len << " frame " << i << "\n"
+                    << reference[i].toString() << "\n" << can_frame.toString();
+            }
+        }
+        payload.push_back(uint8_t(std::rand()));
+    }
+
+    // Max frame index is 62, so the max broadcast payload is 6 + 62 * 8 bytes
+    payload.resize(6 + 62 * 8);
+    ASSERT_EQ(63, uavcan::TransferFrameBuilder(1, uavcan::TransferTypeMessageBroadcast, 1, uavcan::NodeID::Broadcast,
+                                               0, &payload[0], unsigned(payload.size()), crc_base).getNumFrames());
+    payload.push_back(0);
+    ASSERT_FALSE(uavcan::TransferFrameBuilder(1, uavcan::TransferTypeMessageBroadcast, 1, uavcan::NodeID::Broadcast,
+                                              0, &payload[0], unsigned(payload.size()), crc_base).isValid());
+
+    // Invalid addressing
+    ASSERT_FALSE(uavcan::TransferFrameBuilder(1, uavcan::TransferTypeServiceResponse, 1, uavcan::NodeID(),
+                                              0, &payload[0], 8, crc_base).isValid());
+    ASSERT_FALSE(uavcan::TransferFrameBuilder(1, uavcan::TransferTypeMessageUnicast, 1, uavcan::NodeID::Broadcast,
+                                              0, &payload[0], 8, crc_base).isValid());
+    ASSERT_FALSE(uavcan::TransferFrameBuilder(1, uavcan::TransferTypeMessageBroadcast, 1, uavcan::NodeID(2),
+                                              0, &payload[0], 8, crc_base).isValid());
+    ASSERT_FALSE(uavcan::TransferFrameBuilder(1, uavcan::TransferTypeServiceRequest, 1, uavcan::NodeID(1),
+                                              0, &payload[0], 8, crc_base).isValid());
+    ASSERT_FALSE(uavcan::TransferFrameBuilder(1, uavcan::TransferTypeServiceRequest, uavcan::NodeID(), 2,
+                                              0, &payload[0], 8, crc_base).isValid());
+    ASSERT_TRUE(uavcan::TransferFrameBuilder(1, uavcan::TransferTypeServiceRequest, 1, uavcan::NodeID(2),
+                                             0, &payload[0], 8, crc_base).isValid());
+}
+
+
 TEST(Frame, FrameToString)
 {
     using uavcan::Frame;
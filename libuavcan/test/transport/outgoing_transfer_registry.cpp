@@ -3,16 +3,17 @@
  */
 
 #include <algorithm>
+#include <map>
+#include <cstdlib>
 #include <gtest/gtest.h>
 #include <uavcan/transport/outgoing_transfer_registry.hpp>
 #include "../clock.hpp"
 
 
-TEST(OutgoingTransferRegistry, Basic)
+template <typename Registry>
+static void testBasic(Registry& otr)
 {
     using uavcan::OutgoingTransferRegistryKey;
-    uavcan::PoolManager<1> poolmgr;  // Empty
-    uavcan::OutgoingTransferRegistry<4> otr(poolmgr);
 
     otr.cleanup(tsMono(1000));
 
@@ -87,3 +88,165 @@ TEST(OutgoingTransferRegistry, Basic)
     otr.cleanup(tsMono(5000001));    // Frees some memory for 4
     ASSERT_EQ(0, otr.accessOrCreate(keys[0], tsMono(1000000))->get());
 }
+
+TEST(OutgoingTransferRegistry, Basic)
+{
+    uavcan::PoolManager<1> poolmgr;  // Empty
+    uavcan::OutgoingTransferRegistry<4> otr(poolmgr);
+    testBasic(otr);
+}
+
+TEST(OutgoingTransferRegistry, HashedBasic)
+{
+    uavcan::PoolManager<1> poolmgr;  // Empty
+    uavcan::HashedOutgoingTransferRegistry<4> otr(poolmgr);
+    testBasic(otr);
+}
+
+TEST(OutgoingTransferRegistry, HashedCapacity)
+{
+    uavcan::PoolAllocator<uavcan::MemPoolBlockSize * 2, uavcan::MemPoolBlockSize> pool;
+    uavcan::PoolManager<1> poolmgr;
+    poolmgr.addPool(&pool);
+
+    typedef uavcan::HashedOutgoingTransferRegistry<6, 8> Registry;
+    ASSERT_EQ(6, Registry::MaxEntries);
+
+    Registry otr(poolmgr);
+    ASSERT_EQ(6, otr.getMaxEntries());
+
+    for (uint8_t i = 0; i < Registry::MaxEntries; i++)
+    {
+        const uavcan::OutgoingTransferRegistryKey key(123, uavcan::TransferTypeServiceRequest, uint8_t(i + 1));
+        ASSERT_TRUE(otr.accessOrCreate(key, tsMono(1000)));
+    }
+    ASSERT_EQ(0, pool.getNumUsedBlocks());
+    ASSERT_EQ(0, otr.getNumOverflowEntries());
+
+    /*
+     * The index is full, the extra transfer goes to the overflow list
+     */
+    const uavcan::OutgoingTransferRegistryKey extra(456, uavcan::TransferTypeServiceRequest, 42);
+    ASSERT_FALSE(otr.exists(456, uavcan::TransferTypeServiceRequest));
+
+    uavcan::TransferID* const tid = otr.accessOrCreate(extra, tsMono(3000));
+    ASSERT_TRUE(tid);
+    tid->increment();
+    ASSERT_EQ(1, otr.accessOrCreate(extra, tsMono(3000))->get());
+
+    ASSERT_EQ(7, otr.getNumEntries());
+    ASSERT_EQ(1, otr.getNumOverflowEntries());
+    ASSERT_EQ(1, pool.getNumUsedBlocks());
+    ASSERT_TRUE(otr.exists(456, uavcan::TransferTypeServiceRequest));
+    ASSERT_TRUE(otr.exists(123, uavcan::TransferTypeServiceRequest));
+
+    /*
+     * Once there's room, the overflow entry is moved into the index along with its Transfer ID
+     */
+    otr.cleanup(tsMono(2000));
+    ASSERT_EQ(1, otr.getNumEntries());
+    ASSERT_EQ(0, otr.getNumOverflowEntries());
+    ASSERT_EQ(0, pool.getNumUsedBlocks());
+    ASSERT_TRUE(otr.exists(456, uavcan::TransferTypeServiceRequest));
+    ASSERT_FALSE(otr.exists(123, uavcan::TransferTypeServiceRequest));
+    ASSERT_EQ(1, otr.accessOrCreate(extra, tsMono(3000))->get());
+
+    otr.cleanup(tsMono(3000));
+    ASSERT_EQ(0, otr.getNumEntries());
+    ASSERT_FALSE(otr.exists(456, uavcan::TransferTypeServiceRequest));
+}
+
+
+static uavcan::OutgoingTransferRegistryKey makeRandomKey()
+{
+    const uavcan::TransferType tt = uavcan::TransferType((std::rand() % 2) ? uavcan::TransferTypeServiceRequest
+                                                                            : uavcan::TransferTypeMessageBroadcast);
+    const uavcan::NodeID dst = (tt == uavcan::TransferTypeMessageBroadcast) ?
+                               uavcan::NodeID::Broadcast : uavcan::NodeID(uint8_t(1 + std::rand() % 20));
+    return uavcan::OutgoingTransferRegistryKey(uint16_t(std::rand() % 20), tt, dst);
+}
+
+static uint32_t keyToInt(const uavcan::OutgoingTransferRegistryKey& key)
+{
+    return (uint32_t(key.getDataTypeID().get()) << 16) | (uint32_t(key.getTransferType()) << 8) |
+           key.getDestinationNodeID().get();
+}
+
+template <typename Registry>
+static void testHashedRandomized(unsigned& max_overflow_entries)
+{
+    uavcan::PoolAllocator<uavcan::MemPoolBlockSize * 100, uavcan::MemPoolBlockSize> pool;
+    uavcan::PoolManager<1> poolmgr;
+    poolmgr.addPool(&pool);
+
+    std::auto_ptr<Registry> otr(new Registry(poolmgr));
+    max_overflow_entries = 0;
+
+    // Reference model: key -> (deadline, transfer ID)
+    std::map<uint32_t, std::pair<uint64_t, uint8_t> > model;
+
+    std::srand(42);
+    for (unsigned iteration = 0; iteration < 20000; iteration++)
+    {
+        const uint64_t now_usec = iteration * 100U;
+        if ((iteration % 50) == 0)
+        {
+            otr->cleanup(tsMono(now_usec));
+            for (std::map<uint32_t, std::pair<uint64_t, uint8_t> >::iterator it = model.begin(); it != model.end();)
+            {
+                if (it->second.first <= now_usec)
+                {
+                    model.erase(it++);
+                }
+                else
+                {
+                    ++it;
+                }
+            }
+            ASSERT_EQ(model.size(), otr->getNumEntries());
+            max_overflow_entries = uavcan::max(max_overflow_entries, otr->getNumOverflowEntries());
+            // Static entries are preferred, but pool entries are not moved into the static ones once they are freed
+            const int num_indexed = int(otr->getNumEntries() - otr->getNumOverflowEntries());
+            ASSERT_LE(unsigned(uavcan::max(0, num_indexed - 8)), pool.getNumUsedBlocks());
+            ASSERT_GE(model.size(), pool.getNumUsedBlocks());
+        }
+
+        const uavcan::OutgoingTransferRegistryKey key = makeRandomKey();
+        const uint64_t deadline = now_usec + 1000U + unsigned(std::rand() % 10000);
+
+        uavcan::TransferID* const tid = otr->accessOrCreate(key, tsMono(deadline));
+        ASSERT_TRUE(tid);
+        std::pair<uint64_t, uint8_t>& ref = model[keyToInt(key)];
+        ASSERT_EQ(ref.second, tid->get());
+        tid->increment();
+        ref = std::make_pair(deadline, tid->get());
+
+        // Existence of every type must match the model
+        const uavcan::OutgoingTransferRegistryKey probe = makeRandomKey();
+        bool expected_existence = false;
+        for (std::map<uint32_t, std::pair<uint64_t, uint8_t> >::const_iterator it = model.begin();
+             it != model.end(); ++it)
+        {
+            if ((it->first >> 8) == (keyToInt(probe) >> 8))
+            {
+                expected_existence = true;
+                break;
+            }
+        }
+        ASSERT_EQ(expected_existence, otr->exists(probe.getDataTypeID(), probe.getTransferType()));
+    }
+
+    otr.reset();
+    ASSERT_EQ(0, pool.getNumUsedBlocks());
+}
+
+TEST(OutgoingTransferRegistry, HashedRandomized)
+{
+    unsigned max_overflow_entries = 0;
+    testHashedRandomized<uavcan::HashedOutgoingTransferRegistry<8, 128> >(max_overflow_entries);
+    ASSERT_EQ(0, max_overflow_entries);
+
+    // The index is too small, so that the overflow list is used most of the time
+    testHashedRandomized<uavcan::HashedOutgoingTransferRegistry<8, 16> >(max_overflow_entries);
+    ASSERT_LT(0, max_overflow_entries);
+}
@@ -125,9 +125,70 @@ TEST(TransferListener, CrcFailure)
 
     ASSERT_TRUE(subscriber.matchAndPop(tr_sft_damaged));
     ASSERT_TRUE(subscriber.isEmpty());
+
+    /*
+     * The transfer rejected due to CRC mismatch is still counted as received;
+     * errors are reported only for the frames of the repeated transfers.
+     */
+    ASSERT_EQ(2, perf.getRxTransferCount());
+    ASSERT_EQ(4, perf.getErrorCount());
 }
 
 
+TEST(TransferListener, CrossIfaceReassembly)
+{
+    const uavcan::DataTypeDescriptor type(uavcan::DataTypeKindMessage, 123, uavcan::DataTypeSignature(123456789), "A");
+
+    uavcan::PoolAllocator<uavcan::MemPoolBlockSize * 8, uavcan::MemPoolBlockSize> pool;
+    uavcan::PoolManager<1> poolmgr;                 // The pool holds progress of the ifaces
+    poolmgr.addPool(&pool);
+    uavcan::TransferPerfCounter perf;
+    TestListener<256, 1, 1> subscriber(perf, type, poolmgr);
+    subscriber.setReassemblyMode(uavcan::TransferReceiver::ReassemblyCrossIface);
+
+    TransferListenerEmulator emulator(subscriber, type);
+
+    // No memory is used while the source is received from one iface only
+    const Transfer tr_single = emulator.makeTransfer(uavcan::TransferTypeMessageBroadcast, 42, "abcdefghik12345");
+    const std::vector<uavcan::RxFrame> ser_single = serializeTransfer(tr_single);
+    for (unsigned i = 0; i < ser_single.size(); i++)
+    {
+        subscriber.handleFrame(ser_single[i]);
+    }
+    ASSERT_TRUE(subscriber.matchAndPop(tr_single));
+    ASSERT_EQ(0, pool.getNumUsedBlocks());
+
+    const Transfer tr = emulator.makeTransfer(uavcan::TransferTypeMessageBroadcast, 42, "123456789abcdefghik");
+    const std::vector<uavcan::RxFrame> ser = serializeTransfer(tr);
+    ASSERT_EQ(3, ser.size());
+
+    // Every frame is duplicated on iface 1; iface 0 loses the second frame, iface 1 loses the last one
+    for (unsigned i = 0; i < ser.size(); i++)
+    {
+        if (i != 1)
+        {
+            subscriber.handleFrame(ser[i]);
+        }
+        if (i != 2)
+        {
+            subscriber.handleFrame(uavcan::RxFrame(ser[i], ser[i].getMonotonicTimestamp(),
+                                                   ser[i].getUtcTimestamp(), 1));
+        }
+    }
+
+    ASSERT_TRUE(subscriber.matchAndPop(tr));
+    ASSERT_TRUE(subscriber.isEmpty());
+    ASSERT_EQ(2, perf.getRxTransferCount());
+    ASSERT_EQ(0, perf.getErrorCount());
+    ASSERT_EQ(1, perf.getLostFrameCount(0));    // Progress of iface 0 is known from before the tracker was created
+    ASSERT_EQ(0, perf.getLostFrameCount(1));    // Not detected until the next transfer from iface 1
+    ASSERT_LT(0, pool.getNumUsedBlocks());
+
+    // Progress of the ifaces is removed together with the receiver
+    static_cast<uavcan::TransferListenerBase&>(subscriber).cleanup(tsMono(100000000));
+    ASSERT_EQ(0, pool.getNumUsedBlocks());
+}
+
 TEST(TransferListener, BasicSFT)
 {
     const uavcan::DataTypeDescriptor type(uavcan::DataTypeKindMessage, 123, uavcan::DataTypeSignature(123456789), "A");
@@ -219,6 +280,47 @@ TEST(TransferListener, Cleanup)
 }
 
 
+TEST(TransferListener, ReceiverTable)
+{
+    const uavcan::DataTypeDescriptor type(uavcan::DataTypeKindMessage, 123, uavcan::DataTypeSignature(123456789), "A");
+
+    uavcan::PoolManager<1> poolmgr;                           // No dynamic memory
+    uavcan::TransferPerfCounter perf;
+    TestListener<256, 1, 5, uavcan::TransferReceiverTable> subscriber(perf, type, poolmgr);
+
+    TransferListenerEmulator emulator(subscriber, type);
+    const Transfer transfers[] =
+    {
+        emulator.makeTransfer(uavcan::TransferTypeMessageBroadcast, 1,   "123"),
+        emulator.makeTransfer(uavcan::TransferTypeMessageUnicast,   1,   "456"),     // Same NID
+        emulator.makeTransfer(uavcan::TransferTypeMessageUnicast,   126, ""),
+        emulator.makeTransfer(uavcan::TransferTypeServiceRequest,   3,   "123456789abcdefghik"),
+        emulator.makeTransfer(uavcan::TransferTypeServiceResponse,  4,   ""),
+        emulator.makeTransfer(uavcan::TransferTypeServiceResponse,  126, ""),        // New TT, ignored due to OOM
+        emulator.makeTransfer(uavcan::TransferTypeMessageUnicast,   126, "foo"),     // Same as 2, not ignored
+    };
+
+    emulator.send(transfers);
+
+    ASSERT_TRUE(subscriber.matchAndPop(transfers[0]));
+    ASSERT_TRUE(subscriber.matchAndPop(transfers[1]));
+    ASSERT_TRUE(subscriber.matchAndPop(transfers[2]));
+    ASSERT_TRUE(subscriber.matchAndPop(transfers[4]));
+    ASSERT_TRUE(subscriber.matchAndPop(transfers[6]));
+    ASSERT_TRUE(subscriber.matchAndPop(transfers[3]));
+    ASSERT_TRUE(subscriber.isEmpty());
+
+    /*
+     * Cleanup with huge timestamp value will remove all entries, so that the ignored transfer will be accepted
+     */
+    static_cast<uavcan::TransferListenerBase&>(subscriber).cleanup(tsMono(100000000));
+
+    emulator.send(&transfers[5], 1);
+    ASSERT_TRUE(subscriber.matchAndPop(transfers[5]));
+    ASSERT_TRUE(subscriber.isEmpty());
+}
+
+
 TEST(TransferListener, MaximumTransferLength)
 {
     const uavcan::DataTypeDescriptor type(uavcan::DataTypeKindMessage, 123, uavcan::DataTypeSignature(123456789), "A");
@@ -5,6 +5,7 @@
 #include <algorithm>
 #include <gtest/gtest.h>
 #include <uavcan/transport/transfer_receiver.hpp>
+#include <uavcan/transport/crc.hpp>
 #include "../clock.hpp"
 
 /*
@@ -214,6 +215,42 @@ TEST(TransferReceiver, Basic)
 }
 
 
+TEST(TransferReceiver, PayloadCrc)
+{
+    Context<32> context;
+    RxFrameGenerator gen(789);
+    uavcan::TransferReceiver& rcv = context.receiver;
+    uavcan::TransferBufferAccessor bk(context.bufmgr, RxFrameGenerator::DEFAULT_KEY);
+
+    uavcan::TransferCRC crc_base;
+    crc_base.add(reinterpret_cast<const uint8_t*>("signature"), 9);
+
+    uavcan::TransferCRC expected = crc_base;
+    expected.add(reinterpret_cast<const uint8_t*>("345678abcdefghfoo"), 17);
+
+    /*
+     * The CRC field is excluded, the base value is applied at the first frame
+     */
+    CHECK_NOT_COMPLETE(rcv.addFrame(gen(0, "\x34\x12" "345678", 0, false, 0, 100), bk, crc_base));
+    CHECK_NOT_COMPLETE(rcv.addFrame(gen(0, "abcdefgh",           1, false, 0, 200), bk, crc_base));
+    CHECK_COMPLETE(    rcv.addFrame(gen(0, "foo",                2, true,  0, 300), bk, crc_base));
+    ASSERT_EQ(0x1234, rcv.getLastTransferCrc());
+    ASSERT_EQ(expected.get(), rcv.getLastTransferComputedCrc());
+
+    /*
+     * Rejected frames don't affect the CRC; the next transfer starts over
+     */
+    expected = crc_base;
+    expected.add(reinterpret_cast<const uint8_t*>("qwertyzxc"), 9);
+
+    CHECK_NOT_COMPLETE(rcv.addFrame(gen(0, "\x78\x56" "qwerty", 0, false, 1, 1000), bk, crc_base));
+    CHECK_NOT_COMPLETE(rcv.addFrame(gen(1, "garbage",            1, true,  1, 1100), bk, crc_base)); // Wrong iface
+    CHECK_NOT_COMPLETE(rcv.addFrame(gen(0, "garbage",            2, true,  1, 1100), bk, crc_base)); // Wrong index
+    CHECK_COMPLETE(    rcv.addFrame(gen(0, "zxc",                1, true,  1, 1200), bk, crc_base));
+    ASSERT_EQ(0x5678, rcv.getLastTransferCrc());
+    ASSERT_EQ(expected.get(), rcv.getLastTransferComputedCrc());
+}
+
 TEST(TransferReceiver, OutOfBufferSpace_32bytes)
 {
     Context<32> context;
@@ -300,6 +337,105 @@ TEST(TransferReceiver, OutOfOrderFrames)
 }
 
 
+TEST(TransferReceiver, CrossIfaceReassembly)
+{
+    using uavcan::TransferReceiver;
+    Context<32> context;
+    RxFrameGenerator gen(789);
+    uavcan::TransferReceiver& rcv = context.receiver;
+    uavcan::ITransferBufferManager& bufmgr = context.bufmgr;
+    uavcan::TransferBufferAccessor bk(context.bufmgr, RxFrameGenerator::DEFAULT_KEY);
+    const uavcan::TransferCRC crc;
+    const TransferReceiver::ReassemblyMode mode = TransferReceiver::ReassemblyCrossIface;
+    uavcan::TransferReceiverIfaceTracker tracker;
+
+    /*
+     * Iface 0 loses the second frame, iface 1 delivers its twin later
+     */
+    CHECK_NOT_COMPLETE(rcv.addFrame(gen(0, "\x34\x12" "345678", 0, false, 0, 100), bk, crc, mode, &tracker));
+    CHECK_NOT_COMPLETE(rcv.addFrame(gen(1, "\x34\x12" "345678", 0, false, 0, 110), bk, crc, mode, &tracker));  // Twin
+    ASSERT_EQ(0, tracker.yieldLostFrameCount());
+    CHECK_NOT_COMPLETE(rcv.addFrame(gen(0, "foo",              2, true,  0, 200), bk, crc, mode, &tracker));  // Gap
+    ASSERT_EQ(1, tracker.yieldLostFrameCount());
+    CHECK_NOT_COMPLETE(rcv.addFrame(gen(1, "abcdefgh",         1, false, 0, 210), bk, crc, mode, &tracker));
+    CHECK_COMPLETE(    rcv.addFrame(gen(1, "foo",              2, true,  0, 220), bk, crc, mode, &tracker));
+    ASSERT_TRUE(matchBufferContent(bufmgr.access(gen.bufmgr_key), "345678abcdefghfoo"));
+    ASSERT_EQ(0x1234, rcv.getLastTransferCrc());
+    ASSERT_EQ(100, rcv.getLastTransferTimestampMonotonic().toUSec());
+    ASSERT_EQ(0, tracker.yieldLostFrameCount());
+
+    /*
+     * Iface 1 loses the last frame; that's detected when it delivers the next transfer
+     */
+    CHECK_NOT_COMPLETE(rcv.addFrame(gen(0, "\x9a\x78" "qwerty", 0, false, 1, 1000), bk, crc, mode, &tracker));
+    CHECK_NOT_COMPLETE(rcv.addFrame(gen(1, "\x9a\x78" "qwerty", 0, false, 1, 1010), bk, crc, mode, &tracker));
+    CHECK_COMPLETE(    rcv.addFrame(gen(0, "uiop",             1, true,  1, 1100), bk, crc, mode, &tracker));
+    ASSERT_TRUE(matchBufferContent(bufmgr.access(gen.bufmgr_key), "qwertyuiop"));
+
+    CHECK_SINGLE_FRAME(rcv.addFrame(gen(1, "zxc",              0, true,  2, 2000), bk, crc, mode, &tracker));
+    ASSERT_EQ(1, tracker.yieldLostFrameCount());
+    CHECK_NOT_COMPLETE(rcv.addFrame(gen(0, "zxc",              0, true,  2, 2010), bk, crc, mode, &tracker));  // Twin
+    ASSERT_EQ(0, tracker.yieldLostFrameCount());
+
+    // Twin frames and lost frames are not errors
+    ASSERT_EQ(0, rcv.yieldErrorCount());
+
+    /*
+     * Single iface mode ignores the other iface until the current one times out
+     */
+    CHECK_NOT_COMPLETE(rcv.addFrame(gen(0, "\x34\x12" "345678", 0, false, 3, 3000), bk));
+    CHECK_NOT_COMPLETE(rcv.addFrame(gen(1, "abcdefgh",         1, false, 3, 3010), bk));
+    CHECK_NOT_COMPLETE(rcv.addFrame(gen(1, "foo",              2, true,  3, 3020), bk));
+    ASSERT_EQ(0, tracker.yieldLostFrameCount());
+}
+
+TEST(TransferReceiver, CrossIfaceInterleavedTransfers)
+{
+    using uavcan::TransferReceiver;
+    Context<32> context;
+    RxFrameGenerator gen(789);
+    uavcan::TransferReceiver& rcv = context.receiver;
+    uavcan::ITransferBufferManager& bufmgr = context.bufmgr;
+    uavcan::TransferBufferAccessor bk(context.bufmgr, RxFrameGenerator::DEFAULT_KEY);
+    const uavcan::TransferCRC crc;
+    const TransferReceiver::ReassemblyMode mode = TransferReceiver::ReassemblyCrossIface;
+
+    /*
+     * Iface 0 loses the last frame and proceeds to the next transfer, while iface 1 is still delivering this one
+     */
+    CHECK_NOT_COMPLETE(rcv.addFrame(gen(0, "\x34\x12" "345678", 0, false, 0, 100), bk, crc, mode));
+    CHECK_NOT_COMPLETE(rcv.addFrame(gen(0, "abcdefgh",         1, false, 0, 110), bk, crc, mode));
+    CHECK_NOT_COMPLETE(rcv.addFrame(gen(1, "\x34\x12" "345678", 0, false, 0, 120), bk, crc, mode));  // Twin
+    CHECK_NOT_COMPLETE(rcv.addFrame(gen(0, "\x9a\x78" "qwerty", 0, false, 1, 200), bk, crc, mode));  // Ahead
+    CHECK_NOT_COMPLETE(rcv.addFrame(gen(1, "abcdefgh",         1, false, 0, 210), bk, crc, mode));  // Twin
+    CHECK_COMPLETE(    rcv.addFrame(gen(1, "foo",              2, true,  0, 220), bk, crc, mode));
+    ASSERT_TRUE(matchBufferContent(bufmgr.access(gen.bufmgr_key), "345678abcdefghfoo"));
+    ASSERT_EQ(0x1234, rcv.getLastTransferCrc());
+
+    /*
+     * The next transfer is then received from iface 1, iface 0 has already sent its first frame
+     */
+    CHECK_NOT_COMPLETE(rcv.addFrame(gen(0, "uiop",             1, true,  1, 300), bk, crc, mode));  // Gap
+    CHECK_NOT_COMPLETE(rcv.addFrame(gen(1, "\x9a\x78" "qwerty", 0, false, 1, 310), bk, crc, mode));
+    CHECK_COMPLETE(    rcv.addFrame(gen(1, "uiop",             1, true,  1, 320), bk, crc, mode));
+    ASSERT_TRUE(matchBufferContent(bufmgr.access(gen.bufmgr_key), "qwertyuiop"));
+    ASSERT_EQ(0x789a, rcv.getLastTransferCrc());
+    ASSERT_EQ(310, rcv.getLastTransferTimestampMonotonic().toUSec());
+
+    ASSERT_EQ(0, rcv.yieldErrorCount());
+
+    /*
+     * A transfer that is abandoned on all ifaces is dropped once the iface timeout expires
+     */
+    CHECK_NOT_COMPLETE(rcv.addFrame(gen(0, "\x34\x12" "345678", 0, false, 2, 1000), bk, crc, mode));
+    CHECK_NOT_COMPLETE(rcv.addFrame(gen(1, "\x9a\x78" "qwerty", 0, false, 3, 1100), bk, crc, mode));
+    ASSERT_EQ(0, rcv.yieldErrorCount());
+    CHECK_NOT_COMPLETE(rcv.addFrame(gen(1, "\x9a\x78" "qwerty", 0, false, 4, 3000000), bk, crc, mode));
+    CHECK_COMPLETE(    rcv.addFrame(gen(0, "uiop",             1, true,  4, 3000100), bk, crc, mode));
+    ASSERT_TRUE(matchBufferContent(bufmgr.access(gen.bufmgr_key), "qwertyuiop"));
+    ASSERT_EQ(1, rcv.yieldErrorCount());
+}
+
 TEST(TransferReceiver, IntervalMeasurement)
 {
     Context<32> context;
@@ -0,0 +1,127 @@
+/*
+ * Copyright (C) 2014 Pavel Kirienko <pavel.kirienko@gmail.com>
+ */
+
+#include <gtest/gtest.h>
+#include <uavcan/transport/transfer_receiver_store.hpp>
+#include "../clock.hpp"
+
+
+TEST(TransferReceiverTable, Basic)
+{
+    using uavcan::TransferBufferManagerKey;
+    using uavcan::TransferReceiver;
+
+    uavcan::PoolAllocator<uavcan::MemPoolBlockSize * 8, uavcan::MemPoolBlockSize> pool;
+    uavcan::PoolManager<1> poolmgr;
+    poolmgr.addPool(&pool);
+
+    uavcan::TransferBufferManager<16, 1> bufmgr(poolmgr);
+
+    std::auto_ptr<uavcan::TransferReceiverTable<2> > table(new uavcan::TransferReceiverTable<2>(poolmgr));
+
+    const TransferBufferManagerKey key_a(1, uavcan::TransferTypeMessageBroadcast);
+    const TransferBufferManagerKey key_b(1, uavcan::TransferTypeServiceRequest);
+    const TransferBufferManagerKey key_c(127, uavcan::TransferTypeMessageBroadcast);
+    const TransferBufferManagerKey key_d(42, uavcan::TransferTypeServiceResponse);
+
+    ASSERT_TRUE(table->isEmpty());
+    ASSERT_FALSE(table->access(key_a));
+
+    /*
+     * Static entries first
+     */
+    TransferReceiver* const recv_a = table->create(key_a);
+    TransferReceiver* const recv_b = table->create(key_b);
+    ASSERT_TRUE(recv_a);
+    ASSERT_TRUE(recv_b);
+    ASSERT_NE(recv_a, recv_b);
+    ASSERT_EQ(0, pool.getNumUsedBlocks());
+
+    /*
+     * Then the pool
+     */
+    TransferReceiver* const recv_c = table->create(key_c);
+    TransferReceiver* const recv_d = table->create(key_d);
+    ASSERT_TRUE(recv_c);
+    ASSERT_TRUE(recv_d);
+    ASSERT_EQ(2, pool.getNumUsedBlocks());
+    ASSERT_EQ(4, table->getNumEntries());
+
+    ASSERT_EQ(recv_a, table->access(key_a));
+    ASSERT_EQ(recv_b, table->access(key_b));
+    ASSERT_EQ(recv_c, table->access(key_c));
+    ASSERT_EQ(recv_d, table->access(key_d));
+    ASSERT_FALSE(table->access(TransferBufferManagerKey(1, uavcan::TransferTypeMessageUnicast)));
+    ASSERT_FALSE(table->access(TransferBufferManagerKey(2, uavcan::TransferTypeMessageBroadcast)));
+
+    /*
+     * Fresh receivers are timed out; buffers must be removed along with them
+     */
+    ASSERT_TRUE(bufmgr.create(key_b));
+    ASSERT_TRUE(bufmgr.create(key_c));
+    table->removeTimedOut(tsMono(100000000), bufmgr);
+    ASSERT_TRUE(table->isEmpty());
+    ASSERT_EQ(0, pool.getNumUsedBlocks());
+    ASSERT_TRUE(bufmgr.isEmpty());
+
+    /*
+     * Static slots are reused; the destructor releases the pool blocks
+     */
+    ASSERT_TRUE(table->create(key_a));
+    ASSERT_TRUE(table->create(key_c));
+    ASSERT_TRUE(table->create(key_d));
+    ASSERT_EQ(1, pool.getNumUsedBlocks());
+
+    table.reset();
+    ASSERT_EQ(0, pool.getNumUsedBlocks());
+}
+
+TEST(TransferReceiverTable, NoStatic)
+{
+    uavcan::PoolAllocator<uavcan::MemPoolBlockSize * 2, uavcan::MemPoolBlockSize> pool;
+    uavcan::PoolManager<1> poolmgr;
+    poolmgr.addPool(&pool);
+
+    uavcan::TransferReceiverTable<0> table(poolmgr);
+
+    ASSERT_TRUE(table.create(uavcan::TransferBufferManagerKey(10, uavcan::TransferTypeMessageBroadcast)));
+    ASSERT_TRUE(table.create(uavcan::TransferBufferManagerKey(10, uavcan::TransferTypeMessageUnicast)));
+    ASSERT_FALSE(table.create(uavcan::TransferBufferManagerKey(11, uavcan::TransferTypeMessageBroadcast))); // OOM
+    ASSERT_EQ(2, pool.getNumUsedBlocks());
+
+    table.removeAll();
+    ASSERT_TRUE(table.isEmpty());
+    ASSERT_EQ(0, pool.getNumUsedBlocks());
+}
+
+TEST(TransferReceiverHashMap, Basic)
+{
+    using uavcan::TransferBufferManagerKey;
+
+    uavcan::PoolAllocator<uavcan::MemPoolBlockSize * 16, uavcan::MemPoolBlockSize> pool;
+    uavcan::PoolManager<1> poolmgr;
+    poolmgr.addPool(&pool);
+
+    uavcan::TransferBufferManager<16, 1> bufmgr(poolmgr);
+    uavcan::TransferReceiverHashMap<2> map(poolmgr);
+
+    // Every pool block must hold at least one receiver, which is also checked at compile time
+    ASSERT_LE(1, int(uavcan::HashMap<TransferBufferManagerKey, uavcan::TransferReceiver>::NumKVPerPoolBlock));
+
+    // Exceeding the static buffer makes the map grow into the pool
+    for (uint8_t node_id = 1; node_id <= 6; node_id++)
+    {
+        ASSERT_TRUE(map.create(TransferBufferManagerKey(node_id, uavcan::TransferTypeMessageBroadcast)));
+    }
+    ASSERT_LT(0, pool.getNumUsedBlocks());
+    for (uint8_t node_id = 1; node_id <= 6; node_id++)
+    {
+        ASSERT_TRUE(map.access(TransferBufferManagerKey(node_id, uavcan::TransferTypeMessageBroadcast)));
+    }
+    ASSERT_FALSE(map.access(TransferBufferManagerKey(7, uavcan::TransferTypeMessageBroadcast)));
+
+    map.removeTimedOut(tsMono(100000000), bufmgr);
+    ASSERT_TRUE(map.isEmpty());
+    ASSERT_EQ(0, pool.getNumUsedBlocks());
+}
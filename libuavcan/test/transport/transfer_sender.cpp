@@ -243,3 +243,39 @@ TEST(TransferSender, PassiveMode)
     EXPECT_EQ(0, dispatcher.getTransferPerfCounter().getTxTransferCount());
     EXPECT_EQ(0, dispatcher.getTransferPerfCounter().getRxTransferCount());
 }
+
+
+TEST(TransferSender, InvalidDestination)
+{
+    uavcan::PoolManager<1> poolmgr;
+
+    SystemClockMock clockmock(100);
+    CanDriverMock driver(1, clockmock);
+
+    uavcan::OutgoingTransferRegistry<8> out_trans_reg(poolmgr);
+    uavcan::Dispatcher dispatcher(driver, poolmgr, clockmock, out_trans_reg);
+    ASSERT_TRUE(dispatcher.setNodeID(64));
+
+    uavcan::TransferSender sender(dispatcher, makeDataType(uavcan::DataTypeKindService, 123),
+                                  uavcan::CanTxQueue::Volatile);
+
+    static const uint8_t Payload[] = {1, 2, 3, 4, 5};
+
+    // Unicast transfers need a valid unicast destination
+    ASSERT_EQ(-uavcan::ErrLogic,
+              sender.send(Payload, sizeof(Payload), tsMono(1000), uavcan::MonotonicTime(),
+                          uavcan::TransferTypeServiceRequest, uavcan::NodeID(), 0));
+    ASSERT_EQ(-uavcan::ErrLogic,
+              sender.send(Payload, sizeof(Payload), tsMono(1000), uavcan::MonotonicTime(),
+                          uavcan::TransferTypeServiceRequest, uavcan::NodeID::Broadcast, 0));
+    ASSERT_EQ(-uavcan::ErrLogic,
+              sender.send(Payload, sizeof(Payload), tsMono(1000), uavcan::MonotonicTime(),
+                          uavcan::TransferTypeServiceRequest, uavcan::NodeID(64), 0));
+
+    EXPECT_EQ(3, dispatcher.getTransferPerfCounter().getErrorCount());
+    EXPECT_TRUE(driver.ifaces.at(0).tx.empty());
+
+    ASSERT_EQ(1, sender.send(Payload, sizeof(Payload), tsMono(1000), uavcan::MonotonicTime(),
+                             uavcan::TransferTypeServiceRequest, uavcan::NodeID(42), 0));
+    EXPECT_EQ(1, driver.ifaces.at(0).tx.size());
+}
@@ -111,10 +111,14 @@ struct Transfer
  * In reality, uavcan::TransferListener should accept only specific transfer types
  * which are dispatched/filtered by uavcan::Dispatcher.
  */
-template <unsigned MAX_BUF_SIZE, unsigned NUM_STATIC_BUFS, unsigned NUM_STATIC_RECEIVERS>
-class TestListener : public uavcan::TransferListener<MAX_BUF_SIZE, NUM_STATIC_BUFS, NUM_STATIC_RECEIVERS>
+template <unsigned MAX_BUF_SIZE, unsigned NUM_STATIC_BUFS, unsigned NUM_STATIC_RECEIVERS,
+          template <unsigned> class RECEIVER_STORE = uavcan::TransferReceiverMap,
+          template <uint16_t, uint8_t> class BUFFER_MANAGER = uavcan::TransferBufferManager>
+class TestListener : public uavcan::TransferListener<MAX_BUF_SIZE, NUM_STATIC_BUFS, NUM_STATIC_RECEIVERS,
+                                                     RECEIVER_STORE, BUFFER_MANAGER>
 {
-    typedef uavcan::TransferListener<MAX_BUF_SIZE, NUM_STATIC_BUFS, NUM_STATIC_RECEIVERS> Base;
+    typedef uavcan::TransferListener<MAX_BUF_SIZE, NUM_STATIC_BUFS, NUM_STATIC_RECEIVERS, RECEIVER_STORE,
+                                     BUFFER_MANAGER> Base;
 
     std::queue<Transfer> transfers_;
 
@@ -0,0 +1,330 @@
+/*
+ * Copyright (C) 2014 Pavel Kirienko <pavel.kirienko@gmail.com>
+ */
+
+#include <map>
+#include <memory>
+#include <cstdlib>
+#include <gtest/gtest.h>
+#include <uavcan/util/hash_map.hpp>
+
+
+static bool oddValuePredicate(const uint32_t& key, const uint32_t& value)
+{
+    EXPECT_NE(0, key);
+    return value & 1;
+}
+
+struct KeyFindPredicate
+{
+    const uint32_t target;
+    KeyFindPredicate(uint32_t target) : target(target) { }
+    bool operator()(const uint32_t& key, const uint32_t&) const { return key == target; }
+};
+
+struct ValueFindPredicate
+{
+    const uint32_t target;
+    ValueFindPredicate(uint32_t target) : target(target) { }
+    bool operator()(const uint32_t&, const uint32_t& value) const { return value == target; }
+};
+
+struct KeyBucketPredicate
+{
+    const uint32_t bucket;
+    KeyBucketPredicate(uint32_t key) : bucket(key / 16) { }
+    bool operator()(const uint32_t& key, const uint32_t&) const { return (key / 16) == bucket; }
+};
+
+/**
+ * All keys collide, which makes the probe sequences as long as possible.
+ */
+struct CollidingKey
+{
+    uint16_t value;
+
+    CollidingKey(uint16_t value = 0) : value(value) { }
+
+    bool operator==(const CollidingKey& rhs) const { return value == rhs.value; }
+
+    uint32_t hash() const { return 42; }
+};
+
+
+TEST(HashMap, Basic)
+{
+    using uavcan::HashMap;
+
+    static const int POOL_BLOCKS = 8;
+    uavcan::PoolAllocator<uavcan::MemPoolBlockSize * POOL_BLOCKS, uavcan::MemPoolBlockSize> pool;
+    uavcan::PoolManager<2> poolmgr;
+    poolmgr.addPool(&pool);
+
+    typedef HashMap<uint32_t, uint32_t, 3> MapType;
+    std::auto_ptr<MapType> map(new MapType(poolmgr));
+
+    // Empty
+    ASSERT_FALSE(map->access(1));
+    map->remove(1);
+    ASSERT_EQ(0, pool.getNumUsedBlocks());
+    ASSERT_FALSE(map->getByIndex(0));
+    ASSERT_FALSE(map->getByIndex(10000));
+    ASSERT_TRUE(map->isEmpty());
+    ASSERT_EQ(4, map->getCapacity());
+
+    // Static insertion
+    ASSERT_EQ(10, *map->insert(1, 10));
+    ASSERT_EQ(20, *map->insert(2, 20));
+    ASSERT_EQ(30, *map->insert(3, 30));
+    ASSERT_EQ(0, pool.getNumUsedBlocks());
+    ASSERT_EQ(3, map->getNumStaticPairs());
+    ASSERT_EQ(0, map->getNumDynamicPairs());
+    ASSERT_EQ(3, map->getSize());
+
+    // Dynamic insertion - the table grows into the pool and all entries get rehashed
+    ASSERT_EQ(40, *map->insert(4, 40));
+    ASSERT_LT(0, pool.getNumUsedBlocks());
+    ASSERT_LT(0, map->getNumSegments());
+    ASSERT_EQ(4, map->getSize());
+    ASSERT_EQ(50, *map->insert(5, 50));
+    ASSERT_EQ(60, *map->insert(6, 60));
+
+    for (uint32_t i = 1; i <= 6; i++)
+    {
+        ASSERT_TRUE(map->access(i));
+        ASSERT_EQ(i * 10, *map->access(i));
+        ASSERT_TRUE(map->getByIndex(i - 1));
+    }
+    ASSERT_FALSE(map->access(7));
+    ASSERT_FALSE(map->getByIndex(6));
+    ASSERT_EQ(6, map->getNumStaticPairs() + map->getNumDynamicPairs());
+
+    // Replacing an existing entry doesn't change the size
+    ASSERT_EQ(11, *map->insert(1, 11));
+    ASSERT_EQ(6, map->getSize());
+    *map->access(2) = 21;
+    ASSERT_EQ(21, *map->access(2));
+
+    // Finding some keys and values
+    ASSERT_EQ(3, *map->findFirstKey(KeyFindPredicate(3)));
+    ASSERT_EQ(5, *map->findFirstKey(ValueFindPredicate(50)));
+    ASSERT_FALSE(map->findFirstKey(KeyFindPredicate(100)));
+    ASSERT_FALSE(map->findFirstKey(ValueFindPredicate(10)));
+
+    // Removing the odd values; the table shrinks back to the static buffer
+    map->removeWhere(oddValuePredicate);
+    ASSERT_EQ(4, map->getSize());
+    ASSERT_FALSE(map->access(1));
+    ASSERT_FALSE(map->access(2));
+    ASSERT_EQ(30, *map->access(3));
+    ASSERT_EQ(40, *map->access(4));
+
+    map->remove(3);
+    map->remove(3);
+    map->remove(100);
+    ASSERT_EQ(3, map->getSize());
+
+    map->remove(4);
+    ASSERT_EQ(0, map->getNumSegments());
+    ASSERT_EQ(0, pool.getNumUsedBlocks());
+    ASSERT_EQ(2, map->getNumStaticPairs());
+    ASSERT_EQ(50, *map->access(5));
+    ASSERT_EQ(60, *map->access(6));
+
+    // Destruction releases the pool
+    ASSERT_TRUE(map->insert(7, 70));
+    ASSERT_TRUE(map->insert(8, 80));
+    ASSERT_TRUE(map->insert(9, 90));
+    ASSERT_LT(0, pool.getNumUsedBlocks());
+    map.reset();
+    ASSERT_EQ(0, pool.getNumUsedBlocks());
+}
+
+
+TEST(HashMap, NoStatic)
+{
+    using uavcan::HashMap;
+
+    static const int POOL_BLOCKS = 3;
+    uavcan::PoolAllocator<uavcan::MemPoolBlockSize * POOL_BLOCKS, uavcan::MemPoolBlockSize> pool;
+    uavcan::PoolManager<2> poolmgr;
+    poolmgr.addPool(&pool);
+
+    typedef HashMap<uint16_t, uint16_t> MapType;
+    std::auto_ptr<MapType> map(new MapType(poolmgr));
+
+    ASSERT_EQ(0, map->getCapacity());
+    ASSERT_FALSE(map->access(1));
+
+    ASSERT_EQ(10, *map->insert(1, 10));
+    ASSERT_EQ(2, pool.getNumUsedBlocks());          // Directory block and one segment
+    ASSERT_EQ(0, map->getNumStaticPairs());
+    ASSERT_EQ(1, map->getNumDynamicPairs());
+
+    map->remove(1);
+    ASSERT_TRUE(map->isEmpty());
+    ASSERT_EQ(0, pool.getNumUsedBlocks());
+
+    // Out of memory - the last segment can be filled up, except for the last free slot
+    const unsigned max_entries = unsigned(MapType::NumKVPerPoolBlock) * 2U - 1U;
+    for (unsigned i = 1; i <= max_entries; i++)
+    {
+        ASSERT_TRUE(map->insert(uint16_t(i), uint16_t(i * 2))) << i;
+    }
+    ASSERT_FALSE(map->insert(uint16_t(max_entries + 1), 0));
+    ASSERT_EQ(max_entries, map->getSize());
+    ASSERT_EQ(3, pool.getNumUsedBlocks());
+    for (unsigned i = 1; i <= max_entries; i++)
+    {
+        ASSERT_EQ(i * 2, *map->access(uint16_t(i)));
+    }
+
+    map.reset();
+    ASSERT_EQ(0, pool.getNumUsedBlocks());
+}
+
+
+/**
+ * Fills most of a pool block, like TransferReceiver does with 56 byte blocks.
+ */
+struct LargeHashMapValue
+{
+    uint64_t data[uavcan::MemPoolBlockSize / 8U - 2U];
+
+    LargeHashMapValue() { std::fill(data, data + sizeof(data) / sizeof(data[0]), 0); }
+};
+
+TEST(HashMap, LargeValues)
+{
+    using uavcan::HashMap;
+
+    uavcan::PoolAllocator<uavcan::MemPoolBlockSize * 16, uavcan::MemPoolBlockSize> pool;
+    uavcan::PoolManager<1> poolmgr;
+    poolmgr.addPool(&pool);
+
+    typedef HashMap<uint16_t, LargeHashMapValue, 0, 8> MapType;
+    ASSERT_EQ(1, MapType::NumKVPerPoolBlock);      // The key is padded to the alignment of the value
+
+    MapType map(poolmgr);
+    LargeHashMapValue value;
+    for (uint16_t i = 1; i <= 4; i++)
+    {
+        value.data[0] = i;
+        ASSERT_TRUE(map.insert(i, value));
+    }
+    for (uint16_t i = 1; i <= 4; i++)
+    {
+        ASSERT_TRUE(map.access(i));
+        ASSERT_EQ(i, map.access(i)->data[0]);
+    }
+    ASSERT_TRUE(map.getByIndex(0));
+    ASSERT_EQ(map.getByIndex(0)->key, map.getByIndex(0)->value.data[0]);
+    ASSERT_TRUE(map.getByIndex(0)->match(map.getByIndex(0)->key));
+
+    map.removeAll();
+    ASSERT_EQ(0, pool.getNumUsedBlocks());
+}
+
+TEST(HashMap, Collisions)
+{
+    using uavcan::HashMap;
+
+    uavcan::PoolAllocator<uavcan::MemPoolBlockSize * 8, uavcan::MemPoolBlockSize> pool;
+    uavcan::PoolManager<1> poolmgr;
+    poolmgr.addPool(&pool);
+
+    HashMap<CollidingKey, uint16_t, 8> map(poolmgr);
+
+    for (uint16_t i = 1; i <= 20; i++)
+    {
+        ASSERT_TRUE(map.insert(CollidingKey(i), i));
+    }
+
+    // Removal from the middle of the cluster must keep the rest of it reachable
+    for (uint16_t i = 1; i <= 20; i += 3)
+    {
+        map.remove(CollidingKey(i));
+        ASSERT_FALSE(map.access(CollidingKey(i)));
+    }
+    for (uint16_t i = 1; i <= 20; i++)
+    {
+        if ((i - 1) % 3 != 0)
+        {
+            ASSERT_TRUE(map.access(CollidingKey(i))) << i;
+            ASSERT_EQ(i, *map.access(CollidingKey(i)));
+        }
+    }
+
+    map.removeAll();
+    ASSERT_TRUE(map.isEmpty());
+    ASSERT_EQ(0, pool.getNumUsedBlocks());
+}
+
+
+TEST(HashMap, RandomizedAgainstStdMap)
+{
+    using uavcan::HashMap;
+
+    uavcan::PoolAllocator<uavcan::MemPoolBlockSize * 256, uavcan::MemPoolBlockSize> pool;
+    uavcan::PoolManager<1> poolmgr;
+    poolmgr.addPool(&pool);
+
+    std::auto_ptr<HashMap<uint32_t, uint32_t, 10> > map(new HashMap<uint32_t, uint32_t, 10>(poolmgr));
+    std::map<uint32_t, uint32_t> reference;
+
+    std::srand(42);
+    for (unsigned iteration = 0; iteration < 100000; iteration++)
+    {
+        const uint32_t key = 1U + uint32_t(std::rand() % 300);
+        const int action = std::rand() % 8;
+        if (action < 4)
+        {
+            const uint32_t value = uint32_t(std::rand());
+            ASSERT_TRUE(map->insert(key, value));
+            reference[key] = value;
+        }
+        else if (action < 7)
+        {
+            map->remove(key);
+            reference.erase(key);
+        }
+        else
+        {
+            // Removes every key that falls into the same bucket of 16 as the randomly selected one
+            map->removeWhere(KeyBucketPredicate(key));
+            for (std::map<uint32_t, uint32_t>::iterator it = reference.begin(); it != reference.end();)
+            {
+                if (KeyBucketPredicate(key)(it->first, it->second))
+                {
+                    reference.erase(it++);
+                }
+                else
+                {
+                    ++it;
+                }
+            }
+        }
+
+        ASSERT_EQ(reference.size(), map->getSize());
+        if (iteration % 64 == 0)
+        {
+            for (uint32_t k = 1; k <= 300; k++)
+            {
+                const std::map<uint32_t, uint32_t>::const_iterator it = reference.find(k);
+                uint32_t* const value = map->access(k);
+                if (it == reference.end())
+                {
+                    ASSERT_FALSE(value);
+                }
+                else
+                {
+                    ASSERT_TRUE(value);
+                    ASSERT_EQ(it->second, *value);
+                }
+            }
+        }
+    }
+
+    map.reset();
+    ASSERT_EQ(0, pool.getNumUsedBlocks());
+}
@@ -0,0 +1,192 @@
+/*
+ * Copyright (C) 2014 Pavel Kirienko <pavel.kirienko@gmail.com>
+ */
+
+#include <iostream>
+#include <memory>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <chrono>
+#include <cstring>
+#include <uavcan_linux/pool_allocator.hpp>
+#include "debug.hpp"
+
+static constexpr std::size_t BlockSize = uavcan::MemPoolBlockSize;
+static constexpr std::size_t PoolSize = BlockSize * 256;
+
+/**
+ * uavcan::PoolAllocator<> behind a mutex - the reference for the benchmark.
+ */
+class MutexPoolAllocator : public uavcan::IPoolAllocator
+{
+    uavcan::PoolAllocator<PoolSize, BlockSize> pool_;
+    mutable std::mutex mutex_;
+
+public:
+    virtual void* allocate(std::size_t size)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return pool_.allocate(size);
+    }
+
+    virtual void deallocate(const void* ptr)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        pool_.deallocate(ptr);
+    }
+
+    virtual bool isInPool(const void* ptr) const { return pool_.isInPool(ptr); }
+    virtual std::size_t getBlockSize() const { return pool_.getBlockSize(); }
+    virtual std::size_t getNumBlocks() const { return pool_.getNumBlocks(); }
+};
+
+/**
+ * Every thread keeps a few blocks at a time, filling them with its own pattern and checking the pattern on release.
+ * If a block were given to two threads at once, the pattern would be overwritten.
+ * Returns the number of allocate() and deallocate() calls made.
+ */
+static std::uint64_t runWorker(uavcan::IPoolAllocator& allocator, std::uint8_t pattern, unsigned num_iterations,
+                               bool check)
+{
+    static constexpr unsigned NumSlots = 16;
+    std::uint8_t* slots[NumSlots] = { };
+    std::uint32_t rnd = pattern;
+    std::uint64_t num_calls = 0;
+
+    for (unsigned i = 0; i < num_iterations; i++)
+    {
+        rnd = rnd * 1103515245U + 12345U;
+        std::uint8_t*& slot = slots[(rnd >> 16) % NumSlots];
+        if (slot != nullptr)
+        {
+            if (check)
+            {
+                for (std::size_t k = 0; k < BlockSize; k++)
+                {
+                    ENFORCE(slot[k] == pattern);
+                }
+            }
+            allocator.deallocate(slot);
+            slot = nullptr;
+        }
+        else
+        {
+            slot = static_cast<std::uint8_t*>(allocator.allocate(BlockSize));
+            if ((slot != nullptr) && check)
+            {
+                std::memset(slot, pattern, BlockSize);
+            }
+        }
+        num_calls++;
+    }
+    for (auto p : slots)
+    {
+        allocator.deallocate(p);
+    }
+    return num_calls;
+}
+
+/**
+ * Returns the total number of allocate() and deallocate() calls per second, millions.
+ */
+static double runThreads(uavcan::IPoolAllocator& allocator, unsigned num_threads, unsigned num_iterations,
+                         bool check)
+{
+    std::vector<std::thread> threads;
+    std::vector<std::uint64_t> num_calls(num_threads);
+    std::vector<std::string> errors(num_threads);
+
+    const auto started_at = std::chrono::steady_clock::now();
+    for (unsigned i = 0; i < num_threads; i++)
+    {
+        threads.emplace_back([&, i]()
+        {
+            try
+            {
+                num_calls[i] = runWorker(allocator, std::uint8_t(i + 1), num_iterations, check);
+            }
+            catch (const std::exception& ex)
+            {
+                errors[i] = ex.what();
+            }
+        });
+    }
+    for (auto& t : threads)
+    {
+        t.join();
+    }
+    const double elapsed_sec =
+        std::chrono::duration<double>(std::chrono::steady_clock::now() - started_at).count();
+
+    std::uint64_t total_calls = 0;
+    for (unsigned i = 0; i < num_threads; i++)
+    {
+        if (!errors[i].empty())
+        {
+            throw std::runtime_error(errors[i]);
+        }
+        total_calls += num_calls[i];
+    }
+    return double(total_calls) / elapsed_sec / 1e6;
+}
+
+static void testStress()
+{
+    static constexpr unsigned NumThreads = 8;
+    static constexpr unsigned NumIterations = 200000;
+
+    std::unique_ptr<uavcan_linux::LockFreePoolAllocator<PoolSize>> pool(
+        new uavcan_linux::LockFreePoolAllocator<PoolSize>);
+
+    // 8 threads with 16 slots each can't exhaust 256 blocks, so every allocation must succeed
+    (void)runThreads(*pool, NumThreads, NumIterations, true);
+
+    ENFORCE(0 == pool->getNumUsedBlocks());
+    ENFORCE(pool->getNumBlocks() == pool->countFreeListBlocks());
+    ENFORCE(pool->getPeakNumUsedBlocks() > 0);
+    ENFORCE(pool->getPeakNumUsedBlocks() <= NumThreads * 16);
+
+    // Exhaustion under contention
+    std::unique_ptr<uavcan_linux::LockFreePoolAllocator<BlockSize * 20>> small_pool(
+        new uavcan_linux::LockFreePoolAllocator<BlockSize * 20>);
+    (void)runThreads(*small_pool, NumThreads, NumIterations, true);
+    ENFORCE(0 == small_pool->getNumUsedBlocks());
+    ENFORCE(20 >= small_pool->getPeakNumUsedBlocks());
+    ENFORCE(20 == small_pool->countFreeListBlocks());
+
+    ENFORCE(nullptr == pool->allocate(BlockSize + 1));
+    std::cout << "Stress test passed" << std::endl;
+}
+
+static void benchmark()
+{
+    static constexpr unsigned NumIterations = 1000000;
+
+    std::unique_ptr<MutexPoolAllocator> mutex_pool(new MutexPoolAllocator);
+    std::unique_ptr<uavcan_linux::LockFreePoolAllocator<PoolSize>> lock_free_pool(
+        new uavcan_linux::LockFreePoolAllocator<PoolSize>);
+
+    for (unsigned num_threads = 1; num_threads <= 8; num_threads *= 2)
+    {
+        const double mutex_mops = runThreads(*mutex_pool, num_threads, NumIterations, false);
+        const double lock_free_mops = runThreads(*lock_free_pool, num_threads, NumIterations, false);
+        std::cout << num_threads << " threads, million calls per second: mutex " << mutex_mops
+                  << ", lock-free " << lock_free_mops << std::endl;
+    }
+}
+
+int main()
+{
+    try
+    {
+        testStress();
+        benchmark();
+        return 0;
+    }
+    catch (const std::exception& ex)
+    {
+        std::cerr << "Exception: " << ex.what() << std::endl;
+        return 1;
+    }
+}
@@ -0,0 +1,151 @@
+/*
+ * Copyright (C) 2014 Pavel Kirienko <pavel.kirienko@gmail.com>
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include <uavcan/dynamic_memory.hpp>
+
+namespace uavcan_linux
+{
+/**
+ * Thread safe lock-free pool allocator.
+ * Can be used instead of uavcan::PoolAllocator<> when several threads, each running its own libuavcan objects,
+ * share the same memory pool. Note that the rest of libuavcan is still not thread safe.
+ *
+ * The free list is a Treiber stack of block indexes. The head is a 64-bit word that holds the index of the top block
+ * and a modification counter, which protects the stack against the ABA problem. Links are kept outside of the blocks,
+ * so the application can't corrupt the free list by writing into a block after it was released.
+ *
+ * @tparam PoolSize     Size of the pool in bytes.
+ * @tparam BlockSize    Size of one block in bytes; the default is the block size used by libuavcan.
+ */
+template <std::size_t PoolSize, std::size_t BlockSize = uavcan::MemPoolBlockSize>
+class LockFreePoolAllocator : public uavcan::IPoolAllocator, uavcan::Noncopyable
+{
+public:
+    static constexpr unsigned NumBlocks = unsigned(PoolSize / BlockSize);
+
+private:
+    static constexpr std::uint32_t NilIndex = 0xFFFFFFFFU;
+    static constexpr std::uint64_t CounterIncrement = std::uint64_t(1) << 32;
+
+    static_assert(NumBlocks > 0, "Pool is too small");
+    static_assert(NumBlocks < NilIndex, "Pool is too large");
+
+    alignas(std::max_align_t) std::uint8_t pool_[NumBlocks * BlockSize];
+    std::atomic<std::uint32_t> next_[NumBlocks];
+    std::atomic<std::uint64_t> head_;
+    std::atomic<unsigned> used_blocks_;
+    std::atomic<unsigned> peak_used_blocks_;
+
+    static std::uint64_t makeHead(std::uint64_t prev_head, std::uint32_t index)
+    {
+        return ((prev_head & ~std::uint64_t(NilIndex)) + CounterIncrement) | index;
+    }
+
+public:
+    LockFreePoolAllocator()
+        : head_(0)
+        , used_blocks_(0)
+        , peak_used_blocks_(0)
+    {
+        for (unsigned i = 0; i < NumBlocks; i++)
+        {
+            next_[i].store(((i + 1) < NumBlocks) ? (i + 1) : NilIndex, std::memory_order_relaxed);
+        }
+    }
+
+    virtual void* allocate(std::size_t size)
+    {
+        if (size > BlockSize)
+        {
+            return nullptr;
+        }
+        std::uint64_t head = head_.load(std::memory_order_acquire);
+        std::uint32_t index = 0;
+        do
+        {
+            index = std::uint32_t(head);
+            if (index == NilIndex)
+            {
+                return nullptr;
+            }
+        }
+        while (!head_.compare_exchange_weak(head, makeHead(head, next_[index].load(std::memory_order_relaxed)),
+                                            std::memory_order_acquire, std::memory_order_acquire));
+
+        const unsigned used = used_blocks_.fetch_add(1, std::memory_order_relaxed) + 1;
+        unsigned peak = peak_used_blocks_.load(std::memory_order_relaxed);
+        while ((used > peak) &&
+               !peak_used_blocks_.compare_exchange_weak(peak, used, std::memory_order_relaxed))
+        { }
+
+        return pool_ + std::size_t(index) * BlockSize;
+    }
+
+    virtual void deallocate(const void* ptr)
+    {
+        if (ptr == nullptr)
+        {
+            return;
+        }
+        UAVCAN_ASSERT(isInPool(ptr));
+        const auto index = std::uint32_t(std::size_t(static_cast<const std::uint8_t*>(ptr) - pool_) / BlockSize);
+
+        // The counter is decremented before the block becomes available, so it never exceeds the real usage
+        UAVCAN_ASSERT(used_blocks_.load(std::memory_order_relaxed) > 0);
+        used_blocks_.fetch_sub(1, std::memory_order_relaxed);
+
+        std::uint64_t head = head_.load(std::memory_order_relaxed);
+        do
+        {
+            next_[index].store(std::uint32_t(head), std::memory_order_relaxed);
+        }
+        while (!head_.compare_exchange_weak(head, makeHead(head, index),
+                                            std::memory_order_release, std::memory_order_relaxed));
+    }
+
+    virtual bool isInPool(const void* ptr) const
+    {
+        return (ptr >= pool_) && (ptr < (pool_ + sizeof(pool_)));
+    }
+
+    virtual std::size_t getBlockSize() const { return BlockSize; }
+    virtual std::size_t getNumBlocks() const { return NumBlocks; }
+
+    virtual bool getAddressRange(const void*& out_begin, const void*& out_end) const
+    {
+        out_begin = pool_;
+        out_end = pool_ + sizeof(pool_);
+        return true;
+    }
+
+    /**
+     * Usage counters. They are updated separately from the free list, so while other threads are allocating or
+     * releasing blocks they may be slightly lower than the real usage, but never higher.
+     */
+    unsigned getNumUsedBlocks() const { return used_blocks_.load(std::memory_order_relaxed); }
+    unsigned getNumFreeBlocks() const { return NumBlocks - getNumUsedBlocks(); }
+    unsigned getPeakNumUsedBlocks() const { return peak_used_blocks_.load(std::memory_order_relaxed); }
+
+    /**
+     * Walks the free list. Only meaningful when no other thread is using the allocator.
+     */
+    unsigned countFreeListBlocks() const
+    {
+        unsigned num = 0;
+        for (std::uint32_t i = std::uint32_t(head_.load()); (i != NilIndex) && (num <= NumBlocks);
+             i = next_[i].load())
+        {
+            num++;
+        }
+        return num;
+    }
+};
+
+}
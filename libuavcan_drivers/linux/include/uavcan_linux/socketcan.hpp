@@ -358,6 +358,29 @@ public:
         return 1;
     }
 
+    /**
+     * Drains the RX queue in one call; the socket is read only if the RX queue is empty, same as receive().
+     */
+    virtual std::int16_t receiveBurst(uavcan::CanRxFrame* out_frames, std::uint16_t max_frames)
+    {
+        if (rx_queue_.empty())
+        {
+            pollRead();
+        }
+        std::uint16_t num_frames = 0;
+        while ((num_frames < max_frames) && !rx_queue_.empty())
+        {
+            const RxItem& rx = rx_queue_.front();
+            uavcan::CanRxFrame& out = out_frames[num_frames++];
+            static_cast<uavcan::CanFrame&>(out) = rx.frame;
+            out.ts_mono = rx.ts_mono;
+            out.ts_utc  = rx.ts_utc;
+            out.flags   = rx.flags;
+            rx_queue_.pop();
+        }
+        return std::int16_t(num_frames);
+    }
+
     /**
      * Performs socket read/write.
      * @param read  Socket is readable
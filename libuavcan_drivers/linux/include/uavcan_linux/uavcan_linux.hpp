@@ -9,3 +9,4 @@
 #include <uavcan_linux/clock.hpp>
 #include <uavcan_linux/socketcan.hpp>
 #include <uavcan_linux/helpers.hpp>
+#include <uavcan_linux/pool_allocator.hpp>